@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AngleUtilities.h
+ * @brief Inline angle conversion and normalization functions in the
+ *   ANGLE_UTIL namespace.
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_ANGLEUTILITIES_H_
+#define INC_ANGLEUTILITIES_H_
+
+#include <cmath>
+#include "SpaConstants.h"
+
+namespace SPA
+{
+namespace ANGLE_UTIL
+{
+
+/**
+ * @brief Converts an angle in degrees to radians.
+ * @ingroup group_util
+ *
+ * @param[in] aDegrees Input angle in degrees.
+ * @return The angle in radians.
+ */
+inline double degreesToRadians(double aDegrees)
+{
+    return aDegrees * SPA_DEGREES_TO_RADIANS;
+}
+
+/**
+ * @brief Converts an angle in radians to degrees.
+ * @ingroup group_util
+ *
+ * @param[in] aRadians Input angle in radians.
+ * @return The angle in degrees.
+ */
+inline double radiansToDegrees(double aRadians)
+{
+    return aRadians * SPA_RADIANS_TO_DEGREES;
+}
+
+/**
+ * @brief Reduces an angle in degrees to the range [0, 360).
+ * @ingroup group_util
+ *
+ * PAWYC repeatedly asks the reader to "add or subtract multiples
+ * of 360 degrees" to bring an angle into range. Using floor rather than
+ * std::fmod keeps the result non-negative for negative inputs and
+ * allows the compiler to vectorize loops that call this function.
+ *
+ * @param[in] aDegrees Input angle in degrees, any magnitude.
+ * @return The equivalent angle in the range [0, 360).
+ */
+inline double normalizeDegrees(double aDegrees)
+{
+    return aDegrees - SPA_DEGREES_IN_CIRCLE * std::floor(aDegrees / SPA_DEGREES_IN_CIRCLE);
+}
+
+/**
+ * @brief Reduces an angle in radians to the range [0, 2 pi).
+ * @ingroup group_util
+ *
+ * @param[in] aRadians Input angle in radians, any magnitude.
+ * @return The equivalent angle in the range [0, 2 pi).
+ */
+inline double normalizeRadians(double aRadians)
+{
+    return aRadians - SPA_TWO_PI * std::floor(aRadians / SPA_TWO_PI);
+}
+
+} // end namespace ANGLE_UTIL
+} // end namespace SPA
+
+#endif /* INC_ANGLEUTILITIES_H_ */
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AstronomicalCalendar.h
+ * @brief Declaration of the AstronomicalCalendar class
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_ASTRONOMICALCALENDAR_H_
+#define INC_ASTRONOMICALCALENDAR_H_
+
+#include "JulianDate.h"
+#include "SpaPlanetConstants.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <queue>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief Kinds of event in an AstronomicalCalendar.
+ * @ingroup group_time
+ */
+enum class CalendarEventType
+{
+    Easter,
+    Season,
+    LunarPhase,
+    Eclipse,
+    Conjunction,
+    Opposition
+};
+
+/**
+ * @brief A single dated entry in an AstronomicalCalendar.
+ * @ingroup group_time
+ */
+struct CalendarEvent
+{
+    /// Time of the event, decimal Julian Days
+    double julianDays;
+
+    /// Kind of event
+    CalendarEventType type;
+
+    /**
+     * Further detail, interpreted according to type: the SeasonType of
+     * a season, the LunarPhaseType of a lunar phase, the EclipseType
+     * of an eclipse, the Planets value of a conjunction or opposition,
+     * and zero for Easter.
+     */
+    int detail;
+};
+
+/**
+ * @brief A time-ordered stream of CalendarEvent, produced on demand.
+ * @ingroup group_time
+ *
+ * Implementations must return events in non-decreasing time order.
+ */
+class CalendarEventSource
+{
+    public:
+        /// Default destructor
+        virtual ~CalendarEventSource() = default;
+
+        /**
+         * Produces the next event.
+         * @param[out] anEvent The next event, if there is one.
+         * @return False once the stream is exhausted.
+         */
+        virtual bool next(CalendarEvent& anEvent) = 0;
+};
+
+/**
+ * @brief Merges the dated events of PAWYC into a single calendar for a
+ *   range of dates.
+ * @ingroup group_time
+ *
+ * Implements the spirit of Section 75 of PAWYC. Each kind of event is
+ * produced lazily by its own source (Easter from
+ * TIME_UTIL::calculateEaster(), the equinoxes and solstices from
+ * SUN_UTIL::calculateSeason(), the phases of the Moon from
+ * LunarPhaseGenerator, eclipses from EclipseGenerator, and planetary
+ * conjunctions and oppositions from PlanetEventGenerator), and the
+ * calendar merges them with a k-way merge: a min-heap holds the next
+ * event of each source, and taking an event refills the heap from the
+ * source it came from. Memory is therefore proportional to the number
+ * of sources rather than to the length of the range. Events at the
+ * same time come out in the order their sources were added.
+ *
+ * All sources should be added before the first call to next().
+ *
+ * @code
+ * SPA::AstronomicalCalendar calendar(start, end);
+ * calendar.addSeasons();
+ * calendar.addLunarPhases();
+ * SPA::CalendarEvent event;
+ * while (calendar.next(event))
+ * {
+ *     ...
+ * }
+ * @endcode
+ */
+class AstronomicalCalendar
+{
+    public:
+        /**
+         * Constructor. The calendar starts with no sources.
+         * @param[in] aStart Start of the range.
+         * @param[in] anEnd End of the range.
+         */
+        AstronomicalCalendar(const JulianDate& aStart,
+                             const JulianDate& anEnd);
+
+        /// Default destructor
+        virtual ~AstronomicalCalendar() = default;
+
+        /**
+         * Adds Easter Sunday (at 0h UT) for each Gregorian year in the
+         * range, from 1583 onwards.
+         */
+        void addEaster();
+
+        /// Adds the equinoxes and solstices.
+        void addSeasons();
+
+        /// Adds the principal phases of the Moon.
+        void addLunarPhases();
+
+        /// Adds lunar and solar eclipses, at greatest eclipse.
+        void addEclipses();
+
+        /**
+         * Adds the conjunctions and oppositions of a planet with the Sun.
+         * @param[in] aPlanet The planet.
+         */
+        void addPlanetEvents(Planets aPlanet);
+
+        /**
+         * Adds a user-supplied source. Its events are merged as they
+         * are; they are not restricted to the range of the calendar.
+         * @param[in] aSource The source. Ignored if null.
+         */
+        void addSource(std::unique_ptr<CalendarEventSource> aSource);
+
+        /**
+         * Produces the next event of the calendar.
+         * @param[out] anEvent The next event, if there is one.
+         * @return False, leaving anEvent unchanged, once every source is
+         *   exhausted.
+         */
+        bool next(CalendarEvent& anEvent);
+
+    private:
+        /// The next event of one source, as held in the heap
+        struct Head
+        {
+            /// The event
+            CalendarEvent event;
+
+            /// Index of its source in theSources
+            std::size_t source;
+        };
+
+        /// Heap ordering: true if aLeft comes after aRight
+        struct Later
+        {
+            bool operator()(const Head& aLeft, const Head& aRight) const;
+        };
+
+        /**
+         * Pulls the next event of a source into the heap, if it has one.
+         * @param[in] aSource Index of the source in theSources.
+         */
+        void refill(std::size_t aSource);
+
+        /// Start of the range
+        JulianDate theStart;
+
+        /// End of the range
+        JulianDate theEnd;
+
+        /// The sources, in the order they were added
+        std::vector<std::unique_ptr<CalendarEventSource>> theSources;
+
+        /// The next event of each source that is not yet exhausted
+        std::priority_queue<Head, std::vector<Head>, Later> theHeads;
+};
+
+} // end namespace SPA
+
+/**
+ * Ostream operator for CalendarEventType enumeration.
+ * @ingroup group_time
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aType A calendar event type.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::CalendarEventType& aType);
+
+#endif /* INC_ASTRONOMICALCALENDAR_H_ */
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file BinaryStarOrbit.h
+ * @brief Declaration of the BinaryStarOrbit class
+ * @ingroup group_orbits
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_BINARYSTARORBIT_H_
+#define INC_BINARYSTARORBIT_H_
+
+#include <cstddef>
+
+namespace SPA
+{
+
+/**
+ * @brief The seven Campbell elements of the apparent orbit of a visual
+ *   binary star, as used in PAWYC Section 63.
+ * @ingroup group_orbits
+ *
+ * Epochs in years are Julian epochs, i.e. 2000.0 is JD 2451545.0 and a
+ * year is SPA_DAYS_IN_JULIAN_YEAR days.
+ */
+struct BinaryStarElements
+{
+    /// Period, P, years
+    double period;
+
+    /// Epoch of periastron, T, decimal years
+    double periastronEpoch;
+
+    /// Eccentricity, e
+    double eccentricity;
+
+    /// Angular semi-major axis, a, arcseconds
+    double semiMajorAxis;
+
+    /// Inclination, i, degrees
+    double inclination;
+
+    /// Argument of periastron, omega, degrees
+    double argumentOfPeriastron;
+
+    /// Position angle of the ascending node, Omega, degrees
+    double positionAngleOfNode;
+};
+
+/**
+ * @brief The position of the companion of a visual binary relative to
+ *   the primary.
+ * @ingroup group_orbits
+ */
+struct BinaryStarPosition
+{
+    /// Position angle, theta, degrees east of north in the range [0, 360)
+    double positionAngle;
+
+    /// Angular separation, rho, arcseconds
+    double separation;
+};
+
+/**
+ * @brief The apparent orbit of a visual binary star with its
+ *   Thiele-Innes constants precomputed.
+ * @ingroup group_orbits
+ *
+ * The Thiele-Innes constants A, B, F and G fold the semi-major axis and
+ * the three orientation angles together, so that the offsets of the
+ * companion to the north and east are
+ * \f[
+ * x = A X + F Y, \qquad y = B X + G Y
+ * \f]
+ * with X = cos E - e and Y = sqrt(1 - e^2) sin E. After Kepler's
+ * equation has been solved no further trigonometry is needed beyond
+ * the final position angle, and the result is equivalent to steps 4
+ * to 9 of PAWYC Section 63.
+ */
+class BinaryStarOrbit
+{
+    public:
+        /// Default constructor, a circular face-on orbit of 1 arcsecond and 1 year.
+        BinaryStarOrbit();
+
+        /**
+         * Constructs the orbit from its Campbell elements.
+         * @param[in] anElements The elements; 0 <= e < 1 and P > 0.
+         */
+        explicit BinaryStarOrbit(const BinaryStarElements& anElements);
+
+        /// Default destructor
+        virtual ~BinaryStarOrbit() = default;
+
+        /**
+         * Calculates the position of the companion at a given time.
+         * @param[in] aJulianDays Time in decimal Julian Days.
+         * @return The position angle and separation.
+         */
+        BinaryStarPosition calculatePosition(double aJulianDays) const;
+
+        /**
+         * Calculates the position of the companion at each of an array
+         * of times.
+         *
+         * Gives the same results as calculatePosition(), but uses the
+         * batch Kepler solver.
+         *
+         * @param[in] aJulianDays Pointer to aCount times in decimal Julian Days.
+         * @param[in] aCount Number of times.
+         * @param[out] aPositionAngles Pointer to aCount doubles, degrees.
+         * @param[out] aSeparations Pointer to aCount doubles, arcseconds.
+         */
+        void calculatePositions(const double* aJulianDays,
+                                std::size_t aCount,
+                                double* aPositionAngles,
+                                double* aSeparations) const;
+
+        /// @return The Campbell elements this orbit was built from.
+        const BinaryStarElements& getElements() const
+        {
+            return theElements;
+        }
+
+        /**
+         * Returns the Thiele-Innes constants.
+         * @param[out] anA Constant A, arcseconds.
+         * @param[out] aB Constant B, arcseconds.
+         * @param[out] anF Constant F, arcseconds.
+         * @param[out] aG Constant G, arcseconds.
+         */
+        void getThieleInnesConstants(double& anA, double& aB, double& anF, double& aG) const;
+
+    private:
+        /// The Campbell elements
+        BinaryStarElements theElements;
+
+        /// Time of periastron, decimal Julian Days
+        double thePeriastronJulianDays;
+
+        /// Mean motion, radians per day
+        double theDailyMotion;
+
+        /// Eccentricity
+        double theEccentricity;
+
+        /// sqrt(1 - e^2)
+        double theEccentricityFactor;
+
+        /// Thiele-Innes constants, arcseconds
+        double theA;
+        double theB;
+        double theF;
+        double theG;
+};
+
+} // end namespace SPA
+
+#endif /* INC_BINARYSTARORBIT_H_ */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file BinaryStarUtilities.h
+ * @brief Declaration of binary-star functions in the BINARYSTAR_UTIL
+ *   namespace
+ * @ingroup group_orbits
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_BINARYSTARUTILITIES_H_
+#define INC_BINARYSTARUTILITIES_H_
+
+#include "BinaryStarOrbit.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief Binary star positions stored as a structure of arrays.
+ * @ingroup group_orbits
+ *
+ * Element i of every array refers to the same binary and epoch. For
+ * BINARYSTAR_UTIL::calculateBinaryStarPositions() i is the epoch
+ * index; for BINARYSTAR_UTIL::calculateBinaryStarPositionGrid() it is
+ * binaryIndex * numEpochs + epochIndex.
+ */
+struct BinaryStarPositionArrays
+{
+    /// Position angle, degrees east of north in the range [0, 360)
+    std::vector<double> positionAngle;
+
+    /// Angular separation, arcseconds
+    std::vector<double> separation;
+
+    /**
+     * Resizes every array.
+     * @param[in] aSize Number of entries.
+     */
+    void resize(std::size_t aSize);
+
+    /**
+     * Returns the number of entries held.
+     * @return The number of entries held.
+     */
+    std::size_t size() const
+    {
+        return separation.size();
+    }
+
+    /**
+     * Returns the values for one entry as a BinaryStarPosition.
+     * @param[in] anIndex Index of the entry, less than size().
+     * @return The position of the companion.
+     */
+    BinaryStarPosition at(std::size_t anIndex) const;
+};
+
+namespace BINARYSTAR_UTIL
+{
+
+/**
+ * @brief Calculates the position angle and separation of a visual
+ *   binary at a given epoch.
+ * @ingroup group_orbits
+ *
+ * Implements Section 63 of PAWYC via BinaryStarOrbit. When the same
+ * binary is needed at more than a few epochs, build the
+ * BinaryStarOrbit once and use calculateBinaryStarPositions() so that
+ * the Thiele-Innes constants are not recomputed.
+ *
+ * @param[in] anElements Campbell elements of the binary.
+ * @param[in] aJulianDate Epoch.
+ * @return The position of the companion.
+ */
+BinaryStarPosition calculateBinaryStarPosition(const BinaryStarElements& anElements,
+                                               const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position of one binary at each of an array of
+ *   epochs.
+ * @ingroup group_orbits
+ *
+ * @param[in] anOrbit The binary.
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to aCount.
+ */
+void calculateBinaryStarPositions(const BinaryStarOrbit& anOrbit,
+                                  const double* aJulianDays,
+                                  std::size_t aCount,
+                                  BinaryStarPositionArrays& aPositions);
+
+/**
+ * @brief Calculates the positions of many binaries at each of an array
+ *   of epochs, e.g. for an observing-planning table.
+ * @ingroup group_orbits
+ *
+ * Results are identical to calling calculateBinaryStarPositions() for
+ * each binary.
+ *
+ * @param[in] anOrbits The binaries.
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to
+ *   anOrbits.size() * aCount and indexed binary-major.
+ */
+void calculateBinaryStarPositionGrid(const std::vector<BinaryStarOrbit>& anOrbits,
+                                     const double* aJulianDays,
+                                     std::size_t aCount,
+                                     BinaryStarPositionArrays& aPositions);
+
+} // end namespace BINARYSTAR_UTIL
+} // end namespace SPA
+
+#endif /* INC_BINARYSTARUTILITIES_H_ */
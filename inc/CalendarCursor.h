@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CalendarCursor.h
+ * @brief Declaration of the CalendarCursor class.
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CALENDARCURSOR_H_
+#define INC_CALENDARCURSOR_H_
+
+#include "SpaTimeConstants.h"
+
+#include <iosfwd>
+
+namespace SPA
+{
+
+// Forward declarations
+class SpaDate;
+
+/**
+ * @brief Step taken by each CalendarCursor::next().
+ * @ingroup group_time
+ */
+enum class CalendarStep
+{
+    Day,   ///< One day
+    Week,  ///< Seven days
+    Month  ///< One month, see CalendarCursor::nextMonth()
+};
+
+/**
+ * @brief Walks the dates from one SpaDate to another, keeping the day
+ *   of the year and the day of the week up to date as it goes.
+ * @ingroup group_time
+ *
+ * Only the starting date is converted, with calculateDayInTheWeek()
+ * and calculateDayNumber(). Each step after that adds to the day,
+ * carrying into the month and year from the month lengths of
+ * SPA_DAYSTART_LEAPYEAR and TIME_UTIL::isLeapYear(), and moves the day
+ * of the year and week on by the number of days stepped. A daily step
+ * within a month is inline and a handful of integer operations.
+ *
+ * @code
+ * for (CalendarCursor cursor(first, last); !cursor.isDone(); cursor.next())
+ * {
+ *     row(cursor.getYear(), cursor.getMonth(), cursor.getDay(),
+ *         cursor.getDayOfYear(), cursor.getWeekDay());
+ * }
+ * @endcode
+ *
+ * @note The cursor uses the Gregorian calendar throughout, so dates
+ *   before 1582-10-15 are proleptic Gregorian dates, unlike those of
+ *   JulianDate and SerialDate.
+ */
+class CalendarCursor
+{
+    public:
+        /**
+         * Construct a cursor at aFirst that is done once it passes
+         * aLast.
+         *
+         * @param[in] aFirst First date, a valid Gregorian date.
+         * @param[in] aLast Last date, inclusive. When it is before aFirst
+         *   the cursor starts out done.
+         * @param[in] aStep Step taken by next().
+         */
+        CalendarCursor(const SpaDate& aFirst,
+                       const SpaDate& aLast,
+                       CalendarStep aStep = CalendarStep::Day);
+
+        /**
+         * Returns true once the cursor has passed the last date.
+         * @return True when done.
+         */
+        bool isDone() const
+        {
+            if (theYear != theLastYear)
+            {
+                return theYear > theLastYear;
+            }
+            if (theMonth != theLastMonth)
+            {
+                return theMonth > theLastMonth;
+            }
+            return theDay > theLastDay;
+        }
+
+        /// Takes the step given on construction.
+        void next()
+        {
+            switch (theStep)
+            {
+                case CalendarStep::Week:
+                    nextWeek();
+                    break;
+                case CalendarStep::Month:
+                    nextMonth();
+                    break;
+                default:
+                    nextDay();
+                    break;
+            }
+        }
+
+        /// Moves on one day.
+        void nextDay()
+        {
+            if (theDay < theDaysInMonth)
+            {
+                theDay++;
+                theDayOfYear++;
+                theWeekDay = (theWeekDay + 1 == SPA_DAYS_PER_WEEK) ? 0 : theWeekDay + 1;
+                theMonthDay = theDay;
+            }
+            else
+            {
+                advanceDays(1);
+            }
+        }
+
+        /// Moves on seven days.
+        void nextWeek()
+        {
+            advanceDays(SPA_DAYS_PER_WEEK);
+        }
+
+        /**
+         * Moves on one month. The day of the month is kept, or is the
+         * last day of a shorter month, and comes back after it: from
+         * January 31st the cursor goes to February 28th or 29th and
+         * then March 31st.
+         */
+        void nextMonth();
+
+        /**
+         * Moves on a number of days.
+         * @param[in] aDays Number of days, zero or more.
+         */
+        void advanceDays(int aDays);
+
+        /**
+         * Returns the year
+         * @return Returns the year
+         */
+        int getYear() const
+        {
+            return theYear;
+        }
+
+        /**
+         * Returns the month within the year
+         * @return Returns the month within the year, 1 to 12
+         */
+        int getMonth() const
+        {
+            return theMonth;
+        }
+
+        /**
+         * Returns the day of the month
+         * @return Returns the day of the month
+         */
+        int getDay() const
+        {
+            return theDay;
+        }
+
+        /**
+         * Returns the day of the year, as calculateDayNumber()
+         * @return Returns the day of the year, January 1st being 1
+         */
+        int getDayOfYear() const
+        {
+            return theDayOfYear;
+        }
+
+        /**
+         * Returns the day of the week, as calculateDayInTheWeek()
+         * @return Returns the day of the week
+         */
+        WeekDays getWeekDay() const
+        {
+            return static_cast<WeekDays>(theWeekDay);
+        }
+
+        /**
+         * Returns the number of days in the current month
+         * @return Returns 28 to 31
+         */
+        int getDaysInMonth() const
+        {
+            return theDaysInMonth;
+        }
+
+        /**
+         * Returns true if the current year is a leap year
+         * @return Returns true in a leap year
+         */
+        bool isLeapYear() const
+        {
+            return theLeapYear;
+        }
+
+        /**
+         * Returns the current date
+         * @return Returns the current date
+         */
+        SpaDate getSpaDate() const;
+
+    private:
+        /// Moves to the first day of the next month.
+        void startNextMonth();
+
+        /// The year
+        int theYear;
+
+        /// The month
+        int theMonth;
+
+        /// Day within the month
+        int theDay;
+
+        /// Day within the year, from 1
+        int theDayOfYear;
+
+        /// Day of the week, a WeekDays value
+        int theWeekDay;
+
+        /// Number of days in the current month
+        int theDaysInMonth;
+
+        /// Day of the month nextMonth() aims for
+        int theMonthDay;
+
+        /// True if the current year is a leap year
+        bool theLeapYear;
+
+        /// Step taken by next()
+        CalendarStep theStep;
+
+        /// The last year
+        int theLastYear;
+
+        /// The last month
+        int theLastMonth;
+
+        /// The last day
+        int theLastDay;
+};
+
+} // end namespace SPA
+
+/**
+ * Ostream operator for CalendarStep enumeration.
+ * @ingroup group_time
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aStep A calendar step.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::CalendarStep& aStep);
+
+#endif /* INC_CALENDARCURSOR_H_ */
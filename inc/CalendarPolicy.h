@@ -0,0 +1,269 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CalendarPolicy.h
+ * @brief Calendar policies and the date conversions specialized on them.
+ * @ingroup group_time
+ *
+ * JulianDate reads dates up to 1582-10-15 0h as Julian calendar dates
+ * and later ones as Gregorian dates, which costs a comparison against
+ * the switchover on every conversion. The conversions here take the
+ * calendar as a template parameter instead. For ProlepticGregorianCalendar
+ * and ProlepticJulianCalendar the test is a compile-time constant, so
+ * the unused branch is removed; HistoricalCalendar, the default,
+ * reproduces JulianDate exactly.
+ *
+ * A calendar policy is a type with two static functions:
+ *  - bool isGregorianDate(int aYear, int aMonth, int aDay,
+ *    double aDayFraction), true if a calendar date, with its UTC
+ *    corrected day fraction, is a Gregorian calendar date;
+ *  - bool isGregorianDayNumber(double aDayNumber), true if the day
+ *    that starts at Julian Date aDayNumber - 0.5 has a Gregorian
+ *    calendar date.
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CALENDARPOLICY_H_
+#define INC_CALENDARPOLICY_H_
+
+#include "DateAndTime.h"
+#include "JulianDate.h"
+#include "SpaTimeConstants.h"
+#include "TimeUtilities.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+/**
+ * @brief The Julian calendar up to 1582-10-15 0h and the Gregorian
+ *   calendar after it, as used by JulianDate.
+ * @ingroup group_time
+ */
+struct HistoricalCalendar
+{
+    /// True after 1582-10-15 0h
+    static bool isGregorianDate(int aYear,
+                                int aMonth,
+                                int aDay,
+                                double aDayFraction)
+    {
+        return (aYear > 1582) ||
+               (aYear == 1582 && (aMonth > OCT ||
+                                  (aMonth == OCT && (aDay > 15 ||
+                                                     (aDay == 15 && aDayFraction > 0)))));
+    }
+
+    /// True from SPA_LAST_DAY_OF_JULIAN_CALENDAR on
+    static bool isGregorianDayNumber(double aDayNumber)
+    {
+        return aDayNumber >= SPA_LAST_DAY_OF_JULIAN_CALENDAR;
+    }
+};
+
+/**
+ * @brief The Gregorian calendar, extended back before its introduction.
+ * @ingroup group_time
+ */
+struct ProlepticGregorianCalendar
+{
+    /// Always true
+    static constexpr bool isGregorianDate(int, int, int, double)
+    {
+        return true;
+    }
+
+    /// Always true
+    static constexpr bool isGregorianDayNumber(double)
+    {
+        return true;
+    }
+};
+
+/**
+ * @brief The Julian calendar, extended forward past the introduction
+ *   of the Gregorian calendar.
+ * @ingroup group_time
+ */
+struct ProlepticJulianCalendar
+{
+    /// Always false
+    static constexpr bool isGregorianDate(int, int, int, double)
+    {
+        return false;
+    }
+
+    /// Always false
+    static constexpr bool isGregorianDayNumber(double)
+    {
+        return false;
+    }
+};
+
+namespace CALENDAR_UTIL
+{
+
+/**
+ * @brief Converts a calendar date and day fraction into a Julian Date.
+ * @ingroup group_time
+ *
+ * Implements Section 4 of PAWYC, as
+ * JulianDate::convertDateAndTimeToJulianDate(), with the calendar
+ * chosen by the policy.
+ *
+ * @param[in] aYear Year.
+ * @param[in] aMonth Month, 1 to 12.
+ * @param[in] aDay Day of the month.
+ * @param[in] aDayFraction Fraction of the day, UTC corrected, as
+ *   DateAndTime::getDayFraction().
+ * @return Julian Date in decimal days.
+ */
+template <typename Calendar = HistoricalCalendar>
+inline double calculateJulianDays(int aYear,
+                                  int aMonth,
+                                  int aDay,
+                                  double aDayFraction)
+{
+    bool isGregorian = Calendar::isGregorianDate(aYear, aMonth, aDay, aDayFraction);
+    // Selects rather than branches, so that loops over this vectorize
+    bool isBeforeMarch = aMonth < MAR;
+    int year = isBeforeMarch ? aYear - 1 : aYear;
+    int month = isBeforeMarch ? aMonth + 12 : aMonth;
+
+    // Floor, not truncation, so that proleptic dates before year 0 work
+    int aConst = int(std::floor(year / 100.0));
+    int bConst = isGregorian ? 2 - aConst + int(std::floor(aConst / 4.0)) : 0;
+
+    double cTmp = SPA_DAYS_IN_JULIAN_YEAR * year;
+    int cConst = int((year < 0) ? cTmp - 0.75 : cTmp);
+    int dConst = int(SPA_AVG_DAYS_PER_MONTH * (month + 1));
+
+    const double BASE_JD = 1720994.5;
+    return double(bConst + cConst + dConst + aDay) + aDayFraction + BASE_JD;
+}
+
+/**
+ * @brief Converts a Julian Date into a calendar date with a decimal day.
+ * @ingroup group_time
+ *
+ * Implements Section 5 of PAWYC, as JulianDate::getDateAndTime(), with
+ * the calendar chosen by the policy. Valid for Julian Dates from zero.
+ *
+ * @note Uses SPA_DECODE_DAYS_PER_MONTH (30.6001), as PAWYC does, so that
+ *   the last day of every month decodes as itself.
+ *
+ * @param[in] aJulianDays Julian Date in decimal days.
+ * @param[out] aYear Year.
+ * @param[out] aMonth Month, 1 to 12.
+ * @param[out] aDecimalDay Day of the month, with the fraction of the day.
+ */
+template <typename Calendar = HistoricalCalendar>
+inline void calculateCalendarDate(double aJulianDays,
+                                  int& aYear,
+                                  int& aMonth,
+                                  double& aDecimalDay)
+{
+    double valueI;
+    double valueF;
+    TIME_UTIL::integerAndFraction(aJulianDays + 0.5, valueI, valueF);
+
+    double intPart;
+    double fracPart;
+    double valueB = valueI;
+    if (Calendar::isGregorianDayNumber(valueI))
+    {
+        double valueA;
+        TIME_UTIL::integerAndFraction((valueI - SPA_JULIAN_CONVERSION_CONVERSION_CONST)
+                                          / SPA_DAYS_IN_GREGORIAN_CENTURY,
+                                      valueA,
+                                      fracPart);
+        TIME_UTIL::integerAndFraction(0.25 * valueA, intPart, fracPart);
+        valueB = valueI + 1 + valueA - intPart;
+    }
+
+    double valueC = valueB + 1524;
+    double valueD;
+    TIME_UTIL::integerAndFraction((valueC - 122.1) / SPA_DAYS_IN_JULIAN_YEAR, valueD, fracPart);
+    double valueE;
+    TIME_UTIL::integerAndFraction(SPA_DAYS_IN_JULIAN_YEAR * valueD, valueE, fracPart);
+    double valueG;
+    TIME_UTIL::integerAndFraction((valueC - valueE) / SPA_DECODE_DAYS_PER_MONTH, valueG, fracPart);
+
+    TIME_UTIL::integerAndFraction(SPA_DECODE_DAYS_PER_MONTH * valueG, intPart, fracPart);
+    aDecimalDay = valueC - valueE + valueF - intPart;
+    aMonth = (valueG < 13.5) ? int(valueG) - 1 : int(valueG) - 13;
+    aYear = (aMonth > 2.5) ? int(valueD) - 4716 : int(valueD) - 4715;
+}
+
+/**
+ * @brief Converts a DateAndTime into a JulianDate.
+ * @ingroup group_time
+ *
+ * With the default HistoricalCalendar the result is the same as
+ * JulianDate(aDateAndTime).
+ *
+ * @param[in] aDateAndTime Date and time.
+ * @return Julian Date.
+ */
+template <typename Calendar = HistoricalCalendar>
+inline JulianDate convertToJulianDate(const DateAndTime& aDateAndTime)
+{
+    return JulianDate(calculateJulianDays<Calendar>(aDateAndTime.getYear(),
+                                                    aDateAndTime.getMonth(),
+                                                    aDateAndTime.getDay(),
+                                                    aDateAndTime.getDayFraction()));
+}
+
+/**
+ * @brief Converts a JulianDate into a DateAndTime with a zero UTC
+ *   offset.
+ * @ingroup group_time
+ *
+ * With the default HistoricalCalendar the result is the same as
+ * JulianDate::getDateAndTime().
+ *
+ * @param[in] aJulianDate Julian Date.
+ * @return Date and time.
+ */
+template <typename Calendar = HistoricalCalendar>
+inline DateAndTime convertToDateAndTime(const JulianDate& aJulianDate)
+{
+    int year;
+    int month;
+    double decimalDay;
+    calculateCalendarDate<Calendar>(aJulianDate.getDecimalDays(), year, month, decimalDay);
+
+    double intPart;
+    double fracPart;
+    TIME_UTIL::integerAndFraction(decimalDay, intPart, fracPart);
+    int hours;
+    int minutes;
+    double seconds;
+    TIME_UTIL::calculateHoursMinutesAndSeconds(fracPart * SPA_HOURS_IN_DAY, hours, minutes, seconds);
+    return DateAndTime(year, month, int(intPart), hours, minutes, seconds, 0);
+}
+
+} // end namespace CALENDAR_UTIL
+} // end namespace SPA
+
+#endif /* INC_CALENDARPOLICY_H_ */
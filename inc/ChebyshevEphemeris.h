@@ -0,0 +1,278 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevEphemeris.h
+ * @brief Declaration of the Chebyshev ephemeris file format and its
+ *   reader ChebyshevEphemeris
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CHEBYSHEVEPHEMERIS_H_
+#define INC_CHEBYSHEVEPHEMERIS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief Body identifier of the Sun in a Chebyshev ephemeris. The
+ *   planets use their Planets enumeration values.
+ * @ingroup group_util
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr int SPA_EPHEMERIS_SUN = 8;
+
+/**
+ * @brief Body identifier of the Moon in a Chebyshev ephemeris.
+ * @ingroup group_util
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr int SPA_EPHEMERIS_MOON = 9;
+
+/**
+ * @brief Number of body identifiers a Chebyshev ephemeris can hold,
+ *   numbered from zero.
+ * @ingroup group_util
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr int SPA_EPHEMERIS_MAX_BODIES = 16;
+
+/**
+ * @brief Format version written by ChebyshevEphemerisBuilder.
+ * @ingroup group_util
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr std::uint32_t SPA_EPHEMERIS_FORMAT_VERSION = 1;
+
+/**
+ * @brief Directory entry describing one body in a Chebyshev ephemeris.
+ * @ingroup group_util
+ *
+ * The coefficients of a body are stored segment by segment, and within
+ * a segment component by component, each component having
+ * numCoefficients doubles.
+ */
+struct EphemerisBodyEntry
+{
+    /// Body identifier, or -1 if this entry is unused
+    std::int32_t body;
+
+    /// Number of quantities tabulated, e.g. 3 for longitude, latitude, distance
+    std::uint32_t numComponents;
+
+    /// Chebyshev coefficients per component per segment
+    std::uint32_t numCoefficients;
+
+    /// Number of segments
+    std::uint32_t numSegments;
+
+    /// Bit i set if component i is an angle in degrees to be reduced to [0, 360)
+    std::uint32_t angleMask;
+
+    /// Padding, always zero
+    std::uint32_t reserved;
+
+    /// Length of each segment, decimal days
+    double segmentDays;
+
+    /// Offset of the first coefficient from the start of the blob, bytes
+    std::uint64_t offset;
+};
+
+/**
+ * @brief Fixed-size header at the start of a Chebyshev ephemeris blob.
+ * @ingroup group_util
+ *
+ * The directory is indexed directly by body identifier, so finding a
+ * body, and then a segment within it, are both O(1). Numbers are stored
+ * in the byte order of the machine that built the file; byteOrder lets
+ * a reader detect a mismatch.
+ */
+struct EphemerisFileHeader
+{
+    /// "SPAEPHEM"
+    char magic[8];
+
+    /// Always 0x01020304 in the writer's byte order
+    std::uint32_t byteOrder;
+
+    /// SPA_EPHEMERIS_FORMAT_VERSION
+    std::uint32_t version;
+
+    /// Start of every body's first segment, decimal Julian Days
+    double startJulianDays;
+
+    /// End of the range covered, decimal Julian Days
+    double endJulianDays;
+
+    /// Size of the whole blob, bytes
+    std::uint64_t totalBytes;
+
+    /// Directory of bodies, indexed by body identifier
+    EphemerisBodyEntry bodies[SPA_EPHEMERIS_MAX_BODIES];
+};
+
+/**
+ * @brief Read-only access to a Chebyshev ephemeris blob.
+ * @ingroup group_util
+ *
+ * The blob may be owned by the reader, memory-mapped from a file, or
+ * borrowed from the caller. Evaluation never allocates or copies: it
+ * locates the segment by index arithmetic and runs Clenshaw's
+ * recurrence directly on the stored coefficients, so one reader may be
+ * shared by any number of threads.
+ */
+class ChebyshevEphemeris
+{
+    public:
+        /// Default constructor, an empty and invalid ephemeris.
+        ChebyshevEphemeris();
+
+        /**
+         * Takes ownership of a blob, e.g. one returned by
+         * ChebyshevEphemerisBuilder::build().
+         *
+         * @param[in] aBlob The blob.
+         */
+        explicit ChebyshevEphemeris(std::vector<char> aBlob);
+
+        /**
+         * Uses a blob owned by the caller, which must outlive this
+         * object and be aligned to 8 bytes.
+         *
+         * @param[in] aData Start of the blob.
+         * @param[in] aSize Size of the blob in bytes.
+         */
+        ChebyshevEphemeris(const void* aData, std::size_t aSize);
+
+        /**
+         * Opens an ephemeris file, memory-mapping it where the platform
+         * allows and reading it into memory otherwise.
+         *
+         * @param[in] aFileName Path of the file.
+         */
+        explicit ChebyshevEphemeris(const std::string& aFileName);
+
+        /// Copying is disabled, as the reader may own a mapping.
+        ChebyshevEphemeris(const ChebyshevEphemeris&) = delete;
+
+        /// Copying is disabled, as the reader may own a mapping.
+        ChebyshevEphemeris& operator=(const ChebyshevEphemeris&) = delete;
+
+        /// Destructor, releases any mapping.
+        virtual ~ChebyshevEphemeris();
+
+        /**
+         * Returns true if a well-formed blob was loaded.
+         * @return True if the ephemeris can be evaluated.
+         */
+        bool isValid() const
+        {
+            return theHeader != nullptr;
+        }
+
+        /**
+         * Returns true if the ephemeris holds a given body.
+         * @param[in] aBody Body identifier.
+         * @return True if the body is present.
+         */
+        bool hasBody(int aBody) const;
+
+        /**
+         * Returns the number of components tabulated for a body.
+         * @param[in] aBody Body identifier.
+         * @return Number of components, zero if the body is absent.
+         */
+        std::size_t getNumComponents(int aBody) const;
+
+        /// @return Start of the range covered, decimal Julian Days.
+        double getStartJulianDays() const;
+
+        /// @return End of the range covered, decimal Julian Days.
+        double getEndJulianDays() const;
+
+        /**
+         * Evaluates every component of a body at a given time.
+         *
+         * @param[in] aBody Body identifier.
+         * @param[in] aJulianDays Time in decimal Julian Days.
+         * @param[out] aComponents Pointer to getNumComponents(aBody)
+         *   doubles to receive the values.
+         * @return False, leaving aComponents untouched, if the body is
+         *   absent or the time is outside the ephemeris.
+         */
+        bool evaluate(int aBody,
+                      double aJulianDays,
+                      double* aComponents) const;
+
+        /**
+         * Evaluates every component of a body at a given time.
+         *
+         * @param[in] aBody Body identifier.
+         * @param[in] aJulianDate Time, UT.
+         * @param[out] aComponents Pointer to getNumComponents(aBody)
+         *   doubles to receive the values.
+         * @return False if the body is absent or the time is outside
+         *   the ephemeris.
+         */
+        bool evaluate(int aBody,
+                      const JulianDate& aJulianDate,
+                      double* aComponents) const;
+
+    private:
+        /**
+         * Checks the blob and sets theHeader if it is well formed.
+         * @param[in] aData Start of the blob.
+         * @param[in] aSize Size of the blob in bytes.
+         */
+        void attach(const void* aData, std::size_t aSize);
+
+        /// Header of the attached blob, or null if invalid
+        const EphemerisFileHeader* theHeader;
+
+        /// Start of the attached blob
+        const char* theData;
+
+        /// Blob storage when owned by this object
+        std::vector<char> theStorage;
+
+        /// Memory mapping owned by this object, or null
+        void* theMapping;
+
+        /// Size of theMapping in bytes
+        std::size_t theMappingSize;
+};
+
+} // end namespace SPA
+
+#endif /* INC_CHEBYSHEVEPHEMERIS_H_ */
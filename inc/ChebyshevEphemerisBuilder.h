@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevEphemerisBuilder.h
+ * @brief Declaration of the ChebyshevEphemerisBuilder class
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CHEBYSHEVEPHEMERISBUILDER_H_
+#define INC_CHEBYSHEVEPHEMERISBUILDER_H_
+
+#include "ChebyshevEphemeris.h"
+#include "SpaPlanetConstants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief Default segment length used for the Sun by
+ *   ChebyshevEphemerisBuilder::addSun().
+ * @ingroup group_util
+ * @source Chosen so the fit error is below 1e-7 degrees
+ * @units Decimal days
+ */
+constexpr double SPA_EPHEMERIS_SUN_SEGMENT_DAYS = 16.0;
+
+/**
+ * @brief Default number of coefficients used for the Sun by
+ *   ChebyshevEphemerisBuilder::addSun().
+ * @ingroup group_util
+ * @source Chosen so the fit error is below 1e-7 degrees
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_EPHEMERIS_SUN_COEFFICIENTS = 12;
+
+/**
+ * @brief Default segment lengths used for each planet by
+ *   ChebyshevEphemerisBuilder::addPlanet(), indexed by Planets.
+ * @ingroup group_util
+ * @source Chosen so the fit error is below 1e-6 degrees
+ * @units Decimal days
+ */
+constexpr double SPA_EPHEMERIS_PLANET_SEGMENT_DAYS[SPA_NUM_PLANETS] =
+{
+    8.0, 16.0, 16.0, 16.0, 32.0, 32.0, 32.0, 32.0
+};
+
+/**
+ * @brief Default number of coefficients used for each planet by
+ *   ChebyshevEphemerisBuilder::addPlanet().
+ * @ingroup group_util
+ * @source Chosen so the fit error is below 1e-6 degrees
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_EPHEMERIS_PLANET_COEFFICIENTS = 14;
+
+/**
+ * @brief Builds Chebyshev ephemeris blobs and files that can be read
+ *   with ChebyshevEphemeris.
+ * @ingroup group_util
+ *
+ * Each body is described by a segment length, a number of
+ * coefficients and a sampler that evaluates the full theory. When the
+ * blob is built the sampler is called once per body with every
+ * Chebyshev node of every segment, so a batch implementation of the
+ * theory is used to full effect. Components flagged as angles are
+ * unwrapped within each segment before fitting and reduced to [0, 360)
+ * again on evaluation.
+ */
+class ChebyshevEphemerisBuilder
+{
+    public:
+        /**
+         * Function evaluating a body's components at a batch of times.
+         * Arguments are a pointer to the times in decimal Julian Days,
+         * the number of times n, and a pointer to numComponents * n
+         * doubles to receive the values, component-major (all values of
+         * component 0 first).
+         */
+        using Sampler = std::function<void(const double*, std::size_t, double*)>;
+
+        /**
+         * Constructor.
+         * @param[in] aStartJulianDays Start of the range, decimal days.
+         * @param[in] anEndJulianDays End of the range, decimal days.
+         */
+        ChebyshevEphemerisBuilder(double aStartJulianDays,
+                                  double anEndJulianDays);
+
+        /// Destructor
+        virtual ~ChebyshevEphemerisBuilder() = default;
+
+        /**
+         * Adds a body with a user-supplied sampler, replacing any
+         * existing body with the same identifier.
+         *
+         * @param[in] aBody Body identifier in [0, SPA_EPHEMERIS_MAX_BODIES).
+         * @param[in] aSegmentDays Segment length in decimal days.
+         * @param[in] aNumCoefficients Coefficients per component per segment.
+         * @param[in] aNumComponents Number of components the sampler returns.
+         * @param[in] anAngleMask Bit i set if component i is an angle in degrees.
+         * @param[in] aSampler The sampler.
+         * @return False, adding nothing, if an argument is out of range.
+         */
+        bool addBody(int aBody,
+                     double aSegmentDays,
+                     std::size_t aNumCoefficients,
+                     std::size_t aNumComponents,
+                     std::uint32_t anAngleMask,
+                     const Sampler& aSampler);
+
+        /**
+         * Adds the Sun, tabulating its geocentric ecliptic longitude
+         * (degrees), latitude (always zero) and distance (kilometres)
+         * from SUN_UTIL::calculateSunPositions().
+         */
+        void addSun();
+
+        /**
+         * Adds a planet, tabulating its geocentric ecliptic longitude
+         * and latitude (degrees) and distance (AU) from
+         * PLANET_UTIL::calculatePlanetPositions().
+         *
+         * @param[in] aPlanet The planet, which must not be EARTH.
+         * @return False, adding nothing, for EARTH.
+         */
+        bool addPlanet(Planets aPlanet);
+
+        /**
+         * Samples and fits every body and returns the finished blob.
+         * @return The blob, empty if no body has been added.
+         */
+        std::vector<char> build() const;
+
+        /**
+         * Builds the blob and writes it to a file.
+         * @param[in] aFileName Path of the file.
+         * @return False if there is nothing to write or the write failed.
+         */
+        bool write(const std::string& aFileName) const;
+
+    private:
+        /// Description of one body to be tabulated
+        struct BodySpec
+        {
+            int body;
+            double segmentDays;
+            std::size_t numCoefficients;
+            std::size_t numComponents;
+            std::uint32_t angleMask;
+            Sampler sampler;
+        };
+
+        /// Start of the range, decimal Julian Days
+        double theStartJulianDays;
+
+        /// End of the range, decimal Julian Days
+        double theEndJulianDays;
+
+        /// Bodies added so far
+        std::vector<BodySpec> theBodies;
+};
+
+} // end namespace SPA
+
+#endif /* INC_CHEBYSHEVEPHEMERISBUILDER_H_ */
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevTable.h
+ * @brief Declaration of the piecewise Chebyshev approximation class
+ *   ChebyshevTable
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CHEBYSHEVTABLE_H_
+#define INC_CHEBYSHEVTABLE_H_
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief A piecewise Chebyshev approximation to a smooth scalar
+ *   function of time.
+ * @ingroup group_util
+ *
+ * The range [start, start + N * length) is split into N segments of
+ * equal length, each approximated by its own Chebyshev series of the
+ * same order. All coefficients live in one contiguous array, segment
+ * by segment, so looking up a value is an O(1) index calculation
+ * followed by a short Clenshaw recurrence.
+ */
+class ChebyshevTable
+{
+    public:
+        /**
+         * Function that evaluates the quantity being tabulated at each
+         * of an array of times: (times, count, values).
+         */
+        using Sampler = std::function<void(const double*, std::size_t, double*)>;
+
+        /// Default constructor, an empty table.
+        ChebyshevTable();
+
+        /**
+         * Builds a table by sampling a function at the Chebyshev nodes
+         * of every segment.
+         *
+         * The sampler is called once, with the nodes of all segments
+         * in a single array, so that batch implementations can be used.
+         *
+         * @param[in] aStart Start of the first segment.
+         * @param[in] aSegmentLength Length of each segment, > 0.
+         * @param[in] aNumSegments Number of segments, > 0.
+         * @param[in] aNumCoefficients Coefficients per segment, > 0.
+         * @param[in] aSampler Function to approximate.
+         */
+        ChebyshevTable(double aStart,
+                       double aSegmentLength,
+                       std::size_t aNumSegments,
+                       std::size_t aNumCoefficients,
+                       const Sampler& aSampler);
+
+        /**
+         * Constructs a table from existing coefficients, e.g. ones read
+         * back from a file.
+         *
+         * @param[in] aStart Start of the first segment.
+         * @param[in] aSegmentLength Length of each segment, > 0.
+         * @param[in] aNumCoefficients Coefficients per segment, > 0.
+         * @param[in] aCoefficients Coefficients of every segment in
+         *   order; the size must be a multiple of aNumCoefficients.
+         */
+        ChebyshevTable(double aStart,
+                       double aSegmentLength,
+                       std::size_t aNumCoefficients,
+                       const std::vector<double>& aCoefficients);
+
+        /// Default destructor
+        virtual ~ChebyshevTable() = default;
+
+        /**
+         * Evaluates the approximation at a given time.
+         *
+         * @limitations Times outside the table are extrapolated from
+         *   the first or last segment, which quickly loses accuracy.
+         *
+         * @param[in] aTime Time within [getStart(), getEnd()].
+         * @return The approximated value.
+         */
+        double evaluate(double aTime) const;
+
+        /**
+         * Evaluates the approximation at each of an array of times.
+         *
+         * @param[in] aTimes Pointer to aCount times.
+         * @param[in] aCount Number of times.
+         * @param[out] aValues Pointer to aCount doubles for the results.
+         */
+        void evaluate(const double* aTimes,
+                      std::size_t aCount,
+                      double* aValues) const;
+
+        /**
+         * Evaluates the time derivative of the approximation.
+         *
+         * @param[in] aTime Time within [getStart(), getEnd()].
+         * @return The approximated derivative, per unit of time.
+         */
+        double evaluateDerivative(double aTime) const;
+
+        /// @return Start of the first segment.
+        double getStart() const
+        {
+            return theStart;
+        }
+
+        /// @return End of the last segment.
+        double getEnd() const
+        {
+            return theStart + theSegmentLength * double(theNumSegments);
+        }
+
+        /// @return Length of each segment.
+        double getSegmentLength() const
+        {
+            return theSegmentLength;
+        }
+
+        /// @return Number of segments.
+        std::size_t getNumSegments() const
+        {
+            return theNumSegments;
+        }
+
+        /// @return Number of coefficients per segment.
+        std::size_t getNumCoefficients() const
+        {
+            return theNumCoefficients;
+        }
+
+        /// @return Coefficients of every segment, in order.
+        const std::vector<double>& getCoefficients() const
+        {
+            return theCoefficients;
+        }
+
+    private:
+        /**
+         * Finds the segment containing a time and the corresponding
+         * argument in [-1, 1].
+         *
+         * @param[in] aTime Input time.
+         * @param[out] anX Argument of the Chebyshev series.
+         * @return Index of the segment.
+         */
+        std::size_t locate(double aTime, double& anX) const;
+
+        /// Start of the first segment
+        double theStart;
+
+        /// Length of each segment
+        double theSegmentLength;
+
+        /// Number of segments
+        std::size_t theNumSegments;
+
+        /// Number of coefficients per segment
+        std::size_t theNumCoefficients;
+
+        /// Coefficients, theNumCoefficients per segment
+        std::vector<double> theCoefficients;
+};
+
+} // end namespace SPA
+
+#endif /* INC_CHEBYSHEVTABLE_H_ */
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevUtilities.h
+ * @brief Declaration of Chebyshev approximation functions in the
+ *   CHEBYSHEV_UTIL namespace
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CHEBYSHEVUTILITIES_H_
+#define INC_CHEBYSHEVUTILITIES_H_
+
+#include <cstddef>
+
+namespace SPA
+{
+namespace CHEBYSHEV_UTIL
+{
+
+/**
+ * @brief Calculates the Chebyshev nodes (zeros of T_n) on [-1, 1].
+ * @ingroup group_util
+ *
+ * Node k is \f$x_k = \cos(\pi (k + 1/2) / n)\f$, so the nodes run
+ * from near +1 down to near -1.
+ *
+ * @param[in] aCount Number of nodes n.
+ * @param[out] aNodes Pointer to aCount doubles to receive the nodes.
+ */
+void calculateChebyshevNodes(std::size_t aCount,
+                             double* aNodes);
+
+/**
+ * @brief Calculates the coefficients of the Chebyshev series that
+ *   interpolates a function at the Chebyshev nodes.
+ * @ingroup group_util
+ *
+ * The leading coefficient is already halved, so the series is
+ * \f$f(x) \approx \sum_{j=0}^{n-1} c_j T_j(x)\f$ and can be passed
+ * straight to evaluateChebyshev().
+ *
+ * @param[in] aValues Function values at the nodes from
+ *   calculateChebyshevNodes(), in the same order.
+ * @param[in] aCount Number of nodes and of coefficients.
+ * @param[out] aCoefficients Pointer to aCount doubles to receive the
+ *   coefficients.
+ */
+void fitChebyshevCoefficients(const double* aValues,
+                              std::size_t aCount,
+                              double* aCoefficients);
+
+/**
+ * @brief Evaluates a Chebyshev series with Clenshaw's recurrence.
+ * @ingroup group_util
+ *
+ * @param[in] aCoefficients Series coefficients, leading term first,
+ *   as produced by fitChebyshevCoefficients().
+ * @param[in] aCount Number of coefficients.
+ * @param[in] anX Argument, normally in [-1, 1].
+ * @return The value of the series at anX, 0 for an empty series.
+ */
+inline double evaluateChebyshev(const double* aCoefficients,
+                                std::size_t aCount,
+                                double anX)
+{
+    if (aCount == 0)
+    {
+        return 0.0;
+    }
+    double twoX = 2.0 * anX;
+    double b1 = 0.0;
+    double b2 = 0.0;
+    for (std::size_t index = aCount - 1; index > 0; index--)
+    {
+        double b0 = twoX * b1 - b2 + aCoefficients[index];
+        b2 = b1;
+        b1 = b0;
+    }
+    return aCoefficients[0] + anX * b1 - b2;
+}
+
+/**
+ * @brief Evaluates the derivative with respect to x of a Chebyshev
+ *   series.
+ * @ingroup group_util
+ *
+ * Uses \f$T_j'(x) = j U_{j-1}(x)\f$ and the Clenshaw recurrence for
+ * Chebyshev polynomials of the second kind.
+ *
+ * @param[in] aCoefficients Series coefficients, leading term first.
+ * @param[in] aCount Number of coefficients.
+ * @param[in] anX Argument, normally in [-1, 1].
+ * @return The derivative of the series at anX, 0 for an empty series.
+ */
+inline double evaluateChebyshevDerivative(const double* aCoefficients,
+                                          std::size_t aCount,
+                                          double anX)
+{
+    if (aCount == 0)
+    {
+        return 0.0;
+    }
+    double twoX = 2.0 * anX;
+    double b1 = 0.0;
+    double b2 = 0.0;
+    for (std::size_t index = aCount - 1; index > 0; index--)
+    {
+        double b0 = twoX * b1 - b2 + double(index) * aCoefficients[index];
+        b2 = b1;
+        b1 = b0;
+    }
+    // The sum of j c_j U_{j-1}(x) for j >= 1 is b1.
+    return b1;
+}
+
+} // end namespace CHEBYSHEV_UTIL
+} // end namespace SPA
+
+#endif /* INC_CHEBYSHEVUTILITIES_H_ */
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CometOrbitTable.h
+ * @brief Declaration of the CometOrbitTable class
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_COMETORBITTABLE_H_
+#define INC_COMETORBITTABLE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief Osculating orbital elements of a comet or other small body,
+ *   in the form used by PAWYC Table 9 and by orbit element files.
+ * @ingroup group_planets
+ *
+ * The same elements describe elliptic (e < 1), parabolic (e = 1) and
+ * hyperbolic (e > 1) orbits.
+ */
+struct CometElements
+{
+    /// Time of perihelion passage, T, decimal Julian Days
+    double perihelionJulianDays;
+
+    /// Perihelion distance, q, AU
+    double perihelionDistance;
+
+    /// Eccentricity, e
+    double eccentricity;
+
+    /// Argument of perihelion, omega, degrees
+    double argumentOfPerihelion;
+
+    /// Longitude of the ascending node, Omega, degrees
+    double longitudeOfAscendingNode;
+
+    /// Inclination to the ecliptic, i, degrees
+    double inclination;
+};
+
+/**
+ * @brief Orbits of many comets, stored as a structure of arrays with
+ *   every quantity that depends only on the elements precomputed.
+ * @ingroup group_planets
+ *
+ * As for PlanetOrbit, the orientation of each orbit is folded into the
+ * unit vectors P and Q, so that a position needs only the solution of
+ * Kepler's (or Barker's) equation and two multiply-adds per coordinate.
+ * Elliptic, parabolic and hyperbolic orbits may be mixed freely; each
+ * kind is propagated as a separate batch through the array solvers in
+ * KEPLER_UTIL.
+ *
+ * Names are kept apart from the numeric data so that propagation does
+ * not touch them.
+ */
+class CometOrbitTable
+{
+    public:
+        /// Default constructor, an empty table.
+        CometOrbitTable() = default;
+
+        /// Default destructor
+        virtual ~CometOrbitTable() = default;
+
+        /**
+         * Reserves space for a number of bodies.
+         * @param[in] aSize Number of bodies expected.
+         */
+        void reserve(std::size_t aSize);
+
+        /// Removes every body.
+        void clear();
+
+        /**
+         * Adds a body to the end of the table.
+         *
+         * @param[in] anElements Orbital elements. The perihelion
+         *   distance must be positive.
+         * @param[in] aName Name or designation of the body.
+         * @return The index of the new body.
+         */
+        std::size_t add(const CometElements& anElements, const std::string& aName = "");
+
+        /// @return The number of bodies in the table.
+        std::size_t size() const
+        {
+            return theEccentricity.size();
+        }
+
+        /**
+         * Returns the elements of one body.
+         * @param[in] aBody Index of the body, less than size().
+         * @return The orbital elements the body was added with.
+         */
+        CometElements getElements(std::size_t aBody) const;
+
+        /**
+         * Returns the name of one body.
+         * @param[in] aBody Index of the body, less than size().
+         * @return The name the body was added with.
+         */
+        const std::string& getName(std::size_t aBody) const
+        {
+            return theNames.at(aBody);
+        }
+
+        /**
+         * Calculates the heliocentric ecliptic rectangular coordinates
+         * of one body at a given time.
+         *
+         * @param[in] aBody Index of the body, less than size().
+         * @param[in] aJulianDays Time in decimal Julian Days.
+         * @param[out] anX Coordinate towards the vernal equinox, AU.
+         * @param[out] aY Coordinate 90 degrees east along the ecliptic, AU.
+         * @param[out] aZ Coordinate towards the north ecliptic pole, AU.
+         */
+        void calculateHeliocentricPosition(std::size_t aBody,
+                                           double aJulianDays,
+                                           double& anX,
+                                           double& aY,
+                                           double& aZ) const;
+
+        /**
+         * Calculates the heliocentric ecliptic rectangular coordinates
+         * of one body at each of an array of times.
+         *
+         * @param[in] aBody Index of the body, less than size().
+         * @param[in] aJulianDays Pointer to aCount times in decimal Julian Days.
+         * @param[in] aCount Number of times.
+         * @param[out] anX Pointer to aCount doubles, AU.
+         * @param[out] aY Pointer to aCount doubles, AU.
+         * @param[out] aZ Pointer to aCount doubles, AU.
+         */
+        void calculateHeliocentricPositions(std::size_t aBody,
+                                            const double* aJulianDays,
+                                            std::size_t aCount,
+                                            double* anX,
+                                            double* aY,
+                                            double* aZ) const;
+
+        /**
+         * Calculates the heliocentric ecliptic rectangular coordinates
+         * of a contiguous range of bodies, each at its own time.
+         *
+         * Gives the same results as calculateHeliocentricPosition() for
+         * each body. Different ranges may be processed concurrently.
+         *
+         * @param[in] aJulianDays Pointer to anEnd - aBegin times in decimal
+         *   Julian Days, one per body.
+         * @param[in] aBegin Index of the first body.
+         * @param[in] anEnd One past the index of the last body, at most size().
+         * @param[out] anX Pointer to anEnd - aBegin doubles, AU.
+         * @param[out] aY Pointer to anEnd - aBegin doubles, AU.
+         * @param[out] aZ Pointer to anEnd - aBegin doubles, AU.
+         */
+        void calculateHeliocentricPositions(const double* aJulianDays,
+                                            std::size_t aBegin,
+                                            std::size_t anEnd,
+                                            double* anX,
+                                            double* aY,
+                                            double* aZ) const;
+
+    private:
+        /// Kinds of orbit, each solved by a different equation.
+        enum OrbitKind
+        {
+            ELLIPTIC,
+            PARABOLIC,
+            HYPERBOLIC,
+            NUM_ORBIT_KINDS
+        };
+
+        /**
+         * Solves for the in-plane coordinates of a batch of orbits of
+         * one kind. Element j refers to body aBodies[j * aBodyStride],
+         * so a stride of zero gives one body at many times. On entry
+         * anXi holds the time since perihelion in days; on exit anXi
+         * and anEta hold the coordinates towards perihelion and 90
+         * degrees ahead of it, AU.
+         */
+        void solveInPlane(OrbitKind aKind,
+                          const std::size_t* aBodies,
+                          std::size_t aBodyStride,
+                          std::size_t aCount,
+                          double* anXi,
+                          double* anEta) const;
+
+        /// Time of perihelion, decimal Julian Days
+        std::vector<double> thePerihelionJulianDays;
+
+        /// Perihelion distance, AU
+        std::vector<double> thePerihelionDistance;
+
+        /// Eccentricity
+        std::vector<double> theEccentricity;
+
+        /// Argument of perihelion, degrees
+        std::vector<double> theArgumentOfPerihelion;
+
+        /// Longitude of the ascending node, degrees
+        std::vector<double> theLongitudeOfAscendingNode;
+
+        /// Inclination, degrees
+        std::vector<double> theInclination;
+
+        /**
+         * Radians of mean anomaly per day (elliptic and hyperbolic), or
+         * of Barker's W per day (parabolic)
+         */
+        std::vector<double> theMeanMotion;
+
+        /// Semi-major axis (elliptic, hyperbolic) or q (parabolic), AU
+        std::vector<double> theSemiMajorAxis;
+
+        /// Semi-minor axis (elliptic, hyperbolic) or 2q (parabolic), AU
+        std::vector<double> theSemiMinorAxis;
+
+        /// Unit vector towards perihelion, ecliptic coordinates
+        std::vector<double> thePx;
+        std::vector<double> thePy;
+        std::vector<double> thePz;
+
+        /// Unit vector 90 degrees ahead of perihelion in the orbital plane
+        std::vector<double> theQx;
+        std::vector<double> theQy;
+        std::vector<double> theQz;
+
+        /// Kind of each orbit
+        std::vector<unsigned char> theKind;
+
+        /// Indices of the bodies of each kind, in increasing order
+        std::vector<std::size_t> theBodiesOfKind[NUM_ORBIT_KINDS];
+
+        /// Name of each body
+        std::vector<std::string> theNames;
+};
+
+} // end namespace SPA
+
+#endif /* INC_COMETORBITTABLE_H_ */
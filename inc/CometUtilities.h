@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CometUtilities.h
+ * @brief Declaration of comet-related functions in the COMET_UTIL
+ *   namespace
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_COMETUTILITIES_H_
+#define INC_COMETUTILITIES_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class CometOrbitTable;
+class JulianDate;
+
+/**
+ * @brief The position of a comet at a single epoch.
+ * @ingroup group_planets
+ *
+ * As for PlanetPosition, heliocentric quantities refer to the time the
+ * light now reaching the Earth left the comet, and geocentric ecliptic
+ * coordinates are geometric.
+ */
+struct CometPosition
+{
+    /// Heliocentric ecliptic longitude, degrees in the range [0, 360)
+    double heliocentricLongitude;
+
+    /// Heliocentric ecliptic latitude, degrees
+    double heliocentricLatitude;
+
+    /// Distance from the Sun, AU
+    double radiusVector;
+
+    /// Geocentric ecliptic longitude, degrees in the range [0, 360)
+    double eclipticLongitude;
+
+    /// Geocentric ecliptic latitude, degrees
+    double eclipticLatitude;
+
+    /// Distance from the Earth, AU
+    double distance;
+
+    /// Light travel time from the comet to the Earth, decimal days
+    double lightTime;
+};
+
+/**
+ * @brief Comet positions stored as a structure of arrays.
+ * @ingroup group_planets
+ *
+ * Element i of every array refers to body i for the many-body
+ * interfaces, and to epoch i for the many-epoch interfaces.
+ */
+struct CometPositionArrays
+{
+    /// Heliocentric ecliptic longitude, degrees in the range [0, 360)
+    std::vector<double> heliocentricLongitude;
+
+    /// Heliocentric ecliptic latitude, degrees
+    std::vector<double> heliocentricLatitude;
+
+    /// Distance from the Sun, AU
+    std::vector<double> radiusVector;
+
+    /// Geocentric ecliptic longitude, degrees in the range [0, 360)
+    std::vector<double> eclipticLongitude;
+
+    /// Geocentric ecliptic latitude, degrees
+    std::vector<double> eclipticLatitude;
+
+    /// Distance from the Earth, AU
+    std::vector<double> distance;
+
+    /// Light travel time from the comet to the Earth, decimal days
+    std::vector<double> lightTime;
+
+    /**
+     * Resizes every array.
+     * @param[in] aSize Number of entries.
+     */
+    void resize(std::size_t aSize);
+
+    /**
+     * Returns the number of entries held.
+     * @return The number of entries held.
+     */
+    std::size_t size() const
+    {
+        return distance.size();
+    }
+
+    /**
+     * Returns the values for one entry as a CometPosition.
+     * @param[in] anIndex Index of the entry, less than size().
+     * @return The position of the comet.
+     */
+    CometPosition at(std::size_t anIndex) const;
+};
+
+namespace COMET_UTIL
+{
+
+/**
+ * @brief Calculates the position of one comet at a given epoch.
+ * @ingroup group_planets
+ *
+ * Implements Sections 61 and 62 of PAWYC. Elliptic orbits are solved
+ * with Kepler's equation (Section 61 works through the same steps as
+ * for a planet), parabolic orbits with Barker's equation (Section 62),
+ * and hyperbolic orbits with the hyperbolic form of Kepler's equation.
+ * The Earth's position is that of PLANET_UTIL::getPlanetOrbit(), and
+ * the comet's position is corrected for light-time
+ * SPA_PLANET_LIGHT_TIME_ITERATIONS times.
+ *
+ * @limitations Elements are used as given, with no precession between
+ *   their equinox (J2000.0 for most element files) and the equinox of
+ *   the Earth's orbit, and no planetary perturbations. Positions are
+ *   therefore only as good as the osculating elements are near their
+ *   epoch, and may be in error by a few tenths of a degree from
+ *   precession alone.
+ *
+ * @param[in] aTable Table holding the comet.
+ * @param[in] aBody Index of the comet in aTable.
+ * @param[in] aJulianDate Epoch.
+ * @return The position of the comet.
+ */
+CometPosition calculateCometPosition(const CometOrbitTable& aTable,
+                                     std::size_t aBody,
+                                     const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position of every comet in a table at one
+ *   epoch.
+ * @ingroup group_planets
+ *
+ * The Earth's position is calculated once and shared. The table is
+ * split into contiguous chunks of at least SPA_COMET_CHUNK_SIZE
+ * bodies, each propagated as a task on ThreadPool::getDefault();
+ * within a chunk each kind of orbit goes through the array Kepler
+ * solvers as one batch. Results are identical to calling
+ * calculateCometPosition() for each body, whatever the number of
+ * threads.
+ *
+ * @param[in] aTable The comets.
+ * @param[in] aJulianDate Epoch.
+ * @param[out] aPositions Output positions, resized to aTable.size().
+ * @param[in] aNumThreads Most threads to use, or 0 for one per
+ *   hardware thread.
+ */
+void calculateCometPositions(const CometOrbitTable& aTable,
+                             const JulianDate& aJulianDate,
+                             CometPositionArrays& aPositions,
+                             unsigned int aNumThreads = 0);
+
+/**
+ * @brief Calculates the position of one comet at each of an array of
+ *   epochs.
+ * @ingroup group_planets
+ *
+ * Chunked over threads as for the many-body form.
+ *
+ * @param[in] aTable Table holding the comet.
+ * @param[in] aBody Index of the comet in aTable.
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to aCount.
+ * @param[in] aNumThreads Most threads to use, or 0 for one per
+ *   hardware thread.
+ */
+void calculateCometPositions(const CometOrbitTable& aTable,
+                             std::size_t aBody,
+                             const double* aJulianDays,
+                             std::size_t aCount,
+                             CometPositionArrays& aPositions,
+                             unsigned int aNumThreads = 0);
+
+/**
+ * @brief Parses comet orbital elements in the fixed-column format of
+ *   the Minor Planet Center's CometEls.txt.
+ * @ingroup group_planets
+ *
+ * Columns used (1-based): 15-18 year, 20-21 month and 23-29 day of
+ * perihelion; 31-39 q; 42-49 e; 52-59 omega; 62-69 Omega; 72-79 i;
+ * 103-158 designation and name. Lines that are too short or whose
+ * numeric fields do not parse are skipped.
+ *
+ * @param[in] aText Contents of the file.
+ * @param[in,out] aTable Table to which the comets are appended.
+ * @return The number of comets added.
+ */
+std::size_t parseCometElements(const std::string& aText,
+                               CometOrbitTable& aTable);
+
+/**
+ * @brief Reads comet orbital elements from a file in the format of
+ *   parseCometElements().
+ * @ingroup group_planets
+ *
+ * The whole file is read with a single call and parsed in memory.
+ *
+ * @param[in] aFileName Path of the file.
+ * @param[in,out] aTable Table to which the comets are appended.
+ * @return The number of comets added, 0 if the file cannot be read.
+ */
+std::size_t loadCometElements(const std::string& aFileName,
+                              CometOrbitTable& aTable);
+
+} // end namespace COMET_UTIL
+} // end namespace SPA
+
+#endif /* INC_COMETUTILITIES_H_ */
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CoordinateUtilities.h
+ * @brief Declaration of coordinate conversion functions in the
+ *   COORD_UTIL namespace
+ * @ingroup group_coords
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_COORDINATEUTILITIES_H_
+#define INC_COORDINATEUTILITIES_H_
+
+namespace SPA
+{
+
+/**
+ * @defgroup group_coords Coordinate Systems
+ *
+ * @brief Coordinate systems and conversions from Practical Astronomy
+ *   With Your Calculator
+ */
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief A position on the surface of the Earth.
+ * @ingroup group_coords
+ */
+struct GeographicCoordinates
+{
+    /// Geographical latitude, degrees, positive north of the equator
+    double latitude;
+
+    /// Geographical longitude, degrees, positive east of Greenwich
+    double longitude;
+};
+
+/**
+ * @brief A position in the equatorial coordinate system (PAWYC
+ *   Section 18).
+ * @ingroup group_coords
+ */
+struct EquatorialCoordinates
+{
+    /// Right ascension, decimal hours in the range [0, 24)
+    double rightAscension;
+
+    /// Declination, degrees in the range [-90, 90]
+    double declination;
+};
+
+/**
+ * @brief A position in the horizon coordinate system (PAWYC
+ *   Section 17).
+ * @ingroup group_coords
+ */
+struct HorizonCoordinates
+{
+    /// Azimuth, degrees east of north in the range [0, 360)
+    double azimuth;
+
+    /// Altitude above the horizon, degrees in the range [-90, 90]
+    double altitude;
+};
+
+namespace COORD_UTIL
+{
+
+/**
+ * @brief Calculates the mean obliquity of the ecliptic at a given
+ *   epoch.
+ * @ingroup group_coords
+ *
+ * Implements steps 1 to 5 of Section 27 of PAWYC. Nutation is not
+ * included.
+ *
+ * @param[in] aJulianDate Epoch.
+ * @return Mean obliquity of the ecliptic in degrees.
+ */
+double calculateMeanObliquity(const JulianDate& aJulianDate);
+
+/**
+ * @brief Converts ecliptic coordinates to equatorial coordinates.
+ * @ingroup group_coords
+ *
+ * Implements Section 27 of PAWYC.
+ *
+ * @param[in] anEclipticLongitude Ecliptic longitude in degrees.
+ * @param[in] anEclipticLatitude Ecliptic latitude in degrees.
+ * @param[in] anObliquity Obliquity of the ecliptic in degrees, e.g.
+ *   from calculateMeanObliquity().
+ * @return The equivalent equatorial coordinates.
+ */
+EquatorialCoordinates convertEclipticToEquatorial(double anEclipticLongitude,
+                                                  double anEclipticLatitude,
+                                                  double anObliquity);
+
+/**
+ * @brief Converts an hour angle and declination to horizon coordinates.
+ * @ingroup group_coords
+ *
+ * Implements Section 25 of PAWYC.
+ *
+ * @param[in] anHourAngle Hour angle in decimal hours.
+ * @param[in] aDeclination Declination in degrees.
+ * @param[in] aLatitude Geographical latitude of the observer in degrees.
+ * @return The equivalent horizon coordinates.
+ */
+HorizonCoordinates convertEquatorialToHorizon(double anHourAngle,
+                                              double aDeclination,
+                                              double aLatitude);
+
+} // end namespace COORD_UTIL
+} // end namespace SPA
+
+#endif /* INC_COORDINATEUTILITIES_H_ */
@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CpuDispatch.h
+ * @brief Declaration of the BatchKernels table and the CPU_UTIL
+ *   functions that choose one for the running processor
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_CPUDISPATCH_H_
+#define INC_CPUDISPATCH_H_
+
+#include <cstddef>
+#include <iosfwd>
+
+namespace SPA
+{
+
+/**
+ * @brief x86 instruction set levels that libspa compiles kernels for,
+ *   in increasing order.
+ * @ingroup group_util
+ *
+ * On other processors, and with compilers that do not support per
+ * function target attributes, only Generic is available.
+ */
+enum class CpuLevel
+{
+    Generic, ///< Whatever the library was compiled for
+    SSE42,   ///< SSE4.2, which brings single-instruction rounding
+    AVX2,    ///< AVX2, four doubles per vector
+    AVX512   ///< AVX-512 F/DQ/VL, eight doubles per vector
+};
+
+/**
+ * @brief A table of array kernels, all compiled for one instruction
+ *   set level.
+ * @ingroup group_util
+ *
+ * Every level computes the same arithmetic in the same order as the
+ * scalar functions named below, so apart from the trigonometric
+ * functions, which call the C library, results do not depend on the
+ * level. The compiler vectorizes the calendar kernels from SSE4.2 up;
+ * the trigonometric kernels stay one element at a time. The
+ * spa_batch_benchmark tool times each level. Obtain a table from
+ * CPU_UTIL::getBatchKernels().
+ */
+struct BatchKernels
+{
+    /// Level the kernels in this table were compiled for
+    CpuLevel level;
+
+    /**
+     * Converts calendar dates to Julian Dates, as the JulianDate
+     * constructor taking a DateAndTime does.
+     *
+     * Arguments: aCount years, months, days of the month, day fractions
+     * (as DateAndTime::getDayFraction()), the count, and aCount output
+     * Julian Dates.
+     */
+    void (*convertToJulianDays)(const int* aYears,
+                                const int* aMonths,
+                                const int* aDays,
+                                const double* aDayFractions,
+                                std::size_t aCount,
+                                double* aJulianDays);
+
+    /**
+     * Decodes Julian Dates into calendar dates, as
+     * JulianDate::getDateAndTime() does.
+     *
+     * Arguments: aCount Julian Dates, the count, and aCount output
+     * years, months and decimal days of the month (day plus fraction).
+     */
+    void (*convertFromJulianDays)(const double* aJulianDays,
+                                  std::size_t aCount,
+                                  int* aYears,
+                                  int* aMonths,
+                                  double* aDays);
+
+    /**
+     * Sines and cosines of angles in degrees.
+     *
+     * Arguments: aCount angles, the count, and aCount output sines and
+     * cosines.
+     */
+    void (*calculateSinCos)(const double* aDegrees,
+                            std::size_t aCount,
+                            double* aSines,
+                            double* aCosines);
+
+    /**
+     * Converts ecliptic coordinates to equatorial coordinates, as
+     * COORD_UTIL::convertEclipticToEquatorial() does.
+     *
+     * Arguments: aCount ecliptic longitudes and latitudes in degrees,
+     * the count, the obliquity in degrees, and aCount output right
+     * ascensions in decimal hours and declinations in degrees.
+     */
+    void (*convertEclipticToEquatorial)(const double* aLongitudes,
+                                        const double* aLatitudes,
+                                        std::size_t aCount,
+                                        double anObliquity,
+                                        double* aRightAscensions,
+                                        double* aDeclinations);
+};
+
+namespace CPU_UTIL
+{
+
+/**
+ * @brief Returns the highest level the running processor and operating
+ *   system support, among those compiled into the library.
+ * @ingroup group_util
+ */
+CpuLevel detectCpuLevel();
+
+/**
+ * @brief Parses a level name.
+ * @ingroup group_util
+ *
+ * Accepted names, in any case, are "generic", "sse4.2", "avx2" and
+ * "avx512".
+ *
+ * @param[in] aName Name to parse. May be null.
+ * @param[out] aLevel The level, set only on success.
+ * @return True if aName is a level name.
+ */
+bool parseCpuLevel(const char* aName, CpuLevel& aLevel);
+
+/**
+ * @brief Applies an override to a detected level.
+ * @ingroup group_util
+ *
+ * An override can lower the level but never raise it above aDetected,
+ * since the kernels would not run. A null or unrecognised override is
+ * ignored.
+ *
+ * @param[in] anOverride Level name, as for parseCpuLevel(), or null.
+ * @param[in] aDetected Level supported by the processor.
+ * @return The level to use.
+ */
+CpuLevel resolveCpuLevel(const char* anOverride, CpuLevel aDetected);
+
+/**
+ * @brief Returns the level the library uses.
+ * @ingroup group_util
+ *
+ * This is detectCpuLevel() lowered by the SPA_CPU_DISPATCH environment
+ * variable, if set, as for resolveCpuLevel(). It is fixed when the
+ * library is loaded, so the variable must be set before the program
+ * starts; running the tests with each value exercises each path.
+ */
+CpuLevel getCpuLevel();
+
+/**
+ * @brief Returns the kernels for getCpuLevel(). Used by the batch
+ *   functions elsewhere in the library.
+ * @ingroup group_util
+ */
+const BatchKernels& getBatchKernels();
+
+/**
+ * @brief Returns the kernels for a given level, lowered to
+ *   detectCpuLevel() if the processor cannot run it.
+ * @ingroup group_util
+ *
+ * @param[in] aLevel Requested level.
+ */
+const BatchKernels& getBatchKernels(CpuLevel aLevel);
+
+} // end namespace CPU_UTIL
+} // end namespace SPA
+
+/**
+ * Ostream operator for CpuLevel enumeration.
+ * @ingroup group_util
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aLevel A CPU level.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::CpuLevel& aLevel);
+
+#endif /* INC_CPUDISPATCH_H_ */
@@ -30,6 +30,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
 
 namespace SPA
 {
@@ -91,9 +92,6 @@ class DateAndTime
                     double aSeconds = 0,
                     double aUTC_OffsetHours = 0);
 
-        /// Default destructor
-        virtual ~DateAndTime() = default;
-
         /// Friend equality operator
         friend bool operator==(const DateAndTime& aLHS, const DateAndTime& aRHS);
 
@@ -247,6 +245,18 @@ class DateAndTime
         double theUTC_OffsetHours;
 };
 
+static_assert(std::is_trivially_copyable<DateAndTime>::value,
+              "DateAndTime must be trivially copyable");
+static_assert(std::is_standard_layout<DateAndTime>::value,
+              "DateAndTime must be standard layout");
+// Five ints, padded to the alignment of the doubles, then two doubles:
+// 40 bytes on x86-64, 36 on i386. Where there is padding it is never
+// written, so it holds whatever the memory held before.
+static_assert(sizeof(DateAndTime) == (5 * sizeof(int) + alignof(DateAndTime) - 1)
+                                         / alignof(DateAndTime) * alignof(DateAndTime)
+                                     + 2 * sizeof(double),
+              "DateAndTime must be five ints and two doubles, with no other padding");
+
 /**
  * @brief Equality operator for DateAndTime class.
  * @ingroup group_time
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EclipseGenerator.h
+ * @brief Declaration of the EclipseGenerator class
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_ECLIPSEGENERATOR_H_
+#define INC_ECLIPSEGENERATOR_H_
+
+#include "EclipseUtilities.h"
+
+namespace SPA
+{
+
+/**
+ * @brief Produces the lunar and solar eclipses in a range one at a
+ *   time, on demand.
+ * @ingroup group_moon
+ *
+ * The lazy counterpart of ECLIPSE_UTIL::findEclipses(): the generator
+ * holds only the next half-lunation to examine and the range, so it
+ * walks any span in constant memory.
+ *
+ * @code
+ * SPA::EclipseGenerator eclipses(start, end);
+ * SPA::Eclipse event;
+ * while (eclipses.next(event))
+ * {
+ *     ...
+ * }
+ * @endcode
+ */
+class EclipseGenerator
+{
+    public:
+        /**
+         * Constructor.
+         * @param[in] aStart Start of the range.
+         * @param[in] anEnd End of the range.
+         */
+        EclipseGenerator(const JulianDate& aStart,
+                         const JulianDate& anEnd);
+
+        /// Default destructor
+        virtual ~EclipseGenerator() = default;
+
+        /**
+         * Produces the next eclipse in the range.
+         * @param[out] anEvent The next eclipse, if there is one.
+         * @return False, leaving anEvent unchanged, once the range is
+         *   exhausted.
+         */
+        bool next(Eclipse& anEvent);
+
+    private:
+        /// Half-lunation number of the next mean syzygy to examine
+        long theNextHalfLunation;
+
+        /// Start of the range, decimal Julian Days
+        double theStartJulianDays;
+
+        /// End of the range, decimal Julian Days
+        double theEndJulianDays;
+};
+
+} // end namespace SPA
+
+#endif /* INC_ECLIPSEGENERATOR_H_ */
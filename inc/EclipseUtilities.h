@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file EclipseUtilities.h
+ * @brief Declaration of eclipse-related functions in the ECLIPSE_UTIL
+ *   namespace
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_ECLIPSEUTILITIES_H_
+#define INC_ECLIPSEUTILITIES_H_
+
+#include <iosfwd>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief Types of lunar and solar eclipse.
+ * @ingroup group_moon
+ *
+ * Solar eclipses are classified at greatest eclipse, so hybrid
+ * eclipses are reported as total or annular according to the shadow
+ * that reaches the Earth there.
+ */
+enum class EclipseType : unsigned char
+{
+    PenumbralLunar,
+    PartialLunar,
+    TotalLunar,
+    PartialSolar,
+    AnnularSolar,
+    TotalSolar
+};
+
+/**
+ * @brief The global circumstances of a single eclipse.
+ * @ingroup group_moon
+ *
+ * All times are decimal Julian Days. Contacts that do not occur for
+ * this eclipse are NaN.
+ *
+ * For a lunar eclipse the contacts are those of the Moon's limb with
+ * the Earth's penumbra (P1, P4), umbra (U1, U4) and, internally, umbra
+ * (U2, U3). For a solar eclipse the penumbral contacts bound the
+ * period during which the eclipse is partial somewhere on the Earth,
+ * and the umbral contacts the period during which the umbra or
+ * antumbra touches the Earth; the total contacts are always NaN.
+ */
+struct Eclipse
+{
+    /// Time of greatest eclipse
+    double maximumJulianDays;
+
+    /// First contact with the penumbra, P1
+    double penumbralBegin;
+
+    /// First contact with the umbra, U1
+    double umbralBegin;
+
+    /// Start of totality, U2
+    double totalBegin;
+
+    /// End of totality, U3
+    double totalEnd;
+
+    /// Last contact with the umbra, U4
+    double umbralEnd;
+
+    /// Last contact with the penumbra, P4
+    double penumbralEnd;
+
+    /**
+     * Magnitude at greatest eclipse. For a lunar eclipse this is the
+     * umbral magnitude, negative for a penumbral eclipse. For a solar
+     * eclipse it is the fraction of the Sun's diameter covered, or
+     * the ratio of the apparent diameters of the Moon and Sun when
+     * the eclipse is central.
+     */
+    double magnitude;
+
+    /// Penumbral magnitude of a lunar eclipse; NaN for a solar eclipse
+    double penumbralMagnitude;
+
+    /**
+     * Geocentric angular distance at greatest eclipse between the
+     * centre of the Moon and the centre of the Sun (solar eclipse) or
+     * of the Earth's shadow (lunar eclipse), degrees.
+     */
+    double minimumSeparation;
+
+    /// Type of eclipse
+    EclipseType type;
+};
+
+namespace ECLIPSE_UTIL
+{
+
+/**
+ * @brief Calculates the lunar eclipse at a given full Moon, if there
+ *   is one.
+ * @ingroup group_moon
+ *
+ * Implements Section 73 of PAWYC, but finds greatest eclipse directly
+ * from the minimum separation of the Moon and the centre of the
+ * Earth's shadow rather than from the time of opposition. The Moon is
+ * taken from the complete LunarSeries and the Sun from
+ * SUN_UTIL::calculateSunPositionSecular(). The radii of the shadow are
+ * enlarged by SPA_ECLIPSE_SHADOW_ENLARGEMENT. Full Moons too far from
+ * a node for an eclipse by the rules of Section 72 are rejected before
+ * any of this work is done.
+ *
+ * @limitations Times are in the time scale of the theories, i.e.
+ *   Terrestrial Time; the difference from UT is ignored. Times are
+ *   good to a minute or two and magnitudes to about 0.005.
+ *
+ * @param[in] aLunation Number of lunations since the new Moon of 2000
+ *   January 6; the full Moon that follows that new Moon is used.
+ * @param[out] anEclipse The eclipse, unchanged if there is none.
+ * @return True if there is an eclipse at this full Moon.
+ */
+bool calculateLunarEclipse(long aLunation, Eclipse& anEclipse);
+
+/**
+ * @brief Calculates the global circumstances of the solar eclipse at a
+ *   given new Moon, if there is one.
+ * @ingroup group_moon
+ *
+ * Implements Section 74 of PAWYC for the Earth as a whole rather than
+ * for one site: greatest eclipse is the minimum geocentric separation
+ * of the Moon and the Sun, and the eclipse is seen somewhere on the
+ * Earth when that separation is less than the difference of the
+ * horizontal parallaxes plus the sum of the semi-diameters. For a
+ * central eclipse the magnitude uses the Moon's semi-diameter as seen
+ * from the point on the Earth nearest the shadow axis.
+ *
+ * @limitations As for calculateLunarEclipse().
+ *
+ * @param[in] aLunation Number of lunations since the new Moon of 2000
+ *   January 6.
+ * @param[out] anEclipse The eclipse, unchanged if there is none.
+ * @return True if there is an eclipse at this new Moon.
+ */
+bool calculateSolarEclipse(long aLunation, Eclipse& anEclipse);
+
+/**
+ * @brief Finds every lunar eclipse between two epochs.
+ * @ingroup group_moon
+ *
+ * Steps from one mean full Moon to the next, calling
+ * calculateLunarEclipse() for each. Only when the Moon's mean argument
+ * of latitude is within SPA_ECLIPSE_NODE_LIMIT of a node does that do
+ * more than a single sine. Roughly two full Moons in three are
+ * rejected by this test alone, so ranges of several thousand years
+ * take a fraction of a second.
+ *
+ * @param[in] aStart Start of the range.
+ * @param[in] anEnd End of the range.
+ * @param[out] anEclipses Eclipses whose greatest eclipse lies between
+ *   aStart and anEnd, in time order. Existing contents are replaced.
+ */
+void findLunarEclipses(const JulianDate& aStart,
+                       const JulianDate& anEnd,
+                       std::vector<Eclipse>& anEclipses);
+
+/**
+ * @brief Finds every solar eclipse between two epochs.
+ * @ingroup group_moon
+ *
+ * As findLunarEclipses(), but at new Moon with calculateSolarEclipse().
+ *
+ * @param[in] aStart Start of the range.
+ * @param[in] anEnd End of the range.
+ * @param[out] anEclipses Eclipses whose greatest eclipse lies between
+ *   aStart and anEnd, in time order. Existing contents are replaced.
+ */
+void findSolarEclipses(const JulianDate& aStart,
+                       const JulianDate& anEnd,
+                       std::vector<Eclipse>& anEclipses);
+
+/**
+ * @brief Finds every lunar and solar eclipse between two epochs.
+ * @ingroup group_moon
+ *
+ * @param[in] aStart Start of the range.
+ * @param[in] anEnd End of the range.
+ * @param[out] anEclipses Eclipses whose greatest eclipse lies between
+ *   aStart and anEnd, in time order. Existing contents are replaced.
+ */
+void findEclipses(const JulianDate& aStart,
+                  const JulianDate& anEnd,
+                  std::vector<Eclipse>& anEclipses);
+
+} // end namespace ECLIPSE_UTIL
+} // end namespace SPA
+
+/**
+ * Ostream operator for EclipseType enumeration.
+ * @ingroup group_moon
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aType An eclipse type.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::EclipseType& aType);
+
+#endif /* INC_ECLIPSEUTILITIES_H_ */
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file IntervalIndex.h
+ * @brief Declaration of the IntervalIndex class.
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_INTERVALINDEX_H_
+#define INC_INTERVALINDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+class ThreadPool;
+
+/**
+ * @brief A static index of half-open time intervals [start, end) that
+ *   finds the intervals containing an instant or overlapping a window.
+ * @ingroup group_time
+ *
+ * Times are instant keys, see TIME_UTIL::calculateInstantKey(), so a
+ * JulianDate is resolved to the microsecond. The intervals are built
+ * once, sorted by start into a single array, and each element also
+ * holds the latest end in the implicit binary tree below it. A query
+ * walks that tree from the root, skipping every subtree that ends too
+ * early, so it costs O(log n) plus the number of intervals found,
+ * against O(n) for a linear scan.
+ *
+ * Intervals are identified by their index in the arrays the index was
+ * built from. Empty intervals, with end <= start, are never found.
+ * Results come in order of interval start, ties in input order.
+ */
+class IntervalIndex
+{
+    public:
+        /// Default constructor, an index with no intervals
+        IntervalIndex();
+
+        /**
+         * Construct from instant keys.
+         *
+         * @param[in] aStarts Pointer to aCount interval starts.
+         * @param[in] anEnds Pointer to aCount interval ends, exclusive.
+         * @param[in] aCount Number of intervals.
+         * @param[in] aPool Pool to sort on, or null for
+         *   ThreadPool::getDefault().
+         */
+        IntervalIndex(const std::int64_t* aStarts,
+                      const std::int64_t* anEnds,
+                      std::size_t aCount,
+                      ThreadPool* aPool = nullptr);
+
+        /**
+         * Construct from Julian Dates.
+         *
+         * @param[in] aStarts Pointer to aCount interval starts.
+         * @param[in] anEnds Pointer to aCount interval ends, exclusive.
+         * @param[in] aCount Number of intervals.
+         * @param[in] aPool Pool to sort on, or null for
+         *   ThreadPool::getDefault().
+         */
+        IntervalIndex(const JulianDate* aStarts,
+                      const JulianDate* anEnds,
+                      std::size_t aCount,
+                      ThreadPool* aPool = nullptr);
+
+        /**
+         * Returns the number of non-empty intervals in the index.
+         * @return Number of intervals.
+         */
+        std::size_t getCount() const
+        {
+            return theNodes.size();
+        }
+
+        /**
+         * Finds the intervals with start <= aTime < end.
+         *
+         * @param[in] aTime Instant key.
+         * @param[in,out] anIds Indices of the intervals found are
+         *   appended.
+         * @return Number of intervals found.
+         */
+        std::size_t findContaining(std::int64_t aTime,
+                                   std::vector<std::size_t>& anIds) const;
+
+        /**
+         * Finds the intervals containing a Julian Date.
+         *
+         * @param[in] aJulianDate Julian Date.
+         * @param[in,out] anIds Indices of the intervals found are
+         *   appended.
+         * @return Number of intervals found.
+         */
+        std::size_t findContaining(const JulianDate& aJulianDate,
+                                   std::vector<std::size_t>& anIds) const;
+
+        /**
+         * Finds the intervals that overlap [aStart, anEnd), those with
+         * start < anEnd and aStart < end.
+         *
+         * @param[in] aStart Start of the window, as an instant key.
+         * @param[in] anEnd End of the window, exclusive.
+         * @param[in,out] anIds Indices of the intervals found are
+         *   appended.
+         * @return Number of intervals found.
+         */
+        std::size_t findOverlapping(std::int64_t aStart,
+                                    std::int64_t anEnd,
+                                    std::vector<std::size_t>& anIds) const;
+
+        /**
+         * Finds the intervals that overlap a window of Julian Dates.
+         *
+         * @param[in] aStart Start of the window.
+         * @param[in] anEnd End of the window, exclusive.
+         * @param[in,out] anIds Indices of the intervals found are
+         *   appended.
+         * @return Number of intervals found.
+         */
+        std::size_t findOverlapping(const JulianDate& aStart,
+                                    const JulianDate& anEnd,
+                                    std::vector<std::size_t>& anIds) const;
+
+        /**
+         * Counts the intervals that overlap [aStart, anEnd).
+         *
+         * @param[in] aStart Start of the window, as an instant key.
+         * @param[in] anEnd End of the window, exclusive.
+         * @return Number of overlapping intervals.
+         */
+        std::size_t countOverlapping(std::int64_t aStart,
+                                     std::int64_t anEnd) const;
+
+        /**
+         * Finds the intervals that overlap each of a batch of windows,
+         * spread over the threads of a pool.
+         *
+         * The results for window q are anIds[anOffsets[q]] up to but
+         * not including anIds[anOffsets[q + 1]], as findOverlapping()
+         * would find them, whatever the number of threads.
+         *
+         * @param[in] aStarts Pointer to aCount window starts.
+         * @param[in] anEnds Pointer to aCount window ends, exclusive.
+         * @param[in] aCount Number of windows.
+         * @param[out] anOffsets Resized to aCount + 1 offsets into anIds.
+         * @param[out] anIds Resized to hold the indices found.
+         * @param[in] aPool Pool to run on, or null for
+         *   ThreadPool::getDefault().
+         */
+        void findOverlapping(const std::int64_t* aStarts,
+                             const std::int64_t* anEnds,
+                             std::size_t aCount,
+                             std::vector<std::size_t>& anOffsets,
+                             std::vector<std::size_t>& anIds,
+                             ThreadPool* aPool = nullptr) const;
+
+        /**
+         * Finds the intervals that overlap each of a batch of windows
+         * of Julian Dates, as the instant key version.
+         *
+         * @param[in] aStarts Pointer to aCount window starts.
+         * @param[in] anEnds Pointer to aCount window ends, exclusive.
+         * @param[in] aCount Number of windows.
+         * @param[out] anOffsets Resized to aCount + 1 offsets into anIds.
+         * @param[out] anIds Resized to hold the indices found.
+         * @param[in] aPool Pool to run on, or null for
+         *   ThreadPool::getDefault().
+         */
+        void findOverlapping(const JulianDate* aStarts,
+                             const JulianDate* anEnds,
+                             std::size_t aCount,
+                             std::vector<std::size_t>& anOffsets,
+                             std::vector<std::size_t>& anIds,
+                             ThreadPool* aPool = nullptr) const;
+
+    private:
+        /// One interval, at its place in the implicit tree
+        struct Node
+        {
+            /// Start of the interval
+            std::int64_t start;
+
+            /// End of the interval, exclusive
+            std::int64_t end;
+
+            /// Latest end of this node and the nodes below it
+            std::int64_t maxEnd;
+
+            /// Index of the interval in the input arrays
+            std::size_t id;
+        };
+
+        /// Sorts the non-empty intervals and fills in maxEnd.
+        void build(const std::int64_t* aStarts,
+                   const std::int64_t* anEnds,
+                   std::size_t aCount,
+                   ThreadPool* aPool);
+
+        /**
+         * Calls aVisitor(id) for every interval with start <= aLastStart
+         * and end > aTime, in order of start.
+         */
+        template <typename Visitor>
+        void visit(std::int64_t aTime,
+                   std::int64_t aLastStart,
+                   Visitor& aVisitor) const;
+
+        /// Intervals sorted by start
+        std::vector<Node> theNodes;
+
+        /// Level of the root of the implicit tree, or -1 when empty
+        int theRootLevel;
+};
+
+} // end namespace SPA
+
+#endif /* INC_INTERVALINDEX_H_ */
@@ -18,6 +18,10 @@
 #ifndef SPA_JULIANDATE_H_
 #define SPA_JULIANDATE_H_
 
+#include "SpaTimeConstants.h"
+
+#include <type_traits>
+
 namespace SPA
 {
 
@@ -35,6 +39,31 @@ namespace SPA
  * @defgroup group_time Time
  *
  * @brief  Time-related sections from Practical Astronomy With Your Calculator
+ *
+ * @par Thread safety
+ * Every function in the TIME_UTIL namespace is reentrant: none keeps
+ * mutable static state, and each reads only its arguments and writes
+ * only its outputs. The batch functions additionally run on a
+ * ThreadPool, and may be called from several threads at once.
+ * JulianDate, DateAndTime, SpaDate, SpaTime and TimeDifference are
+ * plain values: distinct objects may be used from different threads
+ * freely, and one object may be read from several threads at once,
+ * provided none is modifying it. The ostream operators make a single
+ * insertion into the stream they are given and leave its format flags
+ * unchanged; as for any std::ostream, a stream shared between threads
+ * needs the caller's own synchronization. The spa_thread_stress_test
+ * program checks all of this under ThreadSanitizer.
+ *
+ * @par Value types
+ * JulianDate, DateAndTime, SpaDate, SpaTime, SerialDate and TimeOfDay
+ * have no virtual functions. Each header checks with static_assert
+ * that its class is trivially copyable, standard layout and holds
+ * only its members, so arrays of them may be copied with memcpy,
+ * written to a file, and memory-mapped back as they are on a machine
+ * with the same ABI. DateAndTime is 40 bytes on x86-64 but 36 on
+ * i386, and on x86-64 its four padding bytes are never initialised;
+ * clear the buffer first if a file must not carry stale memory. None
+ * of them is meant to be used as a base class.
  */
 
 // Forward declarations
@@ -138,9 +167,6 @@ class JulianDate
          */
         JulianDate operator+(const TimeDifference& aTimeDifference);
 
-        /// Destructor
-        virtual ~JulianDate() = default;
-
         /**
          * Returns Julian date as 64-bit floating point decimal days since the
          *   start of the Julian Period
@@ -159,7 +185,10 @@ class JulianDate
          *
          * @return The Modified Julian Date
          */
-        double getModifiedJulianDate() const;
+        double getModifiedJulianDate() const
+        {
+            return theJulianDays - SPA_MJD_EPOCH;
+        }
 
         /**
          * @brief Returns the DataAndTime associated with this JulianDate.
@@ -188,7 +217,9 @@ class JulianDate
          *
          * @param[in] aDateAndTime Input DateAndTime. If the input date is less than
          *  1582-10-15 this function assumes that the date must be in the Julian
-         *  Calendar.
+         *  Calendar. This is CALENDAR_UTIL::calculateJulianDays() with the
+         *  HistoricalCalendar policy, see CalendarPolicy.h for the
+         *  proleptic calendars.
          * @return The julian date as a double
          */
         double convertDateAndTimeToJulianDate(const SPA::DateAndTime& aDateAndTime);
@@ -197,6 +228,13 @@ class JulianDate
         double theJulianDays;
 };
 
+static_assert(std::is_trivially_copyable<JulianDate>::value,
+              "JulianDate must be trivially copyable");
+static_assert(std::is_standard_layout<JulianDate>::value,
+              "JulianDate must be standard layout");
+static_assert(sizeof(JulianDate) == 8,
+              "JulianDate must be 8 bytes (one double)");
+
 
 /**
  * @brief Difference operator for two JulianDates
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file KeplerUtilities.h
+ * @brief Declaration of Kepler's equation solvers in the KEPLER_UTIL namespace
+ * @ingroup group_orbits
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_KEPLERUTILITIES_H_
+#define INC_KEPLERUTILITIES_H_
+
+#include <cstddef>
+
+namespace SPA
+{
+
+/**
+ * @defgroup group_orbits Orbits
+ *
+ * @brief Orbit-related sections from Practical Astronomy With Your Calculator
+ *   shared by the Sun, the planets, comets and binary stars.
+ */
+
+namespace KEPLER_UTIL
+{
+
+/**
+ * @brief Number of Halley refinements applied to the elliptic starter.
+ * @ingroup group_orbits
+ *
+ * Markley's starter is accurate to about 5.0e-4 radians over the whole
+ * range 0 <= e < 1, the first Halley step reduces this to about
+ * 1.0e-11 and the second to double precision.
+ */
+constexpr int SPA_KEPLER_ELLIPTIC_REFINEMENTS = 2;
+
+/**
+ * @brief Number of Halley refinements applied to the hyperbolic starter.
+ * @ingroup group_orbits
+ *
+ * Tested to reach double precision for 1 < e < 30 and
+ * 1.0e-8 < |M| < 1.0e4.
+ */
+constexpr int SPA_KEPLER_HYPERBOLIC_REFINEMENTS = 3;
+
+/**
+ * @brief Solves Kepler's equation for an elliptic orbit.
+ * @ingroup group_orbits
+ *
+ * Finds the eccentric anomaly E satisfying E - e sin E = M, the problem
+ * that PAWYC Section 47 solves by open-ended Newton-Raphson iteration.
+ * Here the starting value is from Markley (1995, Celestial Mechanics 63,
+ * 101), followed by a fixed number of Halley steps, so the cost is the
+ * same for every input and there are no data-dependent branches.
+ *
+ * @param[in] aMeanAnomaly Mean anomaly M in radians, any magnitude.
+ * @param[in] anEccentricity Eccentricity e, 0 <= e < 1.
+ * @return Eccentric anomaly E in radians, in the same revolution as M.
+ */
+double solveKeplerElliptic(double aMeanAnomaly,
+                           double anEccentricity);
+
+/**
+ * @brief Solves Kepler's equation for a hyperbolic orbit.
+ * @ingroup group_orbits
+ *
+ * Finds the hyperbolic anomaly H satisfying e sinh H - H = M. The
+ * starting value is the smaller of the root of the cubic expansion
+ * (e - 1) H + e H^3 / 6 = M, good near perihelion, and
+ * ln(2|M|/e + 1.8), good far from it. Both over-estimate H where
+ * they are poor, so taking the minimum is safe.
+ *
+ * @param[in] aMeanAnomaly Hyperbolic mean anomaly M in radians.
+ * @param[in] anEccentricity Eccentricity e > 1.
+ * @return Hyperbolic anomaly H.
+ */
+double solveKeplerHyperbolic(double aMeanAnomaly,
+                             double anEccentricity);
+
+/**
+ * @brief Solves Barker's equation for a parabolic orbit.
+ * @ingroup group_orbits
+ *
+ * Finds s = tan(v/2) satisfying s^3 + 3 s = W, as in PAWYC Section 62,
+ * where W = 3 k (t - T) / (sqrt(2) q^1.5). PAWYC iterates; the cubic
+ * has a single real root with a closed form, used here.
+ *
+ * @param[in] aParabolicAnomaly W, dimensionless.
+ * @return s = tan(v/2), where v is the true anomaly.
+ */
+double solveBarkerEquation(double aParabolicAnomaly);
+
+/**
+ * @brief Converts an eccentric anomaly to a true anomaly.
+ * @ingroup group_orbits
+ *
+ * Uses tan(v/2) = sqrt((1+e)/(1-e)) tan(E/2), written with atan2 so
+ * that it is well conditioned at E = 180 degrees and as e approaches 1.
+ *
+ * @param[in] anEccentricAnomaly Eccentric anomaly E in radians.
+ * @param[in] anEccentricity Eccentricity e, 0 <= e < 1.
+ * @return True anomaly v in radians in the range (-2 pi, 2 pi], equal
+ *   to the true anomaly modulo 2 pi.
+ */
+double calculateEllipticTrueAnomaly(double anEccentricAnomaly,
+                                    double anEccentricity);
+
+/**
+ * @brief Converts a hyperbolic anomaly to a true anomaly.
+ * @ingroup group_orbits
+ *
+ * @param[in] aHyperbolicAnomaly Hyperbolic anomaly H.
+ * @param[in] anEccentricity Eccentricity e > 1.
+ * @return True anomaly v in radians.
+ */
+double calculateHyperbolicTrueAnomaly(double aHyperbolicAnomaly,
+                                      double anEccentricity);
+
+/**
+ * @brief Solves Kepler's elliptic equation for an array of mean anomalies
+ *   sharing one eccentricity, e.g. one body at many epochs.
+ * @ingroup group_orbits
+ *
+ * Each element gives the same result as solveKeplerElliptic(). The
+ * loop has a fixed trip count per element and no branches.
+ *
+ * @param[in] aMeanAnomalies Pointer to aCount mean anomalies, radians.
+ * @param[in] aCount Number of elements.
+ * @param[in] anEccentricity Eccentricity shared by all elements.
+ * @param[out] anEccentricAnomalies Pointer to aCount outputs, radians.
+ *   May be the same array as aMeanAnomalies.
+ */
+void solveKeplerElliptic(const double* aMeanAnomalies,
+                         std::size_t aCount,
+                         double anEccentricity,
+                         double* anEccentricAnomalies);
+
+/**
+ * @brief Solves Kepler's elliptic equation for arrays of mean anomalies
+ *   and eccentricities, e.g. many bodies at one epoch.
+ * @ingroup group_orbits
+ *
+ * @param[in] aMeanAnomalies Pointer to aCount mean anomalies, radians.
+ * @param[in] anEccentricities Pointer to aCount eccentricities.
+ * @param[in] aCount Number of elements.
+ * @param[out] anEccentricAnomalies Pointer to aCount outputs, radians.
+ *   May be the same array as aMeanAnomalies.
+ */
+void solveKeplerElliptic(const double* aMeanAnomalies,
+                         const double* anEccentricities,
+                         std::size_t aCount,
+                         double* anEccentricAnomalies);
+
+/**
+ * @brief Solves Kepler's hyperbolic equation for arrays of mean anomalies
+ *   and eccentricities.
+ * @ingroup group_orbits
+ *
+ * @param[in] aMeanAnomalies Pointer to aCount mean anomalies.
+ * @param[in] anEccentricities Pointer to aCount eccentricities.
+ * @param[in] aCount Number of elements.
+ * @param[out] aHyperbolicAnomalies Pointer to aCount outputs.
+ */
+void solveKeplerHyperbolic(const double* aMeanAnomalies,
+                           const double* anEccentricities,
+                           std::size_t aCount,
+                           double* aHyperbolicAnomalies);
+
+/**
+ * @brief Solves Barker's equation for an array of parabolic anomalies.
+ * @ingroup group_orbits
+ *
+ * @param[in] aParabolicAnomalies Pointer to aCount values of W.
+ * @param[in] aCount Number of elements.
+ * @param[out] aTanHalfTrueAnomalies Pointer to aCount values of tan(v/2).
+ */
+void solveBarkerEquation(const double* aParabolicAnomalies,
+                         std::size_t aCount,
+                         double* aTanHalfTrueAnomalies);
+
+} // end namespace KEPLER_UTIL
+} // end namespace SPA
+
+#endif /* INC_KEPLERUTILITIES_H_ */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarPhaseGenerator.h
+ * @brief Declaration of the LunarPhaseGenerator class
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_LUNARPHASEGENERATOR_H_
+#define INC_LUNARPHASEGENERATOR_H_
+
+#include "LunarPhaseUtilities.h"
+
+namespace SPA
+{
+
+/**
+ * @brief Produces the principal phases of the Moon in a range one at
+ *   a time, on demand.
+ * @ingroup group_moon
+ *
+ * The generator holds only the next quarter-lunation number and the
+ * end of the range, so it can walk any number of millennia in constant
+ * memory, and several generators can be interleaved (for example when
+ * merging event streams into a calendar).
+ *
+ * @code
+ * SPA::LunarPhaseGenerator phases(start, end);
+ * SPA::LunarPhaseEvent event;
+ * while (phases.next(event))
+ * {
+ *     ...
+ * }
+ * @endcode
+ */
+class LunarPhaseGenerator
+{
+    public:
+        /**
+         * Constructor.
+         * @param[in] aStart Start of the range.
+         * @param[in] anEnd End of the range.
+         */
+        LunarPhaseGenerator(const JulianDate& aStart,
+                            const JulianDate& anEnd);
+
+        /// Default destructor
+        virtual ~LunarPhaseGenerator() = default;
+
+        /**
+         * Produces the next phase in the range.
+         * @param[out] anEvent The next phase, if there is one.
+         * @return False, leaving anEvent unchanged, once the range is
+         *   exhausted.
+         */
+        bool next(LunarPhaseEvent& anEvent);
+
+    private:
+        /// Quarter-lunation number of the next phase to refine
+        long theNextQuarterLunation;
+
+        /// Start of the range, decimal Julian Days
+        double theStartJulianDays;
+
+        /// End of the range, decimal Julian Days
+        double theEndJulianDays;
+};
+
+} // end namespace SPA
+
+#endif /* INC_LUNARPHASEGENERATOR_H_ */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarPhaseUtilities.h
+ * @brief Functions finding the times of new Moon, first quarter, full
+ *   Moon and last quarter
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_LUNARPHASEUTILITIES_H_
+#define INC_LUNARPHASEUTILITIES_H_
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief The four principal phases of the Moon.
+ * @ingroup group_moon
+ *
+ * The underlying values are the number of quarter lunations since new
+ * Moon.
+ */
+enum class LunarPhaseType
+{
+    NewMoon,
+    FirstQuarter,
+    FullMoon,
+    LastQuarter
+};
+
+/**
+ * @brief A single principal phase of the Moon.
+ * @ingroup group_moon
+ */
+struct LunarPhaseEvent
+{
+    /// Time of the phase, decimal Julian Days
+    double julianDays;
+
+    /// Which phase this is
+    LunarPhaseType type;
+};
+
+/**
+ * @brief Function receiving lunar phase events one at a time. Return
+ *   false to stop the search early.
+ * @ingroup group_moon
+ */
+using LunarPhaseCallback = std::function<bool(const LunarPhaseEvent&)>;
+
+namespace LUNARPHASE_UTIL
+{
+
+/**
+ * @brief Calculates the apparent elongation of the Moon from the Sun
+ *   in ecliptic longitude.
+ * @ingroup group_moon
+ *
+ * This is the age of Section 67, but evaluated with theories that hold
+ * over several thousand years: the complete LunarSeries for the Moon,
+ * and the Sun's geometric longitude with secular terms (Meeus,
+ * Astronomical Algorithms, Chapter 25) corrected for aberration.
+ *
+ * @param[in] aJulianDays Time in decimal Julian Days.
+ * @return The elongation in degrees in the range [0, 360): 0 at new
+ *   Moon, 90 at first quarter, 180 at full Moon, 270 at last quarter.
+ */
+double calculateLunarPhaseAngle(double aJulianDays);
+
+/**
+ * @brief Finds the time of the principal phase nearest to a mean phase.
+ * @ingroup group_moon
+ *
+ * The mean phase time follows from the mean synodic month. The true
+ * time is refined from it by the secant method on
+ * calculateLunarPhaseAngle() until successive estimates agree to
+ * SPA_MOON_PHASE_TOLERANCE_DAYS.
+ *
+ * @param[in] aQuarterLunation Number of quarter lunations since the
+ *   new Moon of 2000 January 6; its remainder modulo 4 selects the
+ *   phase.
+ * @return The phase event.
+ */
+LunarPhaseEvent calculateLunarPhase(long aQuarterLunation);
+
+/**
+ * @brief Streams every principal phase of the Moon between two epochs
+ *   to a callback, in time order.
+ * @ingroup group_moon
+ *
+ * The search steps a quarter of a mean lunation at a time and refines
+ * each phase with calculateLunarPhase(), so there is no daily scan and
+ * memory use does not depend on the length of the range.
+ *
+ * @param[in] aStart Start of the range.
+ * @param[in] anEnd End of the range.
+ * @param[in] aCallback Called once per phase with aStart <= time <= anEnd.
+ * @return The number of events passed to aCallback.
+ */
+std::size_t findLunarPhases(const JulianDate& aStart,
+                            const JulianDate& anEnd,
+                            const LunarPhaseCallback& aCallback);
+
+/**
+ * @brief Finds every principal phase of the Moon between two epochs.
+ * @ingroup group_moon
+ *
+ * @param[in] aStart Start of the range.
+ * @param[in] anEnd End of the range.
+ * @param[out] anEvents The events in time order. Existing contents are
+ *   replaced.
+ */
+void findLunarPhases(const JulianDate& aStart,
+                     const JulianDate& anEnd,
+                     std::vector<LunarPhaseEvent>& anEvents);
+
+} // end namespace LUNARPHASE_UTIL
+} // end namespace SPA
+
+/**
+ * Ostream operator for LunarPhaseType enumeration.
+ * @ingroup group_moon
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aType A lunar phase type.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::LunarPhaseType& aType);
+
+#endif /* INC_LUNARPHASEUTILITIES_H_ */
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarSeries.h
+ * @brief Declaration of the LunarSeries class
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_LUNARSERIES_H_
+#define INC_LUNARSERIES_H_
+
+#include "MoonUtilities.h"
+#include "SpaMoonConstants.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief A truncated trigonometric series for the position of the
+ *   Moon, for screening work that needs very many positions.
+ * @ingroup group_moon
+ *
+ * Uses the principal periodic terms of the ELP-2000 main problem, as
+ * tabulated by Meeus (Astronomical Algorithms, Chapter 47), in the
+ * Delaunay arguments D, M, M' and F. The constructor sorts the terms by
+ * size and keeps the requested number, storing for each the integer
+ * multiplier of each argument. Evaluation then takes the sine and
+ * cosine of the four arguments once, builds their small multiples with
+ * the Chebyshev recurrence
+ * \f[
+ * \cos kx = 2\cos x\cos(k-1)x - \cos(k-2)x
+ * \f]
+ * and forms every term's sine and cosine by angle addition, so there
+ * are four trigonometric calls per epoch whatever the truncation.
+ *
+ * When every term is kept the small additive terms due to Venus,
+ * Jupiter and the Earth's flattening are included as well, and the
+ * result agrees with Meeus to about 0.001 degrees. Like the rest of
+ * SPA, times are used as given; the difference between UT and
+ * dynamical time (about a minute, or 0.01 degrees of lunar motion) is
+ * ignored.
+ */
+class LunarSeries
+{
+    public:
+        /**
+         * Constructor.
+         *
+         * @param[in] aNumTerms Maximum number of terms to keep in each
+         *   of the longitude/distance and latitude series.
+         */
+        explicit LunarSeries(std::size_t aNumTerms = SPA_MOON_SERIES_DEFAULT_TERMS);
+
+        /// Default destructor
+        virtual ~LunarSeries() = default;
+
+        /**
+         * Calculates the position of the Moon at a given time.
+         *
+         * Distance-derived quantities use the Section 69 scaling of
+         * SPA_MOON_ANGULAR_DIAMETER_AT_A and SPA_MOON_PARALLAX_AT_A.
+         *
+         * @param[in] aJulianDays Time in decimal Julian Days.
+         * @return The position of the Moon.
+         */
+        MoonPosition calculatePosition(double aJulianDays) const;
+
+        /**
+         * Calculates the position of the Moon at a given time.
+         * @param[in] aJulianDate Time, UT.
+         * @return The position of the Moon.
+         */
+        MoonPosition calculatePosition(const JulianDate& aJulianDate) const;
+
+        /**
+         * Calculates the position of the Moon at each of an array of
+         * times. Results are identical to calculatePosition().
+         *
+         * @param[in] aJulianDays Pointer to aCount times in decimal Julian Days.
+         * @param[in] aCount Number of times.
+         * @param[out] aPositions Output positions, resized to aCount.
+         */
+        void calculatePositions(const double* aJulianDays,
+                                std::size_t aCount,
+                                MoonPositionArrays& aPositions) const;
+
+        /// @return Number of terms kept in the longitude/distance series.
+        std::size_t getNumLongitudeTerms() const
+        {
+            return theLongitudeTerms.size();
+        }
+
+        /// @return Number of terms kept in the latitude series.
+        std::size_t getNumLatitudeTerms() const
+        {
+            return theLatitudeTerms.size();
+        }
+
+    private:
+        /// One periodic term with its argument multipliers
+        struct Term
+        {
+            /// Multipliers of D, M, M' and F
+            std::int8_t multiplier[4];
+
+            /// Sine amplitude, degrees
+            double sineAmplitude;
+
+            /// Cosine amplitude, kilometres (longitude series only)
+            double cosineAmplitude;
+        };
+
+        /// Longitude (sine) and distance (cosine) terms
+        std::vector<Term> theLongitudeTerms;
+
+        /// Latitude (sine) terms
+        std::vector<Term> theLatitudeTerms;
+
+        /// True if every term, and the additive terms, are kept
+        bool theIsComplete;
+};
+
+} // end namespace SPA
+
+#endif /* INC_LUNARSERIES_H_ */
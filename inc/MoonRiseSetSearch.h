@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MoonRiseSetSearch.h
+ * @brief Declaration of the MoonRiseSetSearch class
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_MOONRISESETSEARCH_H_
+#define INC_MOONRISESETSEARCH_H_
+
+#include "RiseSetUtilities.h"
+
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief Incremental moonrise and moonset search for one site.
+ * @ingroup group_moon
+ *
+ * The search remembers the last track entry it has seen, with the
+ * site-specific altitude function there. Successive calls to
+ * process() with consecutive pieces of track (for example one day at a
+ * time, as a live display would) therefore continue from where the
+ * previous call stopped: an event falling between the last entry of
+ * one piece and the first entry of the next is still found, and no
+ * entry is evaluated twice.
+ */
+class MoonRiseSetSearch
+{
+    public:
+        /**
+         * Constructor.
+         * @param[in] aSite Observer's geographical coordinates.
+         */
+        explicit MoonRiseSetSearch(const GeographicCoordinates& aSite);
+
+        /// Default destructor
+        virtual ~MoonRiseSetSearch() = default;
+
+        /**
+         * Processes every entry of a track later than the last entry
+         * already seen, appending any events found.
+         *
+         * @param[in] aTrack Lunar track from RISESET_UTIL::calculateMoonTrack().
+         * @param[in,out] anEvents Events found are appended in time order.
+         */
+        void process(const MoonTrack& aTrack,
+                     std::vector<LunarEvent>& anEvents);
+
+        /**
+         * Forgets the last entry seen, so the next call to process()
+         * starts afresh.
+         */
+        void reset();
+
+        /// @return The observer's geographical coordinates.
+        const GeographicCoordinates& getSite() const
+        {
+            return theSite;
+        }
+
+    private:
+        /// One track entry as seen from this site
+        struct Sample
+        {
+            /// Time, decimal Julian Days
+            double julianDays;
+
+            /// Local hour angle, radians, unwrapped
+            double hourAngle;
+
+            /// Declination, radians
+            double declination;
+
+            /// Sine of the rise altitude
+            double sinRiseAltitude;
+
+            /// Sine of the altitude minus sinRiseAltitude
+            double offset;
+        };
+
+        /**
+         * Altitude function at a time between two samples, using
+         * linear interpolation of the sampled quantities.
+         */
+        double interpolatedOffset(const Sample& aLower,
+                                  const Sample& anUpper,
+                                  double aJulianDays) const;
+
+        /// Observer's geographical coordinates
+        GeographicCoordinates theSite;
+
+        /// Sine of the latitude
+        double theSinLatitude;
+
+        /// Cosine of the latitude
+        double theCosLatitude;
+
+        /// Longitude in radians, east positive
+        double theLongitude;
+
+        /// The last entry seen
+        Sample thePrevious;
+
+        /// False until the first entry has been seen
+        bool theHasPrevious;
+};
+
+} // end namespace SPA
+
+#endif /* INC_MOONRISESETSEARCH_H_ */
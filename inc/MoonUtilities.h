@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MoonUtilities.h
+ * @brief Functions implementing PAWYC Sections 65 to 69, the position,
+ *   motion, phase and distance of the Moon
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_MOONUTILITIES_H_
+#define INC_MOONUTILITIES_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @defgroup group_moon The Moon
+ *
+ * @brief Moon-related sections from Practical Astronomy With Your
+ *   Calculator
+ */
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief The geocentric position of the Moon at a single epoch.
+ * @ingroup group_moon
+ *
+ * Ecliptic coordinates are referred to the mean equinox of date.
+ */
+struct MoonPosition
+{
+    /// Ecliptic longitude, degrees in the range [0, 360)
+    double eclipticLongitude;
+
+    /// Ecliptic latitude, degrees
+    double eclipticLatitude;
+
+    /// Distance from the centre of the Earth, kilometres
+    double distance;
+
+    /// Angular diameter, degrees
+    double angularSize;
+
+    /// Horizontal parallax, degrees
+    double horizontalParallax;
+};
+
+/**
+ * @brief The position of the Moon at many epochs, stored as a
+ *   structure of arrays.
+ * @ingroup group_moon
+ *
+ * Element i of every array refers to the same epoch.
+ */
+struct MoonPositionArrays
+{
+    /// Ecliptic longitude, degrees in the range [0, 360)
+    std::vector<double> eclipticLongitude;
+
+    /// Ecliptic latitude, degrees
+    std::vector<double> eclipticLatitude;
+
+    /// Distance from the centre of the Earth, kilometres
+    std::vector<double> distance;
+
+    /// Angular diameter, degrees
+    std::vector<double> angularSize;
+
+    /// Horizontal parallax, degrees
+    std::vector<double> horizontalParallax;
+
+    /**
+     * Resizes every array to the given number of epochs.
+     * @param[in] aSize Number of epochs.
+     */
+    void resize(std::size_t aSize);
+
+    /**
+     * Returns the number of epochs held.
+     * @return The number of epochs held.
+     */
+    std::size_t size() const
+    {
+        return eclipticLongitude.size();
+    }
+
+    /**
+     * Returns the values for one epoch as a MoonPosition.
+     * @param[in] anIndex Index of the epoch, less than size().
+     * @return The position of the Moon at that epoch.
+     */
+    MoonPosition at(std::size_t anIndex) const;
+};
+
+/**
+ * @brief The rate of change of the Moon's ecliptic coordinates.
+ * @ingroup group_moon
+ */
+struct MoonHourlyMotion
+{
+    /// Motion in ecliptic longitude, degrees per hour
+    double longitude;
+
+    /// Motion in ecliptic latitude, degrees per hour
+    double latitude;
+};
+
+namespace MOON_UTIL
+{
+
+/**
+ * @brief Calculates the position of the Moon at a given epoch.
+ * @ingroup group_moon
+ *
+ * Implements Section 65 (longitude and latitude, correcting the mean
+ * motion for the evection, equation of the centre, annual equation and
+ * variation) and Section 69 (distance, angular size and horizontal
+ * parallax).
+ *
+ * @limitations Compared with the ELP-2000 main problem the errors
+ *   reach about 0.2 degrees in longitude and latitude and 7000 km in
+ *   distance. LunarSeries is both faster and more accurate for bulk
+ *   work.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return The position of the Moon.
+ */
+MoonPosition calculateMoonPosition(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position of the Moon at each of an array of
+ *   epochs.
+ * @ingroup group_moon
+ *
+ * Results are identical to calling calculateMoonPosition() for each
+ * epoch. The Sun's position is found for the whole array first using
+ * SUN_UTIL::calculateSunPositions().
+ *
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to aCount.
+ */
+void calculateMoonPositions(const double* aJulianDays,
+                            std::size_t aCount,
+                            MoonPositionArrays& aPositions);
+
+/**
+ * @brief Calculates the Moon's hourly motions in ecliptic longitude and
+ *   latitude.
+ * @ingroup group_moon
+ *
+ * Implements Section 66 by differencing calculateMoonPosition() half a
+ * SPA_MOON_HOURLY_MOTION_STEP_DAYS either side of the epoch.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return The hourly motions.
+ */
+MoonHourlyMotion calculateMoonHourlyMotion(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the age of the Moon, its ecliptic longitude minus
+ *   that of the Sun.
+ * @ingroup group_moon
+ *
+ * The age is 0 at new Moon, 90 at first quarter, 180 at full Moon and
+ * 270 at last quarter.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return Age in degrees in the range [0, 360).
+ */
+double calculateMoonAge(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the phase of the Moon, the fraction of its disk
+ *   that is illuminated.
+ * @ingroup group_moon
+ *
+ * Implements Section 67, F = (1 - cos d) / 2, where d is the age.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return The phase in the range [0, 1].
+ */
+double calculateMoonPhase(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position-angle of the Moon's bright limb.
+ * @ingroup group_moon
+ *
+ * Implements Section 68. The angle is measured from the north point of
+ * the disk towards the east.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return Position angle in degrees in the range [0, 360).
+ */
+double calculateMoonBrightLimbAngle(const JulianDate& aJulianDate);
+
+} // end namespace MOON_UTIL
+} // end namespace SPA
+
+#endif /* INC_MOONUTILITIES_H_ */
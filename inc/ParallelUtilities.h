@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ParallelUtilities.h
+ * @brief Declaration of parallel loop helpers in the PARALLEL_UTIL
+ *   namespace
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_PARALLELUTILITIES_H_
+#define INC_PARALLELUTILITIES_H_
+
+#include "ThreadPool.h"
+
+#include <cstddef>
+
+namespace SPA
+{
+namespace PARALLEL_UTIL
+{
+
+/**
+ * @brief Calls a function for every index in [0, aCount), spread over
+ *   the threads of a pool.
+ * @ingroup group_util
+ *
+ * Results are the same for any number of threads provided aFunction(i)
+ * writes only to element i of its outputs.
+ *
+ * @param[in] aCount Number of indices.
+ * @param[in] aFunction Function called as aFunction(i).
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ * @param[in] aChunkSize Indices per task, or 0 to use
+ *   ThreadPool::chooseChunkSize().
+ */
+template <typename Function>
+void parallelFor(std::size_t aCount,
+                 const Function& aFunction,
+                 ThreadPool* aPool = nullptr,
+                 std::size_t aChunkSize = 0)
+{
+    ThreadPool& pool = (aPool != nullptr) ? *aPool : ThreadPool::getDefault();
+    pool.run(aCount,
+             aChunkSize,
+             [&aFunction](std::size_t aBegin, std::size_t anEnd)
+             {
+                 for (std::size_t i = aBegin; i < anEnd; i++)
+                 {
+                     aFunction(i);
+                 }
+             });
+}
+
+/**
+ * @brief Applies a function to every element of an array, spread over
+ *   the threads of a pool.
+ * @ingroup group_util
+ *
+ * Sets anOutput[i] = aFunction(anInput[i]). Results are the same for
+ * any number of threads.
+ *
+ * @param[in] anInput Pointer to aCount input elements.
+ * @param[in] aCount Number of elements.
+ * @param[out] anOutput Pointer to aCount output elements. May equal
+ *   anInput when the types agree.
+ * @param[in] aFunction Function of one input element.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ * @param[in] aChunkSize Elements per task, or 0 to use
+ *   ThreadPool::chooseChunkSize().
+ */
+template <typename Input, typename Output, typename Function>
+void parallelTransform(const Input* anInput,
+                       std::size_t aCount,
+                       Output* anOutput,
+                       const Function& aFunction,
+                       ThreadPool* aPool = nullptr,
+                       std::size_t aChunkSize = 0)
+{
+    ThreadPool& pool = (aPool != nullptr) ? *aPool : ThreadPool::getDefault();
+    pool.run(aCount,
+             aChunkSize,
+             [anInput, anOutput, &aFunction](std::size_t aBegin, std::size_t anEnd)
+             {
+                 for (std::size_t i = aBegin; i < anEnd; i++)
+                 {
+                     anOutput[i] = aFunction(anInput[i]);
+                 }
+             });
+}
+
+} // end namespace PARALLEL_UTIL
+} // end namespace SPA
+
+#endif /* INC_PARALLELUTILITIES_H_ */
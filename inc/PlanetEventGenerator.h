@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetEventGenerator.h
+ * @brief Declaration of the PlanetEventGenerator class
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_PLANETEVENTGENERATOR_H_
+#define INC_PLANETEVENTGENERATOR_H_
+
+#include "SpaPlanetConstants.h"
+
+#include <iosfwd>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief Types of planetary event found by PlanetEventGenerator.
+ * @ingroup group_planets
+ */
+enum class PlanetEventType
+{
+    Conjunction,
+    Opposition
+};
+
+/**
+ * @brief A conjunction or opposition of a planet with the Sun.
+ * @ingroup group_planets
+ */
+struct PlanetEvent
+{
+    /// Time of the event, decimal Julian Days
+    double julianDays;
+
+    /// The planet
+    Planets planet;
+
+    /// Conjunction or opposition
+    PlanetEventType type;
+};
+
+/**
+ * @brief Produces the conjunctions and oppositions of one planet with
+ *   the Sun in a range one at a time, on demand.
+ * @ingroup group_planets
+ *
+ * An event is a time at which the geocentric ecliptic longitude of the
+ * planet from PLANET_UTIL::calculatePlanetPosition() equals that of the
+ * Sun (conjunction) or differs from it by 180 degrees (opposition).
+ * The sine of the difference is sampled every
+ * SPA_PLANET_EVENT_STEP_DAYS, and each change of sign is refined by
+ * bisection to SPA_PLANET_EVENT_TOLERANCE_DAYS. Both inferior and
+ * superior conjunctions of Mercury and Venus are reported as
+ * conjunctions. The generator holds only the last sample, so it walks
+ * any span in constant memory.
+ *
+ * @limitations Accuracy is that of calculatePlanetPosition(): times are
+ *   good to a few hours for the inner planets, but may be a day or more
+ *   out for Jupiter and Saturn. Passing EARTH gives no events.
+ */
+class PlanetEventGenerator
+{
+    public:
+        /**
+         * Constructor.
+         * @param[in] aPlanet The planet.
+         * @param[in] aStart Start of the range.
+         * @param[in] anEnd End of the range.
+         */
+        PlanetEventGenerator(Planets aPlanet,
+                             const JulianDate& aStart,
+                             const JulianDate& anEnd);
+
+        /// Default destructor
+        virtual ~PlanetEventGenerator() = default;
+
+        /**
+         * Produces the next event in the range.
+         * @param[out] anEvent The next event, if there is one.
+         * @return False, leaving anEvent unchanged, once the range is
+         *   exhausted.
+         */
+        bool next(PlanetEvent& anEvent);
+
+    private:
+        /**
+         * Sine and cosine of the planet's elongation in longitude.
+         * @param[in] aJulianDays Epoch, decimal Julian Days.
+         * @param[out] aSine Sine of the planet's longitude minus the Sun's.
+         * @param[out] aCosine Cosine of the same.
+         */
+        void calculateElongation(double aJulianDays,
+                                 double& aSine,
+                                 double& aCosine) const;
+
+        /// The planet
+        Planets thePlanet;
+
+        /// Time of the last sample, decimal Julian Days
+        double theSampleJulianDays;
+
+        /// Sine of the elongation at the last sample
+        double theSampleSine;
+
+        /// End of the range, decimal Julian Days
+        double theEndJulianDays;
+};
+
+} // end namespace SPA
+
+/**
+ * Ostream operator for PlanetEventType enumeration.
+ * @ingroup group_planets
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aType A planetary event type.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::PlanetEventType& aType);
+
+#endif /* INC_PLANETEVENTGENERATOR_H_ */
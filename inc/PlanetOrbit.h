@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetOrbit.h
+ * @brief Declaration of the cached planetary orbit class PlanetOrbit
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_PLANETORBIT_H_
+#define INC_PLANETORBIT_H_
+
+#include "SpaPlanetConstants.h"
+
+#include <cstddef>
+
+namespace SPA
+{
+
+/**
+ * @brief A heliocentric elliptical orbit with every quantity that
+ *   depends only on the orbital elements precomputed.
+ * @ingroup group_planets
+ *
+ * The orientation of the orbit (node, inclination and argument of
+ * perihelion) is folded into the two unit vectors P and Q, pointing to
+ * perihelion and 90 degrees ahead of it in the orbital plane. The
+ * heliocentric ecliptic position is then
+ * \f[
+ * \vec{r} = a(\cos E - e)\vec{P} + b \sin E \vec{Q}
+ * \f]
+ * so that after solving Kepler's equation no further trigonometry is
+ * needed. This is equivalent to steps 5 to 12 of PAWYC Section 54.
+ */
+class PlanetOrbit
+{
+    public:
+        /// Default constructor, a circular orbit of radius 1 AU in the ecliptic.
+        PlanetOrbit();
+
+        /**
+         * Constructs the orbit from a set of mean orbital elements.
+         *
+         * @param[in] anElements Orbital elements with epoch
+         *   SPA_PLANET_EPOCH_1990.
+         */
+        explicit PlanetOrbit(const PlanetaryElements& anElements);
+
+        /// Default destructor
+        virtual ~PlanetOrbit() = default;
+
+        /**
+         * Calculates the heliocentric ecliptic rectangular coordinates
+         * of the planet at a given time.
+         *
+         * @param[in] aJulianDays Time in decimal Julian Days.
+         * @param[out] anX Coordinate towards the vernal equinox, AU.
+         * @param[out] aY Coordinate 90 degrees east along the ecliptic, AU.
+         * @param[out] aZ Coordinate towards the north ecliptic pole, AU.
+         */
+        void calculateHeliocentricPosition(double aJulianDays,
+                                           double& anX,
+                                           double& aY,
+                                           double& aZ) const;
+
+        /**
+         * Calculates the heliocentric ecliptic rectangular coordinates
+         * of the planet at each of an array of times.
+         *
+         * Gives the same results as calculateHeliocentricPosition(),
+         * but uses the batch Kepler solver.
+         *
+         * @param[in] aJulianDays Pointer to aCount times in decimal Julian Days.
+         * @param[in] aCount Number of times.
+         * @param[out] anX Pointer to aCount doubles, AU.
+         * @param[out] aY Pointer to aCount doubles, AU.
+         * @param[out] aZ Pointer to aCount doubles, AU.
+         */
+        void calculateHeliocentricPositions(const double* aJulianDays,
+                                            std::size_t aCount,
+                                            double* anX,
+                                            double* aY,
+                                            double* aZ) const;
+
+        /// @return The orbital elements this orbit was built from.
+        const PlanetaryElements& getElements() const
+        {
+            return theElements;
+        }
+
+    private:
+        /**
+         * Mean anomaly in radians at a given time.
+         * @param[in] aJulianDays Time in decimal Julian Days.
+         * @return The mean anomaly, not reduced to any range.
+         */
+        double calculateMeanAnomaly(double aJulianDays) const
+        {
+            return theMeanAnomalyAtEpoch + theDailyMotion * (aJulianDays - SPA_PLANET_EPOCH_1990);
+        }
+
+        /// The orbital elements
+        PlanetaryElements theElements;
+
+        /// Mean daily motion, radians per day
+        double theDailyMotion;
+
+        /// Mean anomaly at the epoch, radians
+        double theMeanAnomalyAtEpoch;
+
+        /// Semi-major axis, AU
+        double theSemiMajorAxis;
+
+        /// Semi-minor axis, AU
+        double theSemiMinorAxis;
+
+        /// Eccentricity
+        double theEccentricity;
+
+        /// Unit vector towards perihelion, ecliptic coordinates
+        double theP[3];
+
+        /// Unit vector 90 degrees ahead of perihelion in the orbital plane
+        double theQ[3];
+};
+
+} // end namespace SPA
+
+#endif /* INC_PLANETORBIT_H_ */
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetUtilities.h
+ * @brief Declaration of planet-related functions in the PLANET_UTIL
+ *   namespace
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_PLANETUTILITIES_H_
+#define INC_PLANETUTILITIES_H_
+
+#include "SpaPlanetConstants.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @defgroup group_planets The Planets
+ *
+ * @brief Planet-related sections from Practical Astronomy With Your
+ *   Calculator
+ */
+
+// Forward declarations
+class JulianDate;
+class PlanetOrbit;
+
+/**
+ * @brief The position of a planet at a single epoch.
+ * @ingroup group_planets
+ *
+ * Heliocentric quantities refer to the time the light now reaching the
+ * Earth left the planet. Geocentric ecliptic coordinates are geometric
+ * (no aberration or nutation), matching PAWYC.
+ */
+struct PlanetPosition
+{
+    /// Heliocentric ecliptic longitude, l, degrees in the range [0, 360)
+    double heliocentricLongitude;
+
+    /// Heliocentric ecliptic latitude, psi, degrees
+    double heliocentricLatitude;
+
+    /// Distance from the Sun, r, AU
+    double radiusVector;
+
+    /// Geocentric ecliptic longitude, lambda, degrees in the range [0, 360)
+    double eclipticLongitude;
+
+    /// Geocentric ecliptic latitude, beta, degrees
+    double eclipticLatitude;
+
+    /// Distance from the Earth, rho, AU
+    double distance;
+
+    /// Light travel time from the planet to the Earth, decimal days
+    double lightTime;
+
+    /// Angular diameter, arcseconds
+    double angularSize;
+};
+
+/**
+ * @brief Planetary positions stored as a structure of arrays.
+ * @ingroup group_planets
+ *
+ * Element i of every array refers to the same planet and epoch. For
+ * the single-planet interfaces i is the epoch index; for
+ * PLANET_UTIL::calculatePlanetPositionGrid() it is
+ * planetIndex * numEpochs + epochIndex.
+ */
+struct PlanetPositionArrays
+{
+    /// Heliocentric ecliptic longitude, degrees in the range [0, 360)
+    std::vector<double> heliocentricLongitude;
+
+    /// Heliocentric ecliptic latitude, degrees
+    std::vector<double> heliocentricLatitude;
+
+    /// Distance from the Sun, AU
+    std::vector<double> radiusVector;
+
+    /// Geocentric ecliptic longitude, degrees in the range [0, 360)
+    std::vector<double> eclipticLongitude;
+
+    /// Geocentric ecliptic latitude, degrees
+    std::vector<double> eclipticLatitude;
+
+    /// Distance from the Earth, AU
+    std::vector<double> distance;
+
+    /// Light travel time from the planet to the Earth, decimal days
+    std::vector<double> lightTime;
+
+    /// Angular diameter, arcseconds
+    std::vector<double> angularSize;
+
+    /**
+     * Resizes every array.
+     * @param[in] aSize Number of entries.
+     */
+    void resize(std::size_t aSize);
+
+    /**
+     * Returns the number of entries held.
+     * @return The number of entries held.
+     */
+    std::size_t size() const
+    {
+        return distance.size();
+    }
+
+    /**
+     * Returns the values for one entry as a PlanetPosition.
+     * @param[in] anIndex Index of the entry, less than size().
+     * @return The position of the planet.
+     */
+    PlanetPosition at(std::size_t anIndex) const;
+};
+
+namespace PLANET_UTIL
+{
+
+/**
+ * @brief Returns the cached orbit of a planet.
+ * @ingroup group_planets
+ *
+ * The orbits of all the planets are built from
+ * SPA_PLANETARY_ELEMENTS_1990 on first use and kept for the lifetime of
+ * the program.
+ *
+ * @param[in] aPlanet The planet.
+ * @return The planet's orbit.
+ */
+const PlanetOrbit& getPlanetOrbit(Planets aPlanet);
+
+/**
+ * @brief Calculates the position of a planet at a given epoch.
+ * @ingroup group_planets
+ *
+ * Implements Sections 54 and 57 of PAWYC, solving Kepler's equation
+ * rather than using the equation of the centre (Section 47), and
+ * forming the geocentric position from heliocentric rectangular
+ * coordinates rather than the separate inner- and outer-planet
+ * formulae, to which it is equivalent. The planet's position is
+ * corrected for light-time SPA_PLANET_LIGHT_TIME_ITERATIONS times.
+ *
+ * @limitations The perturbations of Section 56 are not applied, so
+ *   Jupiter and Saturn may be in error by up to a degree. Passing
+ *   EARTH gives its heliocentric position with the geocentric
+ *   quantities set to zero.
+ *
+ * @param[in] aPlanet The planet.
+ * @param[in] aJulianDate Epoch, UT.
+ * @return The position of the planet.
+ */
+PlanetPosition calculatePlanetPosition(Planets aPlanet,
+                                       const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position of a planet at each of an array of
+ *   epochs.
+ * @ingroup group_planets
+ *
+ * Results are identical to calling calculatePlanetPosition() for each
+ * epoch. Every light-time pass runs over the whole array at once.
+ *
+ * @param[in] aPlanet The planet.
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to aCount.
+ */
+void calculatePlanetPositions(Planets aPlanet,
+                              const double* aJulianDays,
+                              std::size_t aCount,
+                              PlanetPositionArrays& aPositions);
+
+/**
+ * @brief Calculates the positions of several planets at each of an
+ *   array of epochs.
+ * @ingroup group_planets
+ *
+ * The position of the Earth is calculated once per epoch and shared by
+ * every planet. Results are identical to calling
+ * calculatePlanetPosition() for each planet and epoch.
+ *
+ * @param[in] aPlanets Planets to calculate.
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to
+ *   aPlanets.size() * aCount and indexed planet-major.
+ */
+void calculatePlanetPositionGrid(const std::vector<Planets>& aPlanets,
+                                 const double* aJulianDays,
+                                 std::size_t aCount,
+                                 PlanetPositionArrays& aPositions);
+
+} // end namespace PLANET_UTIL
+} // end namespace SPA
+
+#endif /* INC_PLANETUTILITIES_H_ */
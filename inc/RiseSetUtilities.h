@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file RiseSetUtilities.h
+ * @brief Declaration of rising, setting and twilight functions in the
+ *   RISESET_UTIL namespace
+ * @ingroup group_sun
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_RISESETUTILITIES_H_
+#define INC_RISESETUTILITIES_H_
+
+#include "CoordinateUtilities.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief Types of event found by RISESET_UTIL::findSolarEvents().
+ * @ingroup group_sun
+ *
+ * Dawn events mark the Sun rising through the corresponding altitude,
+ * dusk events the Sun setting through it.
+ */
+enum class SolarEventType
+{
+    AstronomicalDawn,
+    NauticalDawn,
+    CivilDawn,
+    Sunrise,
+    Sunset,
+    CivilDusk,
+    NauticalDusk,
+    AstronomicalDusk
+};
+
+/**
+ * @brief A single rise, set or twilight event.
+ * @ingroup group_sun
+ */
+struct SolarEvent
+{
+    /// Time of the event, decimal Julian Days, UT
+    double julianDays;
+
+    /// Which event this is
+    SolarEventType type;
+};
+
+/**
+ * @brief The apparent path of the Sun across the sky, tabulated at
+ *   regular intervals.
+ * @ingroup group_sun
+ *
+ * The track depends only on time, not on the observer, so one track
+ * can be shared by every site for which events are wanted. Right
+ * ascension is unwrapped (it increases continuously past 2 pi) so that
+ * it can be linearly interpolated between entries.
+ */
+struct SunTrack
+{
+    /// Time of the first entry, decimal Julian Days, UT
+    double startJulianDays;
+
+    /// Spacing between entries, decimal days
+    double stepDays;
+
+    /// Right ascension of the Sun, radians, unwrapped
+    std::vector<double> rightAscension;
+
+    /// Declination of the Sun, radians
+    std::vector<double> declination;
+
+    /**
+     * Returns the number of entries in the track.
+     * @return The number of entries.
+     */
+    std::size_t size() const
+    {
+        return declination.size();
+    }
+};
+
+/**
+ * @brief Types of event found by RISESET_UTIL::findLunarEvents().
+ * @ingroup group_moon
+ */
+enum class LunarEventType
+{
+    Moonrise,
+    Moonset
+};
+
+/**
+ * @brief A single moonrise or moonset.
+ * @ingroup group_moon
+ */
+struct LunarEvent
+{
+    /// Time of the event, decimal Julian Days, UT
+    double julianDays;
+
+    /// Which event this is
+    LunarEventType type;
+};
+
+/**
+ * @brief The apparent path of the Moon across the sky, tabulated at
+ *   regular intervals.
+ * @ingroup group_moon
+ *
+ * Everything that depends only on time is stored, so that finding
+ * events for a site needs no lunar theory, sidereal time or
+ * obliquity. The Greenwich hour angle (Greenwich sidereal angle minus
+ * right ascension) is unwrapped so that it can be linearly
+ * interpolated; the local hour angle is then this plus the site's
+ * longitude.
+ */
+struct MoonTrack
+{
+    /// Time of the first entry, decimal Julian Days, UT
+    double startJulianDays;
+
+    /// Spacing between entries, decimal days
+    double stepDays;
+
+    /// Greenwich hour angle of the Moon, radians, unwrapped
+    std::vector<double> greenwichHourAngle;
+
+    /// Declination of the Moon, radians
+    std::vector<double> declination;
+
+    /**
+     * Sine of the geocentric altitude of the Moon's centre when its
+     * upper limb is on the horizon: horizontal parallax minus
+     * semi-diameter minus SPA_MOON_HORIZON_REFRACTION.
+     */
+    std::vector<double> sinRiseAltitude;
+
+    /**
+     * Returns the number of entries in the track.
+     * @return The number of entries.
+     */
+    std::size_t size() const
+    {
+        return declination.size();
+    }
+};
+
+namespace RISESET_UTIL
+{
+
+/**
+ * @brief Tabulates the equatorial coordinates of the Sun between two
+ *   epochs.
+ * @ingroup group_sun
+ *
+ * The solar theory of SUN_UTIL::calculateSunPositionSeries() is run
+ * once per entry; nothing downstream needs to run it again.
+ *
+ * @param[in] aStart First epoch, UT.
+ * @param[in] anEnd Last epoch, UT. The track is extended to the
+ *   first entry at or beyond anEnd.
+ * @param[in] aStepDays Spacing between entries in decimal days.
+ * @param[out] aTrack The tabulated track.
+ */
+void calculateSunTrack(const JulianDate& aStart,
+                       const JulianDate& anEnd,
+                       double aStepDays,
+                       SunTrack& aTrack);
+
+/**
+ * @brief Finds every sunrise, sunset and twilight event at a site
+ *   within the span of a precomputed solar track.
+ * @ingroup group_sun
+ *
+ * Implements Sections 49 and 50 of PAWYC, but instead of the
+ * once-per-day rising and setting formulae of Section 33 the altitude
+ * of the Sun is evaluated at every entry of the track and a sign change
+ * relative to each threshold altitude brackets an event. Each bracket
+ * is then refined by regula falsi (Illinois variant) on the altitude
+ * interpolated from the track, so the refinement never calls the solar
+ * theory. Days on which the Sun never reaches a threshold (e.g. polar
+ * day or night) simply contribute no events of that type.
+ *
+ * @limitations Two crossings of the same altitude within one step of
+ *   the track are missed. With the default hourly step this only
+ *   happens for grazing events close to the polar circles. Refraction
+ *   is the fixed PAWYC value.
+ *
+ * @param[in] aTrack Solar track from calculateSunTrack().
+ * @param[in] aSite Observer's geographical coordinates.
+ * @param[out] anEvents Events in time order. Any previous contents are
+ *   discarded.
+ */
+void findSolarEvents(const SunTrack& aTrack,
+                     const GeographicCoordinates& aSite,
+                     std::vector<SolarEvent>& anEvents);
+
+/**
+ * @brief Finds every sunrise, sunset and twilight event at a site
+ *   between two epochs.
+ * @ingroup group_sun
+ *
+ * Convenience wrapper that builds a track with the default step
+ * SPA_SUN_TRACK_STEP_DAYS. When events are wanted for many sites over
+ * the same dates, build the track once and call the other overload per
+ * site.
+ *
+ * @param[in] aSite Observer's geographical coordinates.
+ * @param[in] aStart Start of the search, UT.
+ * @param[in] anEnd End of the search, UT.
+ * @param[out] anEvents Events in time order between aStart and anEnd.
+ */
+void findSolarEvents(const GeographicCoordinates& aSite,
+                     const JulianDate& aStart,
+                     const JulianDate& anEnd,
+                     std::vector<SolarEvent>& anEvents);
+
+/**
+ * @brief Tabulates the hour angle, declination and rise altitude of
+ *   the Moon between two epochs.
+ * @ingroup group_moon
+ *
+ * The Moon's position comes from a LunarSeries with the default
+ * truncation, which is both faster and more accurate than the Section
+ * 65 method.
+ *
+ * @param[in] aStart First epoch, UT.
+ * @param[in] anEnd Last epoch, UT. The track is extended to the
+ *   first entry at or beyond anEnd.
+ * @param[in] aStepDays Spacing between entries in decimal days.
+ * @param[out] aTrack The tabulated track.
+ */
+void calculateMoonTrack(const JulianDate& aStart,
+                        const JulianDate& anEnd,
+                        double aStepDays,
+                        MoonTrack& aTrack);
+
+/**
+ * @brief Finds every moonrise and moonset at a site within the span of
+ *   a precomputed lunar track.
+ * @ingroup group_moon
+ *
+ * Implements Section 70 of PAWYC. Rather than solving each day from
+ * scratch the track is swept once by a MoonRiseSetSearch, which
+ * brackets each crossing of the rise altitude between consecutive
+ * entries and refines it by regula falsi on the interpolated track.
+ *
+ * @limitations Days without a moonrise or moonset (which happen about
+ *   once a month) simply have no event of that type. Two crossings
+ *   within one step of the track, possible only in grazing cases at
+ *   high latitude, are missed.
+ *
+ * @param[in] aTrack Lunar track from calculateMoonTrack().
+ * @param[in] aSite Observer's geographical coordinates.
+ * @param[out] anEvents Events in time order. Any previous contents are
+ *   discarded.
+ */
+void findLunarEvents(const MoonTrack& aTrack,
+                     const GeographicCoordinates& aSite,
+                     std::vector<LunarEvent>& anEvents);
+
+/**
+ * @brief Finds every moonrise and moonset at each of several sites
+ *   within the span of a precomputed lunar track.
+ * @ingroup group_moon
+ *
+ * The lunar theory runs once, when the track is built; each site then
+ * costs one pass over the track.
+ *
+ * @param[in] aTrack Lunar track from calculateMoonTrack().
+ * @param[in] aSites Observers' geographical coordinates.
+ * @param[out] anEvents Resized to match aSites; element i holds the
+ *   events for site i in time order.
+ */
+void findLunarEvents(const MoonTrack& aTrack,
+                     const std::vector<GeographicCoordinates>& aSites,
+                     std::vector<std::vector<LunarEvent>>& anEvents);
+
+/**
+ * @brief Finds every moonrise and moonset at a site between two
+ *   epochs.
+ * @ingroup group_moon
+ *
+ * Convenience wrapper that builds a track with the default step
+ * SPA_MOON_TRACK_STEP_DAYS.
+ *
+ * @param[in] aSite Observer's geographical coordinates.
+ * @param[in] aStart Start of the search, UT.
+ * @param[in] anEnd End of the search, UT.
+ * @param[out] anEvents Events in time order between aStart and anEnd.
+ */
+void findLunarEvents(const GeographicCoordinates& aSite,
+                     const JulianDate& aStart,
+                     const JulianDate& anEnd,
+                     std::vector<LunarEvent>& anEvents);
+
+} // end namespace RISESET_UTIL
+} // end namespace SPA
+
+/**
+ * Ostream operator for SolarEventType enumeration.
+ * @ingroup group_sun
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aType A solar event type.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::SolarEventType& aType);
+
+/**
+ * Ostream operator for LunarEventType enumeration.
+ * @ingroup group_moon
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aType A lunar event type.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::LunarEventType& aType);
+
+#endif /* INC_RISESETUTILITIES_H_ */
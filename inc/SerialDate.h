@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file SerialDate.h
+ * @brief Declaration of the SerialDate class.
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_SERIALDATE_H_
+#define INC_SERIALDATE_H_
+
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+
+namespace SPA
+{
+
+// Forward declarations
+class JulianDate;
+class SpaDate;
+
+/**
+ * @brief A calendar date packed into a signed 32-bit count of days
+ *   since 2000-01-01.
+ * @ingroup group_time
+ *
+ * Comparison, the difference between two dates and adding days are
+ * single integer operations, so a column of SerialDate sorts, joins
+ * and deduplicates as a column of int32_t. Conversion to and from
+ * year, month and day uses integer arithmetic only.
+ *
+ * As for JulianDate, dates from 1582-10-15 on are in the Gregorian
+ * calendar and earlier dates in the Julian calendar, so 1582-10-04 is
+ * the day before 1582-10-15. The count covers some five million years
+ * either side of the epoch.
+ */
+class SerialDate
+{
+    public:
+        /// Default constructor, 2000-01-01
+        SerialDate() : theDays(0)
+        {
+        }
+
+        /**
+         * Construct from a day count.
+         *
+         * @param[in] aDays Days since SPA_SERIAL_DATE_EPOCH (2000-01-01).
+         */
+        explicit SerialDate(std::int32_t aDays) : theDays(aDays)
+        {
+        }
+
+        /**
+         * Construct from year, month and day.
+         *
+         * @param[in] aYear Year, with 0 for 1 BC.
+         * @param[in] aMonth Month of the year, 1 to 12.
+         * @param[in] aDay Day of the month. Values outside the month
+         *   carry into the neighbouring months, so day 0 is the last
+         *   day of the previous month, as PAWYC uses for January 0.
+         */
+        SerialDate(int aYear,
+                   int aMonth,
+                   int aDay);
+
+        /**
+         * Construct from a SpaDate.
+         *
+         * @param[in] aSpaDate Date, as for the year, month and day
+         *   constructor.
+         */
+        explicit SerialDate(const SpaDate& aSpaDate);
+
+        /**
+         * Returns the day count.
+         * @return Days since SPA_SERIAL_DATE_EPOCH (2000-01-01).
+         */
+        std::int32_t getDays() const
+        {
+            return theDays;
+        }
+
+        /**
+         * Converts the day count back to a calendar date.
+         *
+         * @param[out] aYear Year, with 0 for 1 BC.
+         * @param[out] aMonth Month of the year, 1 to 12.
+         * @param[out] aDay Day of the month, from 1.
+         */
+        void getYearMonthDay(int& aYear,
+                             int& aMonth,
+                             int& aDay) const;
+
+        /**
+         * Returns the calendar date as a SpaDate.
+         */
+        SpaDate getSpaDate() const;
+
+        /**
+         * Returns the Julian Date at 0h UT on this date.
+         */
+        JulianDate getJulianDate() const;
+
+        /**
+         * Adds a number of days.
+         * @param[in] aDays Days to add, may be negative.
+         * @return This date.
+         */
+        SerialDate& operator+=(std::int32_t aDays)
+        {
+            theDays += aDays;
+            return *this;
+        }
+
+        /**
+         * Subtracts a number of days.
+         * @param[in] aDays Days to subtract, may be negative.
+         * @return This date.
+         */
+        SerialDate& operator-=(std::int32_t aDays)
+        {
+            theDays -= aDays;
+            return *this;
+        }
+
+    private:
+        /// Days since SPA_SERIAL_DATE_EPOCH
+        std::int32_t theDays;
+};
+
+static_assert(std::is_trivially_copyable<SerialDate>::value,
+              "SerialDate must be trivially copyable");
+static_assert(std::is_standard_layout<SerialDate>::value,
+              "SerialDate must be standard layout");
+static_assert(sizeof(SerialDate) == sizeof(std::int32_t),
+              "SerialDate must be a bare 32-bit day count");
+
+/**
+ * @brief Returns a date a number of days after another.
+ * @ingroup group_time
+ *
+ * @param[in] aDate Start date.
+ * @param[in] aDays Days to add, may be negative.
+ * @return The date aDays after aDate.
+ */
+inline SerialDate operator+(SerialDate aDate,
+                            std::int32_t aDays)
+{
+    return aDate += aDays;
+}
+
+/**
+ * @brief Returns a date a number of days before another.
+ * @ingroup group_time
+ *
+ * @param[in] aDate Start date.
+ * @param[in] aDays Days to subtract, may be negative.
+ * @return The date aDays before aDate.
+ */
+inline SerialDate operator-(SerialDate aDate,
+                            std::int32_t aDays)
+{
+    return aDate -= aDays;
+}
+
+/**
+ * @brief Returns the number of days between two dates.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS Later date.
+ * @param[in] aRHS Earlier date.
+ * @return Days from aRHS to aLHS, negative if aLHS is earlier.
+ */
+inline std::int32_t operator-(SerialDate aLHS,
+                              SerialDate aRHS)
+{
+    return aLHS.getDays() - aRHS.getDays();
+}
+
+/**
+ * @brief Equality operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input SerialDate instance.
+ * @param[in] aRHS Second input SerialDate instance.
+ * @return True if aLHS and aRHS are the same day.
+ */
+inline bool operator==(SerialDate aLHS,
+                       SerialDate aRHS)
+{
+    return aLHS.getDays() == aRHS.getDays();
+}
+
+/**
+ * @brief Inequality operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input SerialDate instance.
+ * @param[in] aRHS Second input SerialDate instance.
+ * @return True if aLHS and aRHS are different days.
+ */
+inline bool operator!=(SerialDate aLHS,
+                       SerialDate aRHS)
+{
+    return aLHS.getDays() != aRHS.getDays();
+}
+
+/**
+ * @brief Less than operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input SerialDate instance.
+ * @param[in] aRHS Second input SerialDate instance.
+ * @return True if aLHS is earlier than aRHS.
+ */
+inline bool operator<(SerialDate aLHS,
+                      SerialDate aRHS)
+{
+    return aLHS.getDays() < aRHS.getDays();
+}
+
+/**
+ * @brief Greater than operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input SerialDate instance.
+ * @param[in] aRHS Second input SerialDate instance.
+ * @return True if aLHS is later than aRHS.
+ */
+inline bool operator>(SerialDate aLHS,
+                      SerialDate aRHS)
+{
+    return aLHS.getDays() > aRHS.getDays();
+}
+
+/**
+ * @brief Less than or equal to operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input SerialDate instance.
+ * @param[in] aRHS Second input SerialDate instance.
+ * @return True if aLHS is not later than aRHS.
+ */
+inline bool operator<=(SerialDate aLHS,
+                       SerialDate aRHS)
+{
+    return aLHS.getDays() <= aRHS.getDays();
+}
+
+/**
+ * @brief Greater than or equal to operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input SerialDate instance.
+ * @param[in] aRHS Second input SerialDate instance.
+ * @return True if aLHS is not earlier than aRHS.
+ */
+inline bool operator>=(SerialDate aLHS,
+                       SerialDate aRHS)
+{
+    return aLHS.getDays() >= aRHS.getDays();
+}
+
+} // end namespace SPA
+
+/**
+ * Ostream operator for SerialDate.
+ * @ingroup group_time
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aSerialDate A SerialDate.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::SerialDate& aSerialDate);
+
+#endif /* INC_SERIALDATE_H_ */
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file SortUtilities.h
+ * @brief Declaration of the radix sorts in the SORT_UTIL namespace
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_SORTUTILITIES_H_
+#define INC_SORTUTILITIES_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SPA
+{
+
+// Forward declarations
+class DateAndTime;
+class JulianDate;
+class ThreadPool;
+
+namespace SORT_UTIL
+{
+
+/**
+ * @brief Sorts signed 64-bit keys into ascending order.
+ * @ingroup group_util
+ *
+ * A least-significant-digit radix sort on bytes, which skips any byte
+ * that all the keys share. Inputs of SPA_RADIX_SORT_PARALLEL_MIN_COUNT
+ * keys or more are sorted on the threads of a pool: each thread counts
+ * and then scatters its own contiguous block, so the result does not
+ * depend on the number of threads.
+ *
+ * @param[in,out] aKeys Pointer to aCount keys.
+ * @param[in] aCount Number of keys.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ */
+void radixSort(std::int64_t* aKeys,
+               std::size_t aCount,
+               ThreadPool* aPool = nullptr);
+
+/**
+ * @brief Finds the permutation that sorts signed 64-bit keys into
+ *   ascending order, as radixSort().
+ * @ingroup group_util
+ *
+ * The sort is stable: equal keys keep their input order.
+ *
+ * @param[in] aKeys Pointer to aCount keys, unchanged.
+ * @param[in] aCount Number of keys.
+ * @param[out] anIndices Pointer to aCount output indices, such that
+ *   aKeys[anIndices[0]] is the smallest key.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ */
+void radixSortIndices(const std::int64_t* aKeys,
+                      std::size_t aCount,
+                      std::size_t* anIndices,
+                      ThreadPool* aPool = nullptr);
+
+/**
+ * @brief Finds the permutation that sorts dates and times by instant.
+ * @ingroup group_util
+ *
+ * Sorts by TIME_UTIL::calculateInstantKey(), so UTC offsets are taken
+ * into account, which operator<(DateAndTime, DateAndTime) does not do.
+ * Stable.
+ *
+ * @param[in] aDateAndTimes Pointer to aCount dates and times.
+ * @param[in] aCount Number of dates.
+ * @param[out] anIndices Pointer to aCount output indices.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ */
+void sortIndicesByInstant(const DateAndTime* aDateAndTimes,
+                          std::size_t aCount,
+                          std::size_t* anIndices,
+                          ThreadPool* aPool = nullptr);
+
+/**
+ * @brief Sorts dates and times by instant, as sortIndicesByInstant().
+ * @ingroup group_util
+ *
+ * @param[in,out] aDateAndTimes Pointer to aCount dates and times.
+ * @param[in] aCount Number of dates.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ */
+void sortByInstant(DateAndTime* aDateAndTimes,
+                   std::size_t aCount,
+                   ThreadPool* aPool = nullptr);
+
+/**
+ * @brief Sorts Julian Dates into ascending order.
+ * @ingroup group_util
+ *
+ * Sorts by the bit pattern of the Julian Date, which orders finite
+ * doubles exactly, rather than by the rounded instant key.
+ *
+ * @param[in,out] aJulianDates Pointer to aCount Julian Dates.
+ * @param[in] aCount Number of dates.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ */
+void sortByInstant(JulianDate* aJulianDates,
+                   std::size_t aCount,
+                   ThreadPool* aPool = nullptr);
+
+} // end namespace SORT_UTIL
+} // end namespace SPA
+
+#endif /* INC_SORTUTILITIES_H_ */
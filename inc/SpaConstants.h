@@ -28,9 +28,93 @@
 #ifndef INC_SPACONSTANTS_H_
 #define INC_SPACONSTANTS_H_
 
+#include <cstddef>
+
 namespace SPA
 {
 
+/**
+ * @brief The ratio of a circle's circumference to its diameter.
+ * @ingroup group_util
+ * @source Common expectation
+ * @units Dimensionless
+ */
+constexpr double SPA_PI = 3.14159265358979323846;
+
+/**
+ * @brief Radians in a full circle.
+ * @ingroup group_util
+ * @source Common expectation
+ * @units Radians
+ */
+constexpr double SPA_TWO_PI = 2.0 * SPA_PI;
+
+/**
+ * @brief Degrees in a full circle.
+ * @ingroup group_util
+ * @source Common expectation
+ * @units Degrees
+ */
+constexpr double SPA_DEGREES_IN_CIRCLE = 360.0;
+
+/**
+ * @brief Multiplicative factor converting degrees to radians.
+ * @ingroup group_util
+ * @source Common expectation
+ * @units Radians per degree
+ */
+constexpr double SPA_DEGREES_TO_RADIANS = SPA_PI / 180.0;
+
+/**
+ * @brief Multiplicative factor converting radians to degrees.
+ * @ingroup group_util
+ * @source Common expectation
+ * @units Degrees per radian
+ */
+constexpr double SPA_RADIANS_TO_DEGREES = 180.0 / SPA_PI;
+
+/**
+ * @brief Smallest number of elements a parallel loop hands out as one
+ *   task when the caller does not choose a chunk size.
+ * @ingroup group_util
+ * @source SPA convention. Below this the cost of queueing a task is
+ *   comparable to the work in it.
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_PARALLEL_MIN_CHUNK_SIZE = 256;
+
+/**
+ * @brief Number of tasks a parallel loop is split into when the caller
+ *   does not choose a chunk size, unless that would make them smaller
+ *   than SPA_PARALLEL_MIN_CHUNK_SIZE.
+ * @ingroup group_util
+ * @source SPA convention. Enough tasks to keep 64 threads busy while
+ *   leaving slack for stealing; it does not depend on the number of
+ *   threads, so neither do the chunk boundaries.
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_PARALLEL_TARGET_CHUNKS = 256;
+
+/**
+ * @brief Number of elements a batch function gathers into local arrays
+ *   before handing them to a BatchKernels kernel.
+ * @ingroup group_util
+ * @source SPA convention. Small enough for the arrays to stay in L1
+ *   cache, large enough to amortize the indirect call.
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_BATCH_KERNEL_BLOCK_SIZE = 256;
+
+/**
+ * @brief Smallest number of keys SORT_UTIL radix sorts spread over the
+ *   threads of a pool. Smaller inputs are sorted on the calling thread.
+ * @ingroup group_util
+ * @source SPA convention. Below this the per-thread histograms cost
+ *   more than they save.
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_RADIX_SORT_PARALLEL_MIN_COUNT = 65536;
+
 } // end namespace SPA
 
 #endif /* INC_SPACONSTANTS_H_ */
@@ -30,6 +30,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
 
 namespace SPA
 {
@@ -70,9 +71,6 @@ class SpaDate
              int aMonth,
              int aDay);
 
-        /// Default destructor
-        virtual ~SpaDate() = default;
-
         /// Friend equality operator
         friend bool operator==(const SpaDate& aLHS, const SpaDate& aRHS);
 
@@ -140,6 +138,13 @@ class SpaDate
         int theDay;
 };
 
+static_assert(std::is_trivially_copyable<SpaDate>::value,
+              "SpaDate must be trivially copyable");
+static_assert(std::is_standard_layout<SpaDate>::value,
+              "SpaDate must be standard layout");
+static_assert(sizeof(SpaDate) == 12,
+              "SpaDate must be 12 bytes (three ints)");
+
 /**
  * @brief Equality operator for SpaDate class.
  * @ingroup group_time
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SpaMoonConstants.h
+ * @brief Constants describing the Moon's orbit
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_SPA_MOON_CONSTANTS_H_
+#define INC_SPA_MOON_CONSTANTS_H_
+
+#include <cstddef>
+
+namespace SPA
+{
+
+/**
+ * @brief Epoch of the Moon's orbital elements, 1990 January 0.0 UT.
+ * @ingroup group_moon
+ * @source PAWYC Section 65
+ * @units Decimal Julian Days since the start of the Julian Period
+ */
+constexpr double SPA_MOON_EPOCH_1990 = 2447891.5;
+
+/**
+ * @brief Mean longitude of the Moon at the epoch, l_0.
+ * @ingroup group_moon
+ * @source PAWYC Section 65, Table 10
+ * @units Degrees
+ */
+constexpr double SPA_MOON_MEAN_LONGITUDE_AT_EPOCH = 318.351648;
+
+/**
+ * @brief Mean longitude of the perigee at the epoch, P_0.
+ * @ingroup group_moon
+ * @source PAWYC Section 65, Table 10
+ * @units Degrees
+ */
+constexpr double SPA_MOON_LONGITUDE_OF_PERIGEE_AT_EPOCH = 36.340410;
+
+/**
+ * @brief Mean longitude of the ascending node at the epoch, N_0.
+ * @ingroup group_moon
+ * @source PAWYC Section 65, Table 10
+ * @units Degrees
+ */
+constexpr double SPA_MOON_LONGITUDE_OF_NODE_AT_EPOCH = 318.510107;
+
+/**
+ * @brief Daily motion of the Moon's mean longitude.
+ * @ingroup group_moon
+ * @source PAWYC Section 65
+ * @units Degrees per day
+ */
+constexpr double SPA_MOON_MEAN_LONGITUDE_RATE = 13.1763966;
+
+/**
+ * @brief Daily motion of the Moon's perigee, subtracted from the mean
+ *   longitude rate to give the anomalistic rate.
+ * @ingroup group_moon
+ * @source PAWYC Section 65
+ * @units Degrees per day
+ */
+constexpr double SPA_MOON_PERIGEE_RATE = 0.1114041;
+
+/**
+ * @brief Daily regression of the Moon's ascending node.
+ * @ingroup group_moon
+ * @source PAWYC Section 65
+ * @units Degrees per day
+ */
+constexpr double SPA_MOON_NODE_RATE = 0.0529539;
+
+/**
+ * @brief Inclination of the Moon's orbit to the ecliptic.
+ * @ingroup group_moon
+ * @source PAWYC Section 65, Table 10
+ * @units Degrees
+ */
+constexpr double SPA_MOON_ORBIT_INCLINATION = 5.145396;
+
+/**
+ * @brief Eccentricity of the Moon's orbit.
+ * @ingroup group_moon
+ * @source PAWYC Section 65, Table 10
+ * @units Dimensionless
+ */
+constexpr double SPA_MOON_ORBIT_ECCENTRICITY = 0.054900;
+
+/**
+ * @brief Semi-major axis of the Moon's orbit, a.
+ * @ingroup group_moon
+ * @source PAWYC Section 69, Table 10
+ * @units Kilometres
+ */
+constexpr double SPA_MOON_SEMI_MAJOR_AXIS_KM = 384401.0;
+
+/**
+ * @brief Angular diameter of the Moon at distance a, theta_0.
+ * @ingroup group_moon
+ * @source PAWYC Section 69, Table 10
+ * @units Degrees
+ */
+constexpr double SPA_MOON_ANGULAR_DIAMETER_AT_A = 0.5181;
+
+/**
+ * @brief Horizontal parallax of the Moon at distance a, pi_0.
+ * @ingroup group_moon
+ * @source PAWYC Section 69, Table 10
+ * @units Degrees
+ */
+constexpr double SPA_MOON_PARALLAX_AT_A = 0.9507;
+
+/**
+ * @brief Default number of terms kept by LunarSeries in each of its
+ *   longitude/distance and latitude series.
+ * @ingroup group_moon
+ * @source Chosen to be about 0.03 degrees in longitude, 0.015 degrees
+ *   in latitude and 150 km in distance, several times better than the
+ *   Section 65 method
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_MOON_SERIES_DEFAULT_TERMS = 20;
+
+/**
+ * @brief Time step used to difference the Moon's position when finding
+ *   its hourly motions.
+ * @ingroup group_moon
+ * @source SPA convention
+ * @units Decimal days
+ */
+constexpr double SPA_MOON_HOURLY_MOTION_STEP_DAYS = 1.0 / 24.0;
+
+/**
+ * @brief Mean length of the synodic month, new Moon to new Moon.
+ * @ingroup group_moon
+ * @source Meeus, Astronomical Algorithms, equation 49.1
+ * @units Decimal days
+ */
+constexpr double SPA_MOON_SYNODIC_MONTH = 29.530588861;
+
+/**
+ * @brief Mean length of the sidereal month.
+ * @ingroup group_moon
+ * @source Meeus, Astronomical Algorithms, Chapter 49
+ * @units Decimal days
+ */
+constexpr double SPA_MOON_SIDEREAL_MONTH = 27.321662;
+
+/**
+ * @brief Time of the mean new Moon of 2000 January 6, the origin of
+ *   the lunation count used by LUNARPHASE_UTIL.
+ * @ingroup group_moon
+ * @source Meeus, Astronomical Algorithms, equation 49.1
+ * @units Decimal Julian Days
+ */
+constexpr double SPA_MOON_MEAN_NEW_MOON_2000 = 2451550.09766;
+
+/**
+ * @brief Convergence tolerance when refining the time of a lunar
+ *   phase.
+ * @ingroup group_moon
+ * @source SPA convention, about 0.1 seconds
+ * @units Decimal days
+ */
+constexpr double SPA_MOON_PHASE_TOLERANCE_DAYS = 1.0e-6;
+
+/**
+ * @brief Maximum number of refinement iterations for a lunar phase.
+ * @ingroup group_moon
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr int SPA_MOON_PHASE_MAX_ITERATIONS = 20;
+
+/**
+ * @brief Atmospheric refraction at the horizon used for moonrise and
+ *   moonset.
+ * @ingroup group_moon
+ * @source PAWYC Section 70
+ * @units Degrees
+ */
+constexpr double SPA_MOON_HORIZON_REFRACTION = 34.0 / 60.0;
+
+/**
+ * @brief Default spacing of entries in a MoonTrack.
+ * @ingroup group_moon
+ * @source SPA convention. Linear interpolation of the Moon's
+ *   coordinates over an hour is good to well under an arcsecond.
+ * @units Decimal days
+ */
+constexpr double SPA_MOON_TRACK_STEP_DAYS = 1.0 / 24.0;
+
+/**
+ * @brief Moon's mean argument of latitude at the mean new Moon of
+ *   SPA_MOON_MEAN_NEW_MOON_2000.
+ * @ingroup group_moon
+ * @source Meeus, Astronomical Algorithms, equation 49.6
+ * @units Degrees
+ */
+constexpr double SPA_MOON_MEAN_ARGUMENT_OF_LATITUDE_2000 = 160.7108;
+
+/**
+ * @brief Increase in the Moon's mean argument of latitude per mean
+ *   synodic month.
+ * @ingroup group_moon
+ * @source Meeus, Astronomical Algorithms, equation 49.6
+ * @units Degrees per lunation
+ */
+constexpr double SPA_MOON_ARGUMENT_OF_LATITUDE_PER_LUNATION = 390.67050284;
+
+/**
+ * @brief Largest |sin F|, F being the Moon's mean argument of latitude
+ *   at mean syzygy, for which an eclipse is possible. Syzygies further
+ *   from a node than this are rejected without further work.
+ * @ingroup group_moon
+ * @source PAWYC Section 72; Meeus, Astronomical Algorithms, Chapter 54
+ * @units Dimensionless
+ */
+constexpr double SPA_ECLIPSE_NODE_LIMIT = 0.36;
+
+/**
+ * @brief Factor by which the Earth's radius, and hence the Moon's
+ *   parallax, is enlarged to allow for the atmosphere when finding the
+ *   size of the Earth's shadow.
+ * @ingroup group_moon
+ * @source Danjon's rule, as used by current eclipse predictions
+ * @units Dimensionless
+ */
+constexpr double SPA_ECLIPSE_SHADOW_ENLARGEMENT = 1.01;
+
+/**
+ * @brief Convergence tolerance for the times of greatest eclipse and
+ *   of the contacts.
+ * @ingroup group_moon
+ * @source SPA convention
+ * @units Decimal days
+ */
+constexpr double SPA_ECLIPSE_TOLERANCE_DAYS = 1.0e-6;
+
+/**
+ * @brief Maximum number of refinement steps for the times of greatest
+ *   eclipse and of the contacts.
+ * @ingroup group_moon
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr int SPA_ECLIPSE_MAX_ITERATIONS = 10;
+
+} // end namespace SPA
+
+#endif /* INC_SPA_MOON_CONSTANTS_H_ */
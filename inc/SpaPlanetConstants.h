@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SpaPlanetConstants.h
+ * @brief Orbital elements and other constants for the planets
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_SPA_PLANET_CONSTANTS_H_
+#define INC_SPA_PLANET_CONSTANTS_H_
+
+#include <array>
+#include <cstddef>
+
+namespace SPA
+{
+
+/**
+ * @brief Named planets enumeration, in order of distance from the Sun.
+ * @ingroup group_planets
+ */
+enum Planets
+{
+    MERCURY,    //!< Mercury. Note that Mercury is zero.
+    VENUS,      //!< Venus
+    EARTH,      //!< Earth
+    MARS,       //!< Mars
+    JUPITER,    //!< Jupiter
+    SATURN,     //!< Saturn
+    URANUS,     //!< Uranus
+    NEPTUNE     //!< Neptune
+};
+
+/**
+ * @brief Number of entries in the Planets enumeration.
+ * @ingroup group_planets
+ * @source Common usage.
+ * @units Dimensionless
+ */
+constexpr int SPA_NUM_PLANETS = 8;
+
+/**
+ * @brief Mean orbital elements of one planet, as tabulated in PAWYC.
+ * @ingroup group_planets
+ */
+struct PlanetaryElements
+{
+    /// Period of the orbit, T_p, tropical years
+    double period;
+
+    /// Mean longitude at the epoch, epsilon, degrees
+    double longitudeAtEpoch;
+
+    /// Longitude of the perihelion, varpi, degrees
+    double longitudeOfPerihelion;
+
+    /// Eccentricity of the orbit, e
+    double eccentricity;
+
+    /// Semi-major axis of the orbit, a, astronomical units
+    double semiMajorAxis;
+
+    /// Inclination of the orbit to the ecliptic, i, degrees
+    double inclination;
+
+    /// Longitude of the ascending node, Omega, degrees
+    double longitudeOfAscendingNode;
+
+    /// Angular diameter at a distance of 1 AU, theta_0, arcseconds
+    double angularDiameterAt1AU;
+
+    /// Visual magnitude at a distance of 1 AU, V_0
+    double magnitudeAt1AU;
+};
+
+/**
+ * @brief Epoch of the planetary orbital elements, 1990 January 0.0 UT.
+ * @ingroup group_planets
+ * @source PAWYC Section 54, Table 8
+ * @units Decimal Julian Days since the start of the Julian Period
+ */
+constexpr double SPA_PLANET_EPOCH_1990 = 2447891.5;
+
+/**
+ * @brief Orbital elements of the planets at epoch 1990 January 0.0,
+ *   indexed by the Planets enumeration.
+ * @ingroup group_planets
+ * @source PAWYC Section 54, Table 8
+ * @units See PlanetaryElements
+ *
+ * @note The Earth has no inclination or node by definition, and no
+ *   angular diameter or magnitude as seen from itself.
+ */
+constexpr std::array<PlanetaryElements, SPA_NUM_PLANETS> SPA_PLANETARY_ELEMENTS_1990 = {{
+    {0.24085,    60.750646,  77.299833,  0.205633, 0.387099,  7.004540, 48.212740,   6.74, -0.42},
+    {0.615211,   88.455855,  131.430236, 0.006778, 0.723332,  3.394535, 76.589820,  16.92, -4.40},
+    {1.00004,    99.403308,  102.768413, 0.016713, 1.000000,  0.0,      0.0,         0.0,   0.0},
+    {1.880932,   240.739474, 335.874939, 0.093396, 1.523688,  1.849736, 49.480308,   9.36, -1.52},
+    {11.863075,  90.638185,  14.170747,  0.048482, 5.202561,  1.303613, 100.353142, 196.74, -9.40},
+    {29.471362,  287.690033, 92.861407,  0.055581, 9.554747,  2.488980, 113.576139, 165.60, -8.88},
+    {84.039492,  271.063148, 172.884833, 0.046321, 19.21814,  0.773059, 73.926961,   65.80, -7.19},
+    {165.845392, 282.349556, 48.009758,  0.010483, 30.1985,   1.770646, 131.670599,  62.20, -6.87}
+}};
+
+/**
+ * @brief Light travel time over one astronomical unit.
+ * @ingroup group_planets
+ * @source PAWYC Section 57 quotes 0.1386 hours; this is the IAU value.
+ * @units Decimal days per astronomical unit
+ */
+constexpr double SPA_LIGHT_TIME_DAYS_PER_AU = 0.0057755183;
+
+/**
+ * @brief Number of light-time corrections applied when calculating
+ *   apparent planetary positions.
+ * @ingroup group_planets
+ * @source The second correction changes positions by less than a
+ *   milliarcsecond, so further corrections are pointless.
+ * @units Dimensionless
+ */
+constexpr int SPA_PLANET_LIGHT_TIME_ITERATIONS = 2;
+
+/**
+ * @brief Gaussian gravitational constant, k. The mean motion of a body
+ *   in an orbit of semi-major axis a AU is k / a^1.5 radians per day.
+ * @ingroup group_planets
+ * @source PAWYC Section 62; IAU 1976 value
+ * @units Radians per day
+ */
+constexpr double SPA_GAUSSIAN_GRAVITATIONAL_CONSTANT = 0.01720209895;
+
+/**
+ * @brief Orbits with |e - 1| below this are treated as parabolic.
+ * @ingroup group_planets
+ * @source SPA convention. Orbit element files quote e to six decimal
+ *   places, with parabolic orbits given as exactly 1.
+ * @units Dimensionless
+ */
+constexpr double SPA_COMET_PARABOLIC_LIMIT = 1.0e-7;
+
+/**
+ * @brief Smallest number of bodies or epochs handed to each thread by
+ *   the bulk comet propagator. Smaller batches run on the calling
+ *   thread alone.
+ * @ingroup group_planets
+ * @source SPA convention. Below this the cost of starting a thread is
+ *   comparable to the work done.
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_COMET_CHUNK_SIZE = 4096;
+
+/**
+ * @brief Step used when scanning for conjunctions and oppositions of
+ *   the planets with the Sun.
+ * @ingroup group_planets
+ * @source SPA convention. Successive conjunctions of Mercury are at
+ *   least six weeks apart, so a sign change in the elongation cannot
+ *   be stepped over.
+ * @units Decimal days
+ */
+constexpr double SPA_PLANET_EVENT_STEP_DAYS = 4.0;
+
+/**
+ * @brief Convergence tolerance for the times of conjunctions and
+ *   oppositions.
+ * @ingroup group_planets
+ * @source SPA convention
+ * @units Decimal days
+ */
+constexpr double SPA_PLANET_EVENT_TOLERANCE_DAYS = 1.0e-5;
+
+} // end namespace SPA
+
+#endif /* INC_SPA_PLANET_CONSTANTS_H_ */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SpaSunConstants.h
+ * @brief Constants describing the Sun's apparent orbit for use in SPA
+ * @ingroup group_sun
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_SPA_SUN_CONSTANTS_H_
+#define INC_SPA_SUN_CONSTANTS_H_
+
+#include <cstddef>
+
+namespace SPA
+{
+
+/**
+ * @brief Epoch of the Sun's orbital elements, 1990 January 0.0 UT.
+ * @ingroup group_sun
+ * @source PAWYC Section 46
+ * @units Decimal Julian Days since the start of the Julian Period
+ */
+constexpr double SPA_SUN_EPOCH_1990 = 2447891.5;
+
+/**
+ * @brief Ecliptic longitude of the Sun at the epoch, epsilon_g.
+ * @ingroup group_sun
+ * @source PAWYC Section 46, Table 6
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ECLIPTIC_LONGITUDE_AT_EPOCH = 279.403303;
+
+/**
+ * @brief Ecliptic longitude of the Sun at perigee, varpi_g.
+ * @ingroup group_sun
+ * @source PAWYC Section 46, Table 6
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ECLIPTIC_LONGITUDE_OF_PERIGEE = 282.768422;
+
+/**
+ * @brief Eccentricity of the Sun-Earth orbit.
+ * @ingroup group_sun
+ * @source PAWYC Section 46, Table 6
+ * @units Dimensionless
+ */
+constexpr double SPA_SUN_ORBIT_ECCENTRICITY = 0.016713;
+
+/**
+ * @brief Semi-major axis of the Sun-Earth orbit, r_0.
+ * @ingroup group_sun
+ * @source PAWYC Section 48, Table 6
+ * @units Kilometres
+ */
+constexpr double SPA_SUN_SEMI_MAJOR_AXIS_KM = 1.495985e8;
+
+/**
+ * @brief Angular diameter of the Sun when at distance r_0, theta_0.
+ * @ingroup group_sun
+ * @source PAWYC Section 48, Table 6
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ANGULAR_DIAMETER_AT_R0 = 0.533128;
+
+/**
+ * @brief Horizontal parallax of the Sun when at distance r_0.
+ * @ingroup group_sun
+ * @source Astronomical Almanac, 8.794 arcseconds
+ * @units Degrees
+ */
+constexpr double SPA_SUN_PARALLAX_AT_R0 = 8.794 / 3600.0;
+
+/**
+ * @brief Altitude of the centre of the Sun at sunrise and sunset,
+ *   allowing for 34 arcminutes of refraction and the 16 arcminute
+ *   semi-diameter of the Sun.
+ * @ingroup group_sun
+ * @source PAWYC Section 49
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ALTITUDE_AT_SUNRISE = -50.0 / 60.0;
+
+/**
+ * @brief Altitude of the centre of the Sun at the start and end of
+ *   civil twilight.
+ * @ingroup group_sun
+ * @source PAWYC Section 50
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ALTITUDE_CIVIL_TWILIGHT = -6.0;
+
+/**
+ * @brief Altitude of the centre of the Sun at the start and end of
+ *   nautical twilight.
+ * @ingroup group_sun
+ * @source PAWYC Section 50
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ALTITUDE_NAUTICAL_TWILIGHT = -12.0;
+
+/**
+ * @brief Altitude of the centre of the Sun at the start and end of
+ *   astronomical twilight.
+ * @ingroup group_sun
+ * @source PAWYC Section 50
+ * @units Degrees
+ */
+constexpr double SPA_SUN_ALTITUDE_ASTRONOMICAL_TWILIGHT = -18.0;
+
+/**
+ * @brief Default spacing of the precomputed solar track used to
+ *   bracket rise, set and twilight events.
+ * @ingroup group_sun
+ * @source Chosen so that no two crossings of the same altitude can
+ *   fall within one step outside the polar circles.
+ * @units Decimal days
+ */
+constexpr double SPA_SUN_TRACK_STEP_DAYS = 1.0 / 24.0;
+
+/**
+ * @brief Default segment length of the compressed equation of time
+ *   table.
+ * @ingroup group_sun
+ * @source Chosen empirically, see SUN_UTIL::buildEquationOfTimeTable()
+ * @units Decimal days
+ */
+constexpr double SPA_EQUATION_OF_TIME_SEGMENT_DAYS = 32.0;
+
+/**
+ * @brief Default number of Chebyshev coefficients per segment of the
+ *   compressed equation of time table.
+ * @ingroup group_sun
+ * @source Chosen empirically, see SUN_UTIL::buildEquationOfTimeTable()
+ * @units Dimensionless
+ */
+constexpr std::size_t SPA_EQUATION_OF_TIME_COEFFICIENTS = 12;
+
+/**
+ * @brief Mean time of the March equinox of 2000.
+ * @ingroup group_sun
+ * @source Meeus, Astronomical Algorithms, Table 27.C
+ * @units Decimal Julian Days
+ */
+constexpr double SPA_SUN_MARCH_EQUINOX_2000 = 2451623.80984;
+
+/**
+ * @brief Convergence tolerance for the times of the equinoxes and
+ *   solstices.
+ * @ingroup group_sun
+ * @source SPA convention
+ * @units Decimal days
+ */
+constexpr double SPA_SUN_SEASON_TOLERANCE_DAYS = 1.0e-6;
+
+/**
+ * @brief Maximum number of refinement steps for the times of the
+ *   equinoxes and solstices.
+ * @ingroup group_sun
+ * @source SPA convention
+ * @units Dimensionless
+ */
+constexpr int SPA_SUN_SEASON_MAX_ITERATIONS = 20;
+
+} // end namespace SPA
+
+#endif /* INC_SPA_SUN_CONSTANTS_H_ */
@@ -30,6 +30,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
 
 namespace SPA
 {
@@ -69,9 +70,6 @@ class SpaTime
                 double aSeconds = 0,
                 double aUTC_OffsetHours = 0);
 
-        /// Default destructor
-        virtual ~SpaTime() = default;
-
         /// Friend equality operator
         friend bool operator==(const SpaTime& aLHS, const SpaTime& aRHS);
 
@@ -166,6 +164,13 @@ class SpaTime
         double theUTC_OffsetHours;
 };
 
+static_assert(std::is_trivially_copyable<SpaTime>::value,
+              "SpaTime must be trivially copyable");
+static_assert(std::is_standard_layout<SpaTime>::value,
+              "SpaTime must be standard layout");
+static_assert(sizeof(SpaTime) == 24,
+              "SpaTime must be 24 bytes (two ints and two doubles)");
+
 /**
  * @brief Equality operator for SpaTime class.
  * @ingroup group_time
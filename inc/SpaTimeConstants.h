@@ -29,6 +29,7 @@
 #define INC_SPA_TIME_CONSTANTS_H_
 
 #include <array>
+#include <cstdint>
 
 namespace SPA
 {
@@ -97,6 +98,57 @@ constexpr int SPA_SECONDS_IN_DAY = SPA_SECONDS_IN_HOUR * SPA_HOURS_IN_DAY;
  */
 constexpr int SPA_MINUTES_IN_DAY = SPA_MINUTES_IN_HOUR * SPA_HOURS_IN_DAY;
 
+/**
+ * @brief TimeOfDay ticks in a second.
+ * @ingroup group_time
+ * @source SPA convention. Nanosecond resolution; a day of ticks still
+ *   fits comfortably in 64 bits.
+ * @units Ticks
+ */
+constexpr std::int64_t SPA_TICKS_IN_SECOND = 1000000000;
+
+/**
+ * @brief TimeOfDay ticks in a minute.
+ * @ingroup group_time
+ * @source Common expectation
+ * @units Ticks
+ */
+constexpr std::int64_t SPA_TICKS_IN_MINUTE = SPA_TICKS_IN_SECOND * SPA_SECONDS_IN_MINUTE;
+
+/**
+ * @brief TimeOfDay ticks in an hour.
+ * @ingroup group_time
+ * @source Common expectation
+ * @units Ticks
+ */
+constexpr std::int64_t SPA_TICKS_IN_HOUR = SPA_TICKS_IN_SECOND * SPA_SECONDS_IN_HOUR;
+
+/**
+ * @brief TimeOfDay ticks in a day.
+ * @ingroup group_time
+ * @source Common expectation
+ * @units Ticks
+ */
+constexpr std::int64_t SPA_TICKS_IN_DAY = SPA_TICKS_IN_SECOND * SPA_SECONDS_IN_DAY;
+
+/**
+ * @brief Instant key ticks in a second.
+ * @ingroup group_time
+ * @source SPA convention. Microsecond resolution keeps some 290000
+ *   years either side of SPA_SERIAL_DATE_EPOCH within a signed 64-bit
+ *   key.
+ * @units Ticks
+ */
+constexpr std::int64_t SPA_INSTANT_KEY_TICKS_IN_SECOND = 1000000;
+
+/**
+ * @brief Instant key ticks in a day.
+ * @ingroup group_time
+ * @source Common expectation
+ * @units Ticks
+ */
+constexpr std::int64_t SPA_INSTANT_KEY_TICKS_IN_DAY = SPA_INSTANT_KEY_TICKS_IN_SECOND * SPA_SECONDS_IN_DAY;
+
 /**
  * @brief Number of Solar Days in a Julian Year.
  * @ingroup group_time
@@ -105,6 +157,15 @@ constexpr int SPA_MINUTES_IN_DAY = SPA_MINUTES_IN_HOUR * SPA_HOURS_IN_DAY;
  */
 constexpr double SPA_DAYS_IN_JULIAN_YEAR = 365.25;
 
+/**
+ * @brief Number of Solar Days in a tropical year, i.e. the time between
+ *   successive vernal equinoxes.
+ * @ingroup group_time
+ * @source PAWYC Section 46
+ * @units Decimal Solar Days
+ */
+constexpr double SPA_DAYS_IN_TROPICAL_YEAR = 365.242191;
+
 /**
  * @brief Average number of Solar Days in Gregorian Year.
  * @ingroup group_time
@@ -137,6 +198,40 @@ constexpr double SPA_DAYS_IN_GREGORIAN_CENTURY = SPA_DAYS_IN_GREGORIAN_YEAR * SP
  */
 constexpr double SPA_MJD_EPOCH = 2400000.5;
 
+/**
+ * @brief The standard epoch J2000.0, 2000-01-01 12:00:00 TT.
+ * @ingroup group_time
+ * @source PAWYC Section 12
+ * @units Decimal Julian Days since the start of the Julian Period
+ */
+constexpr double SPA_J2000_EPOCH = 2451545.0;
+
+/**
+ * @brief Zero epoch of SerialDate day counts, 2000-01-01 00:00:00 UT.
+ * @ingroup group_time
+ * @source SPA convention
+ * @units Decimal Julian Days since the start of the Julian Period
+ */
+constexpr double SPA_SERIAL_DATE_EPOCH = 2451544.5;
+
+/**
+ * @brief SerialDate day count of 1582-10-15, the first day of the
+ *   Gregorian calendar. Earlier days are dates in the Julian calendar.
+ * @ingroup group_time
+ * @source PAWYC Section 4
+ * @units Days since SPA_SERIAL_DATE_EPOCH
+ */
+constexpr int SPA_SERIAL_DATE_FIRST_GREGORIAN_DAY = -152384;
+
+/**
+ * @brief Ratio of the length of the mean solar day to the
+ *   mean sidereal day.
+ * @ingroup group_time
+ * @source PAWYC Section 12
+ * @units Sidereal hours per solar hour
+ */
+constexpr double SPA_SIDEREAL_RATE = 1.002737909;
+
 /**
  * @brief Last day of Julian calendar in most of Western Europe, 1582-10-14 12:00:00 UTC
  * @ingroup group_time
@@ -170,14 +265,27 @@ constexpr double SPA_JULIAN_CONVERSION_CONVERSION_CONST = 1867216.25;
  * @note Although not explained in PAWYC, 30.6 is exactly the average
  *  number of days per month for months March through December
  * (306 days, 10 months).
- * @note This constant can also be used in PAWYC algorithms that
- *  use 30.60001. This value was a necessary historically because
- *  <a href="http://www.hpmuseum.org/cgi-sys/cgiwrap/hpmuseum/archv011.cgi?read=31650">older
- *  calculators lacked the accuracy of ieee754 floating point math.</a>
+ * @note Use SPA_DECODE_DAYS_PER_MONTH, not this constant, when
+ *  decoding a day count back into a month and day.
  *
  */
 constexpr double SPA_AVG_DAYS_PER_MONTH = 30.6;
 
+/**
+ * @brief Average number of days per month, rounded up, for decoding a
+ *   day count into a month and day of the month
+ * @ingroup group_time
+ * @source PAWYC Section 5
+ * @units Decimal days
+ *
+ * @note The extra 0.0001 is not only a historical workaround for
+ *  <a href="http://www.hpmuseum.org/cgi-sys/cgiwrap/hpmuseum/archv011.cgi?read=31650">older
+ *  calculators.</a> Dividing the last day of January, March or August
+ *  by exactly 30.6 lands on, or in ieee754 math just below, a whole
+ *  number, and the day decodes as day 0 of the following month.
+ */
+constexpr double SPA_DECODE_DAYS_PER_MONTH = 30.6001;
+
 /**
  * @brief Days to the beginning of the month for leap years.
  * @ingroup group_time
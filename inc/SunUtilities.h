@@ -0,0 +1,358 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SunUtilities.h
+ * @brief Declaration of Sun-related functions in the SUN_UTIL namespace
+ * @ingroup group_sun
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_SUNUTILITIES_H_
+#define INC_SUNUTILITIES_H_
+
+#include "ChebyshevTable.h"
+#include "SpaSunConstants.h"
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @defgroup group_sun The Sun
+ *
+ * @brief Sun-related sections from Practical Astronomy With Your Calculator
+ */
+
+// Forward declarations
+class JulianDate;
+
+/**
+ * @brief The position of the Sun at a single epoch.
+ * @ingroup group_sun
+ *
+ * All angles are in degrees. The ecliptic longitude is geometric, i.e.
+ * it is not corrected for nutation or aberration, matching PAWYC.
+ */
+struct SunPosition
+{
+    /// Mean anomaly, degrees in the range [0, 360)
+    double meanAnomaly;
+
+    /// True anomaly, degrees in the range [0, 360)
+    double trueAnomaly;
+
+    /// Ecliptic longitude, degrees in the range [0, 360)
+    double eclipticLongitude;
+
+    /// Distance from the Earth to the Sun, kilometres
+    double distance;
+
+    /// Angular diameter of the Sun, degrees
+    double angularSize;
+};
+
+/**
+ * @brief The position of the Sun at many epochs, stored as a structure
+ *   of arrays.
+ * @ingroup group_sun
+ *
+ * Element i of every array refers to the same epoch. Storing each
+ * quantity contiguously lets callers stream through (say) the ecliptic
+ * longitudes without dragging the other quantities through the cache.
+ */
+struct SunPositionArrays
+{
+    /// Mean anomaly, degrees in the range [0, 360)
+    std::vector<double> meanAnomaly;
+
+    /// True anomaly, degrees in the range [0, 360)
+    std::vector<double> trueAnomaly;
+
+    /// Ecliptic longitude, degrees in the range [0, 360)
+    std::vector<double> eclipticLongitude;
+
+    /// Distance from the Earth to the Sun, kilometres
+    std::vector<double> distance;
+
+    /// Angular diameter of the Sun, degrees
+    std::vector<double> angularSize;
+
+    /**
+     * Resizes every array to the given number of epochs.
+     * @param[in] aSize Number of epochs.
+     */
+    void resize(std::size_t aSize);
+
+    /**
+     * Returns the number of epochs held.
+     * @return The number of epochs held.
+     */
+    std::size_t size() const
+    {
+        return eclipticLongitude.size();
+    }
+
+    /**
+     * Returns the values for one epoch as a SunPosition.
+     * @param[in] anIndex Index of the epoch, less than size().
+     * @return The position of the Sun at that epoch.
+     */
+    SunPosition at(std::size_t anIndex) const;
+};
+
+/**
+ * @brief The equinoxes and solstices, which begin the astronomical
+ *   seasons.
+ * @ingroup group_sun
+ *
+ * The underlying values are the apparent longitude of the Sun at the
+ * event divided by 90 degrees.
+ */
+enum class SeasonType
+{
+    MarchEquinox,
+    JuneSolstice,
+    SeptemberEquinox,
+    DecemberSolstice
+};
+
+namespace SUN_UTIL
+{
+
+/**
+ * @brief Calculates the position of the Sun at a given epoch.
+ * @ingroup group_sun
+ *
+ * Implements Sections 46, 47 and 48 of PAWYC: the mean anomaly is
+ * found from the orbital elements at epoch 1990 January 0.0, Kepler's
+ * equation is solved for the eccentric anomaly with
+ * KEPLER_UTIL::solveKeplerElliptic() (Section 47 rather than the
+ * Section 46 equation of the centre approximation), and the distance
+ * and angular size follow from the true anomaly.
+ *
+ * @limitations Accuracy is about 0.01 degrees within a few decades
+ *   of 1990, degrading slowly with time as the orbital elements are
+ *   held fixed.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return The position of the Sun.
+ */
+SunPosition calculateSunPosition(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position of the Sun at a given epoch using
+ *   orbital elements with secular terms.
+ * @ingroup group_sun
+ *
+ * The mean longitude, mean anomaly, eccentricity and equation of the
+ * centre include their secular terms (Meeus, Astronomical Algorithms,
+ * equations 25.2 to 25.5), so unlike calculateSunPosition() the result
+ * remains good to about 0.01 degrees over several millennia. The
+ * ecliptic longitude is the apparent longitude, i.e. it is corrected
+ * for the 20.5 arcsecond aberration, and is referred to the mean
+ * equinox of date like LunarSeries.
+ *
+ * @param[in] aJulianDays Epoch in decimal Julian Days.
+ * @return The position of the Sun.
+ */
+SunPosition calculateSunPositionSecular(double aJulianDays);
+
+/**
+ * @brief Calculates the ecliptic longitude of the Sun at a given epoch.
+ * @ingroup group_sun
+ *
+ * Convenience wrapper around calculateSunPosition().
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @return Ecliptic longitude in degrees in the range [0, 360).
+ */
+double calculateSunEclipticLongitude(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the position of the Sun at each of an array of
+ *   epochs.
+ * @ingroup group_sun
+ *
+ * Results are identical to calling calculateSunPosition() for each
+ * epoch, but the work is arranged as simple loops over contiguous
+ * arrays.
+ *
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to aCount.
+ */
+void calculateSunPositions(const double* aJulianDays,
+                           std::size_t aCount,
+                           SunPositionArrays& aPositions);
+
+/**
+ * @brief Calculates the position of the Sun at each of a vector of
+ *   epochs.
+ * @ingroup group_sun
+ *
+ * @param[in] aJulianDates Input epochs.
+ * @param[out] aPositions Output positions, resized to match aJulianDates.
+ */
+void calculateSunPositions(const std::vector<JulianDate>& aJulianDates,
+                           SunPositionArrays& aPositions);
+
+/**
+ * @brief Calculates the position of the Sun at regularly spaced epochs.
+ * @ingroup group_sun
+ *
+ * Epoch i is aStart + i * aStepDays. Each epoch is computed from
+ * aStart directly rather than by accumulating steps, so long series
+ * (e.g. one per minute for several years) do not drift.
+ *
+ * @param[in] aStart First epoch.
+ * @param[in] aStepDays Spacing between epochs in decimal days.
+ * @param[in] aCount Number of epochs.
+ * @param[out] aPositions Output positions, resized to aCount.
+ */
+void calculateSunPositionSeries(const JulianDate& aStart,
+                                double aStepDays,
+                                std::size_t aCount,
+                                SunPositionArrays& aPositions);
+
+/**
+ * @brief Calculates the equation of time at a given instant.
+ * @ingroup group_sun
+ *
+ * Implements Section 51 of PAWYC. The equation of time is apparent
+ * solar time minus mean solar time, found here as the Greenwich hour
+ * angle of the Sun (GST minus the Sun's right ascension) less the
+ * hour angle of the mean Sun (UT minus 12h), which is equivalent to
+ * the GST to UT conversion in PAWYC but works at any instant rather
+ * than only at 0h UT.
+ *
+ * @param[in] aJulianDate Instant, UT.
+ * @return Equation of time in decimal hours, positive when a sundial
+ *   is ahead of the clock, in the range [-12, 12).
+ */
+double calculateEquationOfTime(const JulianDate& aJulianDate);
+
+/**
+ * @brief Calculates the equation of time at each of an array of
+ *   instants.
+ * @ingroup group_sun
+ *
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of instants.
+ * @param[out] anEquationOfTime Pointer to aCount doubles to receive the
+ *   equation of time in decimal hours.
+ */
+void calculateEquationOfTime(const double* aJulianDays,
+                             std::size_t aCount,
+                             double* anEquationOfTime);
+
+/**
+ * @brief Tabulates the equation of time at regularly spaced instants.
+ * @ingroup group_sun
+ *
+ * Instant i is aStart + i * aStepDays. The result is a single packed
+ * array of decimal hours.
+ *
+ * @param[in] aStart First instant, UT.
+ * @param[in] aStepDays Spacing between instants in decimal days.
+ * @param[in] aCount Number of instants.
+ * @param[out] anEquationOfTime Output table, resized to aCount.
+ */
+void calculateEquationOfTimeSeries(const JulianDate& aStart,
+                                   double aStepDays,
+                                   std::size_t aCount,
+                                   std::vector<double>& anEquationOfTime);
+
+/**
+ * @brief Builds a compressed piecewise Chebyshev table of the equation
+ *   of time.
+ * @ingroup group_sun
+ *
+ * Looking up a value in the returned table with
+ * ChebyshevTable::evaluate() (argument in Julian Days, result in
+ * decimal hours) costs one segment index calculation and a short
+ * Clenshaw recurrence, rather than a full solar position. With the
+ * default settings the table agrees with calculateEquationOfTime() to
+ * better than a millisecond of time.
+ *
+ * @param[in] aStart Start of the table, UT.
+ * @param[in] anEnd End of the table, UT. The table is extended to a
+ *   whole number of segments.
+ * @param[in] aSegmentDays Length of each segment in days.
+ * @param[in] aNumCoefficients Chebyshev coefficients per segment.
+ * @return The table.
+ */
+ChebyshevTable buildEquationOfTimeTable(const JulianDate& aStart,
+                                        const JulianDate& anEnd,
+                                        double aSegmentDays = SPA_EQUATION_OF_TIME_SEGMENT_DAYS,
+                                        std::size_t aNumCoefficients = SPA_EQUATION_OF_TIME_COEFFICIENTS);
+
+/**
+ * @brief Calculates the solar elongation of an object, i.e. its
+ *   angular distance from the Sun.
+ * @ingroup group_sun
+ *
+ * Implements Section 52 of PAWYC.
+ *
+ * @param[in] aJulianDate Epoch, UT.
+ * @param[in] anEclipticLongitude Ecliptic longitude of the object in
+ *   degrees.
+ * @param[in] anEclipticLatitude Ecliptic latitude of the object in
+ *   degrees.
+ * @return Elongation in degrees in the range [0, 180].
+ */
+double calculateSolarElongation(const JulianDate& aJulianDate,
+                                double anEclipticLongitude,
+                                double anEclipticLatitude);
+
+/**
+ * @brief Calculates the time of an equinox or solstice.
+ * @ingroup group_sun
+ *
+ * Finds the time at which the apparent longitude of the Sun from
+ * calculateSunPositionSecular() is a multiple of 90 degrees, by the
+ * secant method from the mean time of the event, until successive
+ * estimates agree to SPA_SUN_SEASON_TOLERANCE_DAYS.
+ *
+ * @limitations Nutation is ignored, so times may be in error by up to
+ *   about seven minutes.
+ *
+ * @param[in] aYear Year.
+ * @param[in] aSeason Which equinox or solstice.
+ * @return Time of the event in decimal Julian Days.
+ */
+double calculateSeason(int aYear, SeasonType aSeason);
+
+} // end namespace SUN_UTIL
+} // end namespace SPA
+
+/**
+ * Ostream operator for SeasonType enumeration.
+ * @ingroup group_sun
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aSeason An equinox or solstice.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::SeasonType& aSeason);
+
+#endif /* INC_SUNUTILITIES_H_ */
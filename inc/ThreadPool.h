@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ThreadPool.h
+ * @brief Declaration of the ThreadPool class
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_THREADPOOL_H_
+#define INC_THREADPOOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SPA
+{
+
+/**
+ * @brief A fixed set of worker threads that run index ranges of a
+ *   loop, with work stealing.
+ * @ingroup group_util
+ *
+ * run() cuts [0, aCount) into chunks and deals them out in contiguous
+ * blocks, one block to each worker's queue. A worker takes chunks from
+ * the back of its own queue and, when that is empty, steals from the
+ * front of the others', so a worker that finishes early relieves one
+ * that is behind. The calling thread takes part too, and does not
+ * return until every chunk is done. Since a thread waiting in run()
+ * will run any queued chunk, run() may be called from inside a chunk.
+ *
+ * Which thread runs a chunk is not fixed, but the chunks themselves
+ * are: for a given count and chunk size they are the same whatever the
+ * number of threads. A function that writes only the elements of its
+ * own range therefore gives the same output on any pool. See also
+ * PARALLEL_UTIL::parallelFor().
+ *
+ * If the function throws, run() still waits for every chunk to finish,
+ * then rethrows the first exception caught on the calling thread. The
+ * other chunks run to the end, so the output may be partly written.
+ */
+class ThreadPool
+{
+    public:
+        /// Function run on each chunk, given its first and one-past-last index
+        using RangeFunction = std::function<void(std::size_t, std::size_t)>;
+
+        /**
+         * Constructor. Starts aNumThreads - 1 workers, the calling
+         * thread of run() being the last.
+         * @param[in] aNumThreads Number of threads to run on, or 0 for
+         *   one per hardware thread. With 1 every chunk runs on the
+         *   caller.
+         */
+        explicit ThreadPool(unsigned int aNumThreads = 0);
+
+        /// Destructor. Waits for the workers to finish and stop.
+        virtual ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /**
+         * Returns the number of threads that run chunks, including the
+         * caller.
+         * @return Number of threads.
+         */
+        unsigned int getNumThreads() const
+        {
+            return static_cast<unsigned int>(theWorkers.size()) + 1;
+        }
+
+        /**
+         * Returns the chunk size used by run() when none is given:
+         * aCount / SPA_PARALLEL_TARGET_CHUNKS, but no less than
+         * SPA_PARALLEL_MIN_CHUNK_SIZE.
+         * @param[in] aCount Number of elements.
+         * @return Chunk size, at least 1.
+         */
+        static std::size_t chooseChunkSize(std::size_t aCount);
+
+        /**
+         * Runs a function over [0, aCount) in chunks, and waits for all
+         * of them to finish.
+         * @param[in] aCount Number of elements.
+         * @param[in] aChunkSize Elements per chunk, or 0 to use
+         *   chooseChunkSize(). The last chunk may be shorter.
+         * @param[in] aFunction Function called once for each chunk.
+         * @throws Whatever aFunction threw first, once every chunk has
+         *   finished.
+         */
+        void run(std::size_t aCount,
+                 std::size_t aChunkSize,
+                 const RangeFunction& aFunction);
+
+        /**
+         * Returns a pool with one thread per hardware thread, created on
+         * first use and shared by the whole program.
+         * @return The shared pool.
+         */
+        static ThreadPool& getDefault();
+
+    private:
+        /// One call of run(), shared by its chunks
+        struct Batch;
+
+        /// One chunk of a batch
+        struct Task
+        {
+            /// The batch the chunk belongs to
+            Batch* batch;
+
+            /// First index of the chunk
+            std::size_t begin;
+
+            /// One past the last index of the chunk
+            std::size_t end;
+        };
+
+        /// A worker's queue of chunks
+        struct WorkQueue
+        {
+            /// Guards tasks
+            std::mutex mutex;
+
+            /// Chunks waiting to run
+            std::deque<Task> tasks;
+        };
+
+        /**
+         * Takes a chunk, from the back of one queue or, failing that,
+         * from the front of any other.
+         * @param[in] aQueue Index of the preferred queue.
+         * @param[out] aTask The chunk, if there was one.
+         * @return False if every queue was empty.
+         */
+        bool takeTask(std::size_t aQueue, Task& aTask);
+
+        /**
+         * Runs a chunk and, if it was the last of its batch, wakes the
+         * thread waiting for the batch.
+         * @param[in] aTask The chunk.
+         */
+        void runTask(const Task& aTask);
+
+        /**
+         * Body of each worker thread.
+         * @param[in] aQueue Index of the worker's own queue.
+         */
+        void work(std::size_t aQueue);
+
+        /// One queue per worker, then one shared by callers of run()
+        std::vector<std::unique_ptr<WorkQueue>> theQueues;
+
+        /// The worker threads
+        std::vector<std::thread> theWorkers;
+
+        /// Guards theQueuedTasks and theStopping
+        std::mutex theWakeMutex;
+
+        /// Signalled when chunks are queued or the pool stops
+        std::condition_variable theWakeCondition;
+
+        /// Number of chunks queued and not yet taken
+        std::size_t theQueuedTasks;
+
+        /// Set by the destructor to stop the workers
+        bool theStopping;
+};
+
+} // end namespace SPA
+
+#endif /* INC_THREADPOOL_H_ */
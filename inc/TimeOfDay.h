@@ -0,0 +1,340 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file TimeOfDay.h
+ * @brief Declaration of the TimeOfDay class.
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef INC_TIMEOFDAY_H_
+#define INC_TIMEOFDAY_H_
+
+#include "SpaTimeConstants.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+
+namespace SPA
+{
+
+// Forward declarations
+class SpaTime;
+
+/**
+ * @brief A time of day held as an integer count of nanosecond ticks
+ *   since midnight.
+ * @ingroup group_time
+ *
+ * The count is always in [0, SPA_TICKS_IN_DAY). Arithmetic that
+ * leaves the day wraps round and reports the whole days carried, which
+ * can be added to a SerialDate. Comparison, differences and bucketing
+ * are integer operations; the hours, minutes and seconds are only
+ * worked out when asked for.
+ *
+ * Unlike SpaTime, TimeOfDay has no UTC offset: it is a reading of
+ * whichever clock the caller chooses, usually UT.
+ */
+class TimeOfDay
+{
+    public:
+        /// Default constructor, midnight
+        TimeOfDay() : theTicks(0)
+        {
+        }
+
+        /**
+         * Construct from a tick count within the day. Use fromTicks()
+         * for counts that may lie outside it.
+         *
+         * @param[in] aTicks Ticks since midnight, in [0, SPA_TICKS_IN_DAY).
+         */
+        explicit TimeOfDay(std::int64_t aTicks) : theTicks(aTicks)
+        {
+        }
+
+        /**
+         * Construct from hours, minutes and seconds. The seconds are
+         * rounded to the nearest tick, and a time past the end of the
+         * day (a leap second, say) wraps round to the next.
+         *
+         * @param[in] anHours Hours after midnight, 0 to 23.
+         * @param[in] aMinutes Minutes into the hour, 0 to 59.
+         * @param[in] aSeconds Seconds into the minute, from 0 and less
+         *   than 61.
+         */
+        TimeOfDay(int anHours,
+                  int aMinutes,
+                  double aSeconds);
+
+        /**
+         * Construct from the hours, minutes and seconds of a SpaTime,
+         * as the constructor above. The UTC offset is not used.
+         *
+         * @param[in] aSpaTime Time to convert.
+         */
+        explicit TimeOfDay(const SpaTime& aSpaTime);
+
+        /**
+         * Wraps a tick count into the day.
+         *
+         * @param[in] aTicks Ticks since midnight of some day, may be
+         *   negative or longer than a day.
+         * @param[out] aDayCarry Whole days to add to that day's date.
+         * @return The time of day.
+         */
+        static TimeOfDay fromTicks(std::int64_t aTicks,
+                                   std::int32_t& aDayCarry)
+        {
+            std::int64_t ticks;
+            aDayCarry = splitTicks(aTicks, ticks);
+            return TimeOfDay(ticks);
+        }
+
+        /**
+         * Converts decimal hours, rounded to the nearest tick, and wraps
+         * them into the day.
+         *
+         * @param[in] aDecimalHours Hours since midnight of some day, may
+         *   be negative or longer than a day.
+         * @param[out] aDayCarry Whole days to add to that day's date.
+         * @return The time of day.
+         */
+        static TimeOfDay fromDecimalHours(double aDecimalHours,
+                                          std::int32_t& aDayCarry);
+
+        /**
+         * Returns the tick count.
+         * @return Ticks since midnight, in [0, SPA_TICKS_IN_DAY).
+         */
+        std::int64_t getTicks() const
+        {
+            return theTicks;
+        }
+
+        /**
+         * Returns the hour within the day, 0 to 23.
+         */
+        int getHours() const
+        {
+            return int(theTicks / SPA_TICKS_IN_HOUR);
+        }
+
+        /**
+         * Returns the minutes into the hour, 0 to 59.
+         */
+        int getMinutes() const
+        {
+            return int((theTicks % SPA_TICKS_IN_HOUR) / SPA_TICKS_IN_MINUTE);
+        }
+
+        /**
+         * Returns the seconds into the minute, from 0 and less than 60.
+         */
+        double getSeconds() const
+        {
+            return double(theTicks % SPA_TICKS_IN_MINUTE) / double(SPA_TICKS_IN_SECOND);
+        }
+
+        /**
+         * Returns the time as decimal hours since midnight.
+         */
+        double getDecimalHours() const
+        {
+            return double(theTicks) / double(SPA_TICKS_IN_HOUR);
+        }
+
+        /**
+         * Returns the time as a fraction of a day.
+         */
+        double getDayFraction() const
+        {
+            return double(theTicks) / double(SPA_TICKS_IN_DAY);
+        }
+
+        /**
+         * Returns the time as a SpaTime.
+         * @param[in] aUTC_OffsetHours UTC offset to give the SpaTime.
+         */
+        SpaTime getSpaTime(double aUTC_OffsetHours = 0) const;
+
+        /**
+         * Adds ticks, wrapping round midnight.
+         * @param[in] aTicks Ticks to add, may be negative.
+         * @return Whole days carried, negative when going back past
+         *   midnight.
+         */
+        std::int32_t addTicks(std::int64_t aTicks)
+        {
+            return splitTicks(theTicks + aTicks, theTicks);
+        }
+
+        /**
+         * Subtracts ticks, wrapping round midnight.
+         * @param[in] aTicks Ticks to subtract, may be negative.
+         * @return Whole days carried, negative when going back past
+         *   midnight.
+         */
+        std::int32_t subtractTicks(std::int64_t aTicks)
+        {
+            return splitTicks(theTicks - aTicks, theTicks);
+        }
+
+    private:
+        /// Splits a tick count into whole days and ticks within the day
+        static std::int32_t splitTicks(std::int64_t aTicks,
+                                       std::int64_t& aTicksOfDay)
+        {
+            std::int64_t days = aTicks / SPA_TICKS_IN_DAY;
+            std::int64_t remainder = aTicks - days * SPA_TICKS_IN_DAY;
+            if (remainder < 0)
+            {
+                days -= 1;
+                remainder += SPA_TICKS_IN_DAY;
+            }
+            aTicksOfDay = remainder;
+            return std::int32_t(days);
+        }
+
+        /// Ticks since midnight
+        std::int64_t theTicks;
+};
+
+static_assert(std::is_trivially_copyable<TimeOfDay>::value,
+              "TimeOfDay must be trivially copyable");
+static_assert(std::is_standard_layout<TimeOfDay>::value,
+              "TimeOfDay must be standard layout");
+static_assert(sizeof(TimeOfDay) == sizeof(std::int64_t),
+              "TimeOfDay must be a bare 64-bit tick count");
+
+/**
+ * @brief Returns the ticks from one time of day to another on the same
+ *   day.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS Later time.
+ * @param[in] aRHS Earlier time.
+ * @return Ticks from aRHS to aLHS, negative if aLHS is earlier.
+ */
+inline std::int64_t operator-(TimeOfDay aLHS,
+                              TimeOfDay aRHS)
+{
+    return aLHS.getTicks() - aRHS.getTicks();
+}
+
+/**
+ * @brief Equality operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input TimeOfDay instance.
+ * @param[in] aRHS Second input TimeOfDay instance.
+ * @return True if the tick counts are equal.
+ */
+inline bool operator==(TimeOfDay aLHS,
+                       TimeOfDay aRHS)
+{
+    return aLHS.getTicks() == aRHS.getTicks();
+}
+
+/**
+ * @brief Inequality operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input TimeOfDay instance.
+ * @param[in] aRHS Second input TimeOfDay instance.
+ * @return True if the tick counts differ.
+ */
+inline bool operator!=(TimeOfDay aLHS,
+                       TimeOfDay aRHS)
+{
+    return aLHS.getTicks() != aRHS.getTicks();
+}
+
+/**
+ * @brief Less than operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input TimeOfDay instance.
+ * @param[in] aRHS Second input TimeOfDay instance.
+ * @return True if aLHS is earlier in the day than aRHS.
+ */
+inline bool operator<(TimeOfDay aLHS,
+                      TimeOfDay aRHS)
+{
+    return aLHS.getTicks() < aRHS.getTicks();
+}
+
+/**
+ * @brief Greater than operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input TimeOfDay instance.
+ * @param[in] aRHS Second input TimeOfDay instance.
+ * @return True if aLHS is later in the day than aRHS.
+ */
+inline bool operator>(TimeOfDay aLHS,
+                      TimeOfDay aRHS)
+{
+    return aLHS.getTicks() > aRHS.getTicks();
+}
+
+/**
+ * @brief Less than or equal to operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input TimeOfDay instance.
+ * @param[in] aRHS Second input TimeOfDay instance.
+ * @return True if aLHS is not later in the day than aRHS.
+ */
+inline bool operator<=(TimeOfDay aLHS,
+                       TimeOfDay aRHS)
+{
+    return aLHS.getTicks() <= aRHS.getTicks();
+}
+
+/**
+ * @brief Greater than or equal to operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] aLHS First input TimeOfDay instance.
+ * @param[in] aRHS Second input TimeOfDay instance.
+ * @return True if aLHS is not earlier in the day than aRHS.
+ */
+inline bool operator>=(TimeOfDay aLHS,
+                       TimeOfDay aRHS)
+{
+    return aLHS.getTicks() >= aRHS.getTicks();
+}
+
+} // end namespace SPA
+
+/**
+ * Ostream operator for TimeOfDay.
+ * @ingroup group_time
+ *
+ * @param[in] os Output stream to modify.
+ * @param[in] aTimeOfDay A TimeOfDay.
+ */
+std::ostream& operator<<(std::ostream& os, const SPA::TimeOfDay& aTimeOfDay);
+
+#endif /* INC_TIMEOFDAY_H_ */
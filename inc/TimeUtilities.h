@@ -20,6 +20,10 @@
  * @brief Declaration of Time-related utility functions in the TIME_UTIL namespace
  * @ingroup group_time
  *
+ * The smallest functions, such as isLeapYear() and
+ * integerAndFraction(), are defined here so that calls to them can be
+ * inlined even when linking against the shared library.
+ *
  * @author Dave Strickland, <dave.strickland@gmail.com>
  *
  * @version Sep 2, 2018 dks : Initial coding 
@@ -28,6 +32,9 @@
 #ifndef INC_TIMEUTILITIES_H_
 #define INC_TIMEUTILITIES_H_
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd> // Forward declarations of iostream.
 #include "SpaTimeConstants.h"
 
@@ -37,6 +44,8 @@ namespace SPA
 // Forward declarations
 class DateAndTime;
 class JulianDate;
+class ThreadPool;
+class TimeOfDay;
 
 namespace TIME_UTIL
 {
@@ -112,6 +121,148 @@ int calculateDayNumber(int aYear,
                        int aMonth,
                        int aDay);
 
+/**
+ * @brief Calculates the day of the year from a Gregorian calendar date
+ *   with integer arithmetic.
+ * @ingroup group_time
+ *
+ * Looks the start of the month up in SPA_DAYSTART_LEAPYEAR and takes
+ * one day off from March on in common years, without a branch.
+ * (aYear, result) is the ISO 8601 ordinal date. calculateDayNumber()
+ * gives the same result.
+ *
+ * @param[in] aYear Year.
+ * @param[in] aMonth Month, 1 to 12.
+ * @param[in] aDay Day of the month, 0 to 31.
+ * @return Day of the year, January 1st being 1.
+ */
+int calculateDayOfYear(int aYear,
+                       int aMonth,
+                       int aDay);
+
+/**
+ * @brief Calculates the month and day of the month from a Gregorian
+ *   year and day of the year, the inverse of calculateDayOfYear().
+ * @ingroup group_time
+ *
+ * Converts an ISO 8601 ordinal date to a calendar date.
+ *
+ * @param[in] aYear Year.
+ * @param[in] aDayOfYear Day of the year, 1 to daysInYear(aYear).
+ * @param[out] aMonth Month, 1 to 12.
+ * @param[out] aDay Day of the month.
+ */
+void calculateMonthAndDay(int aYear,
+                          int aDayOfYear,
+                          int& aMonth,
+                          int& aDay);
+
+/**
+ * @brief Calculates the day of the year for each of an array of
+ *   calendar dates, as calculateDayOfYear().
+ * @ingroup group_time
+ *
+ * @param[in] aYears Pointer to aCount years.
+ * @param[in] aMonths Pointer to aCount months.
+ * @param[in] aDays Pointer to aCount days of the month.
+ * @param[in] aCount Number of dates.
+ * @param[out] aDaysOfYear Pointer to aCount output days of the year.
+ */
+void calculateDaysOfYear(const int* aYears,
+                         const int* aMonths,
+                         const int* aDays,
+                         std::size_t aCount,
+                         int* aDaysOfYear);
+
+/**
+ * @brief Calculates the month and day of the month for each of an
+ *   array of years and days of the year, as calculateMonthAndDay().
+ * @ingroup group_time
+ *
+ * @param[in] aYears Pointer to aCount years.
+ * @param[in] aDaysOfYear Pointer to aCount days of the year.
+ * @param[in] aCount Number of dates.
+ * @param[out] aMonths Pointer to aCount output months.
+ * @param[out] aDays Pointer to aCount output days of the month.
+ */
+void calculateMonthsAndDays(const int* aYears,
+                            const int* aDaysOfYear,
+                            std::size_t aCount,
+                            int* aMonths,
+                            int* aDays);
+
+/**
+ * @brief Returns the number of weeks, 52 or 53, in an ISO 8601
+ *   week-numbering year.
+ * @ingroup group_time
+ *
+ * @param[in] anIsoYear ISO week-numbering year.
+ * @return Number of weeks.
+ */
+int calculateIsoWeeksInYear(int anIsoYear);
+
+/**
+ * @brief Converts a Gregorian calendar date to an ISO 8601 week date.
+ * @ingroup group_time
+ *
+ * ISO weeks start on a Monday, and week 1 is the week holding the
+ * year's first Thursday, so the first and last few days of a year can
+ * belong to a week of the year before or after. Dates before 1582 are
+ * proleptic Gregorian dates, as ISO 8601 specifies.
+ *
+ * @param[in] aYear Year.
+ * @param[in] aMonth Month, 1 to 12.
+ * @param[in] aDay Day of the month.
+ * @param[out] anIsoYear ISO week-numbering year.
+ * @param[out] anIsoWeek Week of anIsoYear, 1 to 53.
+ * @param[out] anIsoWeekDay Day of the week, Monday 1 to Sunday 7.
+ */
+void calculateIsoWeekDate(int aYear,
+                          int aMonth,
+                          int aDay,
+                          int& anIsoYear,
+                          int& anIsoWeek,
+                          int& anIsoWeekDay);
+
+/**
+ * @brief Converts an ISO 8601 week date to a Gregorian calendar date,
+ *   the inverse of calculateIsoWeekDate().
+ * @ingroup group_time
+ *
+ * @param[in] anIsoYear ISO week-numbering year.
+ * @param[in] anIsoWeek Week, 1 to calculateIsoWeeksInYear(anIsoYear).
+ * @param[in] anIsoWeekDay Day of the week, Monday 1 to Sunday 7.
+ * @param[out] aYear Year.
+ * @param[out] aMonth Month, 1 to 12.
+ * @param[out] aDay Day of the month.
+ */
+void calculateDateFromIsoWeekDate(int anIsoYear,
+                                  int anIsoWeek,
+                                  int anIsoWeekDay,
+                                  int& aYear,
+                                  int& aMonth,
+                                  int& aDay);
+
+/**
+ * @brief Calculates the day of the week for each of an array of
+ *   Julian Dates.
+ * @ingroup group_time
+ *
+ * Results are identical to calling calculateDayInTheWeek() for each
+ * date, whatever the number of threads in the pool.
+ *
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of dates.
+ * @param[out] aWeekDays Pointer to aCount output days of the week.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ * @param[in] aChunkSize Dates per task, or 0 for the pool's choice.
+ */
+void calculateDaysInTheWeek(const double* aJulianDays,
+                            std::size_t aCount,
+                            WeekDays* aWeekDays,
+                            ThreadPool* aPool = nullptr,
+                            std::size_t aChunkSize = 0);
+
 /**
  * @brief Calculate decimal hours from hours, minutes
  *  and seconds.
@@ -155,6 +306,18 @@ void calculateEaster(int aYear,
                      int &aMonth,
                      int &aDay);
 
+/**
+ * @brief Calculates the Greenwich sidereal time (GST) at a given
+ *   instant.
+ * @ingroup group_time
+ *
+ * Implements Section 12 of PAWYC.
+ *
+ * @param[in] aJulianDate Instant, UT.
+ * @return GST in decimal hours in the range [0, 24).
+ */
+double calculateGreenwichSiderealTime(const JulianDate& aJulianDate);
+
 /**
  * @brief Converts decimal hours to hours, minutes and seconds.
  * @ingroup group_time
@@ -174,6 +337,21 @@ void calculateHoursMinutesAndSeconds(double aDecimalHours,
                                      int& aMinutes,
                                      double& aSeconds);
 
+/**
+ * @brief Calculates the local sidereal time (LST) from the Greenwich
+ *   sidereal time and the geographical longitude.
+ * @ingroup group_time
+ *
+ * Implements Section 14 of PAWYC.
+ *
+ * @param[in] aGreenwichSiderealTime GST in decimal hours.
+ * @param[in] aLongitude Geographical longitude in degrees, positive
+ *   east of Greenwich and negative west of it.
+ * @return LST in decimal hours in the range [0, 24).
+ */
+double calculateLocalSiderealTime(double aGreenwichSiderealTime,
+                                  double aLongitude);
+
 /**
  * Converts a year BC or BCE into a form usable by DateAndTime and other SPA code.
  *
@@ -194,14 +372,152 @@ inline int convertBCE_Year(int aBCE_Year)
 }
 
 /**
- * @brief Returns the total number of days in a given year
- *  from the Gregorian calendar.
+ * @brief Converts an array of Julian Dates into calendar dates and
+ *   times.
  * @ingroup group_time
  *
- * @param[in] aYear Input year in the Gregorian calendar.
- * @return Number of days in the year, either 365 or 366.
+ * Results are identical to calling JulianDate::getDateAndTime() for
+ * each date, whatever the number of threads in the pool and whichever
+ * BatchKernels CPU_UTIL::getBatchKernels() chose.
+ *
+ * @param[in] aJulianDays Pointer to aCount Julian Dates in decimal days.
+ * @param[in] aCount Number of dates.
+ * @param[out] aDateAndTimes Pointer to aCount output dates and times,
+ *   with a zero UTC offset.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ * @param[in] aChunkSize Dates per task, or 0 for the pool's choice.
+ */
+void convertToDateAndTimes(const double* aJulianDays,
+                           std::size_t aCount,
+                           DateAndTime* aDateAndTimes,
+                           ThreadPool* aPool = nullptr,
+                           std::size_t aChunkSize = 0);
+
+/**
+ * @brief Converts an array of calendar dates and times into Julian
+ *   Dates.
+ * @ingroup group_time
+ *
+ * Results are identical to constructing a JulianDate from each
+ * DateAndTime, whatever the number of threads in the pool and
+ * whichever BatchKernels CPU_UTIL::getBatchKernels() chose.
+ *
+ * @param[in] aDateAndTimes Pointer to aCount dates and times.
+ * @param[in] aCount Number of dates.
+ * @param[out] aJulianDays Pointer to aCount output Julian Dates in
+ *   decimal days.
+ * @param[in] aPool Pool to run on, or null for ThreadPool::getDefault().
+ * @param[in] aChunkSize Dates per task, or 0 for the pool's choice.
  */
-int daysInYear(int aYear);
+void convertToJulianDays(const DateAndTime* aDateAndTimes,
+                         std::size_t aCount,
+                         double* aJulianDays,
+                         ThreadPool* aPool = nullptr,
+                         std::size_t aChunkSize = 0);
+
+/**
+ * @brief Adds the same number of ticks to an array of times of day,
+ *   as TimeOfDay::addTicks().
+ * @ingroup group_time
+ *
+ * The loop has no branches and no division, so the compiler can
+ * vectorize it. Runs on the calling thread.
+ *
+ * @param[in] aTimes Pointer to aCount times.
+ * @param[in] aCount Number of times.
+ * @param[in] aTicks Ticks to add to each, may be negative.
+ * @param[out] aResults Pointer to aCount output times. May equal aTimes.
+ * @param[out] aDayCarries Pointer to aCount output whole days carried,
+ *   or null if they are not needed.
+ */
+void addTicks(const TimeOfDay* aTimes,
+              std::size_t aCount,
+              std::int64_t aTicks,
+              TimeOfDay* aResults,
+              std::int32_t* aDayCarries);
+
+/**
+ * @brief Converts an array of times of day to decimal hours.
+ * @ingroup group_time
+ *
+ * Results are identical to TimeOfDay::getDecimalHours(). Runs on the
+ * calling thread.
+ *
+ * @param[in] aTimes Pointer to aCount times.
+ * @param[in] aCount Number of times.
+ * @param[out] aDecimalHours Pointer to aCount output decimal hours.
+ */
+void convertToDecimalHours(const TimeOfDay* aTimes,
+                           std::size_t aCount,
+                           double* aDecimalHours);
+
+/**
+ * @brief Converts an array of decimal hours to times of day.
+ * @ingroup group_time
+ *
+ * Results are identical to TimeOfDay::fromDecimalHours(). Runs on the
+ * calling thread.
+ *
+ * @param[in] aDecimalHours Pointer to aCount decimal hours.
+ * @param[in] aCount Number of times.
+ * @param[out] aTimes Pointer to aCount output times.
+ * @param[out] aDayCarries Pointer to aCount output whole days carried,
+ *   or null if they are not needed.
+ */
+void convertToTimesOfDay(const double* aDecimalHours,
+                         std::size_t aCount,
+                         TimeOfDay* aTimes,
+                         std::int32_t* aDayCarries);
+
+/**
+ * @brief Sorts times of day into equal buckets, e.g. the minute or
+ *   hour of the day.
+ * @ingroup group_time
+ *
+ * Runs on the calling thread.
+ *
+ * @param[in] aTimes Pointer to aCount times.
+ * @param[in] aCount Number of times.
+ * @param[in] aBucketTicks Width of a bucket in ticks, positive, e.g.
+ *   SPA_TICKS_IN_HOUR.
+ * @param[out] aBuckets Pointer to aCount output bucket numbers,
+ *   counted from 0 at midnight.
+ */
+void calculateTimeOfDayBuckets(const TimeOfDay* aTimes,
+                               std::size_t aCount,
+                               std::int64_t aBucketTicks,
+                               std::int32_t* aBuckets);
+
+/**
+ * @brief Returns an integer key that orders dates and times by the
+ *   instant they represent.
+ * @ingroup group_time
+ *
+ * The key counts microseconds (SPA_INSTANT_KEY_TICKS_IN_SECOND) from
+ * SPA_SERIAL_DATE_EPOCH. The UTC offset is applied as
+ * DateAndTime::getDayFraction() applies it, so two DateAndTime values
+ * compare by key as their Julian Dates compare, whatever their
+ * offsets. The calendar date is converted exactly, as SerialDate does,
+ * and the time of day is rounded to the nearest microsecond.
+ *
+ * @param[in] aDateAndTime Date and time.
+ * @return Instant key.
+ */
+std::int64_t calculateInstantKey(const DateAndTime& aDateAndTime);
+
+/**
+ * @brief Returns an integer key that orders Julian Dates.
+ * @ingroup group_time
+ *
+ * The key is on the same scale as for a DateAndTime. A later Julian
+ * Date never has a smaller key. A double Julian Date resolves only
+ * some tens of microseconds, so a key from a JulianDate can differ by
+ * that much from the key of the DateAndTime it came from.
+ *
+ * @param[in] aJulianDate Julian Date.
+ * @return Instant key.
+ */
+std::int64_t calculateInstantKey(const JulianDate& aJulianDate);
 
 /**
  * @brief Splits an input real number into its integer and
@@ -227,9 +543,13 @@ int daysInYear(int aYear);
  * @param[out] anIntegerPart Output integer part.
  * @param[out] aFractionalPart Output fractional part.
  */
-void integerAndFraction(double aRealNumber,
-                        double& anIntegerPart,
-                        double& aFractionalPart);
+inline void integerAndFraction(double aRealNumber,
+                               double& anIntegerPart,
+                               double& aFractionalPart)
+{
+    anIntegerPart = std::floor(aRealNumber);
+    aFractionalPart = aRealNumber - anIntegerPart;
+}
 
 /**
  * @brief Returns true if the input year is a leap year according to the Gregorian Calendar.
@@ -243,7 +563,25 @@ void integerAndFraction(double aRealNumber,
  * @param[in] aYear Input year according to the Gregorian Calendar
  * @return True if the year is a leap year.
  */
-bool isLeapYear(int aYear);
+inline bool isLeapYear(int aYear)
+{
+    return ((aYear % 4) == 0) &&
+           ( ((aYear % 100) != 0) ||
+             ((aYear % 400) == 0) );
+}
+
+/**
+ * @brief Returns the total number of days in a given year
+ *  from the Gregorian calendar.
+ * @ingroup group_time
+ *
+ * @param[in] aYear Input year in the Gregorian calendar.
+ * @return Number of days in the year, either 365 or 366.
+ */
+inline int daysInYear(int aYear)
+{
+    return isLeapYear(aYear) ? SPA_DAYS_IN_NONLEAP_YEAR + 1 : SPA_DAYS_IN_NONLEAP_YEAR;
+}
 
 /**
  * Divides an integer dividend by a divisor and returns
@@ -267,10 +605,21 @@ bool isLeapYear(int aYear);
  *   dividing aDividend by aDivisor.
  * @param[out] aRemainder Remainder, i.e. D modulus d.
  */
-void quotientAndRemainder(int aDividend,
-                          int aDivisor,
-                          int& aQuotient,
-                          int& aRemainder);
+inline void quotientAndRemainder(int aDividend,
+                                 int aDivisor,
+                                 int& aQuotient,
+                                 int& aRemainder)
+{
+    /*
+     * Implementation note: std::ldiv in cstdlib performs
+     * the same calculation, potentially using a single CPU
+     * operation. Unpacking a std::div_t object is a bit of
+     * a pain, so I've chosen to both use my own function
+     * and expose the logic here.
+     */
+    aQuotient = aDividend / aDivisor;
+    aRemainder = aDividend % aDivisor;
+}
 
 /**
  * Ostream operator for WeekDays enumeration.
@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AstronomicalCalendar.cc
+ * @brief Definition of AstronomicalCalendar functions
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "AstronomicalCalendar.h"
+#include "DateAndTime.h"
+#include "EclipseGenerator.h"
+#include "LunarPhaseGenerator.h"
+#include "PlanetEventGenerator.h"
+#include "SunUtilities.h"
+#include "TimeUtilities.h"
+
+#include <ostream>
+
+namespace SPA
+{
+
+namespace
+{
+
+/// First year for which TIME_UTIL::calculateEaster() is valid
+constexpr int GREGORIAN_EASTER_FIRST_YEAR = 1583;
+
+/// Easter Sunday of each year in a range.
+class EasterSource : public CalendarEventSource
+{
+    public:
+        EasterSource(const JulianDate& aStart, const JulianDate& anEnd) :
+            theYear(aStart.getDateAndTime().getYear() - 1),
+            theStartJulianDays(aStart.getDecimalDays()),
+            theEndJulianDays(anEnd.getDecimalDays())
+        {
+            if (theYear < GREGORIAN_EASTER_FIRST_YEAR)
+            {
+                theYear = GREGORIAN_EASTER_FIRST_YEAR;
+            }
+        }
+
+        bool next(CalendarEvent& anEvent) override
+        {
+            while (true)
+            {
+                int month = 0;
+                int day = 0;
+                TIME_UTIL::calculateEaster(theYear, month, day);
+                double julianDays = JulianDate(theYear, month, day, 0, 0, 0.0).getDecimalDays();
+                if (julianDays > theEndJulianDays)
+                {
+                    return false;
+                }
+                theYear++;
+                if (julianDays >= theStartJulianDays)
+                {
+                    anEvent = CalendarEvent{julianDays, CalendarEventType::Easter, 0};
+                    return true;
+                }
+            }
+        }
+
+    private:
+        int theYear;
+        double theStartJulianDays;
+        double theEndJulianDays;
+};
+
+/// The equinoxes and solstices in a range.
+class SeasonSource : public CalendarEventSource
+{
+    public:
+        SeasonSource(const JulianDate& aStart, const JulianDate& anEnd) :
+            theYear(aStart.getDateAndTime().getYear() - 1),
+            theSeason(0),
+            theStartJulianDays(aStart.getDecimalDays()),
+            theEndJulianDays(anEnd.getDecimalDays())
+        {
+        }
+
+        bool next(CalendarEvent& anEvent) override
+        {
+            while (true)
+            {
+                double julianDays = SUN_UTIL::calculateSeason(theYear, static_cast<SeasonType>(theSeason));
+                if (julianDays > theEndJulianDays)
+                {
+                    return false;
+                }
+                int season = theSeason;
+                if (++theSeason == 4)
+                {
+                    theSeason = 0;
+                    theYear++;
+                }
+                if (julianDays >= theStartJulianDays)
+                {
+                    anEvent = CalendarEvent{julianDays, CalendarEventType::Season, season};
+                    return true;
+                }
+            }
+        }
+
+    private:
+        int theYear;
+        int theSeason;
+        double theStartJulianDays;
+        double theEndJulianDays;
+};
+
+/// Adapts LunarPhaseGenerator.
+class LunarPhaseSource : public CalendarEventSource
+{
+    public:
+        LunarPhaseSource(const JulianDate& aStart, const JulianDate& anEnd) :
+            theGenerator(aStart, anEnd)
+        {
+        }
+
+        bool next(CalendarEvent& anEvent) override
+        {
+            LunarPhaseEvent phase;
+            if (!theGenerator.next(phase))
+            {
+                return false;
+            }
+            anEvent = CalendarEvent{phase.julianDays, CalendarEventType::LunarPhase, static_cast<int>(phase.type)};
+            return true;
+        }
+
+    private:
+        LunarPhaseGenerator theGenerator;
+};
+
+/// Adapts EclipseGenerator.
+class EclipseSource : public CalendarEventSource
+{
+    public:
+        EclipseSource(const JulianDate& aStart, const JulianDate& anEnd) :
+            theGenerator(aStart, anEnd)
+        {
+        }
+
+        bool next(CalendarEvent& anEvent) override
+        {
+            Eclipse eclipse;
+            if (!theGenerator.next(eclipse))
+            {
+                return false;
+            }
+            anEvent = CalendarEvent{eclipse.maximumJulianDays, CalendarEventType::Eclipse, static_cast<int>(eclipse.type)};
+            return true;
+        }
+
+    private:
+        EclipseGenerator theGenerator;
+};
+
+/// Adapts PlanetEventGenerator.
+class PlanetEventSource : public CalendarEventSource
+{
+    public:
+        PlanetEventSource(Planets aPlanet, const JulianDate& aStart, const JulianDate& anEnd) :
+            theGenerator(aPlanet, aStart, anEnd)
+        {
+        }
+
+        bool next(CalendarEvent& anEvent) override
+        {
+            PlanetEvent event;
+            if (!theGenerator.next(event))
+            {
+                return false;
+            }
+            CalendarEventType type = (event.type == PlanetEventType::Opposition)
+                                     ? CalendarEventType::Opposition
+                                     : CalendarEventType::Conjunction;
+            anEvent = CalendarEvent{event.julianDays, type, static_cast<int>(event.planet)};
+            return true;
+        }
+
+    private:
+        PlanetEventGenerator theGenerator;
+};
+
+} // end anonymous namespace
+
+AstronomicalCalendar::AstronomicalCalendar(const JulianDate& aStart,
+                                           const JulianDate& anEnd) :
+    theStart(aStart),
+    theEnd(anEnd)
+{
+}
+
+void AstronomicalCalendar::addEaster()
+{
+    addSource(std::unique_ptr<CalendarEventSource>(new EasterSource(theStart, theEnd)));
+}
+
+void AstronomicalCalendar::addSeasons()
+{
+    addSource(std::unique_ptr<CalendarEventSource>(new SeasonSource(theStart, theEnd)));
+}
+
+void AstronomicalCalendar::addLunarPhases()
+{
+    addSource(std::unique_ptr<CalendarEventSource>(new LunarPhaseSource(theStart, theEnd)));
+}
+
+void AstronomicalCalendar::addEclipses()
+{
+    addSource(std::unique_ptr<CalendarEventSource>(new EclipseSource(theStart, theEnd)));
+}
+
+void AstronomicalCalendar::addPlanetEvents(Planets aPlanet)
+{
+    addSource(std::unique_ptr<CalendarEventSource>(new PlanetEventSource(aPlanet, theStart, theEnd)));
+}
+
+void AstronomicalCalendar::addSource(std::unique_ptr<CalendarEventSource> aSource)
+{
+    if (!aSource)
+    {
+        return;
+    }
+    theSources.push_back(std::move(aSource));
+    refill(theSources.size() - 1);
+}
+
+bool AstronomicalCalendar::next(CalendarEvent& anEvent)
+{
+    if (theHeads.empty())
+    {
+        return false;
+    }
+    Head head = theHeads.top();
+    theHeads.pop();
+    anEvent = head.event;
+    refill(head.source);
+    return true;
+}
+
+bool AstronomicalCalendar::Later::operator()(const Head& aLeft, const Head& aRight) const
+{
+    if (aLeft.event.julianDays != aRight.event.julianDays)
+    {
+        return aLeft.event.julianDays > aRight.event.julianDays;
+    }
+    return aLeft.source > aRight.source;
+}
+
+void AstronomicalCalendar::refill(std::size_t aSource)
+{
+    Head head;
+    head.source = aSource;
+    if (theSources[aSource]->next(head.event))
+    {
+        theHeads.push(head);
+    }
+}
+
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::CalendarEventType& aType)
+{
+    switch (aType)
+    {
+        case SPA::CalendarEventType::Easter:
+            os << "Easter";
+            break;
+        case SPA::CalendarEventType::Season:
+            os << "Season";
+            break;
+        case SPA::CalendarEventType::LunarPhase:
+            os << "Lunar phase";
+            break;
+        case SPA::CalendarEventType::Eclipse:
+            os << "Eclipse";
+            break;
+        case SPA::CalendarEventType::Conjunction:
+            os << "Conjunction";
+            break;
+        case SPA::CalendarEventType::Opposition:
+            os << "Opposition";
+            break;
+        default:
+            os << "Invalid CalendarEventType";
+            break;
+    }
+    return os;
+}
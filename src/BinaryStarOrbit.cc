@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file BinaryStarOrbit.cc
+ * @brief Definition of the BinaryStarOrbit class
+ * @ingroup group_orbits
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "BinaryStarOrbit.h"
+#include "KeplerUtilities.h"
+#include "AngleUtilities.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+namespace
+{
+
+/// Elements of a circular face-on orbit of 1 arcsecond and 1 year.
+constexpr BinaryStarElements DEFAULT_BINARY_ELEMENTS = {1.0, 2000.0, 0.0, 1.0, 0.0, 0.0, 0.0};
+
+} // end anonymous namespace
+
+BinaryStarOrbit::BinaryStarOrbit() : BinaryStarOrbit(DEFAULT_BINARY_ELEMENTS)
+{
+}
+
+BinaryStarOrbit::BinaryStarOrbit(const BinaryStarElements& anElements) :
+    theElements(anElements),
+    thePeriastronJulianDays(SPA_J2000_EPOCH + (anElements.periastronEpoch - 2000.0) * SPA_DAYS_IN_JULIAN_YEAR),
+    theDailyMotion(SPA_TWO_PI / (anElements.period * SPA_DAYS_IN_JULIAN_YEAR)),
+    theEccentricity(anElements.eccentricity),
+    theEccentricityFactor(std::sqrt(1.0 - anElements.eccentricity * anElements.eccentricity)),
+    theA(0.0),
+    theB(0.0),
+    theF(0.0),
+    theG(0.0)
+{
+    double periastron = anElements.argumentOfPeriastron * SPA_DEGREES_TO_RADIANS;
+    double node = anElements.positionAngleOfNode * SPA_DEGREES_TO_RADIANS;
+    double cosIncl = std::cos(anElements.inclination * SPA_DEGREES_TO_RADIANS);
+    double cosPeri = std::cos(periastron);
+    double sinPeri = std::sin(periastron);
+    double cosNode = std::cos(node);
+    double sinNode = std::sin(node);
+    double axis = anElements.semiMajorAxis;
+
+    theA = axis * (cosPeri * cosNode - sinPeri * sinNode * cosIncl);
+    theB = axis * (cosPeri * sinNode + sinPeri * cosNode * cosIncl);
+    theF = axis * (-sinPeri * cosNode - cosPeri * sinNode * cosIncl);
+    theG = axis * (-sinPeri * sinNode + cosPeri * cosNode * cosIncl);
+}
+
+BinaryStarPosition BinaryStarOrbit::calculatePosition(double aJulianDays) const
+{
+    BinaryStarPosition position;
+    calculatePositions(&aJulianDays, 1, &position.positionAngle, &position.separation);
+    return position;
+}
+
+void BinaryStarOrbit::calculatePositions(const double* aJulianDays,
+                                         std::size_t aCount,
+                                         double* aPositionAngles,
+                                         double* aSeparations) const
+{
+    // Mean anomalies are parked in aPositionAngles for the in-place Kepler solve.
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aPositionAngles[index] = theDailyMotion * (aJulianDays[index] - thePeriastronJulianDays);
+    }
+    KEPLER_UTIL::solveKeplerElliptic(aPositionAngles, aCount, theEccentricity, aPositionAngles);
+
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        double eccAnomaly = aPositionAngles[index];
+        double alongMajor = std::cos(eccAnomaly) - theEccentricity;
+        double alongMinor = theEccentricityFactor * std::sin(eccAnomaly);
+        double north = theA * alongMajor + theF * alongMinor;
+        double east = theB * alongMajor + theG * alongMinor;
+        aSeparations[index] = std::sqrt(north * north + east * east);
+        aPositionAngles[index] = ANGLE_UTIL::normalizeDegrees(std::atan2(east, north) * SPA_RADIANS_TO_DEGREES);
+    }
+    return;
+}
+
+void BinaryStarOrbit::getThieleInnesConstants(double& anA, double& aB, double& anF, double& aG) const
+{
+    anA = theA;
+    aB = theB;
+    anF = theF;
+    aG = theG;
+}
+
+} // end namespace SPA
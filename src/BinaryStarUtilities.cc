@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file BinaryStarUtilities.cc
+ * @brief Definition of functions in the BINARYSTAR_UTIL namespace
+ * @ingroup group_orbits
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "BinaryStarUtilities.h"
+#include "JulianDate.h"
+
+namespace SPA
+{
+
+void BinaryStarPositionArrays::resize(std::size_t aSize)
+{
+    positionAngle.resize(aSize);
+    separation.resize(aSize);
+}
+
+BinaryStarPosition BinaryStarPositionArrays::at(std::size_t anIndex) const
+{
+    BinaryStarPosition position;
+    position.positionAngle = positionAngle.at(anIndex);
+    position.separation = separation.at(anIndex);
+    return position;
+}
+
+namespace BINARYSTAR_UTIL
+{
+
+BinaryStarPosition calculateBinaryStarPosition(const BinaryStarElements& anElements,
+                                               const JulianDate& aJulianDate)
+{
+    return BinaryStarOrbit(anElements).calculatePosition(aJulianDate.getDecimalDays());
+}
+
+void calculateBinaryStarPositions(const BinaryStarOrbit& anOrbit,
+                                  const double* aJulianDays,
+                                  std::size_t aCount,
+                                  BinaryStarPositionArrays& aPositions)
+{
+    aPositions.resize(aCount);
+    anOrbit.calculatePositions(aJulianDays, aCount, aPositions.positionAngle.data(), aPositions.separation.data());
+    return;
+}
+
+void calculateBinaryStarPositionGrid(const std::vector<BinaryStarOrbit>& anOrbits,
+                                     const double* aJulianDays,
+                                     std::size_t aCount,
+                                     BinaryStarPositionArrays& aPositions)
+{
+    aPositions.resize(anOrbits.size() * aCount);
+    for (std::size_t binary = 0; binary < anOrbits.size(); binary++)
+    {
+        std::size_t offset = binary * aCount;
+        anOrbits[binary].calculatePositions(aJulianDays, aCount,
+                                            aPositions.positionAngle.data() + offset,
+                                            aPositions.separation.data() + offset);
+    }
+    return;
+}
+
+} // end namespace BINARYSTAR_UTIL
+} // end namespace SPA
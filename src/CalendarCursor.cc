@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CalendarCursor.cc
+ * @brief Definition of CalendarCursor class functions
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CalendarCursor.h"
+#include "SpaDate.h"
+#include "TimeUtilities.h"
+
+#include <algorithm>
+#include <ostream>
+
+namespace SPA
+{
+
+namespace
+{
+
+/// Number of days in a month, from the leap year month starts
+int daysInMonth(int aMonth, bool aLeapYear)
+{
+    int nextMonthStart = (aMonth < DEC) ? SPA_DAYSTART_LEAPYEAR[aMonth] : SPA_DAYS_IN_NONLEAP_YEAR + 1;
+    int days = nextMonthStart - SPA_DAYSTART_LEAPYEAR[aMonth - 1];
+    return (aMonth == FEB && !aLeapYear) ? days - 1 : days;
+}
+
+/*
+ * Year of the first Gregorian calendar cycle. The 400 year cycle is
+ * exactly 20871 weeks long, so earlier years have the weekdays of the
+ * same date in this cycle.
+ */
+constexpr int FIRST_GREGORIAN_CYCLE_YEAR = 1583;
+constexpr int YEARS_IN_GREGORIAN_CYCLE = 400;
+
+} // end anonymous namespace
+
+CalendarCursor::CalendarCursor(const SpaDate& aFirst,
+                               const SpaDate& aLast,
+                               CalendarStep aStep) :
+        theYear(aFirst.getYear()),
+        theMonth(aFirst.getMonth()),
+        theDay(aFirst.getDay()),
+        theDayOfYear(TIME_UTIL::calculateDayNumber(theYear, theMonth, theDay)),
+        theWeekDay(SUN),
+        theDaysInMonth(0),
+        theMonthDay(theDay),
+        theLeapYear(TIME_UTIL::isLeapYear(theYear)),
+        theStep(aStep),
+        theLastYear(aLast.getYear()),
+        theLastMonth(aLast.getMonth()),
+        theLastDay(aLast.getDay())
+{
+    theDaysInMonth = daysInMonth(theMonth, theLeapYear);
+
+    // calculateDayInTheWeek() reads earlier dates as Julian calendar dates
+    int weekYear = theYear;
+    if (weekYear < FIRST_GREGORIAN_CYCLE_YEAR)
+    {
+        int cycles = (FIRST_GREGORIAN_CYCLE_YEAR - weekYear + YEARS_IN_GREGORIAN_CYCLE - 1) / YEARS_IN_GREGORIAN_CYCLE;
+        weekYear += cycles * YEARS_IN_GREGORIAN_CYCLE;
+    }
+    theWeekDay = TIME_UTIL::calculateDayInTheWeek(weekYear, theMonth, theDay);
+}
+
+void CalendarCursor::nextMonth()
+{
+    int daysToMonthEnd = theDaysInMonth - theDay;
+    startNextMonth();
+    int day = std::min(theMonthDay, theDaysInMonth);
+    theWeekDay = (theWeekDay + daysToMonthEnd + day) % SPA_DAYS_PER_WEEK;
+    theDayOfYear += day - 1;
+    theDay = day;
+}
+
+void CalendarCursor::advanceDays(int aDays)
+{
+    theWeekDay = (theWeekDay + aDays % SPA_DAYS_PER_WEEK) % SPA_DAYS_PER_WEEK;
+    int remaining = aDays;
+    while (remaining > theDaysInMonth - theDay)
+    {
+        remaining -= theDaysInMonth - theDay + 1;
+        startNextMonth();
+    }
+    theDay += remaining;
+    theDayOfYear += remaining;
+    theMonthDay = theDay;
+}
+
+SpaDate CalendarCursor::getSpaDate() const
+{
+    return SpaDate(theYear, theMonth, theDay);
+}
+
+void CalendarCursor::startNextMonth()
+{
+    if (theMonth == DEC)
+    {
+        theYear++;
+        theMonth = JAN;
+        theDayOfYear = 1;
+        theLeapYear = TIME_UTIL::isLeapYear(theYear);
+    }
+    else
+    {
+        theDayOfYear += theDaysInMonth - theDay + 1;
+        theMonth++;
+    }
+    theDay = 1;
+    theDaysInMonth = daysInMonth(theMonth, theLeapYear);
+}
+
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::CalendarStep& aStep)
+{
+    switch (aStep)
+    {
+        case SPA::CalendarStep::Day:
+            os << "Day";
+            break;
+        case SPA::CalendarStep::Week:
+            os << "Week";
+            break;
+        case SPA::CalendarStep::Month:
+            os << "Month";
+            break;
+        default:
+            os << "Invalid CalendarStep";
+            break;
+    }
+    return os;
+}
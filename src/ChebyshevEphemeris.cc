@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevEphemeris.cc
+ * @brief Definition of ChebyshevEphemeris functions
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevEphemeris.h"
+#include "AngleUtilities.h"
+#include "ChebyshevUtilities.h"
+#include "JulianDate.h"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SPA_EPHEMERIS_USE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SPA
+{
+
+static_assert(sizeof(EphemerisFileHeader) % sizeof(double) == 0,
+              "Coefficients following the header must stay aligned");
+
+ChebyshevEphemeris::ChebyshevEphemeris() :
+    theHeader(nullptr),
+    theData(nullptr),
+    theStorage(),
+    theMapping(nullptr),
+    theMappingSize(0)
+{
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(std::vector<char> aBlob) :
+    theHeader(nullptr),
+    theData(nullptr),
+    theStorage(std::move(aBlob)),
+    theMapping(nullptr),
+    theMappingSize(0)
+{
+    attach(theStorage.data(), theStorage.size());
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(const void* aData,
+                                       std::size_t aSize) :
+    theHeader(nullptr),
+    theData(nullptr),
+    theStorage(),
+    theMapping(nullptr),
+    theMappingSize(0)
+{
+    attach(aData, aSize);
+}
+
+ChebyshevEphemeris::ChebyshevEphemeris(const std::string& aFileName) :
+    theHeader(nullptr),
+    theData(nullptr),
+    theStorage(),
+    theMapping(nullptr),
+    theMappingSize(0)
+{
+#ifdef SPA_EPHEMERIS_USE_MMAP
+    int fd = ::open(aFileName.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        struct stat status;
+        if (::fstat(fd, &status) == 0 && status.st_size > 0)
+        {
+            std::size_t size = static_cast<std::size_t>(status.st_size);
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED)
+            {
+                theMapping = mapping;
+                theMappingSize = size;
+            }
+        }
+        ::close(fd);
+    }
+    if (theMapping != nullptr)
+    {
+        attach(theMapping, theMappingSize);
+        return;
+    }
+#endif
+
+    // Fall back to reading the whole file. std::vector<char> storage
+    // comes from operator new, which is suitably aligned for doubles.
+    std::ifstream input(aFileName, std::ios::binary);
+    if (input)
+    {
+        theStorage.assign(std::istreambuf_iterator<char>(input),
+                          std::istreambuf_iterator<char>());
+        attach(theStorage.data(), theStorage.size());
+    }
+}
+
+ChebyshevEphemeris::~ChebyshevEphemeris()
+{
+#ifdef SPA_EPHEMERIS_USE_MMAP
+    if (theMapping != nullptr)
+    {
+        ::munmap(theMapping, theMappingSize);
+    }
+#endif
+}
+
+void ChebyshevEphemeris::attach(const void* aData,
+                                std::size_t aSize)
+{
+    theHeader = nullptr;
+    theData = static_cast<const char*>(aData);
+    if (aData == nullptr
+        || aSize < sizeof(EphemerisFileHeader)
+        || reinterpret_cast<std::uintptr_t>(aData) % alignof(double) != 0)
+    {
+        return;
+    }
+
+    const EphemerisFileHeader* header = static_cast<const EphemerisFileHeader*>(aData);
+    if (std::memcmp(header->magic, "SPAEPHEM", sizeof(header->magic)) != 0
+        || header->byteOrder != 0x01020304u
+        || header->version != SPA_EPHEMERIS_FORMAT_VERSION
+        || header->totalBytes > aSize
+        || !(header->endJulianDays > header->startJulianDays))
+    {
+        return;
+    }
+
+    for (int body = 0; body < SPA_EPHEMERIS_MAX_BODIES; body++)
+    {
+        const EphemerisBodyEntry& entry = header->bodies[body];
+        if (entry.body < 0)
+        {
+            continue;
+        }
+        if (entry.body != body
+            || entry.numComponents == 0 || entry.numComponents > 32
+            || entry.numCoefficients == 0
+            || entry.numSegments == 0
+            || !(entry.segmentDays > 0)
+            || !(entry.numSegments * entry.segmentDays >= header->endJulianDays - header->startJulianDays)
+            || entry.offset % sizeof(double) != 0
+            || entry.offset < sizeof(EphemerisFileHeader)
+            || entry.offset > header->totalBytes)
+        {
+            return;
+        }
+
+        // Compared by division, as the byte count of a corrupt entry
+        // can overflow.
+        std::uint64_t available = (header->totalBytes - entry.offset) / sizeof(double);
+        std::uint64_t perCoefficient = std::uint64_t(entry.numSegments) * entry.numComponents;
+        if (entry.numCoefficients > available / perCoefficient)
+        {
+            return;
+        }
+    }
+
+    theHeader = header;
+}
+
+bool ChebyshevEphemeris::hasBody(int aBody) const
+{
+    return theHeader != nullptr
+        && aBody >= 0 && aBody < SPA_EPHEMERIS_MAX_BODIES
+        && theHeader->bodies[aBody].body == aBody;
+}
+
+std::size_t ChebyshevEphemeris::getNumComponents(int aBody) const
+{
+    return hasBody(aBody) ? theHeader->bodies[aBody].numComponents : 0;
+}
+
+double ChebyshevEphemeris::getStartJulianDays() const
+{
+    return theHeader != nullptr ? theHeader->startJulianDays : 0.0;
+}
+
+double ChebyshevEphemeris::getEndJulianDays() const
+{
+    return theHeader != nullptr ? theHeader->endJulianDays : 0.0;
+}
+
+bool ChebyshevEphemeris::evaluate(int aBody,
+                                  double aJulianDays,
+                                  double* aComponents) const
+{
+    // Written so that a NaN time also fails the range test.
+    if (!hasBody(aBody)
+        || !(aJulianDays >= theHeader->startJulianDays && aJulianDays <= theHeader->endJulianDays))
+    {
+        return false;
+    }
+
+    const EphemerisBodyEntry& entry = theHeader->bodies[aBody];
+    double elapsed = aJulianDays - theHeader->startJulianDays;
+    std::size_t segment = static_cast<std::size_t>(elapsed / entry.segmentDays);
+    if (segment >= entry.numSegments)
+    {
+        segment = entry.numSegments - 1;
+    }
+    double x = 2.0 * (elapsed - double(segment) * entry.segmentDays) / entry.segmentDays - 1.0;
+
+    const double* coefficients = reinterpret_cast<const double*>(theData + entry.offset)
+        + segment * entry.numComponents * entry.numCoefficients;
+    for (std::uint32_t component = 0; component < entry.numComponents; component++)
+    {
+        double value = CHEBYSHEV_UTIL::evaluateChebyshev(coefficients + component * entry.numCoefficients,
+                                                         entry.numCoefficients,
+                                                         x);
+        if (entry.angleMask & (1u << component))
+        {
+            value = ANGLE_UTIL::normalizeDegrees(value);
+        }
+        aComponents[component] = value;
+    }
+    return true;
+}
+
+bool ChebyshevEphemeris::evaluate(int aBody,
+                                  const JulianDate& aJulianDate,
+                                  double* aComponents) const
+{
+    return evaluate(aBody, aJulianDate.getDecimalDays(), aComponents);
+}
+
+} // end namespace SPA
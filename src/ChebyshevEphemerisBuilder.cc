@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevEphemerisBuilder.cc
+ * @brief Definition of ChebyshevEphemerisBuilder functions
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevEphemerisBuilder.h"
+#include "ChebyshevUtilities.h"
+#include "PlanetUtilities.h"
+#include "SpaConstants.h"
+#include "SunUtilities.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+namespace SPA
+{
+
+ChebyshevEphemerisBuilder::ChebyshevEphemerisBuilder(double aStartJulianDays,
+                                                     double anEndJulianDays) :
+    theStartJulianDays(aStartJulianDays),
+    theEndJulianDays(anEndJulianDays),
+    theBodies()
+{
+}
+
+bool ChebyshevEphemerisBuilder::addBody(int aBody,
+                                        double aSegmentDays,
+                                        std::size_t aNumCoefficients,
+                                        std::size_t aNumComponents,
+                                        std::uint32_t anAngleMask,
+                                        const Sampler& aSampler)
+{
+    if (aBody < 0 || aBody >= SPA_EPHEMERIS_MAX_BODIES
+        || !(aSegmentDays > 0)
+        || aNumCoefficients == 0
+        || aNumComponents == 0 || aNumComponents > 32
+        || !aSampler)
+    {
+        return false;
+    }
+
+    theBodies.erase(std::remove_if(theBodies.begin(), theBodies.end(),
+                                   [aBody](const BodySpec& aSpec) { return aSpec.body == aBody; }),
+                    theBodies.end());
+    theBodies.push_back(BodySpec{aBody, aSegmentDays, aNumCoefficients, aNumComponents, anAngleMask, aSampler});
+    return true;
+}
+
+void ChebyshevEphemerisBuilder::addSun()
+{
+    addBody(SPA_EPHEMERIS_SUN,
+            SPA_EPHEMERIS_SUN_SEGMENT_DAYS,
+            SPA_EPHEMERIS_SUN_COEFFICIENTS,
+            3,
+            1u,
+            [](const double* aJulianDays, std::size_t aCount, double* aValues)
+            {
+                SunPositionArrays positions;
+                SUN_UTIL::calculateSunPositions(aJulianDays, aCount, positions);
+                std::copy(positions.eclipticLongitude.begin(), positions.eclipticLongitude.end(), aValues);
+                std::fill(aValues + aCount, aValues + 2 * aCount, 0.0);
+                std::copy(positions.distance.begin(), positions.distance.end(), aValues + 2 * aCount);
+            });
+}
+
+bool ChebyshevEphemerisBuilder::addPlanet(Planets aPlanet)
+{
+    if (aPlanet == EARTH)
+    {
+        return false;
+    }
+
+    return addBody(aPlanet,
+                   SPA_EPHEMERIS_PLANET_SEGMENT_DAYS[aPlanet],
+                   SPA_EPHEMERIS_PLANET_COEFFICIENTS,
+                   3,
+                   1u,
+                   [aPlanet](const double* aJulianDays, std::size_t aCount, double* aValues)
+                   {
+                       PlanetPositionArrays positions;
+                       PLANET_UTIL::calculatePlanetPositions(aPlanet, aJulianDays, aCount, positions);
+                       std::copy(positions.eclipticLongitude.begin(), positions.eclipticLongitude.end(), aValues);
+                       std::copy(positions.eclipticLatitude.begin(), positions.eclipticLatitude.end(), aValues + aCount);
+                       std::copy(positions.distance.begin(), positions.distance.end(), aValues + 2 * aCount);
+                   });
+}
+
+std::vector<char> ChebyshevEphemerisBuilder::build() const
+{
+    std::vector<char> blob;
+    if (theBodies.empty() || !(theEndJulianDays > theStartJulianDays))
+    {
+        return blob;
+    }
+
+    EphemerisFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "SPAEPHEM", sizeof(header.magic));
+    header.byteOrder = 0x01020304u;
+    header.version = SPA_EPHEMERIS_FORMAT_VERSION;
+    header.startJulianDays = theStartJulianDays;
+    header.endJulianDays = theEndJulianDays;
+    for (int body = 0; body < SPA_EPHEMERIS_MAX_BODIES; body++)
+    {
+        header.bodies[body].body = -1;
+    }
+
+    // Lay out the directory first so the coefficients can be fitted
+    // straight into their final place in the blob.
+    std::uint64_t offset = sizeof(EphemerisFileHeader);
+    for (const BodySpec& spec : theBodies)
+    {
+        EphemerisBodyEntry& entry = header.bodies[spec.body];
+        entry.body = spec.body;
+        entry.numComponents = static_cast<std::uint32_t>(spec.numComponents);
+        entry.numCoefficients = static_cast<std::uint32_t>(spec.numCoefficients);
+        double span = theEndJulianDays - theStartJulianDays;
+        entry.numSegments = static_cast<std::uint32_t>(std::ceil(span / spec.segmentDays));
+        if (entry.numSegments * spec.segmentDays < span)
+        {
+            // The quotient rounded down onto a whole number
+            entry.numSegments++;
+        }
+        entry.angleMask = spec.angleMask;
+        entry.segmentDays = spec.segmentDays;
+        entry.offset = offset;
+        offset += std::uint64_t(entry.numSegments) * entry.numComponents * entry.numCoefficients * sizeof(double);
+    }
+    header.totalBytes = offset;
+
+    blob.resize(offset);
+    std::memcpy(blob.data(), &header, sizeof(header));
+
+    for (const BodySpec& spec : theBodies)
+    {
+        const EphemerisBodyEntry& entry = header.bodies[spec.body];
+        std::size_t numSegments = entry.numSegments;
+        std::size_t numCoefficients = spec.numCoefficients;
+        std::size_t numComponents = spec.numComponents;
+
+        std::vector<double> nodes(numCoefficients);
+        CHEBYSHEV_UTIL::calculateChebyshevNodes(numCoefficients, nodes.data());
+
+        std::size_t numTimes = numSegments * numCoefficients;
+        std::vector<double> times(numTimes);
+        for (std::size_t segment = 0; segment < numSegments; segment++)
+        {
+            double midpoint = theStartJulianDays + spec.segmentDays * (double(segment) + 0.5);
+            for (std::size_t node = 0; node < numCoefficients; node++)
+            {
+                times[segment * numCoefficients + node] = midpoint + 0.5 * spec.segmentDays * nodes[node];
+            }
+        }
+
+        std::vector<double> values(numComponents * numTimes);
+        spec.sampler(times.data(), numTimes, values.data());
+
+        std::vector<double> segmentValues(numCoefficients);
+        double* coefficients = reinterpret_cast<double*>(blob.data() + entry.offset);
+        for (std::size_t segment = 0; segment < numSegments; segment++)
+        {
+            for (std::size_t component = 0; component < numComponents; component++)
+            {
+                const double* source = values.data() + component * numTimes + segment * numCoefficients;
+                std::copy(source, source + numCoefficients, segmentValues.begin());
+
+                // Remove any 360 degree jumps so the fitted curve is smooth.
+                if (spec.angleMask & (1u << component))
+                {
+                    for (std::size_t node = 1; node < numCoefficients; node++)
+                    {
+                        double step = segmentValues[node] - segmentValues[node - 1];
+                        segmentValues[node] -= SPA_DEGREES_IN_CIRCLE * std::round(step / SPA_DEGREES_IN_CIRCLE);
+                    }
+                }
+
+                CHEBYSHEV_UTIL::fitChebyshevCoefficients(segmentValues.data(),
+                                                         numCoefficients,
+                                                         coefficients + (segment * numComponents + component) * numCoefficients);
+            }
+        }
+    }
+
+    return blob;
+}
+
+bool ChebyshevEphemerisBuilder::write(const std::string& aFileName) const
+{
+    std::vector<char> blob = build();
+    if (blob.empty())
+    {
+        return false;
+    }
+
+    std::ofstream output(aFileName, std::ios::binary | std::ios::trunc);
+    output.write(blob.data(), static_cast<std::streamsize>(blob.size()));
+    return static_cast<bool>(output);
+}
+
+} // end namespace SPA
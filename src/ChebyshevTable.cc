@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevTable.cc
+ * @brief Definition of ChebyshevTable functions
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevTable.h"
+#include "ChebyshevUtilities.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SPA
+{
+
+ChebyshevTable::ChebyshevTable() :
+    theStart(0),
+    theSegmentLength(1),
+    theNumSegments(0),
+    theNumCoefficients(0),
+    theCoefficients()
+{
+}
+
+ChebyshevTable::ChebyshevTable(double aStart,
+                               double aSegmentLength,
+                               std::size_t aNumSegments,
+                               std::size_t aNumCoefficients,
+                               const Sampler& aSampler) :
+    theStart(aStart),
+    theSegmentLength(aSegmentLength),
+    theNumSegments(aNumSegments),
+    theNumCoefficients(aNumCoefficients),
+    theCoefficients(aNumSegments * aNumCoefficients)
+{
+    std::vector<double> nodes(aNumCoefficients);
+    CHEBYSHEV_UTIL::calculateChebyshevNodes(aNumCoefficients, nodes.data());
+
+    std::vector<double> times(aNumSegments * aNumCoefficients);
+    for (std::size_t segment = 0; segment < aNumSegments; segment++)
+    {
+        double midpoint = aStart + aSegmentLength * (double(segment) + 0.5);
+        for (std::size_t node = 0; node < aNumCoefficients; node++)
+        {
+            times[segment * aNumCoefficients + node] = midpoint + 0.5 * aSegmentLength * nodes[node];
+        }
+    }
+
+    std::vector<double> values(times.size());
+    aSampler(times.data(), times.size(), values.data());
+
+    for (std::size_t segment = 0; segment < aNumSegments; segment++)
+    {
+        CHEBYSHEV_UTIL::fitChebyshevCoefficients(values.data() + segment * aNumCoefficients,
+                                                 aNumCoefficients,
+                                                 theCoefficients.data() + segment * aNumCoefficients);
+    }
+}
+
+ChebyshevTable::ChebyshevTable(double aStart,
+                               double aSegmentLength,
+                               std::size_t aNumCoefficients,
+                               const std::vector<double>& aCoefficients) :
+    theStart(aStart),
+    theSegmentLength(aSegmentLength),
+    theNumSegments(aNumCoefficients > 0 ? aCoefficients.size() / aNumCoefficients : 0),
+    theNumCoefficients(aNumCoefficients),
+    theCoefficients(aCoefficients)
+{
+    theCoefficients.resize(theNumSegments * theNumCoefficients);
+}
+
+std::size_t ChebyshevTable::locate(double aTime, double& anX) const
+{
+    double position = (aTime - theStart) / theSegmentLength;
+    double segment = std::floor(position);
+    segment = std::min(std::max(segment, 0.0), double(theNumSegments - 1));
+    anX = 2.0 * (position - segment) - 1.0;
+    return std::size_t(segment);
+}
+
+double ChebyshevTable::evaluate(double aTime) const
+{
+    if (theNumSegments == 0)
+    {
+        return 0;
+    }
+    double x = 0;
+    std::size_t segment = locate(aTime, x);
+    return CHEBYSHEV_UTIL::evaluateChebyshev(theCoefficients.data() + segment * theNumCoefficients,
+                                             theNumCoefficients,
+                                             x);
+}
+
+void ChebyshevTable::evaluate(const double* aTimes,
+                              std::size_t aCount,
+                              double* aValues) const
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aValues[index] = evaluate(aTimes[index]);
+    }
+    return;
+}
+
+double ChebyshevTable::evaluateDerivative(double aTime) const
+{
+    if (theNumSegments == 0)
+    {
+        return 0;
+    }
+    double x = 0;
+    std::size_t segment = locate(aTime, x);
+    // dx/dt = 2 / segment length
+    return 2.0 / theSegmentLength
+                    * CHEBYSHEV_UTIL::evaluateChebyshevDerivative(theCoefficients.data() + segment * theNumCoefficients,
+                                                                  theNumCoefficients,
+                                                                  x);
+}
+
+} // end namespace SPA
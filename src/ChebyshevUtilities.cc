@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevUtilities.cc
+ * @brief Definitions of CHEBYSHEV_UTIL functions
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevUtilities.h"
+#include "SpaConstants.h"
+
+#include <cmath>
+
+namespace SPA
+{
+namespace CHEBYSHEV_UTIL
+{
+
+void calculateChebyshevNodes(std::size_t aCount,
+                             double* aNodes)
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aNodes[index] = std::cos(SPA_PI * (double(index) + 0.5) / double(aCount));
+    }
+    return;
+}
+
+void fitChebyshevCoefficients(const double* aValues,
+                              std::size_t aCount,
+                              double* aCoefficients)
+{
+    double scale = 2.0 / double(aCount);
+    for (std::size_t order = 0; order < aCount; order++)
+    {
+        double sum = 0.0;
+        for (std::size_t index = 0; index < aCount; index++)
+        {
+            sum += aValues[index] * std::cos(SPA_PI * double(order) * (double(index) + 0.5) / double(aCount));
+        }
+        aCoefficients[order] = scale * sum;
+    }
+    aCoefficients[0] *= 0.5;
+    return;
+}
+
+} // end namespace CHEBYSHEV_UTIL
+} // end namespace SPA
@@ -0,0 +1,267 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CometOrbitTable.cc
+ * @brief Definition of the CometOrbitTable class
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CometOrbitTable.h"
+#include "KeplerUtilities.h"
+#include "SpaPlanetConstants.h"
+#include "SpaConstants.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SPA
+{
+
+void CometOrbitTable::reserve(std::size_t aSize)
+{
+    thePerihelionJulianDays.reserve(aSize);
+    thePerihelionDistance.reserve(aSize);
+    theEccentricity.reserve(aSize);
+    theArgumentOfPerihelion.reserve(aSize);
+    theLongitudeOfAscendingNode.reserve(aSize);
+    theInclination.reserve(aSize);
+    theMeanMotion.reserve(aSize);
+    theSemiMajorAxis.reserve(aSize);
+    theSemiMinorAxis.reserve(aSize);
+    thePx.reserve(aSize);
+    thePy.reserve(aSize);
+    thePz.reserve(aSize);
+    theQx.reserve(aSize);
+    theQy.reserve(aSize);
+    theQz.reserve(aSize);
+    theKind.reserve(aSize);
+    theNames.reserve(aSize);
+}
+
+void CometOrbitTable::clear()
+{
+    *this = CometOrbitTable();
+}
+
+std::size_t CometOrbitTable::add(const CometElements& anElements, const std::string& aName)
+{
+    std::size_t body = size();
+    double q = anElements.perihelionDistance;
+    double e = anElements.eccentricity;
+
+    OrbitKind kind;
+    double semiMajorAxis;
+    double semiMinorAxis;
+    double meanMotion;
+    if (std::fabs(e - 1.0) < SPA_COMET_PARABOLIC_LIMIT)
+    {
+        // Section 62: W = 3 k (t - T) / (sqrt(2) q^1.5), r = q (1 + s^2)
+        kind = PARABOLIC;
+        semiMajorAxis = q;
+        semiMinorAxis = 2.0 * q;
+        meanMotion = 3.0 * SPA_GAUSSIAN_GRAVITATIONAL_CONSTANT / (std::sqrt(2.0) * q * std::sqrt(q));
+    }
+    else
+    {
+        kind = (e < 1.0) ? ELLIPTIC : HYPERBOLIC;
+        semiMajorAxis = q / std::fabs(1.0 - e);
+        semiMinorAxis = semiMajorAxis * std::sqrt(std::fabs(1.0 - e * e));
+        meanMotion = SPA_GAUSSIAN_GRAVITATIONAL_CONSTANT / (semiMajorAxis * std::sqrt(semiMajorAxis));
+    }
+
+    double node = anElements.longitudeOfAscendingNode * SPA_DEGREES_TO_RADIANS;
+    double perihelion = anElements.argumentOfPerihelion * SPA_DEGREES_TO_RADIANS;
+    double inclination = anElements.inclination * SPA_DEGREES_TO_RADIANS;
+    double cosNode = std::cos(node);
+    double sinNode = std::sin(node);
+    double cosPeri = std::cos(perihelion);
+    double sinPeri = std::sin(perihelion);
+    double cosIncl = std::cos(inclination);
+    double sinIncl = std::sin(inclination);
+
+    thePerihelionJulianDays.push_back(anElements.perihelionJulianDays);
+    thePerihelionDistance.push_back(q);
+    theEccentricity.push_back(e);
+    theArgumentOfPerihelion.push_back(anElements.argumentOfPerihelion);
+    theLongitudeOfAscendingNode.push_back(anElements.longitudeOfAscendingNode);
+    theInclination.push_back(anElements.inclination);
+    theMeanMotion.push_back(meanMotion);
+    theSemiMajorAxis.push_back(semiMajorAxis);
+    theSemiMinorAxis.push_back(semiMinorAxis);
+    thePx.push_back(cosNode * cosPeri - sinNode * sinPeri * cosIncl);
+    thePy.push_back(sinNode * cosPeri + cosNode * sinPeri * cosIncl);
+    thePz.push_back(sinPeri * sinIncl);
+    theQx.push_back(-cosNode * sinPeri - sinNode * cosPeri * cosIncl);
+    theQy.push_back(-sinNode * sinPeri + cosNode * cosPeri * cosIncl);
+    theQz.push_back(cosPeri * sinIncl);
+    theKind.push_back(static_cast<unsigned char>(kind));
+    theBodiesOfKind[kind].push_back(body);
+    theNames.push_back(aName);
+    return body;
+}
+
+CometElements CometOrbitTable::getElements(std::size_t aBody) const
+{
+    CometElements elements;
+    elements.perihelionJulianDays = thePerihelionJulianDays.at(aBody);
+    elements.perihelionDistance = thePerihelionDistance.at(aBody);
+    elements.eccentricity = theEccentricity.at(aBody);
+    elements.argumentOfPerihelion = theArgumentOfPerihelion.at(aBody);
+    elements.longitudeOfAscendingNode = theLongitudeOfAscendingNode.at(aBody);
+    elements.inclination = theInclination.at(aBody);
+    return elements;
+}
+
+void CometOrbitTable::calculateHeliocentricPosition(std::size_t aBody,
+                                                    double aJulianDays,
+                                                    double& anX,
+                                                    double& aY,
+                                                    double& aZ) const
+{
+    calculateHeliocentricPositions(aBody, &aJulianDays, 1, &anX, &aY, &aZ);
+}
+
+void CometOrbitTable::calculateHeliocentricPositions(std::size_t aBody,
+                                                     const double* aJulianDays,
+                                                     std::size_t aCount,
+                                                     double* anX,
+                                                     double* aY,
+                                                     double* aZ) const
+{
+    // anX and aY hold xi and eta until the final rotation.
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        anX[index] = aJulianDays[index] - thePerihelionJulianDays[aBody];
+    }
+    solveInPlane(static_cast<OrbitKind>(theKind[aBody]), &aBody, 0, aCount, anX, aY);
+
+    double px = thePx[aBody];
+    double py = thePy[aBody];
+    double pz = thePz[aBody];
+    double qx = theQx[aBody];
+    double qy = theQy[aBody];
+    double qz = theQz[aBody];
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        double xi = anX[index];
+        double eta = aY[index];
+        anX[index] = xi * px + eta * qx;
+        aY[index] = xi * py + eta * qy;
+        aZ[index] = xi * pz + eta * qz;
+    }
+}
+
+void CometOrbitTable::calculateHeliocentricPositions(const double* aJulianDays,
+                                                     std::size_t aBegin,
+                                                     std::size_t anEnd,
+                                                     double* anX,
+                                                     double* aY,
+                                                     double* aZ) const
+{
+    std::vector<double> xi;
+    std::vector<double> eta;
+    for (int kind = 0; kind < NUM_ORBIT_KINDS; kind++)
+    {
+        const std::vector<std::size_t>& bodies = theBodiesOfKind[kind];
+        auto first = std::lower_bound(bodies.begin(), bodies.end(), aBegin);
+        auto last = std::lower_bound(first, bodies.end(), anEnd);
+        std::size_t count = static_cast<std::size_t>(last - first);
+        if (count == 0)
+        {
+            continue;
+        }
+
+        const std::size_t* batch = &*first;
+        xi.resize(count);
+        eta.resize(count);
+        for (std::size_t index = 0; index < count; index++)
+        {
+            std::size_t body = batch[index];
+            xi[index] = aJulianDays[body - aBegin] - thePerihelionJulianDays[body];
+        }
+        solveInPlane(static_cast<OrbitKind>(kind), batch, 1, count, xi.data(), eta.data());
+
+        for (std::size_t index = 0; index < count; index++)
+        {
+            std::size_t body = batch[index];
+            std::size_t out = body - aBegin;
+            anX[out] = xi[index] * thePx[body] + eta[index] * theQx[body];
+            aY[out] = xi[index] * thePy[body] + eta[index] * theQy[body];
+            aZ[out] = xi[index] * thePz[body] + eta[index] * theQz[body];
+        }
+    }
+}
+
+void CometOrbitTable::solveInPlane(OrbitKind aKind,
+                                   const std::size_t* aBodies,
+                                   std::size_t aBodyStride,
+                                   std::size_t aCount,
+                                   double* anXi,
+                                   double* anEta) const
+{
+    // Mean anomaly (or W) into anXi, eccentricity into anEta.
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        std::size_t body = aBodies[index * aBodyStride];
+        anXi[index] *= theMeanMotion[body];
+        anEta[index] = theEccentricity[body];
+    }
+
+    switch (aKind)
+    {
+        case ELLIPTIC:
+            KEPLER_UTIL::solveKeplerElliptic(anXi, anEta, aCount, anXi);
+            for (std::size_t index = 0; index < aCount; index++)
+            {
+                std::size_t body = aBodies[index * aBodyStride];
+                double anomaly = anXi[index];
+                anXi[index] = theSemiMajorAxis[body] * (std::cos(anomaly) - anEta[index]);
+                anEta[index] = theSemiMinorAxis[body] * std::sin(anomaly);
+            }
+            break;
+        case HYPERBOLIC:
+            KEPLER_UTIL::solveKeplerHyperbolic(anXi, anEta, aCount, anXi);
+            for (std::size_t index = 0; index < aCount; index++)
+            {
+                std::size_t body = aBodies[index * aBodyStride];
+                double anomaly = anXi[index];
+                anXi[index] = theSemiMajorAxis[body] * (anEta[index] - std::cosh(anomaly));
+                anEta[index] = theSemiMinorAxis[body] * std::sinh(anomaly);
+            }
+            break;
+        case PARABOLIC:
+            KEPLER_UTIL::solveBarkerEquation(anXi, aCount, anXi);
+            for (std::size_t index = 0; index < aCount; index++)
+            {
+                std::size_t body = aBodies[index * aBodyStride];
+                double s = anXi[index];
+                anXi[index] = theSemiMajorAxis[body] * (1.0 - s * s);
+                anEta[index] = theSemiMinorAxis[body] * s;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+} // end namespace SPA
@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CometUtilities.cc
+ * @brief Definition of functions in the COMET_UTIL namespace
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CometUtilities.h"
+#include "CometOrbitTable.h"
+#include "PlanetOrbit.h"
+#include "PlanetUtilities.h"
+#include "SpaPlanetConstants.h"
+#include "SpaConstants.h"
+#include "AngleUtilities.h"
+#include "JulianDate.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+
+namespace SPA
+{
+
+void CometPositionArrays::resize(std::size_t aSize)
+{
+    heliocentricLongitude.resize(aSize);
+    heliocentricLatitude.resize(aSize);
+    radiusVector.resize(aSize);
+    eclipticLongitude.resize(aSize);
+    eclipticLatitude.resize(aSize);
+    distance.resize(aSize);
+    lightTime.resize(aSize);
+}
+
+CometPosition CometPositionArrays::at(std::size_t anIndex) const
+{
+    CometPosition position;
+    position.heliocentricLongitude = heliocentricLongitude.at(anIndex);
+    position.heliocentricLatitude = heliocentricLatitude.at(anIndex);
+    position.radiusVector = radiusVector.at(anIndex);
+    position.eclipticLongitude = eclipticLongitude.at(anIndex);
+    position.eclipticLatitude = eclipticLatitude.at(anIndex);
+    position.distance = distance.at(anIndex);
+    position.lightTime = lightTime.at(anIndex);
+    return position;
+}
+
+namespace COMET_UTIL
+{
+
+namespace
+{
+
+/**
+ * Propagates the comets for output entries [aBegin, anEnd), each at
+ * its own time, to heliocentric rectangular coordinates.
+ */
+using Propagator = std::function<void(const double* aJulianDays,
+                                      std::size_t aBegin,
+                                      std::size_t anEnd,
+                                      double* anX,
+                                      double* aY,
+                                      double* aZ)>;
+
+/**
+ * Core of Sections 61 and 62 for output entries [aBegin, anEnd). Entry
+ * i is observed at aJulianDays[i * aStride] from the Earth at
+ * anEarth[i * aStride], so a stride of zero shares one epoch between
+ * every entry.
+ */
+void calculateCometPositionKernel(const Propagator& aPropagator,
+                                  const double* aJulianDays,
+                                  const double* anEarthX,
+                                  const double* anEarthY,
+                                  const double* anEarthZ,
+                                  std::size_t aStride,
+                                  std::size_t aBegin,
+                                  std::size_t anEnd,
+                                  CometPositionArrays& aPositions)
+{
+    using ANGLE_UTIL::normalizeDegrees;
+
+    std::size_t count = anEnd - aBegin;
+    std::vector<double> times(count);
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    double* lightTime = aPositions.lightTime.data() + aBegin;
+    double* distance = aPositions.distance.data() + aBegin;
+    for (std::size_t index = 0; index < count; index++)
+    {
+        times[index] = aJulianDays[(aBegin + index) * aStride];
+    }
+
+    // Each light-time pass moves the comet back to the time the light
+    // left it, using the distance found in the previous pass.
+    for (int pass = 0; pass <= SPA_PLANET_LIGHT_TIME_ITERATIONS; pass++)
+    {
+        aPropagator(times.data(), aBegin, anEnd, x.data(), y.data(), z.data());
+        for (std::size_t index = 0; index < count; index++)
+        {
+            std::size_t earth = (aBegin + index) * aStride;
+            double dx = x[index] - anEarthX[earth];
+            double dy = y[index] - anEarthY[earth];
+            double dz = z[index] - anEarthZ[earth];
+            distance[index] = std::sqrt(dx * dx + dy * dy + dz * dz);
+            lightTime[index] = SPA_LIGHT_TIME_DAYS_PER_AU * distance[index];
+            times[index] = aJulianDays[earth] - lightTime[index];
+        }
+    }
+
+    for (std::size_t index = 0; index < count; index++)
+    {
+        std::size_t earth = (aBegin + index) * aStride;
+        std::size_t out = aBegin + index;
+        double radius = std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index]);
+        aPositions.heliocentricLongitude[out] = normalizeDegrees(std::atan2(y[index], x[index]) * SPA_RADIANS_TO_DEGREES);
+        aPositions.heliocentricLatitude[out] = std::asin(z[index] / radius) * SPA_RADIANS_TO_DEGREES;
+        aPositions.radiusVector[out] = radius;
+
+        double dx = x[index] - anEarthX[earth];
+        double dy = y[index] - anEarthY[earth];
+        double dz = z[index] - anEarthZ[earth];
+        aPositions.eclipticLongitude[out] = normalizeDegrees(std::atan2(dy, dx) * SPA_RADIANS_TO_DEGREES);
+        aPositions.eclipticLatitude[out] = std::asin(dz / distance[index]) * SPA_RADIANS_TO_DEGREES;
+    }
+}
+
+/**
+ * Splits [0, aCount) into at most aNumThreads contiguous chunks of at
+ * least SPA_COMET_CHUNK_SIZE entries and runs aWork on each, as tasks
+ * on the shared ThreadPool.
+ */
+void runInChunks(std::size_t aCount,
+                 unsigned int aNumThreads,
+                 const ThreadPool::RangeFunction& aWork)
+{
+    ThreadPool& pool = ThreadPool::getDefault();
+    unsigned int numThreads = (aNumThreads > 0) ? aNumThreads : pool.getNumThreads();
+    std::size_t numChunks = std::min<std::size_t>(numThreads,
+                                                  std::max<std::size_t>(aCount / SPA_COMET_CHUNK_SIZE, 1));
+    std::size_t chunkSize = std::max<std::size_t>((aCount + numChunks - 1) / numChunks, 1);
+    pool.run(aCount, chunkSize, aWork);
+}
+
+/// Parses a fixed-width numeric field; false unless it holds exactly one number.
+bool parseField(const std::string& aLine, std::size_t aFirstColumn, std::size_t aLastColumn, double& aValue)
+{
+    char buffer[32];
+    std::size_t length = aLastColumn - aFirstColumn + 1;
+    aLine.copy(buffer, length, aFirstColumn - 1);
+    buffer[length] = '\0';
+    char* end = nullptr;
+    aValue = std::strtod(buffer, &end);
+    if (end == buffer)
+    {
+        return false;
+    }
+    while (*end == ' ')
+    {
+        end++;
+    }
+    return *end == '\0';
+}
+
+} // end anonymous namespace
+
+CometPosition calculateCometPosition(const CometOrbitTable& aTable,
+                                     std::size_t aBody,
+                                     const JulianDate& aJulianDate)
+{
+    double julianDays = aJulianDate.getDecimalDays();
+    CometPositionArrays positions;
+    calculateCometPositions(aTable, aBody, &julianDays, 1, positions, 1);
+    return positions.at(0);
+}
+
+void calculateCometPositions(const CometOrbitTable& aTable,
+                             const JulianDate& aJulianDate,
+                             CometPositionArrays& aPositions,
+                             unsigned int aNumThreads)
+{
+    double julianDays = aJulianDate.getDecimalDays();
+    double earthX = 0.0;
+    double earthY = 0.0;
+    double earthZ = 0.0;
+    PLANET_UTIL::getPlanetOrbit(EARTH).calculateHeliocentricPosition(julianDays, earthX, earthY, earthZ);
+
+    Propagator propagator = [&aTable](const double* aTimes, std::size_t aBegin, std::size_t anEnd,
+                                      double* anX, double* aY, double* aZ)
+    {
+        aTable.calculateHeliocentricPositions(aTimes, aBegin, anEnd, anX, aY, aZ);
+    };
+
+    aPositions.resize(aTable.size());
+    runInChunks(aTable.size(),
+                aNumThreads,
+                [&](std::size_t aBegin, std::size_t anEnd)
+                {
+                    calculateCometPositionKernel(propagator, &julianDays, &earthX, &earthY, &earthZ, 0,
+                                                 aBegin, anEnd, aPositions);
+                });
+}
+
+void calculateCometPositions(const CometOrbitTable& aTable,
+                             std::size_t aBody,
+                             const double* aJulianDays,
+                             std::size_t aCount,
+                             CometPositionArrays& aPositions,
+                             unsigned int aNumThreads)
+{
+    std::vector<double> earthX(aCount);
+    std::vector<double> earthY(aCount);
+    std::vector<double> earthZ(aCount);
+    const PlanetOrbit& earth = PLANET_UTIL::getPlanetOrbit(EARTH);
+
+    // The propagator sees the times and outputs of one chunk only.
+    Propagator propagator = [&aTable, aBody](const double* aTimes, std::size_t aBegin, std::size_t anEnd,
+                                             double* anX, double* aY, double* aZ)
+    {
+        aTable.calculateHeliocentricPositions(aBody, aTimes, anEnd - aBegin, anX, aY, aZ);
+    };
+
+    aPositions.resize(aCount);
+    runInChunks(aCount,
+                aNumThreads,
+                [&](std::size_t aBegin, std::size_t anEnd)
+                {
+                    earth.calculateHeliocentricPositions(aJulianDays + aBegin, anEnd - aBegin,
+                                                         earthX.data() + aBegin,
+                                                         earthY.data() + aBegin,
+                                                         earthZ.data() + aBegin);
+                    calculateCometPositionKernel(propagator, aJulianDays, earthX.data(), earthY.data(),
+                                                 earthZ.data(), 1, aBegin, anEnd, aPositions);
+                });
+}
+
+std::size_t parseCometElements(const std::string& aText,
+                               CometOrbitTable& aTable)
+{
+    std::size_t count = 0;
+    std::size_t lineStart = 0;
+    std::string line;
+    while (lineStart < aText.size())
+    {
+        std::size_t lineEnd = aText.find('\n', lineStart);
+        if (lineEnd == std::string::npos)
+        {
+            lineEnd = aText.size();
+        }
+        line.assign(aText, lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+        if (line.size() < 79)
+        {
+            continue;
+        }
+
+        double year = 0.0;
+        double month = 0.0;
+        double day = 0.0;
+        CometElements elements;
+        if (!parseField(line, 15, 18, year) || !parseField(line, 20, 21, month) || !parseField(line, 23, 29, day)
+            || !parseField(line, 31, 39, elements.perihelionDistance)
+            || !parseField(line, 42, 49, elements.eccentricity)
+            || !parseField(line, 52, 59, elements.argumentOfPerihelion)
+            || !parseField(line, 62, 69, elements.longitudeOfAscendingNode)
+            || !parseField(line, 72, 79, elements.inclination))
+        {
+            continue;
+        }
+        if (month < 1.0 || month > 12.0 || day < 1.0 || !(elements.perihelionDistance > 0.0)
+            || elements.eccentricity < 0.0)
+        {
+            continue;
+        }
+
+        double wholeDay = std::floor(day);
+        JulianDate midnight(static_cast<int>(year), static_cast<int>(month), static_cast<int>(wholeDay), 0, 0, 0.0);
+        elements.perihelionJulianDays = midnight.getDecimalDays() + (day - wholeDay);
+
+        std::string name;
+        if (line.size() > 102)
+        {
+            name = line.substr(102, 56);
+            std::size_t last = name.find_last_not_of(" \r");
+            name.erase(last == std::string::npos ? 0 : last + 1);
+        }
+        aTable.add(elements, name);
+        count++;
+    }
+    return count;
+}
+
+std::size_t loadCometElements(const std::string& aFileName,
+                              CometOrbitTable& aTable)
+{
+    std::ifstream file(aFileName, std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        return 0;
+    }
+    file.seekg(0, std::ios::end);
+    std::streamoff length = file.tellg();
+    if (length <= 0)
+    {
+        return 0;
+    }
+    std::string text(static_cast<std::size_t>(length), '\0');
+    file.seekg(0, std::ios::beg);
+    file.read(&text[0], length);
+    if (!file)
+    {
+        return 0;
+    }
+    return parseCometElements(text, aTable);
+}
+
+} // end namespace COMET_UTIL
+} // end namespace SPA
@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CoordinateUtilities.cc
+ * @brief Definitions of COORD_UTIL functions
+ * @ingroup group_coords
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CoordinateUtilities.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+#include "AngleUtilities.h"
+#include "JulianDate.h"
+
+#include <cmath>
+
+namespace SPA
+{
+namespace COORD_UTIL
+{
+
+double calculateMeanObliquity(const JulianDate& aJulianDate)
+{
+    double centuries = (aJulianDate.getDecimalDays() - SPA_J2000_EPOCH)
+                    / SPA_DAYS_IN_JULIAN_CENTURY;
+    double arcSeconds = centuries * (46.815 + centuries * (0.0006 - centuries * 0.00181));
+    return 23.439292 - arcSeconds / 3600.0;
+}
+
+EquatorialCoordinates convertEclipticToEquatorial(double anEclipticLongitude,
+                                                  double anEclipticLatitude,
+                                                  double anObliquity)
+{
+    using ANGLE_UTIL::degreesToRadians;
+    using ANGLE_UTIL::radiansToDegrees;
+
+    double lambda = degreesToRadians(anEclipticLongitude);
+    double beta = degreesToRadians(anEclipticLatitude);
+    double sinEps = std::sin(degreesToRadians(anObliquity));
+    double cosEps = std::cos(degreesToRadians(anObliquity));
+
+    double sinDec = std::sin(beta) * cosEps + std::cos(beta) * sinEps * std::sin(lambda);
+    double y = std::sin(lambda) * cosEps - std::tan(beta) * sinEps;
+    double x = std::cos(lambda);
+
+    EquatorialCoordinates equatorial;
+    equatorial.rightAscension = ANGLE_UTIL::normalizeDegrees(radiansToDegrees(std::atan2(y, x))) / 15.0;
+    equatorial.declination = radiansToDegrees(std::asin(sinDec));
+    return equatorial;
+}
+
+HorizonCoordinates convertEquatorialToHorizon(double anHourAngle,
+                                              double aDeclination,
+                                              double aLatitude)
+{
+    using ANGLE_UTIL::degreesToRadians;
+    using ANGLE_UTIL::radiansToDegrees;
+
+    double hourAngle = degreesToRadians(anHourAngle * 15.0);
+    double dec = degreesToRadians(aDeclination);
+    double lat = degreesToRadians(aLatitude);
+
+    double sinAlt = std::sin(dec) * std::sin(lat) + std::cos(dec) * std::cos(lat) * std::cos(hourAngle);
+
+    // Use atan2 rather than the acos of step 5 so the azimuth needs no
+    // quadrant correction.
+    double y = -std::cos(dec) * std::cos(lat) * std::sin(hourAngle);
+    double x = std::sin(dec) - std::sin(lat) * sinAlt;
+
+    HorizonCoordinates horizon;
+    horizon.altitude = radiansToDegrees(std::asin(sinAlt));
+    horizon.azimuth = ANGLE_UTIL::normalizeDegrees(radiansToDegrees(std::atan2(y, x)));
+    return horizon;
+}
+
+} // end namespace COORD_UTIL
+} // end namespace SPA
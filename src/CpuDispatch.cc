@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file CpuDispatch.cc
+ * @brief Definitions of the batch kernels, compiled once per CpuLevel,
+ *   and of the CPU_UTIL functions that choose between them
+ * @ingroup group_util
+ *
+ * Each kernel is a loop around an inline scalar body; the calendar
+ * bodies are the CALENDAR_UTIL conversions of CalendarPolicy.h, so
+ * there is one copy of the PAWYC arithmetic. The body is instantiated
+ * inside a function carrying a GCC/Clang target attribute for each
+ * level, so the compiler can use that level's instructions (rounding,
+ * wider vectors) when it vectorizes or schedules the loop, while the
+ * rest of the library is still built for the baseline processor.
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CpuDispatch.h"
+#include "AngleUtilities.h"
+#include "CalendarPolicy.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ostream>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SPA_CPU_DISPATCH_X86 1
+#define SPA_ALWAYS_INLINE inline __attribute__((always_inline))
+#define SPA_TARGET(isa) __attribute__((target(isa)))
+#else
+#define SPA_ALWAYS_INLINE inline
+#endif
+
+// Keep every level's arithmetic identical: no fused multiply-adds where
+// the target happens to provide them. The build also passes
+// -ffp-contract=off for this file, which GCC needs.
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#endif
+
+namespace SPA
+{
+namespace
+{
+
+// Name of the environment variable that lowers the level
+const char* const CPU_DISPATCH_VARIABLE = "SPA_CPU_DISPATCH";
+
+// Same steps as COORD_UTIL::convertEclipticToEquatorial()
+SPA_ALWAYS_INLINE void equatorialOf(double anEclipticLongitude,
+                                    double anEclipticLatitude,
+                                    double aSinObliquity,
+                                    double aCosObliquity,
+                                    double& aRightAscension,
+                                    double& aDeclination)
+{
+    using ANGLE_UTIL::degreesToRadians;
+    using ANGLE_UTIL::radiansToDegrees;
+
+    double lambda = degreesToRadians(anEclipticLongitude);
+    double beta = degreesToRadians(anEclipticLatitude);
+
+    double sinDec = std::sin(beta) * aCosObliquity + std::cos(beta) * aSinObliquity * std::sin(lambda);
+    double y = std::sin(lambda) * aCosObliquity - std::tan(beta) * aSinObliquity;
+    double x = std::cos(lambda);
+
+    aRightAscension = ANGLE_UTIL::normalizeDegrees(radiansToDegrees(std::atan2(y, x))) / 15.0;
+    aDeclination = radiansToDegrees(std::asin(sinDec));
+}
+
+SPA_ALWAYS_INLINE void convertToJulianDaysLoop(const int* aYears,
+                                               const int* aMonths,
+                                               const int* aDays,
+                                               const double* aDayFractions,
+                                               std::size_t aCount,
+                                               double* aJulianDays)
+{
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        aJulianDays[i] = CALENDAR_UTIL::calculateJulianDays<HistoricalCalendar>(aYears[i],
+                                                                                 aMonths[i],
+                                                                                 aDays[i],
+                                                                                 aDayFractions[i]);
+    }
+}
+
+SPA_ALWAYS_INLINE void convertFromJulianDaysLoop(const double* aJulianDays,
+                                                 std::size_t aCount,
+                                                 int* aYears,
+                                                 int* aMonths,
+                                                 double* aDays)
+{
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        CALENDAR_UTIL::calculateCalendarDate<HistoricalCalendar>(aJulianDays[i], aYears[i], aMonths[i], aDays[i]);
+    }
+}
+
+SPA_ALWAYS_INLINE void calculateSinCosLoop(const double* aDegrees,
+                                           std::size_t aCount,
+                                           double* aSines,
+                                           double* aCosines)
+{
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        double radians = ANGLE_UTIL::degreesToRadians(aDegrees[i]);
+        aSines[i] = std::sin(radians);
+        aCosines[i] = std::cos(radians);
+    }
+}
+
+SPA_ALWAYS_INLINE void convertEclipticToEquatorialLoop(const double* aLongitudes,
+                                                       const double* aLatitudes,
+                                                       std::size_t aCount,
+                                                       double anObliquity,
+                                                       double* aRightAscensions,
+                                                       double* aDeclinations)
+{
+    double sinEps = std::sin(ANGLE_UTIL::degreesToRadians(anObliquity));
+    double cosEps = std::cos(ANGLE_UTIL::degreesToRadians(anObliquity));
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        equatorialOf(aLongitudes[i], aLatitudes[i], sinEps, cosEps,
+                     aRightAscensions[i], aDeclinations[i]);
+    }
+}
+
+/*
+ * Defines the four kernels for one level in namespace NAME, with the
+ * given function attributes, and a BatchKernels table for them.
+ */
+#define SPA_DEFINE_BATCH_KERNELS(NAME, LEVEL, ATTRIBUTES)                               \
+namespace NAME                                                                          \
+{                                                                                       \
+ATTRIBUTES void convertToJulianDays(const int* aYears, const int* aMonths,              \
+                                    const int* aDays, const double* aDayFractions,      \
+                                    std::size_t aCount, double* aJulianDays)            \
+{                                                                                       \
+    convertToJulianDaysLoop(aYears, aMonths, aDays, aDayFractions, aCount, aJulianDays); \
+}                                                                                       \
+ATTRIBUTES void convertFromJulianDays(const double* aJulianDays, std::size_t aCount,    \
+                                      int* aYears, int* aMonths, double* aDays)         \
+{                                                                                       \
+    convertFromJulianDaysLoop(aJulianDays, aCount, aYears, aMonths, aDays);             \
+}                                                                                       \
+ATTRIBUTES void calculateSinCos(const double* aDegrees, std::size_t aCount,             \
+                                double* aSines, double* aCosines)                       \
+{                                                                                       \
+    calculateSinCosLoop(aDegrees, aCount, aSines, aCosines);                            \
+}                                                                                       \
+ATTRIBUTES void convertEclipticToEquatorial(const double* aLongitudes,                  \
+                                            const double* aLatitudes,                   \
+                                            std::size_t aCount, double anObliquity,     \
+                                            double* aRightAscensions,                   \
+                                            double* aDeclinations)                      \
+{                                                                                       \
+    convertEclipticToEquatorialLoop(aLongitudes, aLatitudes, aCount, anObliquity,       \
+                                    aRightAscensions, aDeclinations);                   \
+}                                                                                       \
+const BatchKernels KERNELS = {LEVEL,                                                    \
+                              convertToJulianDays,                                      \
+                              convertFromJulianDays,                                    \
+                              calculateSinCos,                                          \
+                              convertEclipticToEquatorial};                             \
+}
+
+SPA_DEFINE_BATCH_KERNELS(GENERIC, CpuLevel::Generic, )
+#ifdef SPA_CPU_DISPATCH_X86
+SPA_DEFINE_BATCH_KERNELS(SSE42, CpuLevel::SSE42, SPA_TARGET("sse4.2"))
+SPA_DEFINE_BATCH_KERNELS(AVX2, CpuLevel::AVX2, SPA_TARGET("avx2"))
+SPA_DEFINE_BATCH_KERNELS(AVX512, CpuLevel::AVX512, SPA_TARGET("avx512f,avx512dq,avx512vl"))
+#endif
+
+#undef SPA_DEFINE_BATCH_KERNELS
+
+// Detect the level while the library is loaded, rather than on the
+// first batch call.
+struct LoadTimeDetection
+{
+    LoadTimeDetection()
+    {
+        CPU_UTIL::getBatchKernels();
+    }
+};
+const LoadTimeDetection DETECT_AT_LOAD;
+
+} // end anonymous namespace
+
+namespace CPU_UTIL
+{
+
+CpuLevel detectCpuLevel()
+{
+    CpuLevel level = CpuLevel::Generic;
+#ifdef SPA_CPU_DISPATCH_X86
+    // Needed when called from a static initializer
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512dq") &&
+        __builtin_cpu_supports("avx512vl"))
+    {
+        level = CpuLevel::AVX512;
+    }
+    else if (__builtin_cpu_supports("avx2"))
+    {
+        level = CpuLevel::AVX2;
+    }
+    else if (__builtin_cpu_supports("sse4.2"))
+    {
+        level = CpuLevel::SSE42;
+    }
+#endif
+    return level;
+}
+
+bool parseCpuLevel(const char* aName, CpuLevel& aLevel)
+{
+    if (aName == nullptr)
+    {
+        return false;
+    }
+
+    const char* NAMES[] = {"generic", "sse4.2", "avx2", "avx512"};
+    const CpuLevel LEVELS[] = {CpuLevel::Generic, CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512};
+    for (std::size_t n = 0; n < sizeof(LEVELS) / sizeof(LEVELS[0]); n++)
+    {
+        std::size_t length = std::strlen(NAMES[n]);
+        bool match = (std::strlen(aName) == length);
+        for (std::size_t i = 0; match && i < length; i++)
+        {
+            match = (std::tolower(static_cast<unsigned char>(aName[i])) == NAMES[n][i]);
+        }
+        if (match)
+        {
+            aLevel = LEVELS[n];
+            return true;
+        }
+    }
+    return false;
+}
+
+CpuLevel resolveCpuLevel(const char* anOverride, CpuLevel aDetected)
+{
+    CpuLevel requested;
+    if (parseCpuLevel(anOverride, requested) && requested < aDetected)
+    {
+        return requested;
+    }
+    return aDetected;
+}
+
+CpuLevel getCpuLevel()
+{
+    static const CpuLevel level = resolveCpuLevel(std::getenv(CPU_DISPATCH_VARIABLE),
+                                                  detectCpuLevel());
+    return level;
+}
+
+const BatchKernels& getBatchKernels()
+{
+    static const BatchKernels& kernels = getBatchKernels(getCpuLevel());
+    return kernels;
+}
+
+const BatchKernels& getBatchKernels(CpuLevel aLevel)
+{
+    CpuLevel detected = detectCpuLevel();
+    CpuLevel level = (aLevel < detected) ? aLevel : detected;
+    switch (level)
+    {
+#ifdef SPA_CPU_DISPATCH_X86
+        case CpuLevel::AVX512:
+            return AVX512::KERNELS;
+        case CpuLevel::AVX2:
+            return AVX2::KERNELS;
+        case CpuLevel::SSE42:
+            return SSE42::KERNELS;
+#endif
+        default:
+            return GENERIC::KERNELS;
+    }
+}
+
+} // end namespace CPU_UTIL
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::CpuLevel& aLevel)
+{
+    switch (aLevel)
+    {
+        case SPA::CpuLevel::Generic:
+            os << "generic";
+            break;
+        case SPA::CpuLevel::SSE42:
+            os << "sse4.2";
+            break;
+        case SPA::CpuLevel::AVX2:
+            os << "avx2";
+            break;
+        case SPA::CpuLevel::AVX512:
+            os << "avx512";
+            break;
+        default:
+            os << "Invalid CpuLevel";
+            break;
+    }
+    return os;
+}
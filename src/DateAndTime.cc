@@ -28,6 +28,9 @@
 #include "DateAndTime.h"
 #include "SpaTimeConstants.h"
 
+#include <iomanip>
+#include <sstream>
+
 namespace SPA
 {
 
@@ -202,14 +205,18 @@ bool operator<(const DateAndTime& aLHS,
 std::ostream& operator<<(std::ostream& os,
                          const SPA::DateAndTime& aDateAndTime)
 {
-    os << "DateAndTime{";
-    os << " theYear=" << aDateAndTime.getYear()
-       << " theMonth=" <<  aDateAndTime.getMonth()
-       << " theDay=" <<  aDateAndTime.getDay()
-       << " theHours=" <<  aDateAndTime.getHours()
-       << " theMinutes=" <<  aDateAndTime.getMinutes()
-       << " theSeconds=" << std::fixed << std::setprecision(6) << aDateAndTime.getSeconds()
-       << " theUTC_OffsetHours=" << std::setprecision(4) << aDateAndTime.getUtcOffsetHours();
-    os << " }";
+    // Format into a local buffer so that os receives a single insertion
+    // and its format flags are left as they were.
+    std::ostringstream buffer;
+    buffer << "DateAndTime{";
+    buffer << " theYear=" << aDateAndTime.getYear()
+           << " theMonth=" <<  aDateAndTime.getMonth()
+           << " theDay=" <<  aDateAndTime.getDay()
+           << " theHours=" <<  aDateAndTime.getHours()
+           << " theMinutes=" <<  aDateAndTime.getMinutes()
+           << " theSeconds=" << std::fixed << std::setprecision(6) << aDateAndTime.getSeconds()
+           << " theUTC_OffsetHours=" << std::setprecision(4) << aDateAndTime.getUtcOffsetHours();
+    buffer << " }";
+    os << buffer.str();
     return os;
 }
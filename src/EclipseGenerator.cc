@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EclipseGenerator.cc
+ * @brief Definition of EclipseGenerator functions
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "EclipseGenerator.h"
+#include "SpaMoonConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+EclipseGenerator::EclipseGenerator(const JulianDate& aStart,
+                                   const JulianDate& anEnd) :
+    theNextHalfLunation(0),
+    theStartJulianDays(aStart.getDecimalDays()),
+    theEndJulianDays(anEnd.getDecimalDays())
+{
+    // Greatest eclipse is within a day of the mean syzygy, so starting
+    // one lunation early cannot miss an eclipse near the start.
+    double lunations = (theStartJulianDays - SPA_MOON_MEAN_NEW_MOON_2000) / SPA_MOON_SYNODIC_MONTH;
+    theNextHalfLunation = 2 * static_cast<long>(std::floor(lunations)) - 2;
+}
+
+bool EclipseGenerator::next(Eclipse& anEvent)
+{
+    Eclipse eclipse;
+    while (SPA_MOON_MEAN_NEW_MOON_2000 + 0.5 * SPA_MOON_SYNODIC_MONTH * theNextHalfLunation
+           < theEndJulianDays + SPA_MOON_SYNODIC_MONTH)
+    {
+        long halfLunation = theNextHalfLunation++;
+        long lunation = static_cast<long>(std::floor(0.5 * halfLunation));
+        bool found = (halfLunation == 2 * lunation)
+                     ? ECLIPSE_UTIL::calculateSolarEclipse(lunation, eclipse)
+                     : ECLIPSE_UTIL::calculateLunarEclipse(lunation, eclipse);
+        if (!found || eclipse.maximumJulianDays < theStartJulianDays)
+        {
+            continue;
+        }
+        if (eclipse.maximumJulianDays > theEndJulianDays)
+        {
+            return false;
+        }
+        anEvent = eclipse;
+        return true;
+    }
+    return false;
+}
+
+} // end namespace SPA
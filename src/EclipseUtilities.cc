@@ -0,0 +1,369 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file EclipseUtilities.cc
+ * @brief Definition of functions in the ECLIPSE_UTIL namespace
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "EclipseUtilities.h"
+#include "LunarSeries.h"
+#include "MoonUtilities.h"
+#include "SunUtilities.h"
+#include "SpaMoonConstants.h"
+#include "SpaSunConstants.h"
+#include "SpaConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace SPA
+{
+namespace ECLIPSE_UTIL
+{
+
+namespace
+{
+
+/// The complete lunar series, built on first use.
+const LunarSeries& getCompleteLunarSeries()
+{
+    static const LunarSeries series(std::numeric_limits<std::size_t>::max());
+    return series;
+}
+
+/**
+ * Positions of the Moon and Sun at one time, and the offset of the
+ * Moon from the Sun (solar) or the antisolar point (lunar) in degrees.
+ * x is along the ecliptic and y perpendicular to it.
+ */
+struct Geometry
+{
+    MoonPosition moon;
+    SunPosition sun;
+    double x;
+    double y;
+};
+
+Geometry calculateGeometry(double aJulianDays, bool aLunar)
+{
+    Geometry geometry;
+    geometry.moon = getCompleteLunarSeries().calculatePosition(aJulianDays);
+    geometry.sun = SUN_UTIL::calculateSunPositionSecular(aJulianDays);
+
+    double offset = geometry.moon.eclipticLongitude - geometry.sun.eclipticLongitude;
+    if (aLunar)
+    {
+        offset -= 0.5 * SPA_DEGREES_IN_CIRCLE;
+    }
+    offset -= SPA_DEGREES_IN_CIRCLE * std::floor(offset / SPA_DEGREES_IN_CIRCLE + 0.5);
+    geometry.x = offset * std::cos(geometry.moon.eclipticLatitude * SPA_DEGREES_TO_RADIANS);
+    geometry.y = geometry.moon.eclipticLatitude;
+    return geometry;
+}
+
+double calculateSeparation(double aJulianDays, bool aLunar)
+{
+    Geometry geometry = calculateGeometry(aJulianDays, aLunar);
+    return std::hypot(geometry.x, geometry.y);
+}
+
+/**
+ * Refines the time of minimum separation from an initial estimate,
+ * treating the motion of the Moon relative to the Sun or shadow as
+ * linear over each step.
+ *
+ * @param[in] aJulianDays Initial estimate, e.g. the mean syzygy.
+ * @param[in] aLunar True for the Earth's shadow, false for the Sun.
+ * @param[out] aGeometry Geometry at the refined time.
+ * @param[out] aSpeed Relative speed at the refined time, degrees per day.
+ * @return The refined time.
+ */
+double findGreatestEclipse(double aJulianDays, bool aLunar, Geometry& aGeometry, double& aSpeed)
+{
+    double time = aJulianDays;
+    aGeometry = calculateGeometry(time, aLunar);
+    aSpeed = 0.0;
+    for (int iteration = 0; iteration < SPA_ECLIPSE_MAX_ITERATIONS; iteration++)
+    {
+        Geometry later = calculateGeometry(time + SPA_MOON_HOURLY_MOTION_STEP_DAYS, aLunar);
+        double vx = (later.x - aGeometry.x) / SPA_MOON_HOURLY_MOTION_STEP_DAYS;
+        double vy = (later.y - aGeometry.y) / SPA_MOON_HOURLY_MOTION_STEP_DAYS;
+        double speedSquared = vx * vx + vy * vy;
+        aSpeed = std::sqrt(speedSquared);
+        double step = -(aGeometry.x * vx + aGeometry.y * vy) / speedSquared;
+        time += step;
+        aGeometry = calculateGeometry(time, aLunar);
+        if (std::fabs(step) < SPA_ECLIPSE_TOLERANCE_DAYS)
+        {
+            break;
+        }
+    }
+    return time;
+}
+
+/**
+ * Finds the time at which the separation equals a given radius on one
+ * side of greatest eclipse, or NaN if the separation never gets that
+ * small. The first estimate assumes linear relative motion, and is
+ * then refined by the secant method.
+ */
+double findContact(double aMaximum,
+                   double aMinimumSeparation,
+                   double aSpeed,
+                   double aRadius,
+                   double aDirection,
+                   bool aLunar)
+{
+    if (!(aMinimumSeparation < aRadius))
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    double previousTime = aMaximum;
+    double previousOffset = aMinimumSeparation - aRadius;
+    double time = aMaximum
+                  + aDirection * std::sqrt(aRadius * aRadius - aMinimumSeparation * aMinimumSeparation) / aSpeed;
+    for (int iteration = 0; iteration < SPA_ECLIPSE_MAX_ITERATIONS; iteration++)
+    {
+        double offset = calculateSeparation(time, aLunar) - aRadius;
+        if (offset == previousOffset)
+        {
+            break;
+        }
+        double step = -offset * (time - previousTime) / (offset - previousOffset);
+        previousTime = time;
+        previousOffset = offset;
+        time += step;
+        if (std::fabs(step) < SPA_ECLIPSE_TOLERANCE_DAYS)
+        {
+            break;
+        }
+    }
+    return time;
+}
+
+/// Time of the mean new Moon (aHalfLunations even) or full Moon (odd).
+double calculateMeanSyzygy(long aHalfLunations)
+{
+    return SPA_MOON_MEAN_NEW_MOON_2000 + 0.5 * SPA_MOON_SYNODIC_MONTH * aHalfLunations;
+}
+
+/// Applies the rules of Section 72 at a mean syzygy.
+bool isNearNode(long aHalfLunations)
+{
+    double argumentOfLatitude = SPA_MOON_MEAN_ARGUMENT_OF_LATITUDE_2000
+                                + 0.5 * SPA_MOON_ARGUMENT_OF_LATITUDE_PER_LUNATION * aHalfLunations;
+    return std::fabs(std::sin(argumentOfLatitude * SPA_DEGREES_TO_RADIANS)) <= SPA_ECLIPSE_NODE_LIMIT;
+}
+
+bool calculateEclipse(long aHalfLunations, Eclipse& anEclipse)
+{
+    if (!isNearNode(aHalfLunations))
+    {
+        return false;
+    }
+
+    const double notApplicable = std::numeric_limits<double>::quiet_NaN();
+    bool lunar = (aHalfLunations % 2 != 0);
+
+    Geometry geometry;
+    double speed = 0.0;
+    double maximum = findGreatestEclipse(calculateMeanSyzygy(aHalfLunations), lunar, geometry, speed);
+    double separation = std::hypot(geometry.x, geometry.y);
+
+    double moonRadius = 0.5 * geometry.moon.angularSize;
+    double moonParallax = geometry.moon.horizontalParallax;
+    double sunRadius = 0.5 * geometry.sun.angularSize;
+    double sunParallax = SPA_SUN_PARALLAX_AT_R0 * SPA_SUN_SEMI_MAJOR_AXIS_KM / geometry.sun.distance;
+
+    Eclipse eclipse;
+    eclipse.maximumJulianDays = maximum;
+    eclipse.minimumSeparation = separation;
+    eclipse.totalBegin = notApplicable;
+    eclipse.totalEnd = notApplicable;
+
+    if (lunar)
+    {
+        double umbra = SPA_ECLIPSE_SHADOW_ENLARGEMENT * moonParallax + sunParallax - sunRadius;
+        double penumbra = SPA_ECLIPSE_SHADOW_ENLARGEMENT * moonParallax + sunParallax + sunRadius;
+        if (!(separation < penumbra + moonRadius))
+        {
+            return false;
+        }
+
+        eclipse.magnitude = (umbra + moonRadius - separation) / (2.0 * moonRadius);
+        eclipse.penumbralMagnitude = (penumbra + moonRadius - separation) / (2.0 * moonRadius);
+        if (eclipse.magnitude >= 1.0)
+        {
+            eclipse.type = EclipseType::TotalLunar;
+        }
+        else if (eclipse.magnitude > 0.0)
+        {
+            eclipse.type = EclipseType::PartialLunar;
+        }
+        else
+        {
+            eclipse.type = EclipseType::PenumbralLunar;
+        }
+
+        eclipse.totalBegin = findContact(maximum, separation, speed, umbra - moonRadius, -1.0, lunar);
+        eclipse.totalEnd = findContact(maximum, separation, speed, umbra - moonRadius, 1.0, lunar);
+        eclipse.umbralBegin = findContact(maximum, separation, speed, umbra + moonRadius, -1.0, lunar);
+        eclipse.umbralEnd = findContact(maximum, separation, speed, umbra + moonRadius, 1.0, lunar);
+        eclipse.penumbralBegin = findContact(maximum, separation, speed, penumbra + moonRadius, -1.0, lunar);
+        eclipse.penumbralEnd = findContact(maximum, separation, speed, penumbra + moonRadius, 1.0, lunar);
+    }
+    else
+    {
+        double central = moonParallax - sunParallax;
+        double outer = central + moonRadius + sunRadius;
+        double umbral = central + std::fabs(moonRadius - sunRadius);
+        if (!(separation < outer))
+        {
+            return false;
+        }
+
+        eclipse.penumbralMagnitude = notApplicable;
+        if (separation < umbral)
+        {
+            // The observer nearest the shadow axis is closer to the Moon
+            // than the centre of the Earth by up to one Earth radius.
+            double axisDistance = std::fmin(separation / central, 1.0);
+            double closer = std::sin(moonParallax * SPA_DEGREES_TO_RADIANS)
+                            * std::sqrt(1.0 - axisDistance * axisDistance);
+            eclipse.magnitude = moonRadius / (1.0 - closer) / sunRadius;
+            eclipse.type = (eclipse.magnitude >= 1.0) ? EclipseType::TotalSolar : EclipseType::AnnularSolar;
+        }
+        else
+        {
+            eclipse.magnitude = (outer - separation) / (2.0 * sunRadius);
+            eclipse.type = EclipseType::PartialSolar;
+        }
+
+        eclipse.umbralBegin = findContact(maximum, separation, speed, umbral, -1.0, lunar);
+        eclipse.umbralEnd = findContact(maximum, separation, speed, umbral, 1.0, lunar);
+        eclipse.penumbralBegin = findContact(maximum, separation, speed, outer, -1.0, lunar);
+        eclipse.penumbralEnd = findContact(maximum, separation, speed, outer, 1.0, lunar);
+    }
+
+    anEclipse = eclipse;
+    return true;
+}
+
+/**
+ * Steps through the syzygies between two epochs, every half lunation
+ * or every lunation, so the eclipses found are already in time order.
+ */
+void findEclipsesBetween(const JulianDate& aStart,
+                         const JulianDate& anEnd,
+                         long aFirstOffset,
+                         long aStride,
+                         std::vector<Eclipse>& anEclipses)
+{
+    anEclipses.clear();
+    double start = aStart.getDecimalDays();
+    double end = anEnd.getDecimalDays();
+
+    // Greatest eclipse is within a day of the mean syzygy, so starting
+    // one lunation early cannot miss an eclipse near aStart.
+    long halfLunations = 2 * static_cast<long>(std::floor((start - SPA_MOON_MEAN_NEW_MOON_2000)
+                                                          / SPA_MOON_SYNODIC_MONTH))
+                         - 2 + aFirstOffset;
+    Eclipse eclipse;
+    for (; calculateMeanSyzygy(halfLunations) < end + SPA_MOON_SYNODIC_MONTH; halfLunations += aStride)
+    {
+        if (calculateEclipse(halfLunations, eclipse)
+            && eclipse.maximumJulianDays >= start && eclipse.maximumJulianDays <= end)
+        {
+            anEclipses.push_back(eclipse);
+        }
+    }
+}
+
+} // end anonymous namespace
+
+bool calculateLunarEclipse(long aLunation, Eclipse& anEclipse)
+{
+    return calculateEclipse(2 * aLunation + 1, anEclipse);
+}
+
+bool calculateSolarEclipse(long aLunation, Eclipse& anEclipse)
+{
+    return calculateEclipse(2 * aLunation, anEclipse);
+}
+
+void findLunarEclipses(const JulianDate& aStart,
+                       const JulianDate& anEnd,
+                       std::vector<Eclipse>& anEclipses)
+{
+    findEclipsesBetween(aStart, anEnd, 1, 2, anEclipses);
+}
+
+void findSolarEclipses(const JulianDate& aStart,
+                       const JulianDate& anEnd,
+                       std::vector<Eclipse>& anEclipses)
+{
+    findEclipsesBetween(aStart, anEnd, 0, 2, anEclipses);
+}
+
+void findEclipses(const JulianDate& aStart,
+                  const JulianDate& anEnd,
+                  std::vector<Eclipse>& anEclipses)
+{
+    findEclipsesBetween(aStart, anEnd, 0, 1, anEclipses);
+}
+
+} // end namespace ECLIPSE_UTIL
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::EclipseType& aType)
+{
+    switch (aType)
+    {
+        case SPA::EclipseType::PenumbralLunar:
+            os << "Penumbral lunar";
+            break;
+        case SPA::EclipseType::PartialLunar:
+            os << "Partial lunar";
+            break;
+        case SPA::EclipseType::TotalLunar:
+            os << "Total lunar";
+            break;
+        case SPA::EclipseType::PartialSolar:
+            os << "Partial solar";
+            break;
+        case SPA::EclipseType::AnnularSolar:
+            os << "Annular solar";
+            break;
+        case SPA::EclipseType::TotalSolar:
+            os << "Total solar";
+            break;
+        default:
+            os << "Invalid EclipseType";
+            break;
+    }
+    return os;
+}
@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file IntervalIndex.cc
+ * @brief Definition of IntervalIndex class functions
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "IntervalIndex.h"
+#include "JulianDate.h"
+#include "ParallelUtilities.h"
+#include "SortUtilities.h"
+#include "ThreadPool.h"
+#include "TimeUtilities.h"
+
+#include <algorithm>
+#include <array>
+
+namespace SPA
+{
+
+namespace
+{
+
+/*
+ * Subtrees at or below this level, at most 2^4 - 1 nodes, are
+ * scanned in order rather than walked.
+ */
+constexpr int SCAN_LEVEL = 3;
+
+/// Converts Julian Dates to instant keys
+std::vector<std::int64_t> toInstantKeys(const JulianDate* aJulianDates, std::size_t aCount)
+{
+    std::vector<std::int64_t> keys(aCount);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        keys[i] = TIME_UTIL::calculateInstantKey(aJulianDates[i]);
+    }
+    return keys;
+}
+
+} // end anonymous namespace
+
+IntervalIndex::IntervalIndex() : theRootLevel(-1)
+{
+}
+
+IntervalIndex::IntervalIndex(const std::int64_t* aStarts,
+                             const std::int64_t* anEnds,
+                             std::size_t aCount,
+                             ThreadPool* aPool) : theRootLevel(-1)
+{
+    build(aStarts, anEnds, aCount, aPool);
+}
+
+IntervalIndex::IntervalIndex(const JulianDate* aStarts,
+                             const JulianDate* anEnds,
+                             std::size_t aCount,
+                             ThreadPool* aPool) : theRootLevel(-1)
+{
+    std::vector<std::int64_t> starts = toInstantKeys(aStarts, aCount);
+    std::vector<std::int64_t> ends = toInstantKeys(anEnds, aCount);
+    build(starts.data(), ends.data(), aCount, aPool);
+}
+
+void IntervalIndex::build(const std::int64_t* aStarts,
+                          const std::int64_t* anEnds,
+                          std::size_t aCount,
+                          ThreadPool* aPool)
+{
+    std::vector<std::int64_t> starts;
+    std::vector<std::size_t> ids;
+    starts.reserve(aCount);
+    ids.reserve(aCount);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        if (anEnds[i] > aStarts[i])
+        {
+            starts.push_back(aStarts[i]);
+            ids.push_back(i);
+        }
+    }
+
+    std::size_t numNodes = starts.size();
+    std::vector<std::size_t> order(numNodes);
+    SORT_UTIL::radixSortIndices(starts.data(), numNodes, order.data(), aPool);
+    theNodes.resize(numNodes);
+    for (std::size_t i = 0; i < numNodes; i++)
+    {
+        std::size_t id = ids[order[i]];
+        theNodes[i] = Node{aStarts[id], anEnds[id], anEnds[id], id};
+    }
+    if (numNodes == 0)
+    {
+        theRootLevel = -1;
+        return;
+    }
+
+    /*
+     * Node i is at the level given by the number of trailing one bits
+     * of i, so the leaves are the even indices and the node at level k
+     * above index i has children i - 2^(k-1) and i + 2^(k-1). When the
+     * array is not a full tree, a right child past the end stands for
+     * the subtree holding the last nodes, whose latest end is carried
+     * up in lastMaxEnd.
+     */
+    std::size_t lastIndex = 0;
+    std::int64_t lastMaxEnd = 0;
+    for (std::size_t i = 0; i < numNodes; i += 2)
+    {
+        lastIndex = i;
+        lastMaxEnd = theNodes[i].maxEnd;
+    }
+    int level = 1;
+    for (; (std::size_t(1) << level) <= numNodes; level++)
+    {
+        std::size_t halfWidth = std::size_t(1) << (level - 1);
+        std::size_t step = halfWidth << 2;
+        for (std::size_t i = (halfWidth << 1) - 1; i < numNodes; i += step)
+        {
+            std::int64_t leftMaxEnd = theNodes[i - halfWidth].maxEnd;
+            std::int64_t rightMaxEnd = (i + halfWidth < numNodes) ? theNodes[i + halfWidth].maxEnd : lastMaxEnd;
+            theNodes[i].maxEnd = std::max(theNodes[i].end, std::max(leftMaxEnd, rightMaxEnd));
+        }
+        lastIndex = ((lastIndex >> level) & 1) ? lastIndex - halfWidth : lastIndex + halfWidth;
+        if (lastIndex < numNodes)
+        {
+            lastMaxEnd = std::max(lastMaxEnd, theNodes[lastIndex].maxEnd);
+        }
+    }
+    theRootLevel = level - 1;
+}
+
+template <typename Visitor>
+void IntervalIndex::visit(std::int64_t aTime,
+                          std::int64_t aLastStart,
+                          Visitor& aVisitor) const
+{
+    if (theRootLevel < 0)
+    {
+        return;
+    }
+
+    // A node is visited first to descend left, then to report itself
+    // and descend right
+    struct Frame
+    {
+        int level;
+        std::size_t index;
+        bool leftDone;
+    };
+    std::array<Frame, 2 * 64> stack;
+    std::size_t depth = 0;
+    std::size_t numNodes = theNodes.size();
+    stack[depth++] = Frame{theRootLevel, (std::size_t(1) << theRootLevel) - 1, false};
+
+    while (depth > 0)
+    {
+        Frame frame = stack[--depth];
+        if (frame.level <= SCAN_LEVEL)
+        {
+            std::size_t first = (frame.index >> frame.level) << frame.level;
+            std::size_t last = std::min(first + (std::size_t(1) << (frame.level + 1)) - 1, numNodes);
+            for (std::size_t i = first; i < last && theNodes[i].start <= aLastStart; i++)
+            {
+                if (theNodes[i].end > aTime)
+                {
+                    aVisitor(theNodes[i].id);
+                }
+            }
+        }
+        else if (!frame.leftDone)
+        {
+            std::size_t left = frame.index - (std::size_t(1) << (frame.level - 1));
+            stack[depth++] = Frame{frame.level, frame.index, true};
+            if (left >= numNodes || theNodes[left].maxEnd > aTime)
+            {
+                stack[depth++] = Frame{frame.level - 1, left, false};
+            }
+        }
+        else if (frame.index < numNodes && theNodes[frame.index].start <= aLastStart)
+        {
+            if (theNodes[frame.index].end > aTime)
+            {
+                aVisitor(theNodes[frame.index].id);
+            }
+            stack[depth++] = Frame{frame.level - 1, frame.index + (std::size_t(1) << (frame.level - 1)), false};
+        }
+    }
+}
+
+std::size_t IntervalIndex::findContaining(std::int64_t aTime,
+                                          std::vector<std::size_t>& anIds) const
+{
+    std::size_t numFound = 0;
+    auto append = [&anIds, &numFound](std::size_t anId)
+    {
+        anIds.push_back(anId);
+        numFound++;
+    };
+    visit(aTime, aTime, append);
+    return numFound;
+}
+
+std::size_t IntervalIndex::findContaining(const JulianDate& aJulianDate,
+                                          std::vector<std::size_t>& anIds) const
+{
+    return findContaining(TIME_UTIL::calculateInstantKey(aJulianDate), anIds);
+}
+
+std::size_t IntervalIndex::findOverlapping(std::int64_t aStart,
+                                           std::int64_t anEnd,
+                                           std::vector<std::size_t>& anIds) const
+{
+    std::size_t numFound = 0;
+    if (anEnd <= aStart)
+    {
+        return numFound;
+    }
+    auto append = [&anIds, &numFound](std::size_t anId)
+    {
+        anIds.push_back(anId);
+        numFound++;
+    };
+    visit(aStart, anEnd - 1, append);
+    return numFound;
+}
+
+std::size_t IntervalIndex::findOverlapping(const JulianDate& aStart,
+                                           const JulianDate& anEnd,
+                                           std::vector<std::size_t>& anIds) const
+{
+    return findOverlapping(TIME_UTIL::calculateInstantKey(aStart),
+                           TIME_UTIL::calculateInstantKey(anEnd),
+                           anIds);
+}
+
+std::size_t IntervalIndex::countOverlapping(std::int64_t aStart,
+                                            std::int64_t anEnd) const
+{
+    std::size_t numFound = 0;
+    if (anEnd <= aStart)
+    {
+        return numFound;
+    }
+    auto count = [&numFound](std::size_t)
+    {
+        numFound++;
+    };
+    visit(aStart, anEnd - 1, count);
+    return numFound;
+}
+
+void IntervalIndex::findOverlapping(const std::int64_t* aStarts,
+                                    const std::int64_t* anEnds,
+                                    std::size_t aCount,
+                                    std::vector<std::size_t>& anOffsets,
+                                    std::vector<std::size_t>& anIds,
+                                    ThreadPool* aPool) const
+{
+    // Count first, so that each window writes its own slice of anIds
+    anOffsets.assign(aCount + 1, 0);
+    PARALLEL_UTIL::parallelFor(aCount,
+                               [&](std::size_t q)
+                               {
+                                   anOffsets[q + 1] = countOverlapping(aStarts[q], anEnds[q]);
+                               },
+                               aPool);
+    for (std::size_t q = 0; q < aCount; q++)
+    {
+        anOffsets[q + 1] += anOffsets[q];
+    }
+
+    anIds.resize(anOffsets[aCount]);
+    PARALLEL_UTIL::parallelFor(aCount,
+                               [&](std::size_t q)
+                               {
+                                   if (anEnds[q] <= aStarts[q])
+                                   {
+                                       return;
+                                   }
+                                   std::size_t* next = anIds.data() + anOffsets[q];
+                                   auto store = [&next](std::size_t anId)
+                                   {
+                                       *next++ = anId;
+                                   };
+                                   visit(aStarts[q], anEnds[q] - 1, store);
+                               },
+                               aPool);
+}
+
+void IntervalIndex::findOverlapping(const JulianDate* aStarts,
+                                    const JulianDate* anEnds,
+                                    std::size_t aCount,
+                                    std::vector<std::size_t>& anOffsets,
+                                    std::vector<std::size_t>& anIds,
+                                    ThreadPool* aPool) const
+{
+    std::vector<std::int64_t> starts = toInstantKeys(aStarts, aCount);
+    std::vector<std::int64_t> ends = toInstantKeys(anEnds, aCount);
+    findOverlapping(starts.data(), ends.data(), aCount, anOffsets, anIds, aPool);
+}
+
+} // end namespace SPA
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file KeplerUtilities.cc
+ * @brief Definitions of Kepler's equation solvers
+ * @ingroup group_orbits
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "KeplerUtilities.h"
+#include "SpaConstants.h"
+
+#include <cmath>
+#include <algorithm>
+
+namespace SPA
+{
+namespace KEPLER_UTIL
+{
+
+namespace
+{
+
+/**
+ * Markley's starter plus Halley refinement. Shared by the scalar and
+ * batch interfaces so that both give identical answers.
+ */
+inline double ellipticKernel(double aMeanAnomaly,
+                             double anEccentricity)
+{
+    const double ecc = anEccentricity;
+    const double piSquared = SPA_PI * SPA_PI;
+
+    // Reduce to [-pi, pi], remembering the whole revolutions removed.
+    double revolutions = SPA_TWO_PI * std::floor(aMeanAnomaly / SPA_TWO_PI + 0.5);
+    double meanAnomaly = aMeanAnomaly - revolutions;
+    double absMeanAnomaly = std::fabs(meanAnomaly);
+
+    // Markley (1995) equations 20 to 23, a cubic in E fitted over [0, pi].
+    double alpha = (3.0 * piSquared + 1.6 * SPA_PI * (SPA_PI - absMeanAnomaly) / (1.0 + ecc))
+                    / (piSquared - 6.0);
+    double dValue = 3.0 * (1.0 - ecc) + alpha * ecc;
+    double qValue = 2.0 * alpha * dValue * (1.0 - ecc) - absMeanAnomaly * absMeanAnomaly;
+    double rValue = 3.0 * alpha * dValue * (dValue - 1.0 + ecc) * absMeanAnomaly
+                    + absMeanAnomaly * absMeanAnomaly * absMeanAnomaly;
+    double wValue = std::cbrt(std::fabs(rValue) + std::sqrt(qValue * qValue * qValue + rValue * rValue));
+    wValue *= wValue;
+    double eccAnomaly = (2.0 * rValue * wValue / (wValue * wValue + wValue * qValue + qValue * qValue)
+                         + absMeanAnomaly) / dValue;
+
+    for (int iIter = 0; iIter < SPA_KEPLER_ELLIPTIC_REFINEMENTS; iIter++)
+    {
+        double eSinE = ecc * std::sin(eccAnomaly);
+        double f0 = eccAnomaly - eSinE - absMeanAnomaly;
+        double f1 = 1.0 - ecc * std::cos(eccAnomaly);
+        eccAnomaly -= f0 / (f1 - 0.5 * f0 * eSinE / f1);
+    }
+    return std::copysign(eccAnomaly, meanAnomaly) + revolutions;
+}
+
+/// Cubic/logarithmic starter plus Halley refinement.
+inline double hyperbolicKernel(double aMeanAnomaly,
+                               double anEccentricity)
+{
+    const double ecc = anEccentricity;
+    double absMeanAnomaly = std::fabs(aMeanAnomaly);
+
+    // Real root of H^3 + p H - q = 0 from (e-1) H + e H^3 / 6 = |M|.
+    // p > 0 so the discriminant is always positive.
+    double pValue = 6.0 * (ecc - 1.0) / ecc;
+    double qHalf = 3.0 * absMeanAnomaly / ecc;
+    double disc = std::sqrt(qHalf * qHalf + pValue * pValue * pValue / 27.0);
+    double cubicStart = std::cbrt(qHalf + disc) + std::cbrt(qHalf - disc);
+    double logStart = std::log(2.0 * absMeanAnomaly / ecc + 1.8);
+    double hypAnomaly = std::min(cubicStart, logStart);
+
+    for (int iIter = 0; iIter < SPA_KEPLER_HYPERBOLIC_REFINEMENTS; iIter++)
+    {
+        double eSinhH = ecc * std::sinh(hypAnomaly);
+        double f0 = eSinhH - hypAnomaly - absMeanAnomaly;
+        double f1 = ecc * std::cosh(hypAnomaly) - 1.0;
+        hypAnomaly -= f0 / (f1 - 0.5 * f0 * eSinhH / f1);
+    }
+    return std::copysign(hypAnomaly, aMeanAnomaly);
+}
+
+/// Closed form root of s^3 + 3 s = W, evaluated for |W| to avoid cancellation.
+inline double barkerKernel(double aParabolicAnomaly)
+{
+    double halfW = 0.5 * std::fabs(aParabolicAnomaly);
+    double yValue = std::cbrt(halfW + std::sqrt(halfW * halfW + 1.0));
+    return std::copysign(yValue - 1.0 / yValue, aParabolicAnomaly);
+}
+
+} // end anonymous namespace
+
+double solveKeplerElliptic(double aMeanAnomaly,
+                           double anEccentricity)
+{
+    return ellipticKernel(aMeanAnomaly, anEccentricity);
+}
+
+double solveKeplerHyperbolic(double aMeanAnomaly,
+                             double anEccentricity)
+{
+    return hyperbolicKernel(aMeanAnomaly, anEccentricity);
+}
+
+double solveBarkerEquation(double aParabolicAnomaly)
+{
+    return barkerKernel(aParabolicAnomaly);
+}
+
+double calculateEllipticTrueAnomaly(double anEccentricAnomaly,
+                                    double anEccentricity)
+{
+    double halfE = 0.5 * anEccentricAnomaly;
+    return 2.0 * std::atan2(std::sqrt(1.0 + anEccentricity) * std::sin(halfE),
+                            std::sqrt(1.0 - anEccentricity) * std::cos(halfE));
+}
+
+double calculateHyperbolicTrueAnomaly(double aHyperbolicAnomaly,
+                                      double anEccentricity)
+{
+    return 2.0 * std::atan(std::sqrt((anEccentricity + 1.0) / (anEccentricity - 1.0))
+                           * std::tanh(0.5 * aHyperbolicAnomaly));
+}
+
+void solveKeplerElliptic(const double* aMeanAnomalies,
+                         std::size_t aCount,
+                         double anEccentricity,
+                         double* anEccentricAnomalies)
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        anEccentricAnomalies[index] = ellipticKernel(aMeanAnomalies[index], anEccentricity);
+    }
+}
+
+void solveKeplerElliptic(const double* aMeanAnomalies,
+                         const double* anEccentricities,
+                         std::size_t aCount,
+                         double* anEccentricAnomalies)
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        anEccentricAnomalies[index] = ellipticKernel(aMeanAnomalies[index], anEccentricities[index]);
+    }
+}
+
+void solveKeplerHyperbolic(const double* aMeanAnomalies,
+                           const double* anEccentricities,
+                           std::size_t aCount,
+                           double* aHyperbolicAnomalies)
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aHyperbolicAnomalies[index] = hyperbolicKernel(aMeanAnomalies[index], anEccentricities[index]);
+    }
+}
+
+void solveBarkerEquation(const double* aParabolicAnomalies,
+                         std::size_t aCount,
+                         double* aTanHalfTrueAnomalies)
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aTanHalfTrueAnomalies[index] = barkerKernel(aParabolicAnomalies[index]);
+    }
+}
+
+} // end namespace KEPLER_UTIL
+} // end namespace SPA
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarPhaseGenerator.cc
+ * @brief Definition of LunarPhaseGenerator functions
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "LunarPhaseGenerator.h"
+#include "SpaMoonConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+LunarPhaseGenerator::LunarPhaseGenerator(const JulianDate& aStart,
+                                         const JulianDate& anEnd) :
+    theNextQuarterLunation(0),
+    theStartJulianDays(aStart.getDecimalDays()),
+    theEndJulianDays(anEnd.getDecimalDays())
+{
+    // True phases differ from mean phases by well under a quarter
+    // lunation, so starting two quarters early cannot miss one.
+    double quarters = (theStartJulianDays - SPA_MOON_MEAN_NEW_MOON_2000) / (0.25 * SPA_MOON_SYNODIC_MONTH);
+    theNextQuarterLunation = static_cast<long>(std::floor(quarters)) - 2;
+}
+
+bool LunarPhaseGenerator::next(LunarPhaseEvent& anEvent)
+{
+    while (true)
+    {
+        LunarPhaseEvent event = LUNARPHASE_UTIL::calculateLunarPhase(theNextQuarterLunation);
+        if (event.julianDays > theEndJulianDays)
+        {
+            return false;
+        }
+        theNextQuarterLunation++;
+        if (event.julianDays >= theStartJulianDays)
+        {
+            anEvent = event;
+            return true;
+        }
+    }
+}
+
+} // end namespace SPA
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarPhaseUtilities.cc
+ * @brief Definition of functions in the LUNARPHASE_UTIL namespace
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "LunarPhaseUtilities.h"
+#include "LunarPhaseGenerator.h"
+#include "LunarSeries.h"
+#include "SunUtilities.h"
+#include "SpaMoonConstants.h"
+#include "SpaConstants.h"
+#include "AngleUtilities.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <limits>
+#include <ostream>
+
+namespace SPA
+{
+namespace LUNARPHASE_UTIL
+{
+
+namespace
+{
+
+/// The complete lunar series, built on first use.
+const LunarSeries& getCompleteLunarSeries()
+{
+    static const LunarSeries series(std::numeric_limits<std::size_t>::max());
+    return series;
+}
+
+/// Phase angle minus a target angle, reduced to [-180, 180) degrees.
+double phaseOffset(double aJulianDays, double aTargetAngle)
+{
+    double offset = calculateLunarPhaseAngle(aJulianDays) - aTargetAngle;
+    return offset - SPA_DEGREES_IN_CIRCLE * std::floor(offset / SPA_DEGREES_IN_CIRCLE + 0.5);
+}
+
+} // end anonymous namespace
+
+double calculateLunarPhaseAngle(double aJulianDays)
+{
+    double moonLongitude = getCompleteLunarSeries().calculatePosition(aJulianDays).eclipticLongitude;
+    return ANGLE_UTIL::normalizeDegrees(moonLongitude - SUN_UTIL::calculateSunPositionSecular(aJulianDays).eclipticLongitude);
+}
+
+LunarPhaseEvent calculateLunarPhase(long aQuarterLunation)
+{
+    long quarter = ((aQuarterLunation % 4) + 4) % 4;
+    double targetAngle = 90.0 * quarter;
+    double meanRate = SPA_DEGREES_IN_CIRCLE / SPA_MOON_SYNODIC_MONTH;
+
+    // First step from the mean phase uses the mean rate, then secant steps.
+    double previousTime = SPA_MOON_MEAN_NEW_MOON_2000 + 0.25 * SPA_MOON_SYNODIC_MONTH * aQuarterLunation;
+    double previousOffset = phaseOffset(previousTime, targetAngle);
+    double time = previousTime - previousOffset / meanRate;
+    for (int iteration = 0; iteration < SPA_MOON_PHASE_MAX_ITERATIONS; iteration++)
+    {
+        if (std::fabs(time - previousTime) < SPA_MOON_PHASE_TOLERANCE_DAYS)
+        {
+            break;
+        }
+        double offset = phaseOffset(time, targetAngle);
+        double slope = (offset - previousOffset) / (time - previousTime);
+        if (!(slope > 0.0))
+        {
+            slope = meanRate;
+        }
+        previousTime = time;
+        previousOffset = offset;
+        time -= offset / slope;
+    }
+
+    LunarPhaseEvent event;
+    event.julianDays = time;
+    event.type = static_cast<LunarPhaseType>(quarter);
+    return event;
+}
+
+std::size_t findLunarPhases(const JulianDate& aStart,
+                            const JulianDate& anEnd,
+                            const LunarPhaseCallback& aCallback)
+{
+    LunarPhaseGenerator generator(aStart, anEnd);
+    LunarPhaseEvent event;
+    std::size_t count = 0;
+    while (generator.next(event))
+    {
+        count++;
+        if (!aCallback(event))
+        {
+            break;
+        }
+    }
+    return count;
+}
+
+void findLunarPhases(const JulianDate& aStart,
+                     const JulianDate& anEnd,
+                     std::vector<LunarPhaseEvent>& anEvents)
+{
+    anEvents.clear();
+    findLunarPhases(aStart,
+                    anEnd,
+                    [&anEvents](const LunarPhaseEvent& anEvent)
+                    {
+                        anEvents.push_back(anEvent);
+                        return true;
+                    });
+}
+
+} // end namespace LUNARPHASE_UTIL
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::LunarPhaseType& aType)
+{
+    switch (aType)
+    {
+        case SPA::LunarPhaseType::NewMoon:
+            os << "New Moon";
+            break;
+        case SPA::LunarPhaseType::FirstQuarter:
+            os << "First quarter";
+            break;
+        case SPA::LunarPhaseType::FullMoon:
+            os << "Full Moon";
+            break;
+        case SPA::LunarPhaseType::LastQuarter:
+            os << "Last quarter";
+            break;
+        default:
+            os << "Invalid LunarPhaseType";
+            break;
+    }
+    return os;
+}
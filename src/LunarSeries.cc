@@ -0,0 +1,343 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarSeries.cc
+ * @brief Definition of LunarSeries functions
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "LunarSeries.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+#include "AngleUtilities.h"
+#include "JulianDate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+
+namespace SPA
+{
+
+namespace
+{
+
+/// A term as tabulated by Meeus, Tables 47.A and 47.B
+struct SeriesEntry
+{
+    /// Multipliers of D, M, M' and F
+    int multiplier[4];
+
+    /// Sine amplitude, 1e-6 degrees
+    int sineAmplitude;
+
+    /// Cosine amplitude, 1e-3 kilometres
+    int cosineAmplitude;
+};
+
+/// Longitude (sine) and distance (cosine) terms, Meeus Table 47.A
+const SeriesEntry LONGITUDE_DISTANCE_ENTRIES[] =
+{
+    {{ 0,  0,  1,  0},  6288774, -20905355},
+    {{ 2,  0, -1,  0},  1274027,  -3699111},
+    {{ 2,  0,  0,  0},   658314,  -2955968},
+    {{ 0,  0,  2,  0},   213618,   -569925},
+    {{ 0,  1,  0,  0},  -185116,     48888},
+    {{ 0,  0,  0,  2},  -114332,     -3149},
+    {{ 2,  0, -2,  0},    58793,    246158},
+    {{ 2, -1, -1,  0},    57066,   -152138},
+    {{ 2,  0,  1,  0},    53322,   -170733},
+    {{ 2, -1,  0,  0},    45758,   -204586},
+    {{ 0,  1, -1,  0},   -40923,   -129620},
+    {{ 1,  0,  0,  0},   -34720,    108743},
+    {{ 0,  1,  1,  0},   -30383,    104755},
+    {{ 2,  0,  0, -2},    15327,     10321},
+    {{ 0,  0,  1,  2},   -12528,         0},
+    {{ 0,  0,  1, -2},    10980,     79661},
+    {{ 4,  0, -1,  0},    10675,    -34782},
+    {{ 0,  0,  3,  0},    10034,    -23210},
+    {{ 4,  0, -2,  0},     8548,    -21636},
+    {{ 2,  1, -1,  0},    -7888,     24208},
+    {{ 2,  1,  0,  0},    -6766,     30824},
+    {{ 1,  0, -1,  0},    -5163,     -8379},
+    {{ 1,  1,  0,  0},     4987,    -16675},
+    {{ 2, -1,  1,  0},     4036,    -12831},
+    {{ 2,  0,  2,  0},     3994,    -10445},
+    {{ 4,  0,  0,  0},     3861,    -11650},
+    {{ 2,  0, -3,  0},     3665,     14403},
+    {{ 0,  1, -2,  0},    -2689,     -7003},
+    {{ 2,  0, -1,  2},    -2602,         0},
+    {{ 2, -1, -2,  0},     2390,     10056},
+    {{ 1,  0,  1,  0},    -2348,      6322},
+    {{ 2, -2,  0,  0},     2236,     -9884},
+    {{ 0,  1,  2,  0},    -2120,      5751},
+    {{ 0,  2,  0,  0},    -2069,         0},
+    {{ 2, -2, -1,  0},     2048,     -4950},
+    {{ 2,  0,  1, -2},    -1773,      4130},
+    {{ 2,  0,  0,  2},    -1595,         0},
+    {{ 4, -1, -1,  0},     1215,     -3958},
+    {{ 0,  0,  2,  2},    -1110,         0},
+    {{ 3,  0, -1,  0},     -892,      3258},
+    {{ 2,  1,  1,  0},     -810,      2616},
+    {{ 4, -1, -2,  0},      759,     -1897},
+    {{ 0,  2, -1,  0},     -713,     -2117},
+    {{ 2,  2, -1,  0},     -700,      2354},
+    {{ 2,  1, -2,  0},      691,         0},
+    {{ 2, -1,  0, -2},      596,         0},
+    {{ 4,  0,  1,  0},      549,     -1423},
+    {{ 0,  0,  4,  0},      537,     -1117},
+    {{ 4, -1,  0,  0},      520,     -1571},
+    {{ 1,  0, -2,  0},     -487,     -1739},
+    {{ 2,  1,  0, -2},     -399,         0},
+    {{ 0,  0,  2, -2},     -381,     -4421},
+    {{ 1,  1,  1,  0},      351,         0},
+    {{ 3,  0, -2,  0},     -340,         0},
+    {{ 4,  0, -3,  0},      330,         0},
+    {{ 2, -1,  2,  0},      327,         0},
+    {{ 0,  2,  1,  0},     -323,      1165},
+    {{ 1,  1, -1,  0},      299,         0},
+    {{ 2,  0,  3,  0},      294,         0},
+    {{ 2,  0, -1, -2},        0,      8752}
+};
+
+/// Latitude terms, the larger part of Meeus Table 47.B
+const SeriesEntry LATITUDE_ENTRIES[] =
+{
+    {{ 0,  0,  0,  1},  5128122, 0},
+    {{ 0,  0,  1,  1},   280602, 0},
+    {{ 0,  0,  1, -1},   277693, 0},
+    {{ 2,  0,  0, -1},   173237, 0},
+    {{ 2,  0, -1,  1},    55413, 0},
+    {{ 2,  0, -1, -1},    46271, 0},
+    {{ 2,  0,  0,  1},    32573, 0},
+    {{ 0,  0,  2,  1},    17198, 0},
+    {{ 2,  0,  1, -1},     9266, 0},
+    {{ 0,  0,  2, -1},     8822, 0},
+    {{ 2, -1,  0, -1},     8216, 0},
+    {{ 2,  0, -2, -1},     4324, 0},
+    {{ 2,  0,  1,  1},     4200, 0},
+    {{ 2,  1,  0, -1},    -3359, 0},
+    {{ 2, -1, -1,  1},     2463, 0},
+    {{ 2, -1,  0,  1},     2211, 0},
+    {{ 2, -1, -1, -1},     2065, 0},
+    {{ 0,  1, -1, -1},    -1870, 0},
+    {{ 4,  0, -1, -1},     1828, 0},
+    {{ 0,  1,  0,  1},    -1794, 0},
+    {{ 0,  0,  0,  3},    -1749, 0},
+    {{ 0,  1, -1,  1},    -1565, 0},
+    {{ 1,  0,  0,  1},    -1491, 0},
+    {{ 0,  1,  1,  1},    -1475, 0},
+    {{ 0,  1,  1, -1},    -1410, 0},
+    {{ 0,  1,  0, -1},    -1344, 0},
+    {{ 1,  0,  0, -1},    -1335, 0},
+    {{ 0,  0,  3,  1},     1107, 0},
+    {{ 4,  0,  0, -1},     1021, 0},
+    {{ 4,  0, -1,  1},      833, 0}
+};
+
+/// Mean distance of the Moon in the series, kilometres
+constexpr double SERIES_MEAN_DISTANCE_KM = 385000.56;
+
+/// Largest multiplier of any argument in either table
+constexpr int MAX_MULTIPLIER = 4;
+
+/**
+ * Size of a term for sorting, in degrees. Distance amplitudes are
+ * converted to the angle they subtend at the Moon's mean distance so
+ * the two series can be ranked on one scale.
+ */
+double termSize(const SeriesEntry& anEntry)
+{
+    double sine = std::abs(anEntry.sineAmplitude) * 1.0e-6;
+    double cosine = std::abs(anEntry.cosineAmplitude) * 1.0e-3
+                    / SERIES_MEAN_DISTANCE_KM * SPA_RADIANS_TO_DEGREES;
+    return std::max(sine, cosine);
+}
+
+} // end anonymous namespace
+
+LunarSeries::LunarSeries(std::size_t aNumTerms) :
+    theLongitudeTerms(),
+    theLatitudeTerms(),
+    theIsComplete(false)
+{
+    auto build = [aNumTerms](const SeriesEntry* aBegin, const SeriesEntry* anEnd, std::vector<Term>& aTerms)
+    {
+        std::vector<const SeriesEntry*> entries;
+        for (const SeriesEntry* entry = aBegin; entry != anEnd; entry++)
+        {
+            entries.push_back(entry);
+        }
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const SeriesEntry* aLeft, const SeriesEntry* aRight)
+                         {
+                             return termSize(*aLeft) > termSize(*aRight);
+                         });
+        entries.resize(std::min(aNumTerms, entries.size()));
+
+        for (const SeriesEntry* entry : entries)
+        {
+            Term term;
+            for (int arg = 0; arg < 4; arg++)
+            {
+                term.multiplier[arg] = static_cast<std::int8_t>(entry->multiplier[arg]);
+            }
+            term.sineAmplitude = entry->sineAmplitude * 1.0e-6;
+            term.cosineAmplitude = entry->cosineAmplitude * 1.0e-3;
+            aTerms.push_back(term);
+        }
+    };
+
+    build(std::begin(LONGITUDE_DISTANCE_ENTRIES), std::end(LONGITUDE_DISTANCE_ENTRIES), theLongitudeTerms);
+    build(std::begin(LATITUDE_ENTRIES), std::end(LATITUDE_ENTRIES), theLatitudeTerms);
+    theIsComplete = theLongitudeTerms.size() == sizeof(LONGITUDE_DISTANCE_ENTRIES) / sizeof(SeriesEntry)
+                    && theLatitudeTerms.size() == sizeof(LATITUDE_ENTRIES) / sizeof(SeriesEntry);
+}
+
+MoonPosition LunarSeries::calculatePosition(double aJulianDays) const
+{
+    double t = (aJulianDays - SPA_J2000_EPOCH) / 36525.0;
+    double t2 = t * t;
+
+    // Mean longitude and the Delaunay arguments D, M, M' and F, Meeus (47.1) to (47.5)
+    double meanLongitude = 218.3164477 + 481267.88123421 * t - 0.0015786 * t2;
+    double args[4] =
+    {
+        297.8501921 + 445267.1114034 * t - 0.0018819 * t2,
+        357.5291092 + 35999.0502909 * t - 0.0001536 * t2,
+        134.9633964 + 477198.8675055 * t + 0.0087414 * t2,
+        93.2720950 + 483202.0175233 * t - 0.0036539 * t2
+    };
+
+    // Powers of the Earth's eccentricity factor for terms in M and 2M
+    double e = 1.0 - 0.002516 * t - 0.0000074 * t2;
+    double eccentricityFactor[3] = {1.0, e, e * e};
+
+    // Sines and cosines of 0 to MAX_MULTIPLIER times each argument
+    double cosines[4][MAX_MULTIPLIER + 1];
+    double sines[4][MAX_MULTIPLIER + 1];
+    for (int arg = 0; arg < 4; arg++)
+    {
+        double radians = ANGLE_UTIL::normalizeDegrees(args[arg]) * SPA_DEGREES_TO_RADIANS;
+        cosines[arg][0] = 1.0;
+        sines[arg][0] = 0.0;
+        cosines[arg][1] = std::cos(radians);
+        sines[arg][1] = std::sin(radians);
+        for (int k = 2; k <= MAX_MULTIPLIER; k++)
+        {
+            cosines[arg][k] = 2.0 * cosines[arg][1] * cosines[arg][k - 1] - cosines[arg][k - 2];
+            sines[arg][k] = 2.0 * cosines[arg][1] * sines[arg][k - 1] - sines[arg][k - 2];
+        }
+    }
+
+    // Sine and cosine of a term's argument by repeated angle addition
+    auto evaluateArgument = [&cosines, &sines](const Term& aTerm, double& aSine, double& aCosine)
+    {
+        double cosine = 1.0;
+        double sine = 0.0;
+        for (int arg = 0; arg < 4; arg++)
+        {
+            int k = aTerm.multiplier[arg];
+            if (k != 0)
+            {
+                double cosK = cosines[arg][std::abs(k)];
+                double sinK = k > 0 ? sines[arg][k] : -sines[arg][-k];
+                double newCosine = cosine * cosK - sine * sinK;
+                sine = sine * cosK + cosine * sinK;
+                cosine = newCosine;
+            }
+        }
+        aSine = sine;
+        aCosine = cosine;
+    };
+
+    double sumLongitude = 0.0;
+    double sumDistance = 0.0;
+    for (const Term& term : theLongitudeTerms)
+    {
+        double sine;
+        double cosine;
+        evaluateArgument(term, sine, cosine);
+        double factor = eccentricityFactor[std::abs(term.multiplier[1])];
+        sumLongitude += factor * term.sineAmplitude * sine;
+        sumDistance += factor * term.cosineAmplitude * cosine;
+    }
+
+    double sumLatitude = 0.0;
+    for (const Term& term : theLatitudeTerms)
+    {
+        double sine;
+        double cosine;
+        evaluateArgument(term, sine, cosine);
+        sumLatitude += eccentricityFactor[std::abs(term.multiplier[1])] * term.sineAmplitude * sine;
+    }
+
+    if (theIsComplete)
+    {
+        // Additive terms for Venus (A1), Jupiter (A2) and the flattening of the Earth
+        double a1 = (119.75 + 131.849 * t) * SPA_DEGREES_TO_RADIANS;
+        double a2 = (53.09 + 479264.290 * t) * SPA_DEGREES_TO_RADIANS;
+        double a3 = (313.45 + 481266.484 * t) * SPA_DEGREES_TO_RADIANS;
+        double lp = meanLongitude * SPA_DEGREES_TO_RADIANS;
+        double mp = args[2] * SPA_DEGREES_TO_RADIANS;
+        double f = args[3] * SPA_DEGREES_TO_RADIANS;
+        sumLongitude += 1.0e-6 * (3958.0 * std::sin(a1) + 1962.0 * std::sin(lp - f) + 318.0 * std::sin(a2));
+        sumLatitude += 1.0e-6 * (-2235.0 * std::sin(lp) + 382.0 * std::sin(a3)
+                                 + 175.0 * std::sin(a1 - f) + 175.0 * std::sin(a1 + f)
+                                 + 127.0 * std::sin(lp - mp) - 115.0 * std::sin(lp + mp));
+    }
+
+    MoonPosition position;
+    position.eclipticLongitude = ANGLE_UTIL::normalizeDegrees(meanLongitude + sumLongitude);
+    position.eclipticLatitude = sumLatitude;
+    position.distance = SERIES_MEAN_DISTANCE_KM + sumDistance;
+
+    // Section 69 scaling
+    double distanceRatio = position.distance / SPA_MOON_SEMI_MAJOR_AXIS_KM;
+    position.angularSize = SPA_MOON_ANGULAR_DIAMETER_AT_A / distanceRatio;
+    position.horizontalParallax = SPA_MOON_PARALLAX_AT_A / distanceRatio;
+    return position;
+}
+
+MoonPosition LunarSeries::calculatePosition(const JulianDate& aJulianDate) const
+{
+    return calculatePosition(aJulianDate.getDecimalDays());
+}
+
+void LunarSeries::calculatePositions(const double* aJulianDays,
+                                     std::size_t aCount,
+                                     MoonPositionArrays& aPositions) const
+{
+    aPositions.resize(aCount);
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        MoonPosition position = calculatePosition(aJulianDays[index]);
+        aPositions.eclipticLongitude[index] = position.eclipticLongitude;
+        aPositions.eclipticLatitude[index] = position.eclipticLatitude;
+        aPositions.distance[index] = position.distance;
+        aPositions.angularSize[index] = position.angularSize;
+        aPositions.horizontalParallax[index] = position.horizontalParallax;
+    }
+}
+
+} // end namespace SPA
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MoonRiseSetSearch.cc
+ * @brief Definition of MoonRiseSetSearch functions
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "MoonRiseSetSearch.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+#include "SpaMoonConstants.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+namespace
+{
+
+/// Refinement stops when the bracket is narrower than this, days (~0.01 s).
+constexpr double TIME_TOLERANCE_DAYS = 1.0e-7;
+
+/// Upper limit on refinement iterations per event.
+constexpr int MAX_REFINEMENTS = 60;
+
+/// Mean rate of the Moon's hour angle, sidereal rate less the sidereal month, radians per day.
+constexpr double MEAN_HOUR_ANGLE_RATE = SPA_TWO_PI * (SPA_SIDEREAL_RATE - 1.0 / SPA_MOON_SIDEREAL_MONTH);
+
+} // end anonymous namespace
+
+MoonRiseSetSearch::MoonRiseSetSearch(const GeographicCoordinates& aSite) :
+    theSite(aSite),
+    theSinLatitude(std::sin(aSite.latitude * SPA_DEGREES_TO_RADIANS)),
+    theCosLatitude(std::cos(aSite.latitude * SPA_DEGREES_TO_RADIANS)),
+    theLongitude(aSite.longitude * SPA_DEGREES_TO_RADIANS),
+    thePrevious(),
+    theHasPrevious(false)
+{
+}
+
+void MoonRiseSetSearch::reset()
+{
+    theHasPrevious = false;
+}
+
+double MoonRiseSetSearch::interpolatedOffset(const Sample& aLower,
+                                             const Sample& anUpper,
+                                             double aJulianDays) const
+{
+    double fraction = (aJulianDays - aLower.julianDays) / (anUpper.julianDays - aLower.julianDays);
+    double hourAngle = aLower.hourAngle + fraction * (anUpper.hourAngle - aLower.hourAngle);
+    double dec = aLower.declination + fraction * (anUpper.declination - aLower.declination);
+    double sinRise = aLower.sinRiseAltitude + fraction * (anUpper.sinRiseAltitude - aLower.sinRiseAltitude);
+    return theSinLatitude * std::sin(dec) + theCosLatitude * std::cos(dec) * std::cos(hourAngle) - sinRise;
+}
+
+void MoonRiseSetSearch::process(const MoonTrack& aTrack,
+                                std::vector<LunarEvent>& anEvents)
+{
+    for (std::size_t index = 0; index < aTrack.size(); index++)
+    {
+        Sample current;
+        current.julianDays = aTrack.startJulianDays + aTrack.stepDays * double(index);
+        if (theHasPrevious && current.julianDays <= thePrevious.julianDays)
+        {
+            continue;
+        }
+        current.hourAngle = aTrack.greenwichHourAngle[index] + theLongitude;
+        current.declination = aTrack.declination[index];
+        current.sinRiseAltitude = aTrack.sinRiseAltitude[index];
+        current.offset = theSinLatitude * std::sin(current.declination)
+                         + theCosLatitude * std::cos(current.declination) * std::cos(current.hourAngle)
+                         - current.sinRiseAltitude;
+
+        // Keep the hour angle continuous with the previous entry, which
+        // may have come from a different track.
+        if (theHasPrevious)
+        {
+            double expected = thePrevious.hourAngle
+                              + MEAN_HOUR_ANGLE_RATE * (current.julianDays - thePrevious.julianDays);
+            current.hourAngle += SPA_TWO_PI * std::round((expected - current.hourAngle) / SPA_TWO_PI);
+        }
+
+        if (theHasPrevious)
+        {
+            double fa = thePrevious.offset;
+            double fb = current.offset;
+            bool rising = (fa < 0.0) && (fb >= 0.0);
+            bool setting = (fa >= 0.0) && (fb < 0.0);
+            if (rising || setting)
+            {
+                // Regula falsi, Illinois variant, as for the Sun.
+                double ta = thePrevious.julianDays;
+                double tb = current.julianDays;
+                int side = 0;
+                for (int iteration = 0; (iteration < MAX_REFINEMENTS) && (tb - ta > TIME_TOLERANCE_DAYS); iteration++)
+                {
+                    double tc = (ta * fb - tb * fa) / (fb - fa);
+                    double fc = interpolatedOffset(thePrevious, current, tc);
+                    if ((fc < 0.0) == (fa < 0.0))
+                    {
+                        ta = tc;
+                        fa = fc;
+                        if (side == -1)
+                        {
+                            fb *= 0.5;
+                        }
+                        side = -1;
+                    }
+                    else
+                    {
+                        tb = tc;
+                        fb = fc;
+                        if (side == 1)
+                        {
+                            fa *= 0.5;
+                        }
+                        side = 1;
+                    }
+                    if (fc == 0.0)
+                    {
+                        ta = tb = tc;
+                    }
+                }
+
+                LunarEvent event;
+                event.julianDays = 0.5 * (ta + tb);
+                event.type = rising ? LunarEventType::Moonrise : LunarEventType::Moonset;
+                anEvents.push_back(event);
+            }
+        }
+
+        thePrevious = current;
+        theHasPrevious = true;
+    }
+}
+
+} // end namespace SPA
@@ -0,0 +1,224 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MoonUtilities.cc
+ * @brief Definition of functions in the MOON_UTIL namespace
+ * @ingroup group_moon
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "MoonUtilities.h"
+#include "SpaMoonConstants.h"
+#include "SpaConstants.h"
+#include "AngleUtilities.h"
+#include "CoordinateUtilities.h"
+#include "SunUtilities.h"
+#include "JulianDate.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+void MoonPositionArrays::resize(std::size_t aSize)
+{
+    eclipticLongitude.resize(aSize);
+    eclipticLatitude.resize(aSize);
+    distance.resize(aSize);
+    angularSize.resize(aSize);
+    horizontalParallax.resize(aSize);
+}
+
+MoonPosition MoonPositionArrays::at(std::size_t anIndex) const
+{
+    MoonPosition position;
+    position.eclipticLongitude = eclipticLongitude.at(anIndex);
+    position.eclipticLatitude = eclipticLatitude.at(anIndex);
+    position.distance = distance.at(anIndex);
+    position.angularSize = angularSize.at(anIndex);
+    position.horizontalParallax = horizontalParallax.at(anIndex);
+    return position;
+}
+
+namespace MOON_UTIL
+{
+
+using ANGLE_UTIL::normalizeDegrees;
+
+namespace
+{
+
+/**
+ * Core of Sections 65 and 69, shared by the scalar and batch
+ * interfaces so that both give bit-identical answers.
+ *
+ * @param[in] aJulianDays Epoch in decimal days.
+ * @param[in] aSunLongitude Ecliptic longitude of the Sun, degrees.
+ * @param[in] aSunMeanAnomaly Mean anomaly of the Sun, degrees.
+ * @return The position of the Moon.
+ */
+MoonPosition calculateMoonPositionKernel(double aJulianDays,
+                                         double aSunLongitude,
+                                         double aSunMeanAnomaly)
+{
+    double days = aJulianDays - SPA_MOON_EPOCH_1990;
+    double sinSunAnomaly = std::sin(aSunMeanAnomaly * SPA_DEGREES_TO_RADIANS);
+
+    // Mean longitude, mean anomaly and longitude of the node
+    double meanLongitude = normalizeDegrees(SPA_MOON_MEAN_LONGITUDE_RATE * days
+                                            + SPA_MOON_MEAN_LONGITUDE_AT_EPOCH);
+    double meanAnomaly = normalizeDegrees(meanLongitude
+                                          - SPA_MOON_PERIGEE_RATE * days
+                                          - SPA_MOON_LONGITUDE_OF_PERIGEE_AT_EPOCH);
+    double node = normalizeDegrees(SPA_MOON_LONGITUDE_OF_NODE_AT_EPOCH
+                                   - SPA_MOON_NODE_RATE * days);
+
+    // Evection, annual equation and the third correction
+    double evection = 1.2739 * std::sin((2.0 * (meanLongitude - aSunLongitude) - meanAnomaly)
+                                        * SPA_DEGREES_TO_RADIANS);
+    double annualEquation = 0.1858 * sinSunAnomaly;
+    double correction3 = 0.37 * sinSunAnomaly;
+    double correctedAnomaly = meanAnomaly + evection - annualEquation - correction3;
+
+    // Equation of the centre and the fourth correction
+    double equationOfCentre = 6.2886 * std::sin(correctedAnomaly * SPA_DEGREES_TO_RADIANS);
+    double correction4 = 0.214 * std::sin(2.0 * correctedAnomaly * SPA_DEGREES_TO_RADIANS);
+    double correctedLongitude = meanLongitude + evection + equationOfCentre
+                                - annualEquation + correction4;
+
+    // Variation gives the true orbital longitude
+    double variation = 0.6583 * std::sin(2.0 * (correctedLongitude - aSunLongitude)
+                                         * SPA_DEGREES_TO_RADIANS);
+    double trueLongitude = correctedLongitude + variation;
+    double correctedNode = node - 0.16 * sinSunAnomaly;
+
+    // Project from the orbit onto the ecliptic
+    double argument = (trueLongitude - correctedNode) * SPA_DEGREES_TO_RADIANS;
+    double inclination = SPA_MOON_ORBIT_INCLINATION * SPA_DEGREES_TO_RADIANS;
+    double y = std::sin(argument) * std::cos(inclination);
+    double x = std::cos(argument);
+
+    MoonPosition position;
+    position.eclipticLongitude = normalizeDegrees(std::atan2(y, x) * SPA_RADIANS_TO_DEGREES
+                                                  + correctedNode);
+    position.eclipticLatitude = std::asin(std::sin(argument) * std::sin(inclination))
+                                * SPA_RADIANS_TO_DEGREES;
+
+    // Section 69
+    double ecc = SPA_MOON_ORBIT_ECCENTRICITY;
+    double distanceRatio = (1.0 - ecc * ecc)
+        / (1.0 + ecc * std::cos((correctedAnomaly + equationOfCentre) * SPA_DEGREES_TO_RADIANS));
+    position.distance = SPA_MOON_SEMI_MAJOR_AXIS_KM * distanceRatio;
+    position.angularSize = SPA_MOON_ANGULAR_DIAMETER_AT_A / distanceRatio;
+    position.horizontalParallax = SPA_MOON_PARALLAX_AT_A / distanceRatio;
+    return position;
+}
+
+} // end anonymous namespace
+
+MoonPosition calculateMoonPosition(const JulianDate& aJulianDate)
+{
+    SunPosition sun = SUN_UTIL::calculateSunPosition(aJulianDate);
+    return calculateMoonPositionKernel(aJulianDate.getDecimalDays(),
+                                       sun.eclipticLongitude,
+                                       sun.meanAnomaly);
+}
+
+void calculateMoonPositions(const double* aJulianDays,
+                            std::size_t aCount,
+                            MoonPositionArrays& aPositions)
+{
+    SunPositionArrays sun;
+    SUN_UTIL::calculateSunPositions(aJulianDays, aCount, sun);
+
+    aPositions.resize(aCount);
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        MoonPosition position = calculateMoonPositionKernel(aJulianDays[index],
+                                                            sun.eclipticLongitude[index],
+                                                            sun.meanAnomaly[index]);
+        aPositions.eclipticLongitude[index] = position.eclipticLongitude;
+        aPositions.eclipticLatitude[index] = position.eclipticLatitude;
+        aPositions.distance[index] = position.distance;
+        aPositions.angularSize[index] = position.angularSize;
+        aPositions.horizontalParallax[index] = position.horizontalParallax;
+    }
+}
+
+MoonHourlyMotion calculateMoonHourlyMotion(const JulianDate& aJulianDate)
+{
+    double halfStep = 0.5 * SPA_MOON_HOURLY_MOTION_STEP_DAYS;
+    MoonPosition before = calculateMoonPosition(JulianDate(aJulianDate.getDecimalDays() - halfStep));
+    MoonPosition after = calculateMoonPosition(JulianDate(aJulianDate.getDecimalDays() + halfStep));
+
+    // Remove any wrap through 360 degrees before differencing.
+    double longitudeChange = after.eclipticLongitude - before.eclipticLongitude;
+    longitudeChange -= SPA_DEGREES_IN_CIRCLE * std::round(longitudeChange / SPA_DEGREES_IN_CIRCLE);
+
+    double hours = SPA_MOON_HOURLY_MOTION_STEP_DAYS * 24.0;
+    MoonHourlyMotion motion;
+    motion.longitude = longitudeChange / hours;
+    motion.latitude = (after.eclipticLatitude - before.eclipticLatitude) / hours;
+    return motion;
+}
+
+double calculateMoonAge(const JulianDate& aJulianDate)
+{
+    SunPosition sun = SUN_UTIL::calculateSunPosition(aJulianDate);
+    MoonPosition moon = calculateMoonPositionKernel(aJulianDate.getDecimalDays(),
+                                                    sun.eclipticLongitude,
+                                                    sun.meanAnomaly);
+    return normalizeDegrees(moon.eclipticLongitude - sun.eclipticLongitude);
+}
+
+double calculateMoonPhase(const JulianDate& aJulianDate)
+{
+    return 0.5 * (1.0 - std::cos(calculateMoonAge(aJulianDate) * SPA_DEGREES_TO_RADIANS));
+}
+
+double calculateMoonBrightLimbAngle(const JulianDate& aJulianDate)
+{
+    SunPosition sun = SUN_UTIL::calculateSunPosition(aJulianDate);
+    MoonPosition moon = calculateMoonPositionKernel(aJulianDate.getDecimalDays(),
+                                                    sun.eclipticLongitude,
+                                                    sun.meanAnomaly);
+
+    double obliquity = COORD_UTIL::calculateMeanObliquity(aJulianDate);
+    EquatorialCoordinates sunEq = COORD_UTIL::convertEclipticToEquatorial(sun.eclipticLongitude,
+                                                                         0.0,
+                                                                         obliquity);
+    EquatorialCoordinates moonEq = COORD_UTIL::convertEclipticToEquatorial(moon.eclipticLongitude,
+                                                                          moon.eclipticLatitude,
+                                                                          obliquity);
+
+    double hoursToRadians = SPA_DEGREES_TO_RADIANS * 15.0;
+    double deltaRA = (sunEq.rightAscension - moonEq.rightAscension) * hoursToRadians;
+    double sunDec = sunEq.declination * SPA_DEGREES_TO_RADIANS;
+    double moonDec = moonEq.declination * SPA_DEGREES_TO_RADIANS;
+
+    double y = std::cos(sunDec) * std::sin(deltaRA);
+    double x = std::sin(sunDec) * std::cos(moonDec)
+               - std::cos(sunDec) * std::sin(moonDec) * std::cos(deltaRA);
+    return normalizeDegrees(std::atan2(y, x) * SPA_RADIANS_TO_DEGREES);
+}
+
+} // end namespace MOON_UTIL
+} // end namespace SPA
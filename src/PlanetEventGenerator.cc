@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetEventGenerator.cc
+ * @brief Definition of PlanetEventGenerator functions
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "PlanetEventGenerator.h"
+#include "PlanetUtilities.h"
+#include "SpaConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <ostream>
+
+namespace SPA
+{
+
+PlanetEventGenerator::PlanetEventGenerator(Planets aPlanet,
+                                           const JulianDate& aStart,
+                                           const JulianDate& anEnd) :
+    thePlanet(aPlanet),
+    theSampleJulianDays(aStart.getDecimalDays()),
+    theSampleSine(0.0),
+    theEndJulianDays(anEnd.getDecimalDays())
+{
+    if (thePlanet == EARTH)
+    {
+        theEndJulianDays = theSampleJulianDays;
+        return;
+    }
+    double cosine = 0.0;
+    calculateElongation(theSampleJulianDays, theSampleSine, cosine);
+}
+
+bool PlanetEventGenerator::next(PlanetEvent& anEvent)
+{
+    while (theSampleJulianDays < theEndJulianDays)
+    {
+        double before = theSampleJulianDays;
+        double after = std::fmin(before + SPA_PLANET_EVENT_STEP_DAYS, theEndJulianDays);
+        double beforeSine = theSampleSine;
+        double afterSine = 0.0;
+        double cosine = 0.0;
+        calculateElongation(after, afterSine, cosine);
+        theSampleJulianDays = after;
+        theSampleSine = afterSine;
+        if ((beforeSine < 0.0) == (afterSine < 0.0))
+        {
+            continue;
+        }
+
+        while (after - before > SPA_PLANET_EVENT_TOLERANCE_DAYS)
+        {
+            double middle = 0.5 * (before + after);
+            double middleSine = 0.0;
+            calculateElongation(middle, middleSine, cosine);
+            if ((middleSine < 0.0) == (beforeSine < 0.0))
+            {
+                before = middle;
+            }
+            else
+            {
+                after = middle;
+            }
+        }
+        double time = 0.5 * (before + after);
+        double sine = 0.0;
+        calculateElongation(time, sine, cosine);
+        anEvent.julianDays = time;
+        anEvent.planet = thePlanet;
+        anEvent.type = (cosine < 0.0) ? PlanetEventType::Opposition : PlanetEventType::Conjunction;
+        return true;
+    }
+    return false;
+}
+
+void PlanetEventGenerator::calculateElongation(double aJulianDays,
+                                               double& aSine,
+                                               double& aCosine) const
+{
+    JulianDate epoch(aJulianDays);
+    double planetLongitude = PLANET_UTIL::calculatePlanetPosition(thePlanet, epoch).eclipticLongitude;
+    double sunLongitude = PLANET_UTIL::calculatePlanetPosition(EARTH, epoch).heliocentricLongitude
+                          + 0.5 * SPA_DEGREES_IN_CIRCLE;
+    double difference = (planetLongitude - sunLongitude) * SPA_DEGREES_TO_RADIANS;
+    aSine = std::sin(difference);
+    aCosine = std::cos(difference);
+}
+
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::PlanetEventType& aType)
+{
+    switch (aType)
+    {
+        case SPA::PlanetEventType::Conjunction:
+            os << "Conjunction";
+            break;
+        case SPA::PlanetEventType::Opposition:
+            os << "Opposition";
+            break;
+        default:
+            os << "Invalid PlanetEventType";
+            break;
+    }
+    return os;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetOrbit.cc
+ * @brief Definition of PlanetOrbit functions
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "PlanetOrbit.h"
+#include "KeplerUtilities.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+
+#include <cmath>
+
+namespace SPA
+{
+
+namespace
+{
+
+/// Elements of a circular orbit of radius 1 AU in the ecliptic.
+constexpr PlanetaryElements DEFAULT_ELEMENTS = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0};
+
+} // end anonymous namespace
+
+PlanetOrbit::PlanetOrbit() : PlanetOrbit(DEFAULT_ELEMENTS)
+{
+}
+
+PlanetOrbit::PlanetOrbit(const PlanetaryElements& anElements) :
+    theElements(anElements),
+    theDailyMotion(SPA_TWO_PI / (SPA_DAYS_IN_TROPICAL_YEAR * anElements.period)),
+    theMeanAnomalyAtEpoch((anElements.longitudeAtEpoch - anElements.longitudeOfPerihelion) * SPA_DEGREES_TO_RADIANS),
+    theSemiMajorAxis(anElements.semiMajorAxis),
+    theSemiMinorAxis(anElements.semiMajorAxis * std::sqrt(1.0 - anElements.eccentricity * anElements.eccentricity)),
+    theEccentricity(anElements.eccentricity),
+    theP(),
+    theQ()
+{
+    double node = anElements.longitudeOfAscendingNode * SPA_DEGREES_TO_RADIANS;
+    double perihelion = (anElements.longitudeOfPerihelion - anElements.longitudeOfAscendingNode) * SPA_DEGREES_TO_RADIANS;
+    double inclination = anElements.inclination * SPA_DEGREES_TO_RADIANS;
+
+    double cosNode = std::cos(node);
+    double sinNode = std::sin(node);
+    double cosPeri = std::cos(perihelion);
+    double sinPeri = std::sin(perihelion);
+    double cosIncl = std::cos(inclination);
+    double sinIncl = std::sin(inclination);
+
+    theP[0] = cosNode * cosPeri - sinNode * sinPeri * cosIncl;
+    theP[1] = sinNode * cosPeri + cosNode * sinPeri * cosIncl;
+    theP[2] = sinPeri * sinIncl;
+
+    theQ[0] = -cosNode * sinPeri - sinNode * cosPeri * cosIncl;
+    theQ[1] = -sinNode * sinPeri + cosNode * cosPeri * cosIncl;
+    theQ[2] = cosPeri * sinIncl;
+}
+
+void PlanetOrbit::calculateHeliocentricPosition(double aJulianDays,
+                                                double& anX,
+                                                double& aY,
+                                                double& aZ) const
+{
+    calculateHeliocentricPositions(&aJulianDays, 1, &anX, &aY, &aZ);
+    return;
+}
+
+void PlanetOrbit::calculateHeliocentricPositions(const double* aJulianDays,
+                                                 std::size_t aCount,
+                                                 double* anX,
+                                                 double* aY,
+                                                 double* aZ) const
+{
+    // Mean anomalies are parked in anX for the in-place Kepler solve.
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        anX[index] = calculateMeanAnomaly(aJulianDays[index]);
+    }
+    KEPLER_UTIL::solveKeplerElliptic(anX, aCount, theEccentricity, anX);
+
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        double eccAnomaly = anX[index];
+        double alongP = theSemiMajorAxis * (std::cos(eccAnomaly) - theEccentricity);
+        double alongQ = theSemiMinorAxis * std::sin(eccAnomaly);
+        anX[index] = alongP * theP[0] + alongQ * theQ[0];
+        aY[index] = alongP * theP[1] + alongQ * theQ[1];
+        aZ[index] = alongP * theP[2] + alongQ * theQ[2];
+    }
+    return;
+}
+
+} // end namespace SPA
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetUtilities.cc
+ * @brief Definitions of PLANET_UTIL functions
+ * @ingroup group_planets
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "PlanetUtilities.h"
+#include "PlanetOrbit.h"
+#include "SpaPlanetConstants.h"
+#include "SpaConstants.h"
+#include "AngleUtilities.h"
+#include "JulianDate.h"
+
+#include <array>
+#include <cmath>
+
+namespace SPA
+{
+
+void PlanetPositionArrays::resize(std::size_t aSize)
+{
+    heliocentricLongitude.resize(aSize);
+    heliocentricLatitude.resize(aSize);
+    radiusVector.resize(aSize);
+    eclipticLongitude.resize(aSize);
+    eclipticLatitude.resize(aSize);
+    distance.resize(aSize);
+    lightTime.resize(aSize);
+    angularSize.resize(aSize);
+}
+
+PlanetPosition PlanetPositionArrays::at(std::size_t anIndex) const
+{
+    PlanetPosition position;
+    position.heliocentricLongitude = heliocentricLongitude.at(anIndex);
+    position.heliocentricLatitude = heliocentricLatitude.at(anIndex);
+    position.radiusVector = radiusVector.at(anIndex);
+    position.eclipticLongitude = eclipticLongitude.at(anIndex);
+    position.eclipticLatitude = eclipticLatitude.at(anIndex);
+    position.distance = distance.at(anIndex);
+    position.lightTime = lightTime.at(anIndex);
+    position.angularSize = angularSize.at(anIndex);
+    return position;
+}
+
+namespace PLANET_UTIL
+{
+
+namespace
+{
+
+/// Heliocentric rectangular coordinates at a set of epochs, AU.
+struct RectangularArrays
+{
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+
+    void resize(std::size_t aSize)
+    {
+        x.resize(aSize);
+        y.resize(aSize);
+        z.resize(aSize);
+    }
+};
+
+/**
+ * Core of Sections 54 and 57 for one planet over an array of epochs,
+ * given the Earth's position at those epochs. Results are written to
+ * aPositions starting at anOffset. aScratch holds the retarded times
+ * and aPlanet the planet's coordinates.
+ */
+void calculatePlanetPositionKernel(Planets aPlanet,
+                                   const double* aJulianDays,
+                                   std::size_t aCount,
+                                   const RectangularArrays& anEarth,
+                                   std::vector<double>& aScratch,
+                                   RectangularArrays& aPlanetXYZ,
+                                   std::size_t anOffset,
+                                   PlanetPositionArrays& aPositions)
+{
+    using ANGLE_UTIL::normalizeDegrees;
+
+    const PlanetOrbit& orbit = getPlanetOrbit(aPlanet);
+    aScratch.assign(aJulianDays, aJulianDays + aCount);
+    aPlanetXYZ.resize(aCount);
+    double* lightTime = aPositions.lightTime.data() + anOffset;
+    double* distance = aPositions.distance.data() + anOffset;
+
+    // Each light-time pass moves the planet back to the time the light
+    // left it, using the distance found in the previous pass.
+    for (int pass = 0; pass <= SPA_PLANET_LIGHT_TIME_ITERATIONS; pass++)
+    {
+        orbit.calculateHeliocentricPositions(aScratch.data(), aCount,
+                                             aPlanetXYZ.x.data(), aPlanetXYZ.y.data(), aPlanetXYZ.z.data());
+        for (std::size_t index = 0; index < aCount; index++)
+        {
+            double dx = aPlanetXYZ.x[index] - anEarth.x[index];
+            double dy = aPlanetXYZ.y[index] - anEarth.y[index];
+            double dz = aPlanetXYZ.z[index] - anEarth.z[index];
+            distance[index] = std::sqrt(dx * dx + dy * dy + dz * dz);
+            lightTime[index] = SPA_LIGHT_TIME_DAYS_PER_AU * distance[index];
+            aScratch[index] = aJulianDays[index] - lightTime[index];
+        }
+    }
+
+    bool isEarth = (aPlanet == EARTH);
+    double angularDiameter = SPA_PLANETARY_ELEMENTS_1990[aPlanet].angularDiameterAt1AU;
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        double x = aPlanetXYZ.x[index];
+        double y = aPlanetXYZ.y[index];
+        double z = aPlanetXYZ.z[index];
+        double radius = std::sqrt(x * x + y * y + z * z);
+        std::size_t out = anOffset + index;
+        aPositions.heliocentricLongitude[out] = normalizeDegrees(std::atan2(y, x) * SPA_RADIANS_TO_DEGREES);
+        aPositions.heliocentricLatitude[out] = std::asin(z / radius) * SPA_RADIANS_TO_DEGREES;
+        aPositions.radiusVector[out] = radius;
+
+        if (isEarth)
+        {
+            aPositions.eclipticLongitude[out] = 0;
+            aPositions.eclipticLatitude[out] = 0;
+            aPositions.distance[out] = 0;
+            aPositions.lightTime[out] = 0;
+            aPositions.angularSize[out] = 0;
+            continue;
+        }
+
+        double dx = x - anEarth.x[index];
+        double dy = y - anEarth.y[index];
+        double dz = z - anEarth.z[index];
+        aPositions.eclipticLongitude[out] = normalizeDegrees(std::atan2(dy, dx) * SPA_RADIANS_TO_DEGREES);
+        aPositions.eclipticLatitude[out] = std::asin(dz / distance[index]) * SPA_RADIANS_TO_DEGREES;
+        aPositions.angularSize[out] = angularDiameter / distance[index];
+    }
+    return;
+}
+
+/// Heliocentric position of the Earth at each epoch.
+void calculateEarthPositions(const double* aJulianDays,
+                             std::size_t aCount,
+                             RectangularArrays& anEarth)
+{
+    anEarth.resize(aCount);
+    getPlanetOrbit(EARTH).calculateHeliocentricPositions(aJulianDays, aCount,
+                                                         anEarth.x.data(), anEarth.y.data(), anEarth.z.data());
+}
+
+} // end anonymous namespace
+
+const PlanetOrbit& getPlanetOrbit(Planets aPlanet)
+{
+    // Built once, on first use; thread-safe under C++11 static
+    // initialization rules.
+    static const std::array<PlanetOrbit, SPA_NUM_PLANETS> orbits = {{
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[MERCURY]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[VENUS]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[EARTH]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[MARS]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[JUPITER]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[SATURN]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[URANUS]),
+        PlanetOrbit(SPA_PLANETARY_ELEMENTS_1990[NEPTUNE])}};
+    return orbits[aPlanet];
+}
+
+PlanetPosition calculatePlanetPosition(Planets aPlanet,
+                                       const JulianDate& aJulianDate)
+{
+    double julianDays = aJulianDate.getDecimalDays();
+    PlanetPositionArrays positions;
+    calculatePlanetPositions(aPlanet, &julianDays, 1, positions);
+    return positions.at(0);
+}
+
+void calculatePlanetPositions(Planets aPlanet,
+                              const double* aJulianDays,
+                              std::size_t aCount,
+                              PlanetPositionArrays& aPositions)
+{
+    RectangularArrays earth;
+    RectangularArrays planet;
+    std::vector<double> scratch;
+    calculateEarthPositions(aJulianDays, aCount, earth);
+    aPositions.resize(aCount);
+    calculatePlanetPositionKernel(aPlanet, aJulianDays, aCount, earth, scratch, planet, 0, aPositions);
+    return;
+}
+
+void calculatePlanetPositionGrid(const std::vector<Planets>& aPlanets,
+                                 const double* aJulianDays,
+                                 std::size_t aCount,
+                                 PlanetPositionArrays& aPositions)
+{
+    RectangularArrays earth;
+    RectangularArrays planet;
+    std::vector<double> scratch;
+    calculateEarthPositions(aJulianDays, aCount, earth);
+    aPositions.resize(aPlanets.size() * aCount);
+    for (std::size_t planetIndex = 0; planetIndex < aPlanets.size(); planetIndex++)
+    {
+        calculatePlanetPositionKernel(aPlanets[planetIndex], aJulianDays, aCount, earth, scratch, planet,
+                                      planetIndex * aCount, aPositions);
+    }
+    return;
+}
+
+} // end namespace PLANET_UTIL
+} // end namespace SPA
@@ -0,0 +1,417 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file RiseSetUtilities.cc
+ * @brief Definitions of RISESET_UTIL functions
+ * @ingroup group_sun
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "RiseSetUtilities.h"
+#include "MoonRiseSetSearch.h"
+#include "LunarSeries.h"
+#include "SpaMoonConstants.h"
+#include "SpaTimeConstants.h"
+#include "SunUtilities.h"
+#include "SpaSunConstants.h"
+#include "SpaConstants.h"
+#include "AngleUtilities.h"
+#include "TimeUtilities.h"
+#include "JulianDate.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <ostream>
+
+namespace SPA
+{
+namespace RISESET_UTIL
+{
+
+namespace
+{
+
+/// Number of threshold altitudes searched for.
+constexpr int NUM_THRESHOLDS = 4;
+
+/// Threshold altitudes, degrees, from highest to lowest.
+constexpr std::array<double, NUM_THRESHOLDS> THRESHOLD_ALTITUDES = {{
+    SPA_SUN_ALTITUDE_AT_SUNRISE,
+    SPA_SUN_ALTITUDE_CIVIL_TWILIGHT,
+    SPA_SUN_ALTITUDE_NAUTICAL_TWILIGHT,
+    SPA_SUN_ALTITUDE_ASTRONOMICAL_TWILIGHT}};
+
+/// Event types for the Sun rising through each threshold.
+constexpr std::array<SolarEventType, NUM_THRESHOLDS> RISING_EVENTS = {{
+    SolarEventType::Sunrise,
+    SolarEventType::CivilDawn,
+    SolarEventType::NauticalDawn,
+    SolarEventType::AstronomicalDawn}};
+
+/// Event types for the Sun setting through each threshold.
+constexpr std::array<SolarEventType, NUM_THRESHOLDS> SETTING_EVENTS = {{
+    SolarEventType::Sunset,
+    SolarEventType::CivilDusk,
+    SolarEventType::NauticalDusk,
+    SolarEventType::AstronomicalDusk}};
+
+/// Refinement stops when the bracket is narrower than this, days (~0.01 s).
+constexpr double TIME_TOLERANCE_DAYS = 1.0e-7;
+
+/// Upper limit on refinement iterations per event.
+constexpr int MAX_REFINEMENTS = 60;
+
+/**
+ * Sine of the altitude of the Sun at an arbitrary time within the
+ * track, using linearly interpolated right ascension and declination
+ * and the exact sidereal time.
+ */
+double interpolatedSinAltitude(const SunTrack& aTrack,
+                               double aSinLatitude,
+                               double aCosLatitude,
+                               double aLongitude,
+                               double aJulianDays)
+{
+    double position = (aJulianDays - aTrack.startJulianDays) / aTrack.stepDays;
+    std::size_t lower = std::min(std::size_t(std::max(position, 0.0)), aTrack.size() - 2);
+    double fraction = position - double(lower);
+
+    double ra = aTrack.rightAscension[lower]
+                    + fraction * (aTrack.rightAscension[lower + 1] - aTrack.rightAscension[lower]);
+    double dec = aTrack.declination[lower]
+                    + fraction * (aTrack.declination[lower + 1] - aTrack.declination[lower]);
+
+    double lst = TIME_UTIL::calculateLocalSiderealTime(
+                    TIME_UTIL::calculateGreenwichSiderealTime(JulianDate(aJulianDays)),
+                    aLongitude);
+    double hourAngle = lst * 15.0 * SPA_DEGREES_TO_RADIANS - ra;
+    return aSinLatitude * std::sin(dec) + aCosLatitude * std::cos(dec) * std::cos(hourAngle);
+}
+
+} // end anonymous namespace
+
+void calculateSunTrack(const JulianDate& aStart,
+                       const JulianDate& anEnd,
+                       double aStepDays,
+                       SunTrack& aTrack)
+{
+    double spanDays = anEnd.getDecimalDays() - aStart.getDecimalDays();
+    std::size_t count = std::size_t(std::ceil(std::max(spanDays, 0.0) / aStepDays)) + 1;
+    count = std::max(count, std::size_t(2));
+
+    SunPositionArrays positions;
+    SUN_UTIL::calculateSunPositionSeries(aStart, aStepDays, count, positions);
+
+    aTrack.startJulianDays = aStart.getDecimalDays();
+    aTrack.stepDays = aStepDays;
+    aTrack.rightAscension.resize(count);
+    aTrack.declination.resize(count);
+
+    double previousRa = 0.0;
+    for (std::size_t index = 0; index < count; index++)
+    {
+        JulianDate epoch(aTrack.startJulianDays + aStepDays * double(index));
+        EquatorialCoordinates equatorial = COORD_UTIL::convertEclipticToEquatorial(
+                        positions.eclipticLongitude[index],
+                        0.0,
+                        COORD_UTIL::calculateMeanObliquity(epoch));
+
+        // Unwrap so that consecutive entries never differ by ~2 pi.
+        double ra = equatorial.rightAscension * 15.0 * SPA_DEGREES_TO_RADIANS;
+        if (index > 0)
+        {
+            ra += SPA_TWO_PI * std::round((previousRa - ra) / SPA_TWO_PI);
+        }
+        previousRa = ra;
+
+        aTrack.rightAscension[index] = ra;
+        aTrack.declination[index] = equatorial.declination * SPA_DEGREES_TO_RADIANS;
+    }
+    return;
+}
+
+void findSolarEvents(const SunTrack& aTrack,
+                     const GeographicCoordinates& aSite,
+                     std::vector<SolarEvent>& anEvents)
+{
+    anEvents.clear();
+    std::size_t count = aTrack.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    double sinLat = std::sin(aSite.latitude * SPA_DEGREES_TO_RADIANS);
+    double cosLat = std::cos(aSite.latitude * SPA_DEGREES_TO_RADIANS);
+    std::array<double, NUM_THRESHOLDS> sinThresholds;
+    for (int level = 0; level < NUM_THRESHOLDS; level++)
+    {
+        sinThresholds[level] = std::sin(THRESHOLD_ALTITUDES[level] * SPA_DEGREES_TO_RADIANS);
+    }
+
+    // Coarse pass: sine of the altitude at every entry of the track.
+    std::vector<double> sinAltitude(count);
+    for (std::size_t index = 0; index < count; index++)
+    {
+        double julianDays = aTrack.startJulianDays + aTrack.stepDays * double(index);
+        sinAltitude[index] = interpolatedSinAltitude(aTrack, sinLat, cosLat, aSite.longitude, julianDays);
+    }
+
+    // Bracket and refine.
+    for (std::size_t index = 0; index + 1 < count; index++)
+    {
+        for (int level = 0; level < NUM_THRESHOLDS; level++)
+        {
+            double fa = sinAltitude[index] - sinThresholds[level];
+            double fb = sinAltitude[index + 1] - sinThresholds[level];
+            bool rising = (fa < 0.0) && (fb >= 0.0);
+            bool setting = (fa >= 0.0) && (fb < 0.0);
+            if (!rising && !setting)
+            {
+                continue;
+            }
+
+            double ta = aTrack.startJulianDays + aTrack.stepDays * double(index);
+            double tb = ta + aTrack.stepDays;
+            int side = 0;
+            for (int iteration = 0; (iteration < MAX_REFINEMENTS) && (tb - ta > TIME_TOLERANCE_DAYS); iteration++)
+            {
+                double tc = (ta * fb - tb * fa) / (fb - fa);
+                double fc = interpolatedSinAltitude(aTrack, sinLat, cosLat, aSite.longitude, tc)
+                                - sinThresholds[level];
+                if ((fc < 0.0) == (fa < 0.0))
+                {
+                    ta = tc;
+                    fa = fc;
+                    if (side == -1)
+                    {
+                        fb *= 0.5;
+                    }
+                    side = -1;
+                }
+                else
+                {
+                    tb = tc;
+                    fb = fc;
+                    if (side == 1)
+                    {
+                        fa *= 0.5;
+                    }
+                    side = 1;
+                }
+                if (fc == 0.0)
+                {
+                    ta = tb = tc;
+                }
+            }
+
+            SolarEvent event;
+            event.julianDays = 0.5 * (ta + tb);
+            event.type = rising ? RISING_EVENTS[level] : SETTING_EVENTS[level];
+            anEvents.push_back(event);
+        }
+    }
+
+    // Events of different types within one step were appended by level.
+    std::stable_sort(anEvents.begin(),
+                     anEvents.end(),
+                     [](const SolarEvent& aLHS, const SolarEvent& aRHS)
+                     {
+                         return aLHS.julianDays < aRHS.julianDays;
+                     });
+    return;
+}
+
+void findSolarEvents(const GeographicCoordinates& aSite,
+                     const JulianDate& aStart,
+                     const JulianDate& anEnd,
+                     std::vector<SolarEvent>& anEvents)
+{
+    SunTrack track;
+    calculateSunTrack(aStart, anEnd, SPA_SUN_TRACK_STEP_DAYS, track);
+    findSolarEvents(track, aSite, anEvents);
+
+    // The track may extend slightly past anEnd.
+    double endDays = anEnd.getDecimalDays();
+    anEvents.erase(std::remove_if(anEvents.begin(),
+                                  anEvents.end(),
+                                  [endDays](const SolarEvent& anEvent)
+                                  {
+                                      return anEvent.julianDays > endDays;
+                                  }),
+                   anEvents.end());
+    return;
+}
+
+void calculateMoonTrack(const JulianDate& aStart,
+                        const JulianDate& anEnd,
+                        double aStepDays,
+                        MoonTrack& aTrack)
+{
+    static const LunarSeries series;
+
+    double spanDays = anEnd.getDecimalDays() - aStart.getDecimalDays();
+    std::size_t count = std::size_t(std::ceil(std::max(spanDays, 0.0) / aStepDays)) + 1;
+    count = std::max(count, std::size_t(2));
+
+    aTrack.startJulianDays = aStart.getDecimalDays();
+    aTrack.stepDays = aStepDays;
+    aTrack.greenwichHourAngle.resize(count);
+    aTrack.declination.resize(count);
+    aTrack.sinRiseAltitude.resize(count);
+
+    std::vector<double> times(count);
+    for (std::size_t index = 0; index < count; index++)
+    {
+        times[index] = aTrack.startJulianDays + aStepDays * double(index);
+    }
+    MoonPositionArrays positions;
+    series.calculatePositions(times.data(), count, positions);
+
+    double previousHourAngle = 0.0;
+    for (std::size_t index = 0; index < count; index++)
+    {
+        JulianDate epoch(times[index]);
+        EquatorialCoordinates equatorial = COORD_UTIL::convertEclipticToEquatorial(
+                        positions.eclipticLongitude[index],
+                        positions.eclipticLatitude[index],
+                        COORD_UTIL::calculateMeanObliquity(epoch));
+        double gst = TIME_UTIL::calculateGreenwichSiderealTime(epoch);
+
+        // Unwrap so that consecutive entries differ by about the hour
+        // angle's mean motion over one step.
+        double hourAngle = (gst - equatorial.rightAscension) * 15.0 * SPA_DEGREES_TO_RADIANS;
+        if (index > 0)
+        {
+            double expected = previousHourAngle
+                              + SPA_TWO_PI * (SPA_SIDEREAL_RATE - 1.0 / SPA_MOON_SIDEREAL_MONTH) * aStepDays;
+            hourAngle += SPA_TWO_PI * std::round((expected - hourAngle) / SPA_TWO_PI);
+        }
+        previousHourAngle = hourAngle;
+
+        double riseAltitude = positions.horizontalParallax[index]
+                              - 0.5 * positions.angularSize[index]
+                              - SPA_MOON_HORIZON_REFRACTION;
+        aTrack.greenwichHourAngle[index] = hourAngle;
+        aTrack.declination[index] = equatorial.declination * SPA_DEGREES_TO_RADIANS;
+        aTrack.sinRiseAltitude[index] = std::sin(riseAltitude * SPA_DEGREES_TO_RADIANS);
+    }
+    return;
+}
+
+void findLunarEvents(const MoonTrack& aTrack,
+                     const GeographicCoordinates& aSite,
+                     std::vector<LunarEvent>& anEvents)
+{
+    anEvents.clear();
+    MoonRiseSetSearch search(aSite);
+    search.process(aTrack, anEvents);
+    return;
+}
+
+void findLunarEvents(const MoonTrack& aTrack,
+                     const std::vector<GeographicCoordinates>& aSites,
+                     std::vector<std::vector<LunarEvent>>& anEvents)
+{
+    anEvents.resize(aSites.size());
+    for (std::size_t site = 0; site < aSites.size(); site++)
+    {
+        findLunarEvents(aTrack, aSites[site], anEvents[site]);
+    }
+    return;
+}
+
+void findLunarEvents(const GeographicCoordinates& aSite,
+                     const JulianDate& aStart,
+                     const JulianDate& anEnd,
+                     std::vector<LunarEvent>& anEvents)
+{
+    MoonTrack track;
+    calculateMoonTrack(aStart, anEnd, SPA_MOON_TRACK_STEP_DAYS, track);
+    findLunarEvents(track, aSite, anEvents);
+
+    // The track may extend slightly past anEnd.
+    double endDays = anEnd.getDecimalDays();
+    anEvents.erase(std::remove_if(anEvents.begin(),
+                                  anEvents.end(),
+                                  [endDays](const LunarEvent& anEvent)
+                                  {
+                                      return anEvent.julianDays > endDays;
+                                  }),
+                   anEvents.end());
+    return;
+}
+
+} // end namespace RISESET_UTIL
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::SolarEventType& aType)
+{
+    switch (aType)
+    {
+        case SPA::SolarEventType::AstronomicalDawn:
+            os << "Astronomical dawn";
+            break;
+        case SPA::SolarEventType::NauticalDawn:
+            os << "Nautical dawn";
+            break;
+        case SPA::SolarEventType::CivilDawn:
+            os << "Civil dawn";
+            break;
+        case SPA::SolarEventType::Sunrise:
+            os << "Sunrise";
+            break;
+        case SPA::SolarEventType::Sunset:
+            os << "Sunset";
+            break;
+        case SPA::SolarEventType::CivilDusk:
+            os << "Civil dusk";
+            break;
+        case SPA::SolarEventType::NauticalDusk:
+            os << "Nautical dusk";
+            break;
+        case SPA::SolarEventType::AstronomicalDusk:
+            os << "Astronomical dusk";
+            break;
+        default:
+            os << "Invalid SolarEventType";
+            break;
+    }
+    return os;
+}
+
+std::ostream& operator<<(std::ostream& os, const SPA::LunarEventType& aType)
+{
+    switch (aType)
+    {
+        case SPA::LunarEventType::Moonrise:
+            os << "Moonrise";
+            break;
+        case SPA::LunarEventType::Moonset:
+            os << "Moonset";
+            break;
+        default:
+            os << "Invalid LunarEventType";
+            break;
+    }
+    return os;
+}
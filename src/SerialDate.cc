@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file SerialDate.cc
+ * @brief Definitions of the SerialDate class
+ * @ingroup group_time
+ *
+ * The conversions count days from 1 March of year 0, so that the leap
+ * day falls at the end of the counting year, in whole cycles of the
+ * calendar (400 years Gregorian, 4 years Julian). The day of such a
+ * year follows from the month with the linear formula (153 m + 2) / 5.
+ * All divisions of possibly negative values are floored.
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "SerialDate.h"
+#include "SpaTimeConstants.h"
+#include "SpaDate.h"
+#include "JulianDate.h"
+
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace SPA
+{
+namespace
+{
+
+// Days in a whole cycle of each calendar
+constexpr std::int64_t DAYS_IN_GREGORIAN_CYCLE = 146097; // 400 years
+constexpr std::int64_t DAYS_IN_JULIAN_CYCLE = 1461;      // 4 years
+
+// Days from 0000-03-01 in each calendar to 2000-01-01 Gregorian
+constexpr std::int64_t GREGORIAN_MARCH_ZERO_OFFSET = 730425;
+constexpr std::int64_t JULIAN_MARCH_ZERO_OFFSET = 730427;
+
+// Integer division rounded toward negative infinity, for a positive divisor
+inline std::int64_t floorDivide(std::int64_t aNumerator, std::int64_t aDivisor)
+{
+    return (aNumerator >= 0 ? aNumerator : aNumerator - aDivisor + 1) / aDivisor;
+}
+
+// Day of the year counted from 1 March, for a month counted from March = 0
+inline int dayOfMarchYear(int aMarchMonth, int aDay)
+{
+    return (153 * aMarchMonth + 2) / 5 + aDay - 1;
+}
+
+// Inverse of dayOfMarchYear()
+inline void monthAndDayOfMarchYear(int aDayOfYear, int& aMonth, int& aDay)
+{
+    int marchMonth = (5 * aDayOfYear + 2) / 153;
+    aDay = aDayOfYear - (153 * marchMonth + 2) / 5 + 1;
+    aMonth = (marchMonth < 10) ? marchMonth + 3 : marchMonth - 9;
+}
+
+std::int32_t daysFromCivil(int aYear, int aMonth, int aDay)
+{
+    bool isGregorian = (aYear > 1582) ||
+                       (aYear == 1582 && (aMonth > 10 || (aMonth == 10 && aDay >= 15)));
+    std::int64_t year = (aMonth <= FEB) ? aYear - 1 : aYear;
+    int dayOfYear = dayOfMarchYear((aMonth > FEB) ? aMonth - 3 : aMonth + 9, aDay);
+
+    std::int64_t days;
+    if (isGregorian)
+    {
+        std::int64_t cycle = floorDivide(year, 400);
+        std::int64_t yearOfCycle = year - 400 * cycle; // [0, 399]
+        days = cycle * DAYS_IN_GREGORIAN_CYCLE
+             + 365 * yearOfCycle + yearOfCycle / 4 - yearOfCycle / 100
+             + dayOfYear - GREGORIAN_MARCH_ZERO_OFFSET;
+    }
+    else
+    {
+        std::int64_t cycle = floorDivide(year, 4);
+        std::int64_t yearOfCycle = year - 4 * cycle; // [0, 3]
+        days = cycle * DAYS_IN_JULIAN_CYCLE
+             + 365 * yearOfCycle
+             + dayOfYear - JULIAN_MARCH_ZERO_OFFSET;
+    }
+    return static_cast<std::int32_t>(days);
+}
+
+} // end anonymous namespace
+
+SerialDate::SerialDate(int aYear,
+                       int aMonth,
+                       int aDay) : theDays(daysFromCivil(aYear, aMonth, aDay))
+{
+}
+
+SerialDate::SerialDate(const SpaDate& aSpaDate) :
+        theDays(daysFromCivil(aSpaDate.getYear(), aSpaDate.getMonth(), aSpaDate.getDay()))
+{
+}
+
+void SerialDate::getYearMonthDay(int& aYear,
+                                 int& aMonth,
+                                 int& aDay) const
+{
+    std::int64_t year;
+    int dayOfYear;
+    if (theDays >= SPA_SERIAL_DATE_FIRST_GREGORIAN_DAY)
+    {
+        std::int64_t days = theDays + GREGORIAN_MARCH_ZERO_OFFSET;
+        std::int64_t cycle = floorDivide(days, DAYS_IN_GREGORIAN_CYCLE);
+        std::int64_t dayOfCycle = days - cycle * DAYS_IN_GREGORIAN_CYCLE; // [0, 146096]
+        std::int64_t yearOfCycle = (dayOfCycle - dayOfCycle / 1460 + dayOfCycle / 36524
+                                    - dayOfCycle / 146096) / 365;         // [0, 399]
+        year = yearOfCycle + 400 * cycle;
+        dayOfYear = int(dayOfCycle - (365 * yearOfCycle + yearOfCycle / 4 - yearOfCycle / 100));
+    }
+    else
+    {
+        std::int64_t days = theDays + JULIAN_MARCH_ZERO_OFFSET;
+        std::int64_t cycle = floorDivide(days, DAYS_IN_JULIAN_CYCLE);
+        std::int64_t dayOfCycle = days - cycle * DAYS_IN_JULIAN_CYCLE;    // [0, 1460]
+        std::int64_t yearOfCycle = (dayOfCycle - dayOfCycle / 1460) / 365; // [0, 3]
+        year = yearOfCycle + 4 * cycle;
+        dayOfYear = int(dayOfCycle - 365 * yearOfCycle);
+    }
+
+    monthAndDayOfMarchYear(dayOfYear, aMonth, aDay);
+    aYear = int((aMonth <= FEB) ? year + 1 : year);
+}
+
+SpaDate SerialDate::getSpaDate() const
+{
+    int year;
+    int month;
+    int day;
+    getYearMonthDay(year, month, day);
+    return SpaDate(year, month, day);
+}
+
+JulianDate SerialDate::getJulianDate() const
+{
+    return JulianDate(SPA_SERIAL_DATE_EPOCH + theDays);
+}
+
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::SerialDate& aSerialDate)
+{
+    int year;
+    int month;
+    int day;
+    aSerialDate.getYearMonthDay(year, month, day);
+
+    std::ostringstream buffer;
+    buffer << "SerialDate{ theDays=" << aSerialDate.getDays()
+           << " (" << year << "-" << std::setfill('0') << std::setw(2) << month
+           << "-" << std::setw(2) << day << ") }";
+    os << buffer.str();
+    return os;
+}
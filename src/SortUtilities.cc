@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file SortUtilities.cc
+ * @brief Definitions of SORT_UTIL functions
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "SortUtilities.h"
+#include "SpaConstants.h"
+#include "DateAndTime.h"
+#include "JulianDate.h"
+#include "ParallelUtilities.h"
+#include "ThreadPool.h"
+#include "TimeUtilities.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace SPA
+{
+namespace SORT_UTIL
+{
+namespace
+{
+
+// Bytes are the digits of the sort
+constexpr int DIGIT_BITS = 8;
+constexpr int NUM_DIGITS = 64 / DIGIT_BITS;
+constexpr std::size_t NUM_BUCKETS = std::size_t(1) << DIGIT_BITS;
+constexpr std::uint64_t DIGIT_MASK = NUM_BUCKETS - 1;
+constexpr std::uint64_t SIGN_BIT = std::uint64_t(1) << 63;
+
+// Maps a signed key to an unsigned one with the same order
+inline std::uint64_t toOrderedBits(std::int64_t aKey)
+{
+    return std::uint64_t(aKey) ^ SIGN_BIT;
+}
+
+// Maps a double to an unsigned integer with the same order: negative
+// values have every bit flipped, positive ones just the sign bit.
+inline std::uint64_t toOrderedBits(double aValue)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &aValue, sizeof(bits));
+    return (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+}
+
+// Inverse of toOrderedBits(double)
+inline double fromOrderedBits(std::uint64_t anOrderedBits)
+{
+    std::uint64_t bits = (anOrderedBits & SIGN_BIT) ? (anOrderedBits ^ SIGN_BIT) : ~anOrderedBits;
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/*
+ * Sorts aKeys into ascending order, applying the same permutation to
+ * aValues unless it is null. The sort is stable.
+ *
+ * The input is cut into one contiguous block per thread. For each
+ * digit every block counts its keys per bucket, a prefix sum over
+ * (bucket, block) gives each block its own run of output positions in
+ * each bucket, and every block then scatters its keys in input order.
+ */
+void sortKeys(std::uint64_t* aKeys,
+              std::size_t* aValues,
+              std::size_t aCount,
+              ThreadPool* aPool)
+{
+    if (aCount < 2)
+    {
+        return;
+    }
+
+    ThreadPool& pool = (aPool != nullptr) ? *aPool : ThreadPool::getDefault();
+    std::size_t numBlocks = 1;
+    if (aCount >= SPA_RADIX_SORT_PARALLEL_MIN_COUNT)
+    {
+        numBlocks = pool.getNumThreads();
+    }
+    std::size_t blockSize = (aCount + numBlocks - 1) / numBlocks;
+    numBlocks = (aCount + blockSize - 1) / blockSize;
+
+    // Digits that every key shares need no pass
+    std::vector<std::uint64_t> blockDiffering(numBlocks, 0);
+    std::uint64_t firstKey = aKeys[0];
+    pool.run(aCount,
+             blockSize,
+             [&](std::size_t aBegin, std::size_t anEnd)
+             {
+                 std::uint64_t differing = 0;
+                 for (std::size_t i = aBegin; i < anEnd; i++)
+                 {
+                     differing |= aKeys[i] ^ firstKey;
+                 }
+                 blockDiffering[aBegin / blockSize] = differing;
+             });
+    std::uint64_t differing = 0;
+    for (std::uint64_t blockBits : blockDiffering)
+    {
+        differing |= blockBits;
+    }
+
+    std::vector<std::uint64_t> keyBuffer(aCount);
+    std::vector<std::size_t> valueBuffer((aValues != nullptr) ? aCount : 0);
+    std::uint64_t* sourceKeys = aKeys;
+    std::uint64_t* targetKeys = keyBuffer.data();
+    std::size_t* sourceValues = aValues;
+    std::size_t* targetValues = valueBuffer.data();
+    std::vector<std::size_t> positions(numBlocks * NUM_BUCKETS);
+
+    for (int digit = 0; digit < NUM_DIGITS; digit++)
+    {
+        int shift = digit * DIGIT_BITS;
+        if (((differing >> shift) & DIGIT_MASK) == 0)
+        {
+            continue;
+        }
+
+        std::fill(positions.begin(), positions.end(), 0);
+        pool.run(aCount,
+                 blockSize,
+                 [&](std::size_t aBegin, std::size_t anEnd)
+                 {
+                     std::size_t* counts = &positions[(aBegin / blockSize) * NUM_BUCKETS];
+                     for (std::size_t i = aBegin; i < anEnd; i++)
+                     {
+                         counts[(sourceKeys[i] >> shift) & DIGIT_MASK]++;
+                     }
+                 });
+
+        std::size_t position = 0;
+        for (std::size_t bucket = 0; bucket < NUM_BUCKETS; bucket++)
+        {
+            for (std::size_t block = 0; block < numBlocks; block++)
+            {
+                std::size_t count = positions[block * NUM_BUCKETS + bucket];
+                positions[block * NUM_BUCKETS + bucket] = position;
+                position += count;
+            }
+        }
+
+        pool.run(aCount,
+                 blockSize,
+                 [&](std::size_t aBegin, std::size_t anEnd)
+                 {
+                     std::size_t* next = &positions[(aBegin / blockSize) * NUM_BUCKETS];
+                     for (std::size_t i = aBegin; i < anEnd; i++)
+                     {
+                         std::size_t target = next[(sourceKeys[i] >> shift) & DIGIT_MASK]++;
+                         targetKeys[target] = sourceKeys[i];
+                         if (sourceValues != nullptr)
+                         {
+                             targetValues[target] = sourceValues[i];
+                         }
+                     }
+                 });
+
+        std::swap(sourceKeys, targetKeys);
+        std::swap(sourceValues, targetValues);
+    }
+
+    if (sourceKeys != aKeys)
+    {
+        std::copy(sourceKeys, sourceKeys + aCount, aKeys);
+        if (aValues != nullptr)
+        {
+            std::copy(sourceValues, sourceValues + aCount, aValues);
+        }
+    }
+}
+
+// Sorts indices 0 .. aCount - 1 by ordered keys, which are overwritten
+void sortIndices(std::vector<std::uint64_t>& aKeys,
+                 std::size_t* anIndices,
+                 ThreadPool* aPool)
+{
+    std::iota(anIndices, anIndices + aKeys.size(), std::size_t(0));
+    sortKeys(aKeys.data(), anIndices, aKeys.size(), aPool);
+}
+
+} // end anonymous namespace
+
+void radixSort(std::int64_t* aKeys,
+               std::size_t aCount,
+               ThreadPool* aPool)
+{
+    // Signed and unsigned variants of a type may alias
+    std::uint64_t* bits = reinterpret_cast<std::uint64_t*>(aKeys);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        bits[i] = toOrderedBits(aKeys[i]);
+    }
+    sortKeys(bits, nullptr, aCount, aPool);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        bits[i] ^= SIGN_BIT;
+    }
+}
+
+void radixSortIndices(const std::int64_t* aKeys,
+                      std::size_t aCount,
+                      std::size_t* anIndices,
+                      ThreadPool* aPool)
+{
+    std::vector<std::uint64_t> keys(aCount);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        keys[i] = toOrderedBits(aKeys[i]);
+    }
+    sortIndices(keys, anIndices, aPool);
+}
+
+void sortIndicesByInstant(const DateAndTime* aDateAndTimes,
+                          std::size_t aCount,
+                          std::size_t* anIndices,
+                          ThreadPool* aPool)
+{
+    std::vector<std::uint64_t> keys(aCount);
+    PARALLEL_UTIL::parallelTransform(aDateAndTimes,
+                                     aCount,
+                                     keys.data(),
+                                     [](const DateAndTime& aDateAndTime)
+                                     {
+                                         return toOrderedBits(TIME_UTIL::calculateInstantKey(aDateAndTime));
+                                     },
+                                     aPool);
+    sortIndices(keys, anIndices, aPool);
+}
+
+void sortByInstant(DateAndTime* aDateAndTimes,
+                   std::size_t aCount,
+                   ThreadPool* aPool)
+{
+    std::vector<std::size_t> indices(aCount);
+    sortIndicesByInstant(aDateAndTimes, aCount, indices.data(), aPool);
+
+    std::vector<DateAndTime> sorted(aCount);
+    PARALLEL_UTIL::parallelFor(aCount,
+                               [&](std::size_t i)
+                               {
+                                   sorted[i] = aDateAndTimes[indices[i]];
+                               },
+                               aPool);
+    std::copy(sorted.begin(), sorted.end(), aDateAndTimes);
+}
+
+void sortByInstant(JulianDate* aJulianDates,
+                   std::size_t aCount,
+                   ThreadPool* aPool)
+{
+    std::vector<std::uint64_t> keys(aCount);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        keys[i] = toOrderedBits(aJulianDates[i].getDecimalDays());
+    }
+    sortKeys(keys.data(), nullptr, aCount, aPool);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        aJulianDates[i] = JulianDate(fromOrderedBits(keys[i]));
+    }
+}
+
+} // end namespace SORT_UTIL
+} // end namespace SPA
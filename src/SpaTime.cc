@@ -28,6 +28,9 @@
 #include "SpaTime.h"
 #include "SpaTimeConstants.h"
 
+#include <iomanip>
+#include <sstream>
+
 namespace SPA
 {
 
@@ -126,11 +129,15 @@ bool operator<(const SpaTime& aLHS,
 std::ostream& operator<<(std::ostream& os,
                          const SPA::SpaTime& aSpaTime)
 {
-    os << "SpaTime{";
-    os << " theHours="   <<  aSpaTime.getHours()
-       << " theMinutes=" <<  aSpaTime.getMinutes()
-       << " theSeconds=" << std::fixed << std::setprecision(6) << aSpaTime.getSeconds()
-       << " theUTC_OffsetHours="       << std::setprecision(4) << aSpaTime.getUtcOffsetHours();
-    os << " }";
+    // Format into a local buffer so that os receives a single insertion
+    // and its format flags are left as they were.
+    std::ostringstream buffer;
+    buffer << "SpaTime{";
+    buffer << " theHours="   <<  aSpaTime.getHours()
+           << " theMinutes=" <<  aSpaTime.getMinutes()
+           << " theSeconds=" << std::fixed << std::setprecision(6) << aSpaTime.getSeconds()
+           << " theUTC_OffsetHours="       << std::setprecision(4) << aSpaTime.getUtcOffsetHours();
+    buffer << " }";
+    os << buffer.str();
     return os;
 }
@@ -0,0 +1,349 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SunUtilities.cc
+ * @brief Definitions of Sun-related functions
+ * @ingroup group_sun
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "SunUtilities.h"
+#include "SpaSunConstants.h"
+#include "SpaTimeConstants.h"
+#include "SpaConstants.h"
+#include "AngleUtilities.h"
+#include "KeplerUtilities.h"
+#include "CoordinateUtilities.h"
+#include "TimeUtilities.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <algorithm>
+#include <ostream>
+
+namespace SPA
+{
+
+void SunPositionArrays::resize(std::size_t aSize)
+{
+    meanAnomaly.resize(aSize);
+    trueAnomaly.resize(aSize);
+    eclipticLongitude.resize(aSize);
+    distance.resize(aSize);
+    angularSize.resize(aSize);
+}
+
+SunPosition SunPositionArrays::at(std::size_t anIndex) const
+{
+    SunPosition position;
+    position.meanAnomaly = meanAnomaly.at(anIndex);
+    position.trueAnomaly = trueAnomaly.at(anIndex);
+    position.eclipticLongitude = eclipticLongitude.at(anIndex);
+    position.distance = distance.at(anIndex);
+    position.angularSize = angularSize.at(anIndex);
+    return position;
+}
+
+namespace SUN_UTIL
+{
+
+namespace
+{
+
+/**
+ * Core of Sections 46 to 48, shared by the scalar and batch interfaces
+ * so that both give bit-identical answers.
+ *
+ * On input aMeanAnomaly holds the days since SPA_SUN_EPOCH_1990; on
+ * output it holds the mean anomaly. Reusing the output arrays as
+ * scratch space avoids temporaries the size of the batch. Each pass is
+ * a simple loop over contiguous arrays with no data-dependent branches.
+ */
+void calculateSunPositionKernel(std::size_t aCount,
+                                double* aMeanAnomaly,
+                                double* aTrueAnomaly,
+                                double* anEclipticLongitude,
+                                double* aDistance,
+                                double* anAngularSize)
+{
+    using ANGLE_UTIL::normalizeDegrees;
+
+    const double dailyMotion = SPA_DEGREES_IN_CIRCLE / SPA_DAYS_IN_TROPICAL_YEAR;
+    const double meanAnomalyAtEpoch = SPA_SUN_ECLIPTIC_LONGITUDE_AT_EPOCH
+                    - SPA_SUN_ECLIPTIC_LONGITUDE_OF_PERIGEE;
+    const double ecc = SPA_SUN_ORBIT_ECCENTRICITY;
+
+    // Section 46 steps 2 to 4: N and M. The mean anomaly in radians is
+    // parked in aTrueAnomaly for the Kepler solve.
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        double meanAnomaly = normalizeDegrees(dailyMotion * aMeanAnomaly[index]
+                                              + meanAnomalyAtEpoch);
+        aMeanAnomaly[index] = meanAnomaly;
+        aTrueAnomaly[index] = meanAnomaly * SPA_DEGREES_TO_RADIANS;
+    }
+
+    // Section 47: solve E - e sin E = M in place.
+    KEPLER_UTIL::solveKeplerElliptic(aTrueAnomaly, aCount, ecc, aTrueAnomaly);
+
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        double eccAnomaly = aTrueAnomaly[index];
+        double trueAnomaly = normalizeDegrees(SPA_RADIANS_TO_DEGREES
+                        * KEPLER_UTIL::calculateEllipticTrueAnomaly(eccAnomaly, ecc));
+
+        // Section 48: (1 + e cos v) / (1 - e^2) equals 1 / (1 - e cos E).
+        double distanceFactor = 1.0 - ecc * std::cos(eccAnomaly);
+
+        aTrueAnomaly[index] = trueAnomaly;
+        anEclipticLongitude[index] = normalizeDegrees(trueAnomaly
+                                        + SPA_SUN_ECLIPTIC_LONGITUDE_OF_PERIGEE);
+        aDistance[index] = SPA_SUN_SEMI_MAJOR_AXIS_KM * distanceFactor;
+        anAngularSize[index] = SPA_SUN_ANGULAR_DIAMETER_AT_R0 / distanceFactor;
+    }
+}
+
+/// Runs the kernel over arrays already holding days since the epoch.
+void runSunPositionKernel(SunPositionArrays& aPositions)
+{
+    calculateSunPositionKernel(aPositions.size(),
+                               aPositions.meanAnomaly.data(),
+                               aPositions.trueAnomaly.data(),
+                               aPositions.eclipticLongitude.data(),
+                               aPositions.distance.data(),
+                               aPositions.angularSize.data());
+}
+
+} // end anonymous namespace
+
+SunPosition calculateSunPosition(const JulianDate& aJulianDate)
+{
+    SunPosition position;
+    position.meanAnomaly = aJulianDate.getDecimalDays() - SPA_SUN_EPOCH_1990;
+    calculateSunPositionKernel(1,
+                               &position.meanAnomaly,
+                               &position.trueAnomaly,
+                               &position.eclipticLongitude,
+                               &position.distance,
+                               &position.angularSize);
+    return position;
+}
+
+SunPosition calculateSunPositionSecular(double aJulianDays)
+{
+    double t = (aJulianDays - SPA_J2000_EPOCH) / 36525.0;
+    double meanLongitude = 280.46646 + 36000.76983 * t + 0.0003032 * t * t;
+    double meanAnomaly = 357.52911 + 35999.05029 * t - 0.0001537 * t * t;
+    double eccentricity = 0.016708634 - 0.000042037 * t - 0.0000001267 * t * t;
+    double meanAnomalyRadians = meanAnomaly * SPA_DEGREES_TO_RADIANS;
+    double centre = (1.914602 - 0.004817 * t - 0.000014 * t * t) * std::sin(meanAnomalyRadians)
+                    + (0.019993 - 0.000101 * t) * std::sin(2.0 * meanAnomalyRadians)
+                    + 0.000289 * std::sin(3.0 * meanAnomalyRadians);
+
+    SunPosition position;
+    position.meanAnomaly = ANGLE_UTIL::normalizeDegrees(meanAnomaly);
+    position.trueAnomaly = ANGLE_UTIL::normalizeDegrees(meanAnomaly + centre);
+    position.eclipticLongitude = ANGLE_UTIL::normalizeDegrees(meanLongitude + centre - 0.00569);
+
+    double distanceRatio = 1.000001018 * (1.0 - eccentricity * eccentricity)
+                           / (1.0 + eccentricity * std::cos(position.trueAnomaly * SPA_DEGREES_TO_RADIANS));
+    position.distance = distanceRatio * SPA_SUN_SEMI_MAJOR_AXIS_KM;
+    position.angularSize = SPA_SUN_ANGULAR_DIAMETER_AT_R0 / distanceRatio;
+    return position;
+}
+
+double calculateSunEclipticLongitude(const JulianDate& aJulianDate)
+{
+    return calculateSunPosition(aJulianDate).eclipticLongitude;
+}
+
+void calculateSunPositions(const double* aJulianDays,
+                           std::size_t aCount,
+                           SunPositionArrays& aPositions)
+{
+    aPositions.resize(aCount);
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aPositions.meanAnomaly[index] = aJulianDays[index] - SPA_SUN_EPOCH_1990;
+    }
+    runSunPositionKernel(aPositions);
+}
+
+void calculateSunPositions(const std::vector<JulianDate>& aJulianDates,
+                           SunPositionArrays& aPositions)
+{
+    aPositions.resize(aJulianDates.size());
+    for (std::size_t index = 0; index < aJulianDates.size(); index++)
+    {
+        aPositions.meanAnomaly[index] = aJulianDates[index].getDecimalDays() - SPA_SUN_EPOCH_1990;
+    }
+    runSunPositionKernel(aPositions);
+}
+
+void calculateSunPositionSeries(const JulianDate& aStart,
+                                double aStepDays,
+                                std::size_t aCount,
+                                SunPositionArrays& aPositions)
+{
+    aPositions.resize(aCount);
+    double startDays = aStart.getDecimalDays() - SPA_SUN_EPOCH_1990;
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aPositions.meanAnomaly[index] = startDays + aStepDays * double(index);
+    }
+    runSunPositionKernel(aPositions);
+}
+
+double calculateEquationOfTime(const JulianDate& aJulianDate)
+{
+    double julianDays = aJulianDate.getDecimalDays();
+    double equationOfTime = 0;
+    calculateEquationOfTime(&julianDays, 1, &equationOfTime);
+    return equationOfTime;
+}
+
+void calculateEquationOfTime(const double* aJulianDays,
+                             std::size_t aCount,
+                             double* anEquationOfTime)
+{
+    const double hoursInDay = double(SPA_HOURS_IN_DAY);
+
+    SunPositionArrays positions;
+    calculateSunPositions(aJulianDays, aCount, positions);
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        JulianDate jd(aJulianDays[index]);
+        EquatorialCoordinates equatorial = COORD_UTIL::convertEclipticToEquatorial(
+                        positions.eclipticLongitude[index],
+                        0.0,
+                        COORD_UTIL::calculateMeanObliquity(jd));
+        double universalTime = (aJulianDays[index] - 0.5 - std::floor(aJulianDays[index] - 0.5)) * hoursInDay;
+
+        // Apparent solar time minus mean solar time, both from midnight.
+        double difference = TIME_UTIL::calculateGreenwichSiderealTime(jd)
+                        - equatorial.rightAscension
+                        + 0.5 * hoursInDay
+                        - universalTime;
+        anEquationOfTime[index] = difference - hoursInDay * std::floor(difference / hoursInDay + 0.5);
+    }
+    return;
+}
+
+void calculateEquationOfTimeSeries(const JulianDate& aStart,
+                                   double aStepDays,
+                                   std::size_t aCount,
+                                   std::vector<double>& anEquationOfTime)
+{
+    std::vector<double> julianDays(aCount);
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        julianDays[index] = aStart.getDecimalDays() + aStepDays * double(index);
+    }
+    anEquationOfTime.resize(aCount);
+    calculateEquationOfTime(julianDays.data(), aCount, anEquationOfTime.data());
+    return;
+}
+
+ChebyshevTable buildEquationOfTimeTable(const JulianDate& aStart,
+                                        const JulianDate& anEnd,
+                                        double aSegmentDays,
+                                        std::size_t aNumCoefficients)
+{
+    double spanDays = anEnd.getDecimalDays() - aStart.getDecimalDays();
+    std::size_t numSegments = std::max(std::size_t(1), std::size_t(std::ceil(spanDays / aSegmentDays)));
+    ChebyshevTable::Sampler sampler = [](const double* aTimes, std::size_t aCount, double* aValues)
+    {
+        calculateEquationOfTime(aTimes, aCount, aValues);
+    };
+    return ChebyshevTable(aStart.getDecimalDays(), aSegmentDays, numSegments, aNumCoefficients, sampler);
+}
+
+double calculateSolarElongation(const JulianDate& aJulianDate,
+                                double anEclipticLongitude,
+                                double anEclipticLatitude)
+{
+    using ANGLE_UTIL::degreesToRadians;
+
+    double sunLongitude = calculateSunEclipticLongitude(aJulianDate);
+    double cosElongation = std::cos(degreesToRadians(anEclipticLatitude))
+                    * std::cos(degreesToRadians(anEclipticLongitude - sunLongitude));
+    return ANGLE_UTIL::radiansToDegrees(std::acos(cosElongation));
+}
+
+double calculateSeason(int aYear, SeasonType aSeason)
+{
+    double targetLongitude = 90.0 * static_cast<int>(aSeason);
+    double meanRate = SPA_DEGREES_IN_CIRCLE / SPA_DAYS_IN_TROPICAL_YEAR;
+    auto offset = [targetLongitude](double aJulianDays)
+    {
+        double difference = calculateSunPositionSecular(aJulianDays).eclipticLongitude - targetLongitude;
+        return difference - SPA_DEGREES_IN_CIRCLE * std::floor(difference / SPA_DEGREES_IN_CIRCLE + 0.5);
+    };
+
+    // First step from the mean time uses the mean rate, then secant steps.
+    double previousTime = SPA_SUN_MARCH_EQUINOX_2000
+                          + SPA_DAYS_IN_TROPICAL_YEAR * ((aYear - 2000) + 0.25 * static_cast<int>(aSeason));
+    double previousOffset = offset(previousTime);
+    double time = previousTime - previousOffset / meanRate;
+    for (int iteration = 0; iteration < SPA_SUN_SEASON_MAX_ITERATIONS; iteration++)
+    {
+        if (std::fabs(time - previousTime) < SPA_SUN_SEASON_TOLERANCE_DAYS)
+        {
+            break;
+        }
+        double currentOffset = offset(time);
+        double slope = (currentOffset - previousOffset) / (time - previousTime);
+        if (!(slope > 0.0))
+        {
+            slope = meanRate;
+        }
+        previousTime = time;
+        previousOffset = currentOffset;
+        time -= currentOffset / slope;
+    }
+    return time;
+}
+
+} // end namespace SUN_UTIL
+} /* namespace SPA */
+
+std::ostream& operator<<(std::ostream& os, const SPA::SeasonType& aSeason)
+{
+    switch (aSeason)
+    {
+        case SPA::SeasonType::MarchEquinox:
+            os << "March equinox";
+            break;
+        case SPA::SeasonType::JuneSolstice:
+            os << "June solstice";
+            break;
+        case SPA::SeasonType::SeptemberEquinox:
+            os << "September equinox";
+            break;
+        case SPA::SeasonType::DecemberSolstice:
+            os << "December solstice";
+            break;
+        default:
+            os << "Invalid SeasonType";
+            break;
+    }
+    return os;
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ThreadPool.cc
+ * @brief Definition of ThreadPool functions
+ * @ingroup group_util
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ThreadPool.h"
+#include "SpaConstants.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace SPA
+{
+
+struct ThreadPool::Batch
+{
+    /// The function to run on each chunk
+    const RangeFunction* function;
+
+    /// Guards remaining and error
+    std::mutex mutex;
+
+    /// Signalled when the last chunk finishes
+    std::condition_variable finished;
+
+    /// Chunks not yet finished
+    std::size_t remaining;
+
+    /// First exception thrown by a chunk, rethrown by run()
+    std::exception_ptr error;
+};
+
+ThreadPool::ThreadPool(unsigned int aNumThreads) :
+    theQueuedTasks(0),
+    theStopping(false)
+{
+    unsigned int numThreads = (aNumThreads > 0) ? aNumThreads : std::thread::hardware_concurrency();
+    numThreads = std::max(numThreads, 1u);
+    for (unsigned int queue = 0; queue < numThreads; queue++)
+    {
+        theQueues.emplace_back(new WorkQueue);
+    }
+    for (unsigned int worker = 0; worker + 1 < numThreads; worker++)
+    {
+        theWorkers.emplace_back(&ThreadPool::work, this, worker);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(theWakeMutex);
+        theStopping = true;
+    }
+    theWakeCondition.notify_all();
+    for (std::thread& worker : theWorkers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t ThreadPool::chooseChunkSize(std::size_t aCount)
+{
+    return std::max(aCount / SPA_PARALLEL_TARGET_CHUNKS, SPA_PARALLEL_MIN_CHUNK_SIZE);
+}
+
+void ThreadPool::run(std::size_t aCount,
+                     std::size_t aChunkSize,
+                     const RangeFunction& aFunction)
+{
+    std::size_t chunkSize = (aChunkSize > 0) ? aChunkSize : chooseChunkSize(aCount);
+    std::size_t numChunks = (aCount + chunkSize - 1) / chunkSize;
+    if (numChunks <= 1 || theWorkers.empty())
+    {
+        for (std::size_t begin = 0; begin < aCount; begin += chunkSize)
+        {
+            aFunction(begin, std::min(begin + chunkSize, aCount));
+        }
+        return;
+    }
+
+    Batch batch;
+    batch.function = &aFunction;
+    batch.remaining = numChunks;
+
+    // Count the chunks before queueing them, so that a worker that takes
+    // one straight away never decrements the count below zero.
+    {
+        std::lock_guard<std::mutex> lock(theWakeMutex);
+        theQueuedTasks += numChunks;
+    }
+
+    // Deal the chunks out in contiguous blocks, so that each thread
+    // starts on neighbouring elements.
+    std::size_t numQueues = theQueues.size();
+    for (std::size_t queue = 0; queue < numQueues; queue++)
+    {
+        std::size_t firstChunk = queue * numChunks / numQueues;
+        std::size_t lastChunk = (queue + 1) * numChunks / numQueues;
+        std::lock_guard<std::mutex> lock(theQueues[queue]->mutex);
+        for (std::size_t chunk = firstChunk; chunk < lastChunk; chunk++)
+        {
+            std::size_t begin = chunk * chunkSize;
+            theQueues[queue]->tasks.push_back(Task{&batch, begin, std::min(begin + chunkSize, aCount)});
+        }
+    }
+    theWakeCondition.notify_all();
+
+    // Help until the queues are empty, then wait for chunks still
+    // running elsewhere.
+    Task task;
+    while (takeTask(numQueues - 1, task))
+    {
+        runTask(task);
+    }
+    std::unique_lock<std::mutex> lock(batch.mutex);
+    batch.finished.wait(lock, [&batch]() { return batch.remaining == 0; });
+    if (batch.error)
+    {
+        std::rethrow_exception(batch.error);
+    }
+}
+
+ThreadPool& ThreadPool::getDefault()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+bool ThreadPool::takeTask(std::size_t aQueue, Task& aTask)
+{
+    bool found = false;
+    {
+        WorkQueue& own = *theQueues[aQueue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            aTask = own.tasks.back();
+            own.tasks.pop_back();
+            found = true;
+        }
+    }
+    for (std::size_t offset = 1; !found && offset < theQueues.size(); offset++)
+    {
+        WorkQueue& victim = *theQueues[(aQueue + offset) % theQueues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            aTask = victim.tasks.front();
+            victim.tasks.pop_front();
+            found = true;
+        }
+    }
+    if (found)
+    {
+        std::lock_guard<std::mutex> lock(theWakeMutex);
+        theQueuedTasks--;
+    }
+    return found;
+}
+
+void ThreadPool::runTask(const Task& aTask)
+{
+    Batch& batch = *aTask.batch;
+    std::exception_ptr error;
+    try
+    {
+        (*batch.function)(aTask.begin, aTask.end);
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(batch.mutex);
+    if (error && !batch.error)
+    {
+        batch.error = error;
+    }
+    if (--batch.remaining == 0)
+    {
+        // Notify while holding the lock, as the waiting thread destroys
+        // the batch as soon as it can see that it is finished.
+        batch.finished.notify_all();
+    }
+}
+
+void ThreadPool::work(std::size_t aQueue)
+{
+    Task task;
+    while (true)
+    {
+        if (takeTask(aQueue, task))
+        {
+            runTask(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(theWakeMutex);
+        theWakeCondition.wait(lock, [this]() { return theStopping || theQueuedTasks > 0; });
+        if (theStopping && theQueuedTasks == 0)
+        {
+            return;
+        }
+    }
+}
+
+} // end namespace SPA
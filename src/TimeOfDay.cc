@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file TimeOfDay.cc
+ * @brief Definitions of the TimeOfDay class
+ * @ingroup group_time
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "TimeOfDay.h"
+#include "SpaTime.h"
+
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+namespace SPA
+{
+
+TimeOfDay::TimeOfDay(int anHours,
+                     int aMinutes,
+                     double aSeconds)
+{
+    std::int64_t ticks = anHours * SPA_TICKS_IN_HOUR
+                       + aMinutes * SPA_TICKS_IN_MINUTE
+                       + std::int64_t(std::floor(aSeconds * SPA_TICKS_IN_SECOND + 0.5));
+    splitTicks(ticks, theTicks);
+}
+
+TimeOfDay::TimeOfDay(const SpaTime& aSpaTime) : TimeOfDay(aSpaTime.getHours(),
+                                                          aSpaTime.getMinutes(),
+                                                          aSpaTime.getSeconds())
+{
+}
+
+TimeOfDay TimeOfDay::fromDecimalHours(double aDecimalHours,
+                                      std::int32_t& aDayCarry)
+{
+    std::int64_t ticks = std::int64_t(std::floor(aDecimalHours * SPA_TICKS_IN_HOUR + 0.5));
+    return fromTicks(ticks, aDayCarry);
+}
+
+SpaTime TimeOfDay::getSpaTime(double aUTC_OffsetHours) const
+{
+    return SpaTime(getHours(), getMinutes(), getSeconds(), aUTC_OffsetHours);
+}
+
+} // end namespace SPA
+
+std::ostream& operator<<(std::ostream& os, const SPA::TimeOfDay& aTimeOfDay)
+{
+    std::ostringstream buffer;
+    buffer << "TimeOfDay{ theTicks=" << aTimeOfDay.getTicks()
+           << " (" << std::setfill('0') << std::setw(2) << aTimeOfDay.getHours()
+           << ":" << std::setw(2) << aTimeOfDay.getMinutes()
+           << ":" << std::setw(2) << (aTimeOfDay.getTicks() % SPA::SPA_TICKS_IN_MINUTE) / SPA::SPA_TICKS_IN_SECOND
+           << "." << std::setw(9) << aTimeOfDay.getTicks() % SPA::SPA_TICKS_IN_SECOND
+           << ") }";
+    os << buffer.str();
+    return os;
+}
@@ -26,43 +26,78 @@
  */
 
 #include "TimeUtilities.h"
+#include "SpaConstants.h"
 #include "SpaTimeConstants.h"
+#include "CpuDispatch.h"
 #include "DateAndTime.h"
 #include "JulianDate.h"
+#include "ParallelUtilities.h"
+#include "TimeOfDay.h"
+#include "SerialDate.h"
 
+#include <algorithm>
 #include <cmath>
-#include <iostream>
+#include <ostream>
 
 namespace SPA
 {
 namespace TIME_UTIL
 {
 
-void integerAndFraction(double aRealNumber,
-                        double& anIntegerPart,
-                        double& aFractionalPart)
+namespace
 {
-    anIntegerPart = std::floor(aRealNumber);
-    aFractionalPart = aRealNumber - anIntegerPart;
-    return;
+
+// Day of the year on which March 1st falls in a common year
+constexpr int LAST_DAY_OF_FEBRUARY = 59;
+
+// ISO 8601 day of the week of a Thursday, Monday being 1
+constexpr int ISO_THURSDAY = 4;
+
+/// 1 in a Gregorian leap year, otherwise 0, without a branch
+inline int leapYearFlag(int aYear)
+{
+    return int(aYear % 4 == 0) & (int(aYear % 100 != 0) | int(aYear % 400 == 0));
+}
+
+/// Quotient rounded towards minus infinity, for a positive divisor
+inline long long floorDivide(long long aDividend, long long aDivisor)
+{
+    long long quotient = aDividend / aDivisor;
+    return quotient - int(aDividend % aDivisor < 0);
+}
+
+inline int dayOfYear(int aYear, int aMonth, int aDay)
+{
+    int commonYearAdjustment = int(aMonth > FEB) & (1 - leapYearFlag(aYear));
+    return SPA_DAYSTART_LEAPYEAR[aMonth - 1] + aDay - commonYearAdjustment;
+}
+
+inline void monthAndDay(int aYear, int aDayOfYear, int& aMonth, int& aDay)
+{
+    // On the leap year scale the month starts are those of the table
+    int leapDayOfYear = aDayOfYear + (int(aDayOfYear > LAST_DAY_OF_FEBRUARY) & (1 - leapYearFlag(aYear)));
+
+    // No month is longer than 31 days, so this is the month or the one before it
+    int monthIndex = (leapDayOfYear - 1) / 31;
+    int nextMonthStart = (monthIndex < DEC - 1) ? SPA_DAYSTART_LEAPYEAR[monthIndex + 1] : SPA_DAYS_IN_NONLEAP_YEAR + 1;
+    monthIndex += int(leapDayOfYear > nextMonthStart);
+
+    aMonth = monthIndex + 1;
+    aDay = leapDayOfYear - SPA_DAYSTART_LEAPYEAR[monthIndex];
 }
 
-void quotientAndRemainder(int aDividend,
-                          int aDivisor,
-                          int& aQuotient,
-                          int& aRemainder)
+/// ISO 8601 day of the week, Monday 1 to Sunday 7, of January 1st
+int isoWeekDayOfJanuaryFirst(int aYear)
 {
-    /*
-     * Implementation note: std::ldiv in cstdlib performs
-     * the same calculation, potentially using a single CPU
-     * operation. Unpacking a std::div_t object is a bit of
-     * a pain, so I've chosen to both use my own function
-     * and expose the logic here.
-     */
-    aQuotient = aDividend / aDivisor;
-    aRemainder = aDividend % aDivisor;
+    // Days from 0001-01-01, a Monday, in the proleptic Gregorian calendar
+    long long year = aYear - 1;
+    long long days = SPA_DAYS_IN_NONLEAP_YEAR * year + floorDivide(year, 4)
+                   - floorDivide(year, 100) + floorDivide(year, 400);
+    return int(days - SPA_DAYS_PER_WEEK * floorDivide(days, SPA_DAYS_PER_WEEK)) + 1;
 }
 
+} // end anonymous namespace
+
 void calculateEaster(int aYear,
                      int &aMonth,
                      int &aDay)
@@ -146,30 +181,109 @@ int calculateDayNumber(int aYear,
                        int aMonth,
                        int aDay)
 {
-    int multiplicand = 63; // Magic number?
-    int dayNumber = 0;
-    if ( isLeapYear(aYear) )
+    // PAWYC Routine R1 computes this as int(30.6 * (aMonth + 1)) - 63,
+    // plus one in a leap year, from March on. The table gives the same
+    // day numbers with integer arithmetic.
+    return dayOfYear(aYear, aMonth, aDay);
+}
+
+int calculateDayOfYear(int aYear,
+                       int aMonth,
+                       int aDay)
+{
+    return dayOfYear(aYear, aMonth, aDay);
+}
+
+void calculateMonthAndDay(int aYear,
+                          int aDayOfYear,
+                          int& aMonth,
+                          int& aDay)
+{
+    monthAndDay(aYear, aDayOfYear, aMonth, aDay);
+}
+
+void calculateDaysOfYear(const int* aYears,
+                         const int* aMonths,
+                         const int* aDays,
+                         std::size_t aCount,
+                         int* aDaysOfYear)
+{
+    for (std::size_t i = 0; i < aCount; i++)
     {
-        multiplicand -= 1;
+        aDaysOfYear[i] = dayOfYear(aYears[i], aMonths[i], aDays[i]);
     }
+}
+
+void calculateMonthsAndDays(const int* aYears,
+                            const int* aDaysOfYear,
+                            std::size_t aCount,
+                            int* aMonths,
+                            int* aDays)
+{
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        monthAndDay(aYears[i], aDaysOfYear[i], aMonths[i], aDays[i]);
+    }
+}
+
+int calculateIsoWeeksInYear(int anIsoYear)
+{
+    // Years that start on a Thursday, and leap years that start on a
+    // Wednesday, have a Thursday in a 53rd week
+    int januaryFirst = isoWeekDayOfJanuaryFirst(anIsoYear);
+    bool hasLongWeek = (januaryFirst == ISO_THURSDAY) ||
+                       (januaryFirst == ISO_THURSDAY - 1 && leapYearFlag(anIsoYear) == 1);
+    return hasLongWeek ? 53 : 52;
+}
+
+void calculateIsoWeekDate(int aYear,
+                          int aMonth,
+                          int aDay,
+                          int& anIsoYear,
+                          int& anIsoWeek,
+                          int& anIsoWeekDay)
+{
+    int ordinal = dayOfYear(aYear, aMonth, aDay);
+    anIsoWeekDay = (isoWeekDayOfJanuaryFirst(aYear) + ordinal - 2) % SPA_DAYS_PER_WEEK + 1;
 
-    if (aMonth > FEB)
+    // Weeks are numbered by the day of the year of their Thursday
+    anIsoYear = aYear;
+    anIsoWeek = (ordinal - anIsoWeekDay + ISO_THURSDAY - 1 + SPA_DAYS_PER_WEEK) / SPA_DAYS_PER_WEEK;
+    if (anIsoWeek < 1)
     {
-        dayNumber = int(SPA_AVG_DAYS_PER_MONTH * (aMonth + 1));
-        dayNumber -= multiplicand;
+        anIsoYear--;
+        anIsoWeek = calculateIsoWeeksInYear(anIsoYear);
     }
-    else
+    else if (anIsoWeek > calculateIsoWeeksInYear(aYear))
     {
-        dayNumber = int((aMonth - 1) * multiplicand / 2);
+        anIsoYear++;
+        anIsoWeek = 1;
     }
-    return dayNumber + aDay;
 }
 
-bool isLeapYear(int aYear)
+void calculateDateFromIsoWeekDate(int anIsoYear,
+                                  int anIsoWeek,
+                                  int anIsoWeekDay,
+                                  int& aYear,
+                                  int& aMonth,
+                                  int& aDay)
 {
-    return ((aYear % 4) == 0) &&
-           ( ((aYear % 100) != 0) ||
-             ((aYear % 400) == 0) );
+    // January 4th is always in week 1
+    int januaryFourth = (isoWeekDayOfJanuaryFirst(anIsoYear) + 2) % SPA_DAYS_PER_WEEK + 1;
+    int ordinal = SPA_DAYS_PER_WEEK * anIsoWeek + anIsoWeekDay - (januaryFourth + 3);
+
+    aYear = anIsoYear;
+    if (ordinal < 1)
+    {
+        aYear--;
+        ordinal += daysInYear(aYear);
+    }
+    else if (ordinal > daysInYear(aYear))
+    {
+        ordinal -= daysInYear(aYear);
+        aYear++;
+    }
+    monthAndDay(aYear, ordinal, aMonth, aDay);
 }
 
 WeekDays calculateDayInTheWeek(const JulianDate& aJulianDate)
@@ -219,18 +333,173 @@ WeekDays calculateDayInTheWeek(int aYear,
     return calculateDayInTheWeek(date);
 }
 
-int daysInYear(int aYear)
+void calculateDaysInTheWeek(const double* aJulianDays,
+                            std::size_t aCount,
+                            WeekDays* aWeekDays,
+                            ThreadPool* aPool,
+                            std::size_t aChunkSize)
+{
+    PARALLEL_UTIL::parallelTransform(aJulianDays,
+                                     aCount,
+                                     aWeekDays,
+                                     [](double aJulianDays)
+                                     {
+                                         return calculateDayInTheWeek(JulianDate(aJulianDays));
+                                     },
+                                     aPool,
+                                     aChunkSize);
+}
+
+void convertToDateAndTimes(const double* aJulianDays,
+                           std::size_t aCount,
+                           DateAndTime* aDateAndTimes,
+                           ThreadPool* aPool,
+                           std::size_t aChunkSize)
+{
+    const BatchKernels& kernels = CPU_UTIL::getBatchKernels();
+    ThreadPool& pool = (aPool != nullptr) ? *aPool : ThreadPool::getDefault();
+    pool.run(aCount,
+             aChunkSize,
+             [&kernels, aJulianDays, aDateAndTimes](std::size_t aBegin, std::size_t anEnd)
+             {
+                 int years[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 int months[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 double days[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 for (std::size_t block = aBegin; block < anEnd; block += SPA_BATCH_KERNEL_BLOCK_SIZE)
+                 {
+                     std::size_t count = std::min(SPA_BATCH_KERNEL_BLOCK_SIZE, anEnd - block);
+                     kernels.convertFromJulianDays(aJulianDays + block, count, years, months, days);
+
+                     // As the end of JulianDate::getDateAndTime()
+                     for (std::size_t i = 0; i < count; i++)
+                     {
+                         double intPart;
+                         double fracPart;
+                         integerAndFraction(days[i], intPart, fracPart);
+                         int hours;
+                         int minutes;
+                         double seconds;
+                         calculateHoursMinutesAndSeconds(fracPart * SPA_HOURS_IN_DAY,
+                                                         hours,
+                                                         minutes,
+                                                         seconds);
+                         aDateAndTimes[block + i] = DateAndTime(years[i], months[i], int(intPart),
+                                                                hours, minutes, seconds, 0);
+                     }
+                 }
+             });
+}
+
+void convertToJulianDays(const DateAndTime* aDateAndTimes,
+                         std::size_t aCount,
+                         double* aJulianDays,
+                         ThreadPool* aPool,
+                         std::size_t aChunkSize)
 {
-    if (isLeapYear(aYear))
+    const BatchKernels& kernels = CPU_UTIL::getBatchKernels();
+    ThreadPool& pool = (aPool != nullptr) ? *aPool : ThreadPool::getDefault();
+    pool.run(aCount,
+             aChunkSize,
+             [&kernels, aDateAndTimes, aJulianDays](std::size_t aBegin, std::size_t anEnd)
+             {
+                 int years[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 int months[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 int days[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 double dayFractions[SPA_BATCH_KERNEL_BLOCK_SIZE];
+                 for (std::size_t block = aBegin; block < anEnd; block += SPA_BATCH_KERNEL_BLOCK_SIZE)
+                 {
+                     std::size_t count = std::min(SPA_BATCH_KERNEL_BLOCK_SIZE, anEnd - block);
+                     for (std::size_t i = 0; i < count; i++)
+                     {
+                         const DateAndTime& dateAndTime = aDateAndTimes[block + i];
+                         years[i] = dateAndTime.getYear();
+                         months[i] = dateAndTime.getMonth();
+                         days[i] = dateAndTime.getDay();
+                         dayFractions[i] = dateAndTime.getDayFraction();
+                     }
+                     kernels.convertToJulianDays(years, months, days, dayFractions,
+                                                 count, aJulianDays + block);
+                 }
+             });
+}
+
+void addTicks(const TimeOfDay* aTimes,
+              std::size_t aCount,
+              std::int64_t aTicks,
+              TimeOfDay* aResults,
+              std::int32_t* aDayCarries)
+{
+    // Split the increment once, so each element needs at most one
+    // day's correction.
+    std::int32_t increment;
+    TimeOfDay offset = TimeOfDay::fromTicks(aTicks, increment);
+    std::int64_t offsetTicks = offset.getTicks();
+    for (std::size_t i = 0; i < aCount; i++)
     {
-        return SPA::SPA_DAYS_IN_NONLEAP_YEAR + 1;
+        std::int64_t ticks = aTimes[i].getTicks() + offsetTicks;
+        std::int64_t isNextDay = (ticks >= SPA_TICKS_IN_DAY);
+        aResults[i] = TimeOfDay(ticks - isNextDay * SPA_TICKS_IN_DAY);
+        if (aDayCarries != nullptr)
+        {
+            aDayCarries[i] = increment + std::int32_t(isNextDay);
+        }
     }
-    else
+}
+
+void convertToDecimalHours(const TimeOfDay* aTimes,
+                           std::size_t aCount,
+                           double* aDecimalHours)
+{
+    for (std::size_t i = 0; i < aCount; i++)
     {
-        return SPA::SPA_DAYS_IN_NONLEAP_YEAR;
+        aDecimalHours[i] = aTimes[i].getDecimalHours();
     }
 }
 
+void convertToTimesOfDay(const double* aDecimalHours,
+                         std::size_t aCount,
+                         TimeOfDay* aTimes,
+                         std::int32_t* aDayCarries)
+{
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        std::int32_t dayCarry;
+        aTimes[i] = TimeOfDay::fromDecimalHours(aDecimalHours[i], dayCarry);
+        if (aDayCarries != nullptr)
+        {
+            aDayCarries[i] = dayCarry;
+        }
+    }
+}
+
+void calculateTimeOfDayBuckets(const TimeOfDay* aTimes,
+                               std::size_t aCount,
+                               std::int64_t aBucketTicks,
+                               std::int32_t* aBuckets)
+{
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        aBuckets[i] = std::int32_t(aTimes[i].getTicks() / aBucketTicks);
+    }
+}
+
+std::int64_t calculateInstantKey(const DateAndTime& aDateAndTime)
+{
+    SerialDate date(aDateAndTime.getYear(), aDateAndTime.getMonth(), aDateAndTime.getDay());
+    std::int64_t ticks = aDateAndTime.getHours() * SPA_SECONDS_IN_HOUR * SPA_INSTANT_KEY_TICKS_IN_SECOND
+                       + aDateAndTime.getMinutes() * SPA_SECONDS_IN_MINUTE * SPA_INSTANT_KEY_TICKS_IN_SECOND
+                       + std::llround(aDateAndTime.getSeconds() * SPA_INSTANT_KEY_TICKS_IN_SECOND)
+                       + std::llround(aDateAndTime.getUtcOffsetHours() * SPA_SECONDS_IN_HOUR
+                                      * SPA_INSTANT_KEY_TICKS_IN_SECOND);
+    return std::int64_t(date.getDays()) * SPA_INSTANT_KEY_TICKS_IN_DAY + ticks;
+}
+
+std::int64_t calculateInstantKey(const JulianDate& aJulianDate)
+{
+    double days = aJulianDate.getDecimalDays() - SPA_SERIAL_DATE_EPOCH;
+    return std::llround(days * SPA_INSTANT_KEY_TICKS_IN_DAY);
+}
+
 double calculateDecimalHours(int anHour,
                              int aMinute,
                              double aSeconds)
@@ -241,6 +510,22 @@ double calculateDecimalHours(int anHour,
     return decimalHours;
 }
 
+double calculateGreenwichSiderealTime(const JulianDate& aJulianDate)
+{
+    // Split into the Julian Date at 0h UT and the UT in hours.
+    double julianDays = aJulianDate.getDecimalDays();
+    double julianDayAtMidnight = std::floor(julianDays - 0.5) + 0.5;
+    double universalTime = (julianDays - julianDayAtMidnight) * double(SPA_HOURS_IN_DAY);
+
+    double centuries = (julianDayAtMidnight - SPA_J2000_EPOCH) / SPA_DAYS_IN_JULIAN_CENTURY;
+    double gstAtMidnight = 6.697374558
+                    + 2400.051336 * centuries
+                    + 0.000025862 * centuries * centuries;
+
+    double gst = gstAtMidnight + universalTime * SPA_SIDEREAL_RATE;
+    return gst - double(SPA_HOURS_IN_DAY) * std::floor(gst / double(SPA_HOURS_IN_DAY));
+}
+
 void calculateHoursMinutesAndSeconds(double aDecimalHours,
                                      int& anHours,
                                      int& aMinutes,
@@ -255,6 +540,13 @@ void calculateHoursMinutesAndSeconds(double aDecimalHours,
     return;
 }
 
+double calculateLocalSiderealTime(double aGreenwichSiderealTime,
+                                  double aLongitude)
+{
+    double lst = aGreenwichSiderealTime + aLongitude / 15.0;
+    return lst - double(SPA_HOURS_IN_DAY) * std::floor(lst / double(SPA_HOURS_IN_DAY));
+}
+
 std::ostream& operator<<(std::ostream& os, const WeekDays& aWeekDay)
 {
     // Simple but ugly implementation.
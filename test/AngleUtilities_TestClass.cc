@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AngleUtilities_TestClass.cc
+ * @brief Definition of AngleUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "AngleUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "AngleUtilities.h"
+
+#include <array>
+#include <sstream>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void AngleUtilities_TestClass::testDegreesAndRadians()
+{
+    double tolerance = 1.0e-15;
+    ASSERT_EQUAL_DELTAM("180 degrees to radians",
+                        SPA_PI,
+                        ANGLE_UTIL::degreesToRadians(180.0),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("pi/2 radians to degrees",
+                        90.0,
+                        ANGLE_UTIL::radiansToDegrees(0.5 * SPA_PI),
+                        1.0e-12);
+    return;
+}
+
+void AngleUtilities_TestClass::testNormalize()
+{
+    const int NUM_TESTS = 6;
+    std::array<double, NUM_TESTS> inputDegrees =    {{0.0, 360.0, 725.5, -10.0, -1234.25, 359.5}};
+    std::array<double, NUM_TESTS> expectedDegrees = {{0.0, 0.0,   5.5,   350.0, 205.75,   359.5}};
+    double tolerance = 1.0e-9;
+    std::ostringstream ss;
+    for (int iTest = 0; iTest < NUM_TESTS; iTest++)
+    {
+        ss << "  Test " << iTest << " normalizeDegrees(" << inputDegrees[iTest] << ")";
+        spaTestFloatingPointEqual(ss.str(),
+                                  expectedDegrees[iTest],
+                                  ANGLE_UTIL::normalizeDegrees(inputDegrees[iTest]),
+                                  tolerance);
+        ss.str(std::string());
+
+        ss << "  Test " << iTest << " normalizeRadians(" << inputDegrees[iTest] << " deg)";
+        spaTestFloatingPointEqual(ss.str(),
+                                  ANGLE_UTIL::degreesToRadians(expectedDegrees[iTest]),
+                                  ANGLE_UTIL::normalizeRadians(ANGLE_UTIL::degreesToRadians(inputDegrees[iTest])),
+                                  tolerance);
+        ss.str(std::string());
+    }
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,280 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AstronomicalCalendar_TestClass.cc
+ * @brief Definition of AstronomicalCalendar_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "AstronomicalCalendar_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "AstronomicalCalendar.h"
+#include "EclipseUtilities.h"
+#include "LunarPhaseUtilities.h"
+#include "SunUtilities.h"
+#include "JulianDate.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// A source that replays a fixed list of events.
+class ListSource : public CalendarEventSource
+{
+    public:
+        explicit ListSource(const std::vector<CalendarEvent>& anEvents) :
+            theEvents(anEvents),
+            theNext(0)
+        {
+        }
+
+        bool next(CalendarEvent& anEvent) override
+        {
+            if (theNext == theEvents.size())
+            {
+                return false;
+            }
+            anEvent = theEvents[theNext++];
+            return true;
+        }
+
+    private:
+        std::vector<CalendarEvent> theEvents;
+        std::size_t theNext;
+};
+
+/// Drains a calendar.
+std::vector<CalendarEvent> drain(AstronomicalCalendar& aCalendar)
+{
+    std::vector<CalendarEvent> events;
+    CalendarEvent event;
+    while (aCalendar.next(event))
+    {
+        events.push_back(event);
+    }
+    return events;
+}
+
+} // end anonymous namespace
+
+void AstronomicalCalendar_TestClass::testYear2024()
+{
+    JulianDate start(2024, 1, 1, 0, 0, 0);
+    JulianDate end(2025, 1, 1, 0, 0, 0);
+    AstronomicalCalendar calendar(start, end);
+    calendar.addEaster();
+    calendar.addSeasons();
+    calendar.addLunarPhases();
+    calendar.addEclipses();
+    std::vector<CalendarEvent> events = drain(calendar);
+
+    std::vector<CalendarEvent> easter;
+    std::vector<CalendarEvent> seasons;
+    std::vector<CalendarEvent> eclipses;
+    std::size_t phases = 0;
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        ASSERTM("Within range", events[i].julianDays >= start.getDecimalDays()
+                && events[i].julianDays <= end.getDecimalDays());
+        ASSERTM("Time order", i == 0 || events[i - 1].julianDays <= events[i].julianDays);
+        switch (events[i].type)
+        {
+            case CalendarEventType::Easter:
+                easter.push_back(events[i]);
+                break;
+            case CalendarEventType::Season:
+                seasons.push_back(events[i]);
+                break;
+            case CalendarEventType::LunarPhase:
+                phases++;
+                break;
+            case CalendarEventType::Eclipse:
+                eclipses.push_back(events[i]);
+                break;
+            default:
+                FAILM("Unexpected event type");
+                break;
+        }
+    }
+
+    ASSERT_EQUALM("One Easter", 1u, easter.size());
+    ASSERT_EQUAL_DELTAM("Easter Sunday 2024 March 31",
+                        JulianDate(2024, 3, 31, 0, 0, 0).getDecimalDays(),
+                        easter[0].julianDays,
+                        0.0);
+
+    ASSERT_EQUALM("Four seasons", 4u, seasons.size());
+    for (int season = 0; season < 4; season++)
+    {
+        ASSERT_EQUALM("Season order", season, seasons[season].detail);
+        ASSERT_EQUAL_DELTAM("Season time",
+                            SUN_UTIL::calculateSeason(2024, static_cast<SeasonType>(season)),
+                            seasons[season].julianDays,
+                            0.0);
+    }
+
+    std::vector<LunarPhaseEvent> expectedPhases;
+    LUNARPHASE_UTIL::findLunarPhases(start, end, expectedPhases);
+    ASSERT_EQUALM("Lunar phases", expectedPhases.size(), phases);
+
+    // Published times of greatest eclipse, UT.
+    struct Expected
+    {
+        JulianDate date;
+        EclipseType type;
+    };
+    const std::vector<Expected> expected = {
+        {JulianDate(2024, 3, 25, 7, 13, 0), EclipseType::PenumbralLunar},
+        {JulianDate(2024, 4, 8, 18, 17, 0), EclipseType::TotalSolar},
+        {JulianDate(2024, 9, 18, 2, 44, 0), EclipseType::PartialLunar},
+        {JulianDate(2024, 10, 2, 18, 45, 0), EclipseType::AnnularSolar}};
+    ASSERT_EQUALM("Four eclipses", expected.size(), eclipses.size());
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_EQUALM("Eclipse type", static_cast<int>(expected[i].type), eclipses[i].detail);
+        ASSERT_EQUAL_DELTAM("Eclipse time", expected[i].date.getDecimalDays(), eclipses[i].julianDays, 0.01);
+    }
+}
+
+void AstronomicalCalendar_TestClass::testMergeOrder()
+{
+    JulianDate start(2020, 1, 1, 0, 0, 0);
+    JulianDate end(2026, 1, 1, 0, 0, 0);
+
+    // Each source on its own.
+    std::vector<std::vector<CalendarEvent>> streams;
+    for (int kind = 0; kind < 6; kind++)
+    {
+        AstronomicalCalendar single(start, end);
+        switch (kind)
+        {
+            case 0:
+                single.addEaster();
+                break;
+            case 1:
+                single.addSeasons();
+                break;
+            case 2:
+                single.addLunarPhases();
+                break;
+            case 3:
+                single.addEclipses();
+                break;
+            case 4:
+                single.addPlanetEvents(MERCURY);
+                break;
+            default:
+                single.addPlanetEvents(MARS);
+                break;
+        }
+        streams.push_back(drain(single));
+        ASSERTM("Source not empty", !streams.back().empty());
+    }
+
+    // A user source that duplicates the lunar phases exactly, so
+    // every one of its events ties with one from the lunar source.
+    streams.push_back(streams[2]);
+
+    AstronomicalCalendar calendar(start, end);
+    calendar.addEaster();
+    calendar.addSeasons();
+    calendar.addLunarPhases();
+    calendar.addEclipses();
+    calendar.addPlanetEvents(MERCURY);
+    calendar.addPlanetEvents(MARS);
+    calendar.addSource(std::unique_ptr<CalendarEventSource>(new ListSource(streams.back())));
+    calendar.addSource(std::unique_ptr<CalendarEventSource>());
+    std::vector<CalendarEvent> merged = drain(calendar);
+
+    std::vector<CalendarEvent> expected;
+    for (const auto& stream : streams)
+    {
+        expected.insert(expected.end(), stream.begin(), stream.end());
+    }
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const CalendarEvent& aLeft, const CalendarEvent& aRight)
+                     {
+                         return aLeft.julianDays < aRight.julianDays;
+                     });
+
+    ASSERT_EQUALM("Merged size", expected.size(), merged.size());
+    for (std::size_t i = 0; i < merged.size(); i++)
+    {
+        ASSERT_EQUAL_DELTAM("Merged time", expected[i].julianDays, merged[i].julianDays, 0.0);
+        ASSERTM("Merged type", expected[i].type == merged[i].type);
+        ASSERT_EQUALM("Merged detail", expected[i].detail, merged[i].detail);
+    }
+
+    CalendarEvent event;
+    ASSERTM("Exhausted calendar stays exhausted", !calendar.next(event));
+    AstronomicalCalendar empty(start, end);
+    ASSERTM("Calendar with no sources", !empty.next(event));
+}
+
+void AstronomicalCalendar_TestClass::testLongRange()
+{
+    // Eight centuries of events, streamed without being stored.
+    AstronomicalCalendar calendar(JulianDate(1600, 1, 1, 0, 0, 0), JulianDate(2400, 1, 1, 0, 0, 0));
+    calendar.addEaster();
+    calendar.addSeasons();
+    calendar.addLunarPhases();
+    calendar.addEclipses();
+
+    std::size_t counts[4] = {0, 0, 0, 0};
+    double previous = 0.0;
+    bool ordered = true;
+    CalendarEvent event;
+    while (calendar.next(event))
+    {
+        ordered = ordered && (event.julianDays >= previous);
+        previous = event.julianDays;
+        counts[static_cast<int>(event.type)]++;
+    }
+    ASSERTM("Time order", ordered);
+    ASSERT_EQUALM("Easters", 800u, counts[0]);
+    ASSERT_EQUALM("Seasons", 3200u, counts[1]);
+    ASSERTM("Lunar phases", counts[2] > 39570 && counts[2] < 39590);
+    ASSERTM("Eclipses", counts[3] > 3850 && counts[3] < 3910);
+}
+
+void AstronomicalCalendar_TestClass::testOstream()
+{
+    std::ostringstream oss;
+    oss << CalendarEventType::Easter << ", " << CalendarEventType::Season << ", "
+        << CalendarEventType::LunarPhase << ", " << CalendarEventType::Eclipse << ", "
+        << CalendarEventType::Conjunction << ", " << CalendarEventType::Opposition;
+    ASSERT_EQUALM("Event type names",
+                  std::string("Easter, Season, Lunar phase, Eclipse, Conjunction, Opposition"),
+                  oss.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
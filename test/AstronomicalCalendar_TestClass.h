@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file AstronomicalCalendar_TestClass.h
+ * @brief Declaration of the CUTE test class for AstronomicalCalendar
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_ASTRONOMICALCALENDAR_TESTCLASS_H_
+#define TEST_ASTRONOMICALCALENDAR_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for AstronomicalCalendar
+ * @ingroup group_test
+ */
+class AstronomicalCalendar_TestClass
+{
+    public:
+        /// Default constructor
+        AstronomicalCalendar_TestClass() = default;
+
+        /// Default destructor
+        virtual ~AstronomicalCalendar_TestClass() = default;
+
+        /**
+         * Tests the calendar for 2024 against the published dates of
+         * Easter, the equinoxes and solstices and the eclipses, and the
+         * number of lunar phases.
+         */
+        void testYear2024();
+
+        /**
+         * Tests that the merged stream equals the concatenation of its
+         * sources sorted by time, with ties in the order the sources
+         * were added.
+         */
+        void testMergeOrder();
+
+        /**
+         * Tests a calendar streamed over several centuries.
+         */
+        void testLongRange();
+
+        /**
+         * Tests the ostream operator for CalendarEventType.
+         */
+        void testOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(AstronomicalCalendar_TestClass, testYear2024);
+            aSuite += CUTE_SMEMFUN(AstronomicalCalendar_TestClass, testMergeOrder);
+            aSuite += CUTE_SMEMFUN(AstronomicalCalendar_TestClass, testLongRange);
+            aSuite += CUTE_SMEMFUN(AstronomicalCalendar_TestClass, testOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_ASTRONOMICALCALENDAR_TESTCLASS_H_ */
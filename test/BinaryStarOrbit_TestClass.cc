@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file BinaryStarOrbit_TestClass.cc
+ * @brief Definition of BinaryStarOrbit_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "BinaryStarOrbit_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "BinaryStarOrbit.h"
+#include "BinaryStarUtilities.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// A few well-observed binaries of different eccentricity and inclination.
+const BinaryStarElements TEST_BINARIES[4] =
+{
+    {41.623, 1934.008, 0.2763, 0.907, 59.025, 219.907, 23.717},   // eta CrB, PAWYC
+    {169.1, 2005.13, 0.8831, 3.662, 148.0, 256.5, 36.9},          // gamma Vir
+    {79.91, 1955.56, 0.5179, 17.57, 79.20, 231.65, 204.85},       // alpha Cen
+    {50.09, 1894.13, 0.5923, 7.50, 136.53, 147.27, 44.57}         // Sirius
+};
+
+/**
+ * Steps 4 to 9 of PAWYC Section 63 taken literally: Newton's method on
+ * Kepler's equation, then the true anomaly, radius vector, position
+ * angle and separation.
+ */
+BinaryStarPosition calculateCampbellPosition(const BinaryStarElements& anElements, double aJulianDays)
+{
+    double years = 2000.0 + (aJulianDays - SPA_J2000_EPOCH) / SPA_DAYS_IN_JULIAN_YEAR - anElements.periastronEpoch;
+    double meanAnomaly = SPA_TWO_PI * years / anElements.period;
+    double e = anElements.eccentricity;
+    double eccAnomaly = meanAnomaly;
+    for (int iteration = 0; iteration < 100; iteration++)
+    {
+        eccAnomaly -= (eccAnomaly - e * std::sin(eccAnomaly) - meanAnomaly) / (1.0 - e * std::cos(eccAnomaly));
+    }
+    double trueAnomaly = 2.0 * std::atan(std::sqrt((1.0 + e) / (1.0 - e)) * std::tan(0.5 * eccAnomaly));
+    double radius = anElements.semiMajorAxis * (1.0 - e * std::cos(eccAnomaly));
+    double argument = trueAnomaly + anElements.argumentOfPeriastron * SPA_DEGREES_TO_RADIANS;
+    double thetaMinusNode = std::atan2(std::sin(argument) * std::cos(anElements.inclination * SPA_DEGREES_TO_RADIANS),
+                                       std::cos(argument));
+
+    BinaryStarPosition position;
+    position.separation = radius * std::cos(argument) / std::cos(thetaMinusNode);
+    position.positionAngle = std::fmod(thetaMinusNode * SPA_RADIANS_TO_DEGREES + anElements.positionAngleOfNode
+                                       + 720.0, 360.0);
+    return position;
+}
+
+/// Difference of two angles in degrees reduced to [-180, 180).
+double angleDifference(double anAngle, double anotherAngle)
+{
+    double difference = anAngle - anotherAngle;
+    return difference - 360.0 * std::floor(difference / 360.0 + 0.5);
+}
+
+} // end anonymous namespace
+
+void BinaryStarOrbit_TestClass::testThieleInnes()
+{
+    for (const BinaryStarElements& elements : TEST_BINARIES)
+    {
+        BinaryStarOrbit orbit(elements);
+        double a = 0.0;
+        double b = 0.0;
+        double f = 0.0;
+        double g = 0.0;
+        orbit.getThieleInnesConstants(a, b, f, g);
+
+        double axisSquared = elements.semiMajorAxis * elements.semiMajorAxis;
+        double cosIncl = std::cos(elements.inclination * SPA_DEGREES_TO_RADIANS);
+        spaTestFloatingPointEqual("A^2 + B^2 + F^2 + G^2",
+                                  axisSquared * (1.0 + cosIncl * cosIncl),
+                                  a * a + b * b + f * f + g * g,
+                                  1e-10 * axisSquared);
+        spaTestFloatingPointEqual("AG - BF", axisSquared * cosIncl, a * g - b * f, 1e-10 * axisSquared);
+    }
+
+    // At periastron the companion lies along (A, B) at distance a(1 - e).
+    BinaryStarOrbit orbit(TEST_BINARIES[0]);
+    double periastron = SPA_J2000_EPOCH + (TEST_BINARIES[0].periastronEpoch - 2000.0) * SPA_DAYS_IN_JULIAN_YEAR;
+    BinaryStarPosition position = orbit.calculatePosition(periastron);
+    double a = 0.0;
+    double b = 0.0;
+    double f = 0.0;
+    double g = 0.0;
+    orbit.getThieleInnesConstants(a, b, f, g);
+    double scale = 1.0 - TEST_BINARIES[0].eccentricity;
+    spaTestFloatingPointEqual("Separation at periastron",
+                              scale * std::sqrt(a * a + b * b),
+                              position.separation,
+                              1e-12);
+    spaTestFloatingPointEqual("Position angle at periastron",
+                              0.0,
+                              angleDifference(std::atan2(b, a) * SPA_RADIANS_TO_DEGREES, position.positionAngle),
+                              1e-9);
+}
+
+void BinaryStarOrbit_TestClass::testAgainstCampbell()
+{
+    for (const BinaryStarElements& elements : TEST_BINARIES)
+    {
+        BinaryStarOrbit orbit(elements);
+        for (int step = 0; step < 200; step++)
+        {
+            double julianDays = 2415020.0 + 250.0 * step;
+            BinaryStarPosition expected = calculateCampbellPosition(elements, julianDays);
+            BinaryStarPosition actual = orbit.calculatePosition(julianDays);
+            spaTestFloatingPointEqual("Separation", expected.separation, actual.separation,
+                                      1e-9 * elements.semiMajorAxis);
+            ASSERTM("Position angle in range", actual.positionAngle >= 0.0 && actual.positionAngle < 360.0);
+            spaTestFloatingPointEqual("Position angle",
+                                      0.0,
+                                      angleDifference(expected.positionAngle, actual.positionAngle),
+                                      1e-7);
+        }
+    }
+}
+
+void BinaryStarOrbit_TestClass::testBatch()
+{
+    std::vector<BinaryStarOrbit> orbits;
+    for (const BinaryStarElements& elements : TEST_BINARIES)
+    {
+        orbits.emplace_back(elements);
+    }
+    std::vector<double> julianDays(365);
+    for (std::size_t index = 0; index < julianDays.size(); index++)
+    {
+        julianDays[index] = 2460676.5 + static_cast<double>(index);
+    }
+
+    BinaryStarPositionArrays grid;
+    BINARYSTAR_UTIL::calculateBinaryStarPositionGrid(orbits, julianDays.data(), julianDays.size(), grid);
+    ASSERT_EQUALM("Grid size", orbits.size() * julianDays.size(), grid.size());
+
+    BinaryStarPositionArrays single;
+    for (std::size_t binary = 0; binary < orbits.size(); binary++)
+    {
+        BINARYSTAR_UTIL::calculateBinaryStarPositions(orbits[binary], julianDays.data(), julianDays.size(), single);
+        for (std::size_t index = 0; index < julianDays.size(); index++)
+        {
+            BinaryStarPosition expected = orbits[binary].calculatePosition(julianDays[index]);
+            BinaryStarPosition fromGrid = grid.at(binary * julianDays.size() + index);
+            ASSERT_EQUAL_DELTAM("Batch position angle", expected.positionAngle, single.positionAngle[index], 0.0);
+            ASSERT_EQUAL_DELTAM("Batch separation", expected.separation, single.separation[index], 0.0);
+            ASSERT_EQUAL_DELTAM("Grid position angle", expected.positionAngle, fromGrid.positionAngle, 0.0);
+            ASSERT_EQUAL_DELTAM("Grid separation", expected.separation, fromGrid.separation, 0.0);
+        }
+    }
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
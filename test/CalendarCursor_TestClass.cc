@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CalendarCursor_TestClass.cc
+ * @brief Definition of CalendarCursor_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CalendarCursor_TestClass.h"
+#include "CalendarCursor.h"
+#include "SerialDate.h"
+#include "SpaDate.h"
+#include "SpaTimeConstants.h"
+#include "TimeUtilities.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void CalendarCursor_TestClass::testDaily()
+{
+    SpaDate first(1899, 12, 25);
+    SpaDate last(2101, 1, 7);
+    std::int32_t expectedDays = SerialDate(first).getDays();
+    bool allMatch = true;
+    CalendarCursor cursor(first, last);
+    for (; !cursor.isDone(); cursor.next())
+    {
+        int year = cursor.getYear();
+        int month = cursor.getMonth();
+        int day = cursor.getDay();
+        allMatch = allMatch
+            && SerialDate(year, month, day).getDays() == expectedDays
+            && cursor.getDayOfYear() == TIME_UTIL::calculateDayNumber(year, month, day)
+            && cursor.getWeekDay() == TIME_UTIL::calculateDayInTheWeek(year, month, day)
+            && cursor.isLeapYear() == TIME_UTIL::isLeapYear(year);
+        expectedDays++;
+    }
+    ASSERTM("Daily steps match conversions", allMatch);
+    ASSERT_EQUALM("Number of days", SerialDate(last).getDays() + 1, expectedDays);
+    ASSERTM("Stops after the last date", cursor.getSpaDate() == SpaDate(2101, 1, 8));
+}
+
+void CalendarCursor_TestClass::testWeekly()
+{
+    SpaDate first(2023, 12, 28);
+    CalendarCursor cursor(first, SpaDate(2025, 1, 5), CalendarStep::Week);
+    std::int32_t expectedDays = SerialDate(first).getDays();
+    bool allMatch = true;
+    int numWeeks = 0;
+    for (; !cursor.isDone(); cursor.next())
+    {
+        int year = cursor.getYear();
+        int month = cursor.getMonth();
+        int day = cursor.getDay();
+        allMatch = allMatch
+            && SerialDate(year, month, day).getDays() == expectedDays
+            && cursor.getDayOfYear() == TIME_UTIL::calculateDayNumber(year, month, day)
+            && cursor.getWeekDay() == THU;
+        expectedDays += SPA_DAYS_PER_WEEK;
+        numWeeks++;
+    }
+    ASSERTM("Weekly steps match conversions", allMatch);
+    ASSERT_EQUALM("Number of weeks", 54, numWeeks);
+
+    // An arbitrary number of days
+    CalendarCursor advanced(SpaDate(1999, 2, 27), SpaDate(2100, 1, 1));
+    advanced.advanceDays(10000);
+    SerialDate expected = SerialDate(1999, 2, 27) + 10000;
+    ASSERTM("Advance days", advanced.getSpaDate() == expected.getSpaDate());
+    ASSERT_EQUALM("Advance days, weekday",
+                  TIME_UTIL::calculateDayInTheWeek(advanced.getYear(), advanced.getMonth(), advanced.getDay()),
+                  advanced.getWeekDay());
+}
+
+void CalendarCursor_TestClass::testMonthly()
+{
+    CalendarCursor cursor(SpaDate(2023, 10, 31), SpaDate(2024, 12, 31), CalendarStep::Month);
+    std::vector<int> expectedDays = { 31, 30, 31, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    std::vector<int> days;
+    bool allMatch = true;
+    for (; !cursor.isDone(); cursor.next())
+    {
+        int year = cursor.getYear();
+        int month = cursor.getMonth();
+        int day = cursor.getDay();
+        days.push_back(day);
+        allMatch = allMatch
+            && cursor.getDaysInMonth() == day
+            && cursor.getDayOfYear() == TIME_UTIL::calculateDayNumber(year, month, day)
+            && cursor.getWeekDay() == TIME_UTIL::calculateDayInTheWeek(year, month, day);
+    }
+    ASSERTM("Monthly steps match conversions", allMatch);
+    ASSERTM("Last day of each month", days == expectedDays);
+
+    // Steps by day reset the day of the month kept
+    CalendarCursor mixed(SpaDate(2023, 1, 30), SpaDate(2023, 12, 31));
+    mixed.nextMonth();
+    ASSERTM("January 30th to February 28th", mixed.getSpaDate() == SpaDate(2023, 2, 28));
+    mixed.nextDay();
+    mixed.nextMonth();
+    ASSERTM("March 1st to April 1st", mixed.getSpaDate() == SpaDate(2023, 4, 1));
+    ASSERT_EQUALM("April 1st 2023", SAT, mixed.getWeekDay());
+}
+
+void CalendarCursor_TestClass::testRange()
+{
+    CalendarCursor empty(SpaDate(2026, 10, 18), SpaDate(2026, 10, 17));
+    ASSERTM("Last before first", empty.isDone());
+    CalendarCursor single(SpaDate(2026, 10, 18), SpaDate(2026, 10, 18));
+    ASSERTM("Single day", !single.isDone());
+    ASSERT_EQUALM("Single day, weekday", SUN, single.getWeekDay());
+    single.next();
+    ASSERTM("Single day, done", single.isDone());
+
+    // Proleptic Gregorian dates before the calendar change
+    CalendarCursor early(SpaDate(1582, 10, 4), SpaDate(1582, 10, 15));
+    ASSERT_EQUALM("Gregorian 1582-10-04", MON, early.getWeekDay());
+    early.advanceDays(11);
+    ASSERT_EQUALM("Gregorian 1582-10-15", FRI, early.getWeekDay());
+    CalendarCursor yearOne(SpaDate(1, 1, 1), SpaDate(1, 12, 31));
+    ASSERT_EQUALM("Gregorian 0001-01-01", MON, yearOne.getWeekDay());
+
+    std::ostringstream os;
+    os << CalendarStep::Day << ", " << CalendarStep::Week << ", " << CalendarStep::Month;
+    ASSERT_EQUALM("Ostream operator", std::string("Day, Week, Month"), os.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CalendarCursor_TestClass.h
+ * @brief Declaration of the CUTE test class for CalendarCursor
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_CALENDARCURSOR_TESTCLASS_H_
+#define TEST_CALENDARCURSOR_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for CalendarCursor
+ * @ingroup group_test
+ */
+class CalendarCursor_TestClass
+{
+    public:
+        /// Default constructor
+        CalendarCursor_TestClass() = default;
+
+        /// Default destructor
+        virtual ~CalendarCursor_TestClass() = default;
+
+        /**
+         * Tests daily steps against the from-scratch conversions
+         */
+        void testDaily();
+
+        /**
+         * Tests weekly steps across month and year ends
+         */
+        void testWeekly();
+
+        /**
+         * Tests monthly steps, including month ends
+         */
+        void testMonthly();
+
+        /**
+         * Tests the end of the range, early dates and output
+         */
+        void testRange();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(CalendarCursor_TestClass, testDaily);
+            aSuite += CUTE_SMEMFUN(CalendarCursor_TestClass, testWeekly);
+            aSuite += CUTE_SMEMFUN(CalendarCursor_TestClass, testMonthly);
+            aSuite += CUTE_SMEMFUN(CalendarCursor_TestClass, testRange);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_CALENDARCURSOR_TESTCLASS_H_ */
@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CalendarPolicy_TestClass.cc
+ * @brief Definition of CalendarPolicy_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CalendarPolicy_TestClass.h"
+#include "CalendarPolicy.h"
+#include "CalendarCursor.h"
+#include "DateAndTime.h"
+#include "JulianDate.h"
+#include "SpaDate.h"
+
+#include <cmath>
+#include <random>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/*
+ * Checks that a Julian Date survives the round trip through a calendar
+ * date, and that the calendar date is the expected one.
+ */
+template <typename Calendar>
+bool roundTrips(double aJulianDays, int aYear, int aMonth, int aDay)
+{
+    int year;
+    int month;
+    double day;
+    CALENDAR_UTIL::calculateCalendarDate<Calendar>(aJulianDays, year, month, day);
+    double jd = CALENDAR_UTIL::calculateJulianDays<Calendar>(year, month, int(day), day - int(day));
+    bool sameDate = (year == aYear && month == aMonth && int(day) == aDay);
+    return sameDate && std::fabs(jd - aJulianDays) < 1.0e-6;
+}
+
+/*
+ * Number of days in a month of the Gregorian or Julian calendar.
+ */
+int daysInMonth(int aYear, int aMonth, bool isGregorian)
+{
+    const int DAYS[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    bool isLeap = (aYear % 4 == 0) && (!isGregorian || aYear % 100 != 0 || aYear % 400 == 0);
+    return DAYS[aMonth - 1] + ((aMonth == FEB && isLeap) ? 1 : 0);
+}
+
+} // end anonymous namespace
+
+void CalendarPolicy_TestClass::testHistorical()
+{
+    std::mt19937 generator(3);
+    bool allMatch = true;
+    for (int i = 0; i < 100000; i++)
+    {
+        int year = int(generator() % 6000) - 2000;
+        if (i % 4 == 0)
+        {
+            year = 1582;
+        }
+        int month = 1 + int(generator() % 12);
+        DateAndTime date(year,
+                         month,
+                         1 + int(generator() % daysInMonth(year, month, year > 1582)),
+                         int(generator() % 24),
+                         int(generator() % 60),
+                         double(generator() % 60000) / 1000.0,
+                         double(int(generator() % 49) - 24) * 0.5);
+        JulianDate jd(date);
+        allMatch = allMatch
+            && CALENDAR_UTIL::convertToJulianDate(date).getDecimalDays() == jd.getDecimalDays()
+            && CALENDAR_UTIL::convertToJulianDate<HistoricalCalendar>(date).getDecimalDays() == jd.getDecimalDays()
+            && CALENDAR_UTIL::convertToDateAndTime(jd) == jd.getDateAndTime();
+    }
+    ASSERTM("HistoricalCalendar matches JulianDate", allMatch);
+
+    ASSERT_EQUAL_DELTAM("PAWYC Section 4 example", 2446113.75,
+                        CALENDAR_UTIL::calculateJulianDays(1985, 2, 17, 0.25), 1.0e-9);
+    ASSERT_EQUAL_DELTAM("First Gregorian day", 2299160.5,
+                        CALENDAR_UTIL::calculateJulianDays(1582, 10, 15, 0.5) - 0.5, 1.0e-9);
+    ASSERT_EQUAL_DELTAM("Last Julian day", 2299159.5,
+                        CALENDAR_UTIL::calculateJulianDays(1582, 10, 4, 0.0), 1.0e-9);
+}
+
+void CalendarPolicy_TestClass::testProlepticGregorian()
+{
+    ASSERT_EQUAL_DELTAM("J2000",
+                        2451545.0,
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(2000, 1, 1, 0.5),
+                        1.0e-9);
+    ASSERT_EQUAL_DELTAM("Gregorian 1582-10-04",
+                        2299149.5,
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(1582, 10, 4, 0.0),
+                        1.0e-9);
+    ASSERT_EQUAL_DELTAM("Start of the Julian Period",
+                        0.0,
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(-4713, 11, 24, 0.5),
+                        1.0e-9);
+
+    // Consecutive days, as walked by the Gregorian CalendarCursor
+    double expected = CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(-4000, 1, 1, 0.0);
+    bool allMatch = true;
+    for (CalendarCursor cursor(SpaDate(-4000, 1, 1), SpaDate(3000, 12, 31)); !cursor.isDone(); cursor.next())
+    {
+        double jd = CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(cursor.getYear(),
+                                                                                   cursor.getMonth(),
+                                                                                   cursor.getDay(),
+                                                                                   0.0);
+        allMatch = allMatch && jd == expected
+            && roundTrips<ProlepticGregorianCalendar>(jd + 0.25, cursor.getYear(), cursor.getMonth(), cursor.getDay());
+        expected += 1.0;
+    }
+    ASSERTM("Consecutive days and round trip", allMatch);
+}
+
+void CalendarPolicy_TestClass::testProlepticJulian()
+{
+    ASSERT_EQUAL_DELTAM("Julian 2000-01-01 is Gregorian 2000-01-14",
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(2000, 1, 14, 0.0),
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticJulianCalendar>(2000, 1, 1, 0.0),
+                        1.0e-9);
+    ASSERT_EQUAL_DELTAM("Julian 1582-10-04",
+                        2299159.5,
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticJulianCalendar>(1582, 10, 4, 0.0),
+                        1.0e-9);
+    ASSERT_EQUAL_DELTAM("Julian leap day 1900",
+                        2.0,
+                        CALENDAR_UTIL::calculateJulianDays<ProlepticJulianCalendar>(1900, 3, 1, 0.0)
+                            - CALENDAR_UTIL::calculateJulianDays<ProlepticJulianCalendar>(1900, 2, 28, 0.0),
+                        1.0e-9);
+
+    std::mt19937 generator(4);
+    bool allMatch = true;
+    for (int i = 0; i < 100000; i++)
+    {
+        int year = int(generator() % 8000) - 4700;
+        int month = 1 + int(generator() % 12);
+        int day = 1 + int(generator() % daysInMonth(year, month, false));
+        double fraction = double(generator() % 24) / 24.0;
+        double jd = CALENDAR_UTIL::calculateJulianDays<ProlepticJulianCalendar>(year, month, day, fraction);
+        allMatch = allMatch && roundTrips<ProlepticJulianCalendar>(jd, year, month, day);
+    }
+    ASSERTM("Round trip", allMatch);
+    DateAndTime julian = CALENDAR_UTIL::convertToDateAndTime<ProlepticJulianCalendar>(JulianDate(2461331.5));
+    ASSERTM("Julian calendar 2026-10-05", julian == DateAndTime(2026, 10, 5));
+}
+
+void CalendarPolicy_TestClass::testMonthEnds()
+{
+    ASSERTM("2000-01-31", JulianDate(DateAndTime(2000, 1, 31)).getDateAndTime() == DateAndTime(2000, 1, 31));
+    ASSERTM("2000-02-29", JulianDate(DateAndTime(2000, 2, 29)).getDateAndTime() == DateAndTime(2000, 2, 29));
+    ASSERTM("2000-03-31", JulianDate(DateAndTime(2000, 3, 31)).getDateAndTime() == DateAndTime(2000, 3, 31));
+    ASSERTM("1999-08-31", JulianDate(DateAndTime(1999, 8, 31)).getDateAndTime() == DateAndTime(1999, 8, 31));
+    ASSERTM("1999-12-31", JulianDate(DateAndTime(1999, 12, 31)).getDateAndTime() == DateAndTime(1999, 12, 31));
+    ASSERTM("Julian 1500-01-31", JulianDate(DateAndTime(1500, 1, 31)).getDateAndTime() == DateAndTime(1500, 1, 31));
+    ASSERTM("Proleptic Gregorian 2000-01-31",
+            CALENDAR_UTIL::convertToDateAndTime<ProlepticGregorianCalendar>(
+                CALENDAR_UTIL::convertToJulianDate<ProlepticGregorianCalendar>(DateAndTime(2000, 1, 31)))
+                == DateAndTime(2000, 1, 31));
+    ASSERTM("Proleptic Julian 2000-01-31",
+            CALENDAR_UTIL::convertToDateAndTime<ProlepticJulianCalendar>(
+                CALENDAR_UTIL::convertToJulianDate<ProlepticJulianCalendar>(DateAndTime(2000, 1, 31)))
+                == DateAndTime(2000, 1, 31));
+
+    // The first and last moments of the last day of every month
+    bool allMatch = true;
+    for (int year = -4700; year <= 3300; year++)
+    {
+        for (int month = JAN; month <= DEC; month++)
+        {
+            int gregorianDay = daysInMonth(year, month, true);
+            double gregorian = CALENDAR_UTIL::calculateJulianDays<ProlepticGregorianCalendar>(year,
+                                                                                              month,
+                                                                                              gregorianDay,
+                                                                                              0.0);
+            int julianDay = daysInMonth(year, month, false);
+            double julian = CALENDAR_UTIL::calculateJulianDays<ProlepticJulianCalendar>(year,
+                                                                                        month,
+                                                                                        julianDay,
+                                                                                        0.0);
+            allMatch = allMatch
+                && roundTrips<ProlepticGregorianCalendar>(gregorian, year, month, gregorianDay)
+                && roundTrips<ProlepticGregorianCalendar>(gregorian + 0.999, year, month, gregorianDay)
+                && roundTrips<ProlepticJulianCalendar>(julian, year, month, julianDay)
+                && roundTrips<ProlepticJulianCalendar>(julian + 0.999, year, month, julianDay);
+        }
+    }
+    ASSERTM("Last day of every month", allMatch);
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
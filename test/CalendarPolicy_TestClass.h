@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CalendarPolicy_TestClass.h
+ * @brief Declaration of the CUTE test class for CalendarPolicy
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_CALENDARPOLICY_TESTCLASS_H_
+#define TEST_CALENDARPOLICY_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for CalendarPolicy
+ * @ingroup group_test
+ */
+class CalendarPolicy_TestClass
+{
+    public:
+        /// Default constructor
+        CalendarPolicy_TestClass() = default;
+
+        /// Default destructor
+        virtual ~CalendarPolicy_TestClass() = default;
+
+        /**
+         * Tests that HistoricalCalendar reproduces JulianDate
+         */
+        void testHistorical();
+
+        /**
+         * Tests ProlepticGregorianCalendar conversions
+         */
+        void testProlepticGregorian();
+
+        /**
+         * Tests ProlepticJulianCalendar conversions
+         */
+        void testProlepticJulian();
+
+        /**
+         * Tests that the last day of every month decodes as itself
+         */
+        void testMonthEnds();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(CalendarPolicy_TestClass, testHistorical);
+            aSuite += CUTE_SMEMFUN(CalendarPolicy_TestClass, testProlepticGregorian);
+            aSuite += CUTE_SMEMFUN(CalendarPolicy_TestClass, testProlepticJulian);
+            aSuite += CUTE_SMEMFUN(CalendarPolicy_TestClass, testMonthEnds);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_CALENDARPOLICY_TESTCLASS_H_ */
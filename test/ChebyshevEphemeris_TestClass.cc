@@ -0,0 +1,226 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevEphemeris_TestClass.cc
+ * @brief Definition of ChebyshevEphemeris_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevEphemeris_TestClass.h"
+#include "ChebyshevEphemeris.h"
+#include "ChebyshevEphemerisBuilder.h"
+#include "JulianDate.h"
+#include "PlanetUtilities.h"
+#include "SunUtilities.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Difference between two angles in degrees, in the range [-180, 180).
+double angleDifference(double anAngle1, double anAngle2)
+{
+    double difference = std::fmod(anAngle1 - anAngle2, 360.0);
+    if (difference >= 180.0)
+    {
+        difference -= 360.0;
+    }
+    else if (difference < -180.0)
+    {
+        difference += 360.0;
+    }
+    return difference;
+}
+
+/// 2020-01-01 0h UT to 2022-01-01 0h UT
+const double theStart = 2458849.5;
+const double theEnd = 2459580.5;
+
+} // end anonymous namespace
+
+void ChebyshevEphemeris_TestClass::testSunAccuracy()
+{
+    ChebyshevEphemerisBuilder builder(theStart, theEnd);
+    builder.addSun();
+    ChebyshevEphemeris ephemeris(builder.build());
+    ASSERTM("Ephemeris is valid", ephemeris.isValid());
+    ASSERTM("Has the Sun", ephemeris.hasBody(SPA_EPHEMERIS_SUN));
+    ASSERT_EQUALM("Sun components", std::size_t(3), ephemeris.getNumComponents(SPA_EPHEMERIS_SUN));
+
+    double maxLongitudeError = 0.0;
+    double maxDistanceError = 0.0;
+    double components[3];
+    for (double jd = theStart; jd <= theEnd; jd += 0.737)
+    {
+        ASSERTM("Sun evaluates in range", ephemeris.evaluate(SPA_EPHEMERIS_SUN, jd, components));
+        SunPosition expected = SUN_UTIL::calculateSunPosition(JulianDate(jd));
+        maxLongitudeError = std::max(maxLongitudeError,
+                                     std::fabs(angleDifference(components[0], expected.eclipticLongitude)));
+        maxDistanceError = std::max(maxDistanceError,
+                                    std::fabs(components[2] / expected.distance - 1.0));
+        ASSERTM("Longitude in [0, 360)", components[0] >= 0.0 && components[0] < 360.0);
+        ASSERT_EQUAL_DELTAM("Latitude", 0.0, components[1], 1e-12);
+    }
+    ASSERT_EQUAL_DELTAM("Max Sun longitude error", 0.0, maxLongitudeError, 1e-7);
+    ASSERT_EQUAL_DELTAM("Max Sun fractional distance error", 0.0, maxDistanceError, 1e-10);
+}
+
+void ChebyshevEphemeris_TestClass::testPlanetAccuracy()
+{
+    ChebyshevEphemerisBuilder builder(theStart, theEnd);
+    for (int planet = MERCURY; planet < SPA_NUM_PLANETS; planet++)
+    {
+        ASSERT_EQUALM("addPlanet succeeds except for the Earth",
+                      planet != EARTH,
+                      builder.addPlanet(static_cast<Planets>(planet)));
+    }
+    ChebyshevEphemeris ephemeris(builder.build());
+    ASSERTM("Ephemeris is valid", ephemeris.isValid());
+    ASSERTM("No Earth", !ephemeris.hasBody(EARTH));
+    ASSERTM("No Sun", !ephemeris.hasBody(SPA_EPHEMERIS_SUN));
+
+    double components[3];
+    for (int planet = MERCURY; planet < SPA_NUM_PLANETS; planet++)
+    {
+        if (planet == EARTH)
+        {
+            continue;
+        }
+        double maxAngleError = 0.0;
+        double maxDistanceError = 0.0;
+        for (double jd = theStart; jd <= theEnd; jd += 1.313)
+        {
+            ASSERTM("Planet evaluates in range", ephemeris.evaluate(planet, jd, components));
+            PlanetPosition expected = PLANET_UTIL::calculatePlanetPosition(static_cast<Planets>(planet), JulianDate(jd));
+            maxAngleError = std::max(maxAngleError,
+                                     std::fabs(angleDifference(components[0], expected.eclipticLongitude)));
+            maxAngleError = std::max(maxAngleError,
+                                     std::fabs(components[1] - expected.eclipticLatitude));
+            maxDistanceError = std::max(maxDistanceError,
+                                        std::fabs(components[2] / expected.distance - 1.0));
+        }
+        std::string name = std::to_string(planet);
+        ASSERT_EQUAL_DELTAM("Max angle error, planet " + name, 0.0, maxAngleError, 1e-6);
+        ASSERT_EQUAL_DELTAM("Max fractional distance error, planet " + name, 0.0, maxDistanceError, 1e-8);
+    }
+}
+
+void ChebyshevEphemeris_TestClass::testFileRoundTrip()
+{
+    ChebyshevEphemerisBuilder builder(theStart, theEnd);
+    builder.addSun();
+    builder.addPlanet(MARS);
+    ChebyshevEphemeris inMemory(builder.build());
+
+    std::string fileName = "spa_ephemeris_test.bin";
+    ASSERTM("Write file", builder.write(fileName));
+    ChebyshevEphemeris fromFile(fileName);
+    std::remove(fileName.c_str());
+
+    ASSERTM("File ephemeris is valid", fromFile.isValid());
+    ASSERT_EQUAL_DELTAM("Start", theStart, fromFile.getStartJulianDays(), 0.0);
+    ASSERT_EQUAL_DELTAM("End", theEnd, fromFile.getEndJulianDays(), 0.0);
+
+    double expected[3];
+    double actual[3];
+    for (double jd = theStart; jd <= theEnd; jd += 17.3)
+    {
+        for (int body : {static_cast<int>(MARS), SPA_EPHEMERIS_SUN})
+        {
+            ASSERTM("In memory evaluates", inMemory.evaluate(body, jd, expected));
+            ASSERTM("From file evaluates", fromFile.evaluate(body, JulianDate(jd), actual));
+            ASSERTM("Identical results", std::memcmp(expected, actual, sizeof(expected)) == 0);
+        }
+    }
+
+    ChebyshevEphemeris missing(std::string("no_such_directory/no_such_file.bin"));
+    ASSERTM("Missing file is invalid", !missing.isValid());
+}
+
+void ChebyshevEphemeris_TestClass::testInvalidInputs()
+{
+    ChebyshevEphemeris empty;
+    double components[3] = {1.0, 2.0, 3.0};
+    ASSERTM("Default is invalid", !empty.isValid());
+    ASSERTM("Default has no bodies", !empty.hasBody(SPA_EPHEMERIS_SUN));
+    ASSERTM("Default does not evaluate", !empty.evaluate(SPA_EPHEMERIS_SUN, theStart, components));
+
+    ChebyshevEphemerisBuilder builder(theStart, theEnd);
+    ASSERTM("Empty builder gives empty blob", builder.build().empty());
+    ASSERTM("Body id too large", !builder.addBody(SPA_EPHEMERIS_MAX_BODIES, 1.0, 4, 1, 0, [](const double*, std::size_t, double*) {}));
+    ASSERTM("Zero segment length", !builder.addBody(0, 0.0, 4, 1, 0, [](const double*, std::size_t, double*) {}));
+    ASSERTM("Empty sampler", !builder.addBody(0, 1.0, 4, 1, 0, ChebyshevEphemerisBuilder::Sampler()));
+    builder.addSun();
+    std::vector<char> blob = builder.build();
+
+    ChebyshevEphemeris ephemeris(blob);
+    ASSERTM("Valid", ephemeris.isValid());
+    ASSERTM("Before start", !ephemeris.evaluate(SPA_EPHEMERIS_SUN, theStart - 1e-3, components));
+    ASSERTM("After end", !ephemeris.evaluate(SPA_EPHEMERIS_SUN, theEnd + 1e-3, components));
+    ASSERTM("NaN time", !ephemeris.evaluate(SPA_EPHEMERIS_SUN, std::numeric_limits<double>::quiet_NaN(), components));
+    ASSERTM("Missing body", !ephemeris.evaluate(MARS, theStart, components));
+    ASSERTM("Negative body", !ephemeris.evaluate(-1, theStart, components));
+    ASSERT_EQUAL_DELTAM("Components untouched on failure", 1.0, components[0], 0.0);
+    ASSERTM("Start evaluates", ephemeris.evaluate(SPA_EPHEMERIS_SUN, theStart, components));
+    ASSERTM("End evaluates", ephemeris.evaluate(SPA_EPHEMERIS_SUN, theEnd, components));
+
+    std::vector<char> truncated(blob.begin(), blob.end() - 8);
+    ASSERTM("Truncated blob is invalid", !ChebyshevEphemeris(truncated).isValid());
+
+    std::vector<char> corrupted(blob);
+    corrupted[0] = 'X';
+    ASSERTM("Bad magic is invalid", !ChebyshevEphemeris(corrupted).isValid());
+
+    ChebyshevEphemeris borrowed(blob.data(), blob.size());
+    ASSERTM("Borrowed blob is valid", borrowed.isValid());
+
+    EphemerisFileHeader header;
+    std::memcpy(&header, blob.data(), sizeof(header));
+    std::vector<char> shortRange(blob);
+    EphemerisFileHeader shortHeader(header);
+    shortHeader.bodies[SPA_EPHEMERIS_SUN].numSegments--;
+    std::memcpy(shortRange.data(), &shortHeader, sizeof(shortHeader));
+    ASSERTM("Segments not covering the range are invalid", !ChebyshevEphemeris(shortRange).isValid());
+
+    // 2^30 segments of 32 components of 2^29 coefficients, 2^64 in all
+    std::vector<char> overflowing(blob);
+    EphemerisFileHeader overflowingHeader(header);
+    overflowingHeader.bodies[SPA_EPHEMERIS_SUN].numSegments = 0x40000000u;
+    overflowingHeader.bodies[SPA_EPHEMERIS_SUN].numComponents = 32;
+    overflowingHeader.bodies[SPA_EPHEMERIS_SUN].numCoefficients = 0x20000000u;
+    std::memcpy(overflowing.data(), &overflowingHeader, sizeof(overflowingHeader));
+    ASSERTM("Overflowing coefficient count is invalid", !ChebyshevEphemeris(overflowing).isValid());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevEphemeris_TestClass.h
+ * @brief Declaration of the CUTE test class for ChebyshevEphemeris
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_CHEBYSHEVEPHEMERIS_TESTCLASS_H_
+#define TEST_CHEBYSHEVEPHEMERIS_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for ChebyshevEphemeris
+ * @ingroup group_test
+ */
+class ChebyshevEphemeris_TestClass
+{
+    public:
+        /// Default constructor
+        ChebyshevEphemeris_TestClass() = default;
+
+        /// Default destructor
+        virtual ~ChebyshevEphemeris_TestClass() = default;
+
+        /**
+         * Tests that the tabulated Sun matches SUN_UTIL to well below
+         * the accuracy of the theory.
+         */
+        void testSunAccuracy();
+
+        /**
+         * Tests that the tabulated planets match PLANET_UTIL to well
+         * below the accuracy of the theory.
+         */
+        void testPlanetAccuracy();
+
+        /**
+         * Tests writing an ephemeris file and reading it back through
+         * the memory-mapped reader.
+         */
+        void testFileRoundTrip();
+
+        /**
+         * Tests missing bodies, out of range times and malformed blobs.
+         */
+        void testInvalidInputs();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(ChebyshevEphemeris_TestClass, testSunAccuracy);
+            aSuite += CUTE_SMEMFUN(ChebyshevEphemeris_TestClass, testPlanetAccuracy);
+            aSuite += CUTE_SMEMFUN(ChebyshevEphemeris_TestClass, testFileRoundTrip);
+            aSuite += CUTE_SMEMFUN(ChebyshevEphemeris_TestClass, testInvalidInputs);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_CHEBYSHEVEPHEMERIS_TESTCLASS_H_ */
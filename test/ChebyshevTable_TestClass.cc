@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevTable_TestClass.cc
+ * @brief Definition of ChebyshevTable_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevTable_TestClass.h"
+#include "ChebyshevTable.h"
+
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Sampler used throughout: a smooth but non-polynomial function.
+void sampleFunction(const double* aTimes, std::size_t aCount, double* aValues)
+{
+    for (std::size_t index = 0; index < aCount; index++)
+    {
+        aValues[index] = std::sin(aTimes[index] / 10.0) + 0.01 * aTimes[index];
+    }
+}
+
+} // end anonymous namespace
+
+void ChebyshevTable_TestClass::testBuildAndEvaluate()
+{
+    ChebyshevTable table(-50.0, 8.0, 25, 12, sampleFunction);
+    ASSERT_EQUALM("Number of segments", std::size_t(25), table.getNumSegments());
+    ASSERT_EQUALM("Number of coefficients", std::size_t(12), table.getNumCoefficients());
+    ASSERT_EQUALM("Coefficient storage", std::size_t(300), table.getCoefficients().size());
+    ASSERT_EQUAL_DELTAM("End of table", 150.0, table.getEnd(), 0.0);
+
+    for (double time = -50.0; time <= 150.0; time += 0.37)
+    {
+        double expected = 0;
+        sampleFunction(&time, 1, &expected);
+        ASSERT_EQUAL_DELTAM("Table value", expected, table.evaluate(time), 1.0e-13);
+        ASSERT_EQUAL_DELTAM("Table derivative",
+                            std::cos(time / 10.0) / 10.0 + 0.01,
+                            table.evaluateDerivative(time),
+                            1.0e-11);
+    }
+    return;
+}
+
+void ChebyshevTable_TestClass::testFromCoefficients()
+{
+    ChebyshevTable original(0.0, 5.0, 10, 8, sampleFunction);
+    ChebyshevTable copy(original.getStart(),
+                        original.getSegmentLength(),
+                        original.getNumCoefficients(),
+                        original.getCoefficients());
+    ASSERT_EQUALM("Number of segments", original.getNumSegments(), copy.getNumSegments());
+    for (double time = 0.0; time < 50.0; time += 1.1)
+    {
+        ASSERT_EQUALM("Same values", original.evaluate(time), copy.evaluate(time));
+    }
+
+    ChebyshevTable empty;
+    ASSERT_EQUALM("Empty table", std::size_t(0), empty.getNumSegments());
+    ASSERT_EQUAL_DELTAM("Empty table value", 0.0, empty.evaluate(1.0), 0.0);
+    return;
+}
+
+void ChebyshevTable_TestClass::testBatchEvaluate()
+{
+    ChebyshevTable table(0.0, 5.0, 10, 8, sampleFunction);
+    std::vector<double> times;
+    for (double time = 0.0; time < 50.0; time += 0.7)
+    {
+        times.push_back(time);
+    }
+    std::vector<double> values(times.size());
+    table.evaluate(times.data(), times.size(), values.data());
+    for (std::size_t index = 0; index < times.size(); index++)
+    {
+        ASSERT_EQUALM("Batch matches scalar", table.evaluate(times[index]), values[index]);
+    }
+    return;
+}
+
+void ChebyshevTable_TestClass::testEdges()
+{
+    ChebyshevTable table(0.0, 5.0, 10, 12, sampleFunction);
+    double expected = 0;
+    double time = 0.0;
+    sampleFunction(&time, 1, &expected);
+    ASSERT_EQUAL_DELTAM("Start of table", expected, table.evaluate(time), 1.0e-13);
+    time = 50.0;
+    sampleFunction(&time, 1, &expected);
+    ASSERT_EQUAL_DELTAM("End of table", expected, table.evaluate(time), 1.0e-13);
+
+    // Slightly outside: extrapolated from the edge segments.
+    time = 50.01;
+    sampleFunction(&time, 1, &expected);
+    ASSERT_EQUAL_DELTAM("Just past the end", expected, table.evaluate(time), 1.0e-8);
+    time = -0.01;
+    sampleFunction(&time, 1, &expected);
+    ASSERT_EQUAL_DELTAM("Just before the start", expected, table.evaluate(time), 1.0e-8);
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevTable_TestClass.h
+ * @brief Declaration of the CUTE test class for ChebyshevTable
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_CHEBYSHEVTABLE_TESTCLASS_H_
+#define TEST_CHEBYSHEVTABLE_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for ChebyshevTable
+ * @ingroup group_test
+ */
+class ChebyshevTable_TestClass
+{
+    public:
+        /// Default constructor
+        ChebyshevTable_TestClass() = default;
+
+        /// Default destructor
+        virtual ~ChebyshevTable_TestClass() = default;
+
+        /**
+         * Tests building a table from a sampler and evaluating
+         * it inside every segment.
+         */
+        void testBuildAndEvaluate();
+
+        /**
+         * Tests constructing a table from existing coefficients.
+         */
+        void testFromCoefficients();
+
+        /**
+         * Tests that batch evaluation matches scalar evaluation.
+         */
+        void testBatchEvaluate();
+
+        /**
+         * Tests evaluation at and just beyond the ends of the table.
+         */
+        void testEdges();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(ChebyshevTable_TestClass, testBuildAndEvaluate);
+            aSuite += CUTE_SMEMFUN(ChebyshevTable_TestClass, testFromCoefficients);
+            aSuite += CUTE_SMEMFUN(ChebyshevTable_TestClass, testBatchEvaluate);
+            aSuite += CUTE_SMEMFUN(ChebyshevTable_TestClass, testEdges);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_CHEBYSHEVTABLE_TESTCLASS_H_ */
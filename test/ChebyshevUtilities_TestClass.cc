@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevUtilities_TestClass.cc
+ * @brief Definition of ChebyshevUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevUtilities_TestClass.h"
+#include "ChebyshevUtilities.h"
+#include "SpaConstants.h"
+
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void ChebyshevUtilities_TestClass::testChebyshevNodes()
+{
+    const std::size_t count = 9;
+    std::vector<double> nodes(count);
+    CHEBYSHEV_UTIL::calculateChebyshevNodes(count, nodes.data());
+    for (std::size_t index = 0; index < count; index++)
+    {
+        // T_n(cos t) = cos(n t)
+        double value = std::cos(double(count) * std::acos(nodes[index]));
+        ASSERT_EQUAL_DELTAM("Node is a zero of T_n", 0.0, value, 1.0e-14);
+        if (index > 0)
+        {
+            ASSERTM("Nodes decreasing", nodes[index] < nodes[index - 1]);
+        }
+    }
+    return;
+}
+
+void ChebyshevUtilities_TestClass::testFitAndEvaluate()
+{
+    const std::size_t count = 6;
+    std::vector<double> nodes(count);
+    std::vector<double> values(count);
+    std::vector<double> coefficients(count);
+    CHEBYSHEV_UTIL::calculateChebyshevNodes(count, nodes.data());
+
+    // A cubic is reproduced exactly, with zero high-order coefficients.
+    for (std::size_t index = 0; index < count; index++)
+    {
+        double x = nodes[index];
+        values[index] = 1.0 - 2.0 * x + 0.5 * x * x + 3.0 * x * x * x;
+    }
+    CHEBYSHEV_UTIL::fitChebyshevCoefficients(values.data(), count, coefficients.data());
+    ASSERT_EQUAL_DELTAM("Coefficient 4", 0.0, coefficients[4], 1.0e-14);
+    ASSERT_EQUAL_DELTAM("Coefficient 5", 0.0, coefficients[5], 1.0e-14);
+    for (double x = -1.0; x <= 1.0; x += 0.125)
+    {
+        double expected = 1.0 - 2.0 * x + 0.5 * x * x + 3.0 * x * x * x;
+        ASSERT_EQUAL_DELTAM("Cubic reproduced",
+                            expected,
+                            CHEBYSHEV_UTIL::evaluateChebyshev(coefficients.data(), count, x),
+                            1.0e-13);
+    }
+
+    // Clenshaw against direct summation of c_j cos(j acos x).
+    std::vector<double> arbitrary = {0.3, -1.2, 0.7, 0.05, -0.4, 0.9, 0.11};
+    for (double x = -1.0; x <= 1.0; x += 0.1)
+    {
+        double direct = 0.0;
+        for (std::size_t order = 0; order < arbitrary.size(); order++)
+        {
+            direct += arbitrary[order] * std::cos(double(order) * std::acos(x));
+        }
+        ASSERT_EQUAL_DELTAM("Clenshaw matches direct sum",
+                            direct,
+                            CHEBYSHEV_UTIL::evaluateChebyshev(arbitrary.data(), arbitrary.size(), x),
+                            1.0e-13);
+    }
+
+    // A single coefficient is a constant.
+    double constant = 2.5;
+    ASSERT_EQUAL_DELTAM("Constant series", 2.5, CHEBYSHEV_UTIL::evaluateChebyshev(&constant, 1, 0.3), 0.0);
+    ASSERT_EQUAL_DELTAM("Empty series", 0.0, CHEBYSHEV_UTIL::evaluateChebyshev(nullptr, 0, 0.3), 0.0);
+    return;
+}
+
+void ChebyshevUtilities_TestClass::testDerivative()
+{
+    const std::size_t count = 20;
+    std::vector<double> nodes(count);
+    std::vector<double> values(count);
+    std::vector<double> coefficients(count);
+    CHEBYSHEV_UTIL::calculateChebyshevNodes(count, nodes.data());
+    for (std::size_t index = 0; index < count; index++)
+    {
+        values[index] = std::sin(2.0 * nodes[index]);
+    }
+    CHEBYSHEV_UTIL::fitChebyshevCoefficients(values.data(), count, coefficients.data());
+    for (double x = -1.0; x <= 1.0; x += 0.05)
+    {
+        ASSERT_EQUAL_DELTAM("Value of sin(2x)",
+                            std::sin(2.0 * x),
+                            CHEBYSHEV_UTIL::evaluateChebyshev(coefficients.data(), count, x),
+                            1.0e-14);
+        ASSERT_EQUAL_DELTAM("Derivative of sin(2x)",
+                            2.0 * std::cos(2.0 * x),
+                            CHEBYSHEV_UTIL::evaluateChebyshevDerivative(coefficients.data(), count, x),
+                            1.0e-12);
+    }
+    ASSERT_EQUAL_DELTAM("Empty series", 0.0, CHEBYSHEV_UTIL::evaluateChebyshevDerivative(nullptr, 0, 0.3), 0.0);
+    double constant = 2.5;
+    ASSERT_EQUAL_DELTAM("Constant series", 0.0, CHEBYSHEV_UTIL::evaluateChebyshevDerivative(&constant, 1, 0.3), 0.0);
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ChebyshevUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for ChebyshevUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_CHEBYSHEVUTILITIES_TESTCLASS_H_
+#define TEST_CHEBYSHEVUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for ChebyshevUtilities
+ * @ingroup group_test
+ */
+class ChebyshevUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        ChebyshevUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~ChebyshevUtilities_TestClass() = default;
+
+        /**
+         * Tests the Chebyshev nodes against their defining property
+         * T_n(x_k) = 0.
+         */
+        void testChebyshevNodes();
+
+        /**
+         * Tests that fitting a polynomial of degree less than n
+         * reproduces it exactly, and that Clenshaw evaluation matches
+         * direct summation.
+         */
+        void testFitAndEvaluate();
+
+        /**
+         * Tests the derivative of a Chebyshev series against
+         * analytic derivatives.
+         */
+        void testDerivative();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(ChebyshevUtilities_TestClass, testChebyshevNodes);
+            aSuite += CUTE_SMEMFUN(ChebyshevUtilities_TestClass, testFitAndEvaluate);
+            aSuite += CUTE_SMEMFUN(ChebyshevUtilities_TestClass, testDerivative);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_CHEBYSHEVUTILITIES_TESTCLASS_H_ */
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CometOrbitTable_TestClass.cc
+ * @brief Definition of CometOrbitTable_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CometOrbitTable_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "CometOrbitTable.h"
+
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// One orbit of each kind, sharing every element but e.
+CometOrbitTable makeMixedTable()
+{
+    CometOrbitTable table;
+    const double eccentricities[5] = {0.2, 0.967277, 1.0, 1.05, 3.0};
+    for (double eccentricity : eccentricities)
+    {
+        CometElements elements = {2451000.5, 1.2, eccentricity, 130.0, 40.0, 70.0};
+        table.add(elements);
+    }
+    return table;
+}
+
+} // end anonymous namespace
+
+void CometOrbitTable_TestClass::testPerihelion()
+{
+    CometOrbitTable table = makeMixedTable();
+    double reference[3] = {0.0, 0.0, 0.0};
+    for (std::size_t body = 0; body < table.size(); body++)
+    {
+        double x = 0.0;
+        double y = 0.0;
+        double z = 0.0;
+        table.calculateHeliocentricPosition(body, 2451000.5, x, y, z);
+        spaTestFloatingPointEqual("Radius at perihelion", 1.2, std::sqrt(x * x + y * y + z * z), 1e-12);
+        if (body == 0)
+        {
+            reference[0] = x;
+            reference[1] = y;
+            reference[2] = z;
+        }
+        spaTestFloatingPointEqual("Same perihelion direction x", reference[0], x, 1e-12);
+        spaTestFloatingPointEqual("Same perihelion direction y", reference[1], y, 1e-12);
+        spaTestFloatingPointEqual("Same perihelion direction z", reference[2], z, 1e-12);
+    }
+
+    // Moving away from perihelion, the more eccentric the orbit the
+    // further from the Sun it gets in the same time.
+    double previousRadius = 0.0;
+    for (std::size_t body = 0; body < table.size(); body++)
+    {
+        double x = 0.0;
+        double y = 0.0;
+        double z = 0.0;
+        table.calculateHeliocentricPosition(body, 2451100.5, x, y, z);
+        double radius = std::sqrt(x * x + y * y + z * z);
+        ASSERTM("Radius grows with eccentricity", radius > previousRadius);
+        previousRadius = radius;
+    }
+}
+
+void CometOrbitTable_TestClass::testBatchMatchesSingle()
+{
+    CometOrbitTable table = makeMixedTable();
+    std::size_t count = table.size();
+
+    // Every body at its own time, using a range that skips the first.
+    std::vector<double> times = {2451010.0, 2450900.0, 2451300.0, 2449000.0, 2452000.0};
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    table.calculateHeliocentricPositions(times.data() + 1, 1, count, x.data(), y.data(), z.data());
+    for (std::size_t body = 1; body < count; body++)
+    {
+        double sx = 0.0;
+        double sy = 0.0;
+        double sz = 0.0;
+        table.calculateHeliocentricPosition(body, times[body], sx, sy, sz);
+        ASSERT_EQUAL_DELTAM("Range x", sx, x[body - 1], 0.0);
+        ASSERT_EQUAL_DELTAM("Range y", sy, y[body - 1], 0.0);
+        ASSERT_EQUAL_DELTAM("Range z", sz, z[body - 1], 0.0);
+    }
+
+    // One body at every time.
+    for (std::size_t body = 0; body < count; body++)
+    {
+        table.calculateHeliocentricPositions(body, times.data(), times.size(), x.data(), y.data(), z.data());
+        for (std::size_t index = 0; index < times.size(); index++)
+        {
+            double sx = 0.0;
+            double sy = 0.0;
+            double sz = 0.0;
+            table.calculateHeliocentricPosition(body, times[index], sx, sy, sz);
+            ASSERT_EQUAL_DELTAM("Epochs x", sx, x[index], 0.0);
+            ASSERT_EQUAL_DELTAM("Epochs y", sy, y[index], 0.0);
+            ASSERT_EQUAL_DELTAM("Epochs z", sz, z[index], 0.0);
+        }
+    }
+}
+
+void CometOrbitTable_TestClass::testElements()
+{
+    CometOrbitTable table;
+    table.reserve(2);
+    CometElements elements = {2446470.9589, 0.587104, 0.967277, 111.8657, 58.8601, 162.2422};
+    ASSERT_EQUALM("First index", std::size_t(0), table.add(elements, "1P/Halley"));
+    ASSERT_EQUALM("Second index", std::size_t(1), table.add(elements));
+    ASSERT_EQUALM("Size", std::size_t(2), table.size());
+    ASSERT_EQUALM("Name", std::string("1P/Halley"), table.getName(0));
+    ASSERT_EQUALM("Default name", std::string(""), table.getName(1));
+
+    CometElements stored = table.getElements(0);
+    ASSERT_EQUAL_DELTAM("T", elements.perihelionJulianDays, stored.perihelionJulianDays, 0.0);
+    ASSERT_EQUAL_DELTAM("q", elements.perihelionDistance, stored.perihelionDistance, 0.0);
+    ASSERT_EQUAL_DELTAM("e", elements.eccentricity, stored.eccentricity, 0.0);
+    ASSERT_EQUAL_DELTAM("omega", elements.argumentOfPerihelion, stored.argumentOfPerihelion, 0.0);
+    ASSERT_EQUAL_DELTAM("Omega", elements.longitudeOfAscendingNode, stored.longitudeOfAscendingNode, 0.0);
+    ASSERT_EQUAL_DELTAM("i", elements.inclination, stored.inclination, 0.0);
+
+    table.clear();
+    ASSERT_EQUALM("Cleared", std::size_t(0), table.size());
+    ASSERT_EQUALM("Index after clear", std::size_t(0), table.add(elements));
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
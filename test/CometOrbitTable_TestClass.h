@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CometOrbitTable_TestClass.h
+ * @brief Declaration of the CUTE test class for CometOrbitTable
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_COMETORBITTABLE_TESTCLASS_H_
+#define TEST_COMETORBITTABLE_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for CometOrbitTable
+ * @ingroup group_test
+ */
+class CometOrbitTable_TestClass
+{
+    public:
+        /// Default constructor
+        CometOrbitTable_TestClass() = default;
+
+        /// Default destructor
+        virtual ~CometOrbitTable_TestClass() = default;
+
+        /**
+         * Tests that every kind of orbit is at q towards perihelion at time T.
+         */
+        void testPerihelion();
+
+        /**
+         * Tests that the batch interfaces match single-body propagation.
+         */
+        void testBatchMatchesSingle();
+
+        /**
+         * Tests storage of elements and names, and clear().
+         */
+        void testElements();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(CometOrbitTable_TestClass, testPerihelion);
+            aSuite += CUTE_SMEMFUN(CometOrbitTable_TestClass, testBatchMatchesSingle);
+            aSuite += CUTE_SMEMFUN(CometOrbitTable_TestClass, testElements);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_COMETORBITTABLE_TESTCLASS_H_ */
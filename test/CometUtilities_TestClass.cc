@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CometUtilities_TestClass.cc
+ * @brief Definition of CometUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CometUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "CometUtilities.h"
+#include "CometOrbitTable.h"
+#include "SpaPlanetConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Lines in the format of the Minor Planet Center's CometEls.txt.
+const char* const COMET_ELEMENT_TEXT =
+    "0001P         1986 02  9.4589  0.587104  0.967277  111.8657   58.8601  162.2422  19860205   5.5  8.0"
+    "  1P/Halley                                                MPC  5432\n"
+    "    CK20F030  2020 07  3.6796  0.294537  0.999229   37.2786   61.0097  128.9375  20200705   9.0  4.0"
+    "  C/2020 F3 (NEOWISE)                                      MPC 12345\n"
+    "This line is too short\n"
+    "    CK77R010  1977 11 10.5659  0.990662  1.000000  163.4799  181.8175   48.7196             6.0  4.0"
+    "  C/1977 R1 (Kohler)                                       MPC  4321\n"
+    "    CXXXXXXX  19xx 11 10.5659  0.990662  1.000000  163.4799  181.8175   48.7196             6.0  4.0\n";
+
+/// A large table mixing every kind of orbit.
+CometOrbitTable makeLargeTable(std::size_t aSize)
+{
+    CometOrbitTable table;
+    table.reserve(aSize);
+    for (std::size_t index = 0; index < aSize; index++)
+    {
+        double fraction = static_cast<double>(index) / static_cast<double>(aSize);
+        CometElements elements;
+        elements.perihelionJulianDays = 2451000.5 + 3000.0 * fraction;
+        elements.perihelionDistance = 0.3 + 4.0 * fraction;
+        elements.eccentricity = (index % 7 == 0) ? 1.0 : 1.4 * fraction;
+        elements.argumentOfPerihelion = 360.0 * fraction;
+        elements.longitudeOfAscendingNode = std::fmod(7.0 * 360.0 * fraction, 360.0);
+        elements.inclination = 180.0 * fraction;
+        table.add(elements);
+    }
+    return table;
+}
+
+} // end anonymous namespace
+
+void CometUtilities_TestClass::testHalley()
+{
+    // Reference values from an independent implementation with the same
+    // Earth orbit. The actual closest approach, 1986 April 11, was at
+    // 0.417 AU.
+    CometOrbitTable table;
+    CometElements halley = {2446470.9589, 0.587104, 0.967277, 111.8657, 58.8601, 162.2422};
+    table.add(halley, "1P/Halley");
+
+    CometPosition position = COMET_UTIL::calculateCometPosition(table, 0, JulianDate(1986, 4, 11, 0, 0, 0));
+    spaTestFloatingPointEqual("Distance 1986-04-11", 0.418493, position.distance, 1e-5);
+    spaTestFloatingPointEqual("Longitude 1986-04-11", 236.8358, position.eclipticLongitude, 1e-3);
+    spaTestFloatingPointEqual("Latitude 1986-04-11", -28.8072, position.eclipticLatitude, 1e-3);
+    spaTestFloatingPointEqual("Radius 1986-04-11", 1.331984, position.radiusVector, 1e-5);
+    spaTestFloatingPointEqual("Light time", 0.418493 * SPA_LIGHT_TIME_DAYS_PER_AU, position.lightTime, 1e-6);
+
+    position = COMET_UTIL::calculateCometPosition(table, 0, JulianDate(1985, 11, 27, 0, 0, 0));
+    spaTestFloatingPointEqual("Distance 1985-11-27", 0.618081, position.distance, 1e-5);
+    spaTestFloatingPointEqual("Longitude 1985-11-27", 32.3015, position.eclipticLongitude, 1e-3);
+    spaTestFloatingPointEqual("Heliocentric longitude", 52.3829, position.heliocentricLongitude, 1e-3);
+    spaTestFloatingPointEqual("Heliocentric latitude", 2.0690, position.heliocentricLatitude, 1e-3);
+}
+
+void CometUtilities_TestClass::testParabolicAndHyperbolic()
+{
+    CometOrbitTable table;
+    CometElements parabolic = {2451000.5, 1.2, 1.0, 130.0, 40.0, 70.0};
+    CometElements hyperbolic = {2451000.5, 1.2, 1.05, 130.0, 40.0, 70.0};
+    table.add(parabolic);
+    table.add(hyperbolic);
+
+    // Reference values from an independent implementation that
+    // iterates Barker's and Kepler's equations.
+    const double times[2] = {2451100.5, 2450700.5};
+    const double expected[2][2][3] =
+    {
+        {{218.80531, -16.07891, 2.779480}, {59.75260, 16.45413, 3.674928}},
+        {{218.92072, -16.19566, 2.808141}, {59.83196, 17.52218, 3.796658}}
+    };
+    CometPositionArrays positions;
+    for (std::size_t body = 0; body < 2; body++)
+    {
+        COMET_UTIL::calculateCometPositions(table, body, times, 2, positions);
+        for (std::size_t index = 0; index < 2; index++)
+        {
+            spaTestFloatingPointEqual("Longitude", expected[body][index][0], positions.eclipticLongitude[index], 1e-4);
+            spaTestFloatingPointEqual("Latitude", expected[body][index][1], positions.eclipticLatitude[index], 1e-4);
+            spaTestFloatingPointEqual("Distance", expected[body][index][2], positions.distance[index], 1e-5);
+        }
+    }
+}
+
+void CometUtilities_TestClass::testThreadedBulk()
+{
+    CometOrbitTable table = makeLargeTable(20000);
+    JulianDate epoch(2002, 6, 1, 0, 0, 0);
+
+    CometPositionArrays single;
+    CometPositionArrays threaded;
+    COMET_UTIL::calculateCometPositions(table, epoch, single, 1);
+    COMET_UTIL::calculateCometPositions(table, epoch, threaded, 4);
+    ASSERT_EQUALM("Size", table.size(), threaded.size());
+    for (std::size_t body = 0; body < table.size(); body++)
+    {
+        ASSERT_EQUAL_DELTAM("Same longitude", single.eclipticLongitude[body], threaded.eclipticLongitude[body], 0.0);
+        ASSERT_EQUAL_DELTAM("Same distance", single.distance[body], threaded.distance[body], 0.0);
+    }
+    for (std::size_t body = 0; body < table.size(); body += 997)
+    {
+        CometPosition position = COMET_UTIL::calculateCometPosition(table, body, epoch);
+        ASSERT_EQUAL_DELTAM("Bulk matches single longitude", position.eclipticLongitude,
+                            threaded.eclipticLongitude[body], 0.0);
+        ASSERT_EQUAL_DELTAM("Bulk matches single latitude", position.eclipticLatitude,
+                            threaded.eclipticLatitude[body], 0.0);
+        ASSERT_EQUAL_DELTAM("Bulk matches single radius", position.radiusVector,
+                            threaded.radiusVector[body], 0.0);
+    }
+
+    // One body at many epochs
+    std::vector<double> times(10000);
+    for (std::size_t index = 0; index < times.size(); index++)
+    {
+        times[index] = 2450000.5 + 0.5 * static_cast<double>(index);
+    }
+    COMET_UTIL::calculateCometPositions(table, 7, times.data(), times.size(), single, 1);
+    COMET_UTIL::calculateCometPositions(table, 7, times.data(), times.size(), threaded, 3);
+    for (std::size_t index = 0; index < times.size(); index++)
+    {
+        ASSERT_EQUAL_DELTAM("Same epoch longitude", single.eclipticLongitude[index],
+                            threaded.eclipticLongitude[index], 0.0);
+        ASSERT_EQUAL_DELTAM("Same epoch distance", single.distance[index], threaded.distance[index], 0.0);
+    }
+    CometPosition last = COMET_UTIL::calculateCometPosition(table, 7, JulianDate(times.back()));
+    ASSERT_EQUAL_DELTAM("Epochs match single", last.distance, threaded.distance.back(), 0.0);
+}
+
+void CometUtilities_TestClass::testParse()
+{
+    CometOrbitTable table;
+    ASSERT_EQUALM("Three valid lines", std::size_t(3), COMET_UTIL::parseCometElements(COMET_ELEMENT_TEXT, table));
+    ASSERT_EQUALM("Table size", std::size_t(3), table.size());
+    ASSERT_EQUALM("Name", std::string("1P/Halley"), table.getName(0));
+    ASSERT_EQUALM("Name with spaces", std::string("C/2020 F3 (NEOWISE)"), table.getName(1));
+
+    CometElements halley = table.getElements(0);
+    spaTestFloatingPointEqual("T", 2446470.9589, halley.perihelionJulianDays, 1e-9, 12);
+    spaTestFloatingPointEqual("q", 0.587104, halley.perihelionDistance, 1e-12);
+    spaTestFloatingPointEqual("e", 0.967277, halley.eccentricity, 1e-12);
+    spaTestFloatingPointEqual("omega", 111.8657, halley.argumentOfPerihelion, 1e-12);
+    spaTestFloatingPointEqual("Omega", 58.8601, halley.longitudeOfAscendingNode, 1e-12);
+    spaTestFloatingPointEqual("i", 162.2422, halley.inclination, 1e-12);
+    spaTestFloatingPointEqual("Parabolic e", 1.0, table.getElements(2).eccentricity, 0.0);
+
+    // The same text from a file, appended to the existing table
+    const char* fileName = "spa_test_comet_elements.txt";
+    {
+        std::ofstream file(fileName);
+        file << COMET_ELEMENT_TEXT;
+    }
+    ASSERT_EQUALM("Loaded from file", std::size_t(3), COMET_UTIL::loadCometElements(fileName, table));
+    ASSERT_EQUALM("Appended", std::size_t(6), table.size());
+    ASSERT_EQUALM("Appended name", std::string("C/1977 R1 (Kohler)"), table.getName(5));
+    std::remove(fileName);
+    ASSERT_EQUALM("Missing file", std::size_t(0), COMET_UTIL::loadCometElements(fileName, table));
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CometUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for CometUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_COMETUTILITIES_TESTCLASS_H_
+#define TEST_COMETUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for CometUtilities
+ * @ingroup group_test
+ */
+class CometUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        CometUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~CometUtilities_TestClass() = default;
+
+        /**
+         * Tests the position of comet Halley in 1986.
+         */
+        void testHalley();
+
+        /**
+         * Tests parabolic and hyperbolic orbits against reference values.
+         */
+        void testParabolicAndHyperbolic();
+
+        /**
+         * Tests that chunked multithreaded propagation matches single-threaded.
+         */
+        void testThreadedBulk();
+
+        /**
+         * Tests parsing and loading of orbit element text.
+         */
+        void testParse();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(CometUtilities_TestClass, testHalley);
+            aSuite += CUTE_SMEMFUN(CometUtilities_TestClass, testParabolicAndHyperbolic);
+            aSuite += CUTE_SMEMFUN(CometUtilities_TestClass, testThreadedBulk);
+            aSuite += CUTE_SMEMFUN(CometUtilities_TestClass, testParse);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_COMETUTILITIES_TESTCLASS_H_ */
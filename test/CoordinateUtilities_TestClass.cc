@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CoordinateUtilities_TestClass.cc
+ * @brief Definition of CoordinateUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CoordinateUtilities_TestClass.h"
+#include "CoordinateUtilities.h"
+#include "JulianDate.h"
+
+namespace SPA
+{
+namespace TEST
+{
+
+void CoordinateUtilities_TestClass::testMeanObliquity()
+{
+    double tolerance = 1.0e-6;
+    ASSERT_EQUAL_DELTAM("Obliquity at J2000",
+                        23.439292,
+                        COORD_UTIL::calculateMeanObliquity(JulianDate(2451545.0)),
+                        tolerance);
+
+    // 46.8 arcseconds per century decrease.
+    double change = COORD_UTIL::calculateMeanObliquity(JulianDate(2451545.0 + 36525.0))
+                    - COORD_UTIL::calculateMeanObliquity(JulianDate(2451545.0));
+    ASSERT_EQUAL_DELTAM("Obliquity rate",
+                        -46.815 / 3600.0,
+                        change,
+                        1.0e-5);
+    return;
+}
+
+void CoordinateUtilities_TestClass::testEclipticToEquatorial()
+{
+    double tolerance = 1.0e-10;
+    double obliquity = 23.44;
+
+    EquatorialCoordinates vernal = COORD_UTIL::convertEclipticToEquatorial(0.0, 0.0, obliquity);
+    ASSERT_EQUAL_DELTAM("Vernal equinox RA", 0.0, vernal.rightAscension, tolerance);
+    ASSERT_EQUAL_DELTAM("Vernal equinox Dec", 0.0, vernal.declination, tolerance);
+
+    EquatorialCoordinates summer = COORD_UTIL::convertEclipticToEquatorial(90.0, 0.0, obliquity);
+    ASSERT_EQUAL_DELTAM("Summer solstice RA", 6.0, summer.rightAscension, tolerance);
+    ASSERT_EQUAL_DELTAM("Summer solstice Dec", obliquity, summer.declination, tolerance);
+
+    EquatorialCoordinates winter = COORD_UTIL::convertEclipticToEquatorial(270.0, 0.0, obliquity);
+    ASSERT_EQUAL_DELTAM("Winter solstice RA", 18.0, winter.rightAscension, tolerance);
+    ASSERT_EQUAL_DELTAM("Winter solstice Dec", -obliquity, winter.declination, tolerance);
+
+    EquatorialCoordinates pole = COORD_UTIL::convertEclipticToEquatorial(90.0, 90.0 - obliquity, obliquity);
+    ASSERT_EQUAL_DELTAM("Ecliptic latitude reaching the celestial pole", 90.0, pole.declination, 1.0e-6);
+    return;
+}
+
+void CoordinateUtilities_TestClass::testEquatorialToHorizon()
+{
+    double tolerance = 1.0e-10;
+    double latitude = 52.0;
+
+    // On the meridian south of the zenith.
+    HorizonCoordinates transit = COORD_UTIL::convertEquatorialToHorizon(0.0, 10.0, latitude);
+    ASSERT_EQUAL_DELTAM("Transit altitude", 90.0 - latitude + 10.0, transit.altitude, tolerance);
+    ASSERT_EQUAL_DELTAM("Transit azimuth", 180.0, transit.azimuth, tolerance);
+
+    // Celestial equator at hour angle +6h sets due west on the horizon.
+    HorizonCoordinates west = COORD_UTIL::convertEquatorialToHorizon(6.0, 0.0, latitude);
+    ASSERT_EQUAL_DELTAM("Setting altitude", 0.0, west.altitude, tolerance);
+    ASSERT_EQUAL_DELTAM("Setting azimuth", 270.0, west.azimuth, tolerance);
+
+    // ...and rises due east at hour angle -6h.
+    HorizonCoordinates east = COORD_UTIL::convertEquatorialToHorizon(-6.0, 0.0, latitude);
+    ASSERT_EQUAL_DELTAM("Rising azimuth", 90.0, east.azimuth, tolerance);
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
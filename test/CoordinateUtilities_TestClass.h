@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CoordinateUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for CoordinateUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_COORDINATEUTILITIES_TESTCLASS_H_
+#define TEST_COORDINATEUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for CoordinateUtilities
+ * @ingroup group_test
+ */
+class CoordinateUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        CoordinateUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~CoordinateUtilities_TestClass() = default;
+
+        /**
+         * Tests the mean obliquity of the ecliptic at J2000 and its
+         * slow decrease with time.
+         */
+        void testMeanObliquity();
+
+        /**
+         * Tests ecliptic to equatorial conversion at the equinoxes and
+         * solstices, where the answers are known exactly.
+         */
+        void testEclipticToEquatorial();
+
+        /**
+         * Tests equatorial to horizon conversion for objects on the
+         * meridian and on the horizon.
+         */
+        void testEquatorialToHorizon();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(CoordinateUtilities_TestClass, testMeanObliquity);
+            aSuite += CUTE_SMEMFUN(CoordinateUtilities_TestClass, testEclipticToEquatorial);
+            aSuite += CUTE_SMEMFUN(CoordinateUtilities_TestClass, testEquatorialToHorizon);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_COORDINATEUTILITIES_TESTCLASS_H_ */
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CpuDispatch_TestClass.cc
+ * @brief Definition of CpuDispatch_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CpuDispatch_TestClass.h"
+#include "CpuDispatch.h"
+#include "AngleUtilities.h"
+#include "CoordinateUtilities.h"
+#include "DateAndTime.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void CpuDispatch_TestClass::testParse()
+{
+    CpuLevel level = CpuLevel::AVX512;
+    ASSERTM("generic", CPU_UTIL::parseCpuLevel("generic", level));
+    ASSERT_EQUALM("generic level", int(CpuLevel::Generic), int(level));
+    ASSERTM("SSE4.2", CPU_UTIL::parseCpuLevel("SSE4.2", level));
+    ASSERT_EQUALM("SSE4.2 level", int(CpuLevel::SSE42), int(level));
+    ASSERTM("Avx2", CPU_UTIL::parseCpuLevel("Avx2", level));
+    ASSERT_EQUALM("Avx2 level", int(CpuLevel::AVX2), int(level));
+    ASSERTM("avx512", CPU_UTIL::parseCpuLevel("avx512", level));
+    ASSERT_EQUALM("avx512 level", int(CpuLevel::AVX512), int(level));
+
+    ASSERTM("Null name", !CPU_UTIL::parseCpuLevel(nullptr, level));
+    ASSERTM("Empty name", !CPU_UTIL::parseCpuLevel("", level));
+    ASSERTM("Prefix", !CPU_UTIL::parseCpuLevel("avx", level));
+    ASSERTM("Suffix", !CPU_UTIL::parseCpuLevel("avx2x", level));
+    ASSERT_EQUALM("Unchanged on failure", int(CpuLevel::AVX512), int(level));
+
+    ASSERT_EQUALM("No override", int(CpuLevel::AVX2),
+                  int(CPU_UTIL::resolveCpuLevel(nullptr, CpuLevel::AVX2)));
+    ASSERT_EQUALM("Bad override", int(CpuLevel::AVX2),
+                  int(CPU_UTIL::resolveCpuLevel("sse5", CpuLevel::AVX2)));
+    ASSERT_EQUALM("Lower override", int(CpuLevel::SSE42),
+                  int(CPU_UTIL::resolveCpuLevel("sse4.2", CpuLevel::AVX2)));
+    ASSERT_EQUALM("Higher override", int(CpuLevel::AVX2),
+                  int(CPU_UTIL::resolveCpuLevel("avx512", CpuLevel::AVX2)));
+}
+
+void CpuDispatch_TestClass::testSelection()
+{
+    CpuLevel detected = CPU_UTIL::detectCpuLevel();
+    ASSERTM("Active level within detected", CPU_UTIL::getCpuLevel() <= detected);
+    ASSERT_EQUALM("Active kernels", int(CPU_UTIL::getCpuLevel()),
+                  int(CPU_UTIL::getBatchKernels().level));
+    ASSERT_EQUALM("Highest request", int(detected),
+                  int(CPU_UTIL::getBatchKernels(CpuLevel::AVX512).level));
+    ASSERT_EQUALM("Generic request", int(CpuLevel::Generic),
+                  int(CPU_UTIL::getBatchKernels(CpuLevel::Generic).level));
+}
+
+void CpuDispatch_TestClass::testKernels()
+{
+    // Dates either side of the Gregorian reform and of year zero
+    std::vector<int> years;
+    std::vector<int> months;
+    std::vector<int> days;
+    std::vector<double> dayFractions;
+    std::vector<double> expectedJulianDays;
+    for (int year = -1000; year <= 3000; year += 37)
+    {
+        for (int month = 1; month <= 12; month++)
+        {
+            int day = 1 + (year + 1000 + 3 * month) % 28;
+            int hours = (year + 1000 + month) % 24;
+            DateAndTime dateAndTime(year, month, day, hours, 17, 42.5, 0);
+            years.push_back(year);
+            months.push_back(month);
+            days.push_back(day);
+            dayFractions.push_back(dateAndTime.getDayFraction());
+            expectedJulianDays.push_back(JulianDate(dateAndTime).getDecimalDays());
+        }
+    }
+    const int reformDays[] = {4, 5, 14, 15, 15, 16};
+    const double reformFractions[] = {0.5, 0.0, 0.9, 0.0, 0.25, 0.0};
+    for (std::size_t i = 0; i < sizeof(reformDays) / sizeof(reformDays[0]); i++)
+    {
+        DateAndTime dateAndTime(1582, 10, reformDays[i], int(24 * reformFractions[i]), 0, 0, 0);
+        years.push_back(1582);
+        months.push_back(10);
+        days.push_back(reformDays[i]);
+        dayFractions.push_back(dateAndTime.getDayFraction());
+        expectedJulianDays.push_back(JulianDate(dateAndTime).getDecimalDays());
+    }
+    std::size_t numDates = years.size();
+
+    std::vector<double> angles;
+    for (double angle = -720.0; angle <= 720.0; angle += 7.3)
+    {
+        angles.push_back(angle);
+    }
+    std::size_t numAngles = angles.size();
+    const double obliquity = 23.44;
+
+    CpuLevel detected = CPU_UTIL::detectCpuLevel();
+    const CpuLevel levels[] = {CpuLevel::Generic, CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512};
+    for (CpuLevel level : levels)
+    {
+        if (level > detected)
+        {
+            break;
+        }
+        const BatchKernels& kernels = CPU_UTIL::getBatchKernels(level);
+        ASSERT_EQUALM("Kernel level", int(level), int(kernels.level));
+
+        std::vector<double> julianDays(numDates);
+        kernels.convertToJulianDays(years.data(), months.data(), days.data(), dayFractions.data(),
+                                    numDates, julianDays.data());
+        for (std::size_t i = 0; i < numDates; i++)
+        {
+            ASSERT_EQUALM("Julian Date", expectedJulianDays[i], julianDays[i]);
+        }
+
+        std::vector<int> decodedYears(numDates);
+        std::vector<int> decodedMonths(numDates);
+        std::vector<double> decodedDays(numDates);
+        kernels.convertFromJulianDays(julianDays.data(), numDates,
+                                      decodedYears.data(), decodedMonths.data(), decodedDays.data());
+        for (std::size_t i = 0; i < numDates; i++)
+        {
+            DateAndTime expected = JulianDate(julianDays[i]).getDateAndTime();
+            ASSERT_EQUALM("Decoded year", expected.getYear(), decodedYears[i]);
+            ASSERT_EQUALM("Decoded month", expected.getMonth(), decodedMonths[i]);
+            ASSERT_EQUAL_DELTAM("Decoded day",
+                                expected.getDay() + expected.getDayFraction(),
+                                decodedDays[i],
+                                1.0e-9);
+        }
+
+        std::vector<double> sines(numAngles);
+        std::vector<double> cosines(numAngles);
+        kernels.calculateSinCos(angles.data(), numAngles, sines.data(), cosines.data());
+        std::vector<double> rightAscensions(numAngles);
+        std::vector<double> declinations(numAngles);
+        std::vector<double> latitudes(numAngles);
+        for (std::size_t i = 0; i < numAngles; i++)
+        {
+            latitudes[i] = 0.1 * angles[i];
+        }
+        kernels.convertEclipticToEquatorial(angles.data(), latitudes.data(), numAngles, obliquity,
+                                            rightAscensions.data(), declinations.data());
+        for (std::size_t i = 0; i < numAngles; i++)
+        {
+            double radians = ANGLE_UTIL::degreesToRadians(angles[i]);
+            ASSERT_EQUAL_DELTAM("Sine", std::sin(radians), sines[i], 1.0e-15);
+            ASSERT_EQUAL_DELTAM("Cosine", std::cos(radians), cosines[i], 1.0e-15);
+
+            EquatorialCoordinates expected =
+                COORD_UTIL::convertEclipticToEquatorial(angles[i], latitudes[i], obliquity);
+            ASSERT_EQUAL_DELTAM("Right ascension", expected.rightAscension, rightAscensions[i], 1.0e-12);
+            ASSERT_EQUAL_DELTAM("Declination", expected.declination, declinations[i], 1.0e-12);
+        }
+    }
+}
+
+void CpuDispatch_TestClass::testOstream()
+{
+    std::ostringstream os;
+    os << CpuLevel::Generic << " " << CpuLevel::SSE42 << " "
+       << CpuLevel::AVX2 << " " << CpuLevel::AVX512;
+    ASSERT_EQUALM("CpuLevel names", std::string("generic sse4.2 avx2 avx512"), os.str());
+
+    // Every name printed parses back to its level
+    const CpuLevel levels[] = {CpuLevel::Generic, CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512};
+    for (CpuLevel level : levels)
+    {
+        std::ostringstream name;
+        name << level;
+        CpuLevel parsed = CpuLevel::Generic;
+        ASSERTM("Parse printed name", CPU_UTIL::parseCpuLevel(name.str().c_str(), parsed));
+        ASSERT_EQUALM("Round trip", int(level), int(parsed));
+    }
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
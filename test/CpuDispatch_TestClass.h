@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file CpuDispatch_TestClass.h
+ * @brief Declaration of the CUTE test class for CpuDispatch
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_CPUDISPATCH_TESTCLASS_H_
+#define TEST_CPUDISPATCH_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for CpuDispatch
+ * @ingroup group_test
+ */
+class CpuDispatch_TestClass
+{
+    public:
+        /// Default constructor
+        CpuDispatch_TestClass() = default;
+
+        /// Default destructor
+        virtual ~CpuDispatch_TestClass() = default;
+
+        /**
+         * Tests parsing level names and resolving an override against
+         * the detected level.
+         */
+        void testParse();
+
+        /**
+         * Tests that the active kernels never exceed the detected
+         * level, and that a higher request is lowered to it.
+         */
+        void testSelection();
+
+        /**
+         * Tests that the kernels of every level the processor supports
+         * match the scalar functions they replace.
+         */
+        void testKernels();
+
+        /**
+         * Tests the ostream operator for CpuLevel.
+         */
+        void testOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(CpuDispatch_TestClass, testParse);
+            aSuite += CUTE_SMEMFUN(CpuDispatch_TestClass, testSelection);
+            aSuite += CUTE_SMEMFUN(CpuDispatch_TestClass, testKernels);
+            aSuite += CUTE_SMEMFUN(CpuDispatch_TestClass, testOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_CPUDISPATCH_TESTCLASS_H_ */
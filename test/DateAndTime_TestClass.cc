@@ -29,9 +29,12 @@
 #include <sstream>
 #include <iomanip>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 #include "DateAndTime_TestClass.h"
 #include "DateAndTime.h"
+#include "JulianDate.h"
 #include "SpaTimeConstants.h"
 
 namespace SPA
@@ -232,6 +235,38 @@ void DateAndTime_TestClass::testGetDayFraction()
     return;
 }
 
+void DateAndTime_TestClass::testBinaryCopy()
+{
+    std::vector<DateAndTime> dates;
+    std::vector<JulianDate> julianDates;
+    for (int year = 1900; year < 2100; year += 7)
+    {
+        DateAndTime dateAndTime(year, 1 + year % 12, 1 + year % 28,
+                                year % 24, year % 60, 0.125 * (year % 480),
+                                0.5 * (year % 5));
+        dates.push_back(dateAndTime);
+        julianDates.push_back(JulianDate(dateAndTime));
+    }
+
+    // As if written to a file and read or mapped back
+    std::vector<char> dateBytes(dates.size() * sizeof(DateAndTime));
+    std::memcpy(dateBytes.data(), dates.data(), dateBytes.size());
+    std::vector<char> julianBytes(julianDates.size() * sizeof(JulianDate));
+    std::memcpy(julianBytes.data(), julianDates.data(), julianBytes.size());
+
+    std::vector<DateAndTime> copiedDates(dates.size());
+    std::memcpy(copiedDates.data(), dateBytes.data(), dateBytes.size());
+    std::vector<JulianDate> copiedJulianDates(julianDates.size());
+    std::memcpy(copiedJulianDates.data(), julianBytes.data(), julianBytes.size());
+    for (std::size_t i = 0; i < dates.size(); i++)
+    {
+        ASSERTM("DateAndTime copied", dates[i] == copiedDates[i]);
+        ASSERT_EQUALM("JulianDate copied",
+                      julianDates[i].getDecimalDays(),
+                      copiedJulianDates[i].getDecimalDays());
+    }
+}
+
 bool DateAndTime_TestClass::checkDateAndTimeValues(const SPA::DateAndTime& aDateAndTime,
                                                    int anExpectedYear,
                                                    int anExpectedMonth,
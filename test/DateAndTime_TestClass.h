@@ -72,6 +72,12 @@ class DateAndTime_TestClass
          */
         void testGetDayFraction();
 
+        /**
+         * Tests that arrays of DateAndTime and JulianDate survive a
+         * round trip through a byte buffer.
+         */
+        void testBinaryCopy();
+
         /**
          * Adds all methods that run this class's unit tests to the given cute suite.
          *
@@ -82,6 +88,7 @@ class DateAndTime_TestClass
             aSuite += CUTE_SMEMFUN(DateAndTime_TestClass, testConstructors);
             aSuite += CUTE_SMEMFUN(DateAndTime_TestClass, testComparisonOperators);
             aSuite += CUTE_SMEMFUN(DateAndTime_TestClass, testGetDayFraction);
+            aSuite += CUTE_SMEMFUN(DateAndTime_TestClass, testBinaryCopy);
         }
     private:
         /**
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EclipseUtilities_TestClass.cc
+ * @brief Definition of EclipseUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "EclipseUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "EclipseUtilities.h"
+#include "EclipseGenerator.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Published times are good to a minute; ours ignore Delta T.
+constexpr double CONTACT_TOLERANCE_DAYS = 3.0 / 1440.0;
+
+/// Finds the single eclipse within a day of the given UT.
+bool findEclipseNear(const JulianDate& aTime, Eclipse& anEclipse)
+{
+    std::vector<Eclipse> eclipses;
+    ECLIPSE_UTIL::findEclipses(JulianDate(aTime.getDecimalDays() - 1.0),
+                               JulianDate(aTime.getDecimalDays() + 1.0),
+                               eclipses);
+    if (eclipses.size() != 1)
+    {
+        return false;
+    }
+    anEclipse = eclipses[0];
+    return true;
+}
+
+} // end anonymous namespace
+
+void EclipseUtilities_TestClass::testLunarEclipses()
+{
+    // Total lunar eclipse of 2022 November 8, NASA Eclipse Web Site
+    Eclipse eclipse;
+    ASSERTM("Eclipse on 2022-11-08", findEclipseNear(JulianDate(2022, 11, 8, 11, 0, 0), eclipse));
+    ASSERTM("Total", eclipse.type == EclipseType::TotalLunar);
+    spaTestFloatingPointEqual("Greatest eclipse",
+                              JulianDate(2022, 11, 8, 10, 59, 11).getDecimalDays(),
+                              eclipse.maximumJulianDays,
+                              CONTACT_TOLERANCE_DAYS,
+                              10);
+    spaTestFloatingPointEqual("Umbral magnitude", 1.359, eclipse.magnitude, 0.01);
+    spaTestFloatingPointEqual("Penumbral magnitude", 2.416, eclipse.penumbralMagnitude, 0.01);
+    const double contacts[6][2] =
+    {
+        {JulianDate(2022, 11, 8, 8, 2, 17).getDecimalDays(), eclipse.penumbralBegin},
+        {JulianDate(2022, 11, 8, 9, 9, 12).getDecimalDays(), eclipse.umbralBegin},
+        {JulianDate(2022, 11, 8, 10, 16, 39).getDecimalDays(), eclipse.totalBegin},
+        {JulianDate(2022, 11, 8, 11, 41, 35).getDecimalDays(), eclipse.totalEnd},
+        {JulianDate(2022, 11, 8, 12, 49, 4).getDecimalDays(), eclipse.umbralEnd},
+        {JulianDate(2022, 11, 8, 13, 56, 9).getDecimalDays(), eclipse.penumbralEnd}
+    };
+    for (int index = 0; index < 6; index++)
+    {
+        spaTestFloatingPointEqual("Contact", contacts[index][0], contacts[index][1], CONTACT_TOLERANCE_DAYS, 10);
+    }
+
+    // Total lunar eclipse of 2000 January 21
+    ASSERTM("Eclipse on 2000-01-21", findEclipseNear(JulianDate(2000, 1, 21, 4, 44, 0), eclipse));
+    ASSERTM("Total", eclipse.type == EclipseType::TotalLunar);
+    spaTestFloatingPointEqual("Umbral magnitude", 1.325, eclipse.magnitude, 0.01);
+
+    // Partial lunar eclipse of 2021 November 19
+    ASSERTM("Eclipse on 2021-11-19", findEclipseNear(JulianDate(2021, 11, 19, 9, 3, 0), eclipse));
+    ASSERTM("Partial", eclipse.type == EclipseType::PartialLunar);
+    spaTestFloatingPointEqual("Umbral magnitude", 0.974, eclipse.magnitude, 0.01);
+    ASSERTM("No totality", std::isnan(eclipse.totalBegin) && std::isnan(eclipse.totalEnd));
+    ASSERTM("Umbral contacts", eclipse.umbralBegin < eclipse.maximumJulianDays
+            && eclipse.maximumJulianDays < eclipse.umbralEnd);
+
+    // Penumbral lunar eclipse of 2020 January 10
+    ASSERTM("Eclipse on 2020-01-10", findEclipseNear(JulianDate(2020, 1, 10, 19, 10, 0), eclipse));
+    ASSERTM("Penumbral", eclipse.type == EclipseType::PenumbralLunar);
+    ASSERTM("Negative umbral magnitude", eclipse.magnitude < 0.0);
+    spaTestFloatingPointEqual("Penumbral magnitude", 0.896, eclipse.penumbralMagnitude, 0.01);
+    ASSERTM("No umbral contacts", std::isnan(eclipse.umbralBegin) && std::isnan(eclipse.umbralEnd));
+}
+
+void EclipseUtilities_TestClass::testSolarEclipses()
+{
+    struct Expected
+    {
+        JulianDate maximum;
+        EclipseType type;
+        double magnitude;
+    };
+    // Greatest eclipse and magnitude from the NASA Eclipse Web Site
+    const Expected expected[4] =
+    {
+        {JulianDate(2017, 8, 21, 18, 26, 40), EclipseType::TotalSolar, 1.0306},
+        {JulianDate(2022, 10, 25, 11, 0, 20), EclipseType::PartialSolar, 0.8619},
+        {JulianDate(2023, 10, 14, 17, 59, 3), EclipseType::AnnularSolar, 0.9520},
+        {JulianDate(2024, 4, 8, 18, 17, 16), EclipseType::TotalSolar, 1.0566}
+    };
+    for (const Expected& entry : expected)
+    {
+        Eclipse eclipse;
+        ASSERTM("Eclipse found", findEclipseNear(entry.maximum, eclipse));
+        ASSERTM("Type", eclipse.type == entry.type);
+        spaTestFloatingPointEqual("Greatest eclipse",
+                                  entry.maximum.getDecimalDays(),
+                                  eclipse.maximumJulianDays,
+                                  CONTACT_TOLERANCE_DAYS,
+                                  10);
+        spaTestFloatingPointEqual("Magnitude", entry.magnitude, eclipse.magnitude, 0.01);
+        ASSERTM("No penumbral magnitude", std::isnan(eclipse.penumbralMagnitude));
+        ASSERTM("Partial phase spans greatest eclipse",
+                eclipse.penumbralBegin < eclipse.maximumJulianDays
+                && eclipse.maximumJulianDays < eclipse.penumbralEnd);
+        ASSERTM("Central eclipses have umbral contacts",
+                (entry.type == EclipseType::PartialSolar) == std::isnan(eclipse.umbralBegin));
+    }
+}
+
+void EclipseUtilities_TestClass::testEclipseCounts()
+{
+    // Five Millennium Canon: 224 solar and 228 lunar eclipses in 2001-2100.
+    JulianDate start(2001, 1, 1, 0, 0, 0);
+    JulianDate end(2101, 1, 1, 0, 0, 0);
+    std::vector<Eclipse> solar;
+    std::vector<Eclipse> lunar;
+    std::vector<Eclipse> all;
+    ECLIPSE_UTIL::findSolarEclipses(start, end, solar);
+    ECLIPSE_UTIL::findLunarEclipses(start, end, lunar);
+    ECLIPSE_UTIL::findEclipses(start, end, all);
+    ASSERTM("Solar eclipses in the 21st century", solar.size() >= 221 && solar.size() <= 227);
+    ASSERTM("Lunar eclipses in the 21st century", lunar.size() >= 225 && lunar.size() <= 231);
+    ASSERT_EQUALM("Combined search", solar.size() + lunar.size(), all.size());
+
+    for (std::size_t index = 0; index < all.size(); index++)
+    {
+        ASSERTM("In range", all[index].maximumJulianDays >= start.getDecimalDays()
+                && all[index].maximumJulianDays <= end.getDecimalDays());
+        if (index > 0)
+        {
+            ASSERTM("Time order", all[index].maximumJulianDays > all[index - 1].maximumJulianDays);
+        }
+    }
+    for (const Eclipse& eclipse : solar)
+    {
+        ASSERTM("Solar type", eclipse.type >= EclipseType::PartialSolar);
+    }
+    for (const Eclipse& eclipse : lunar)
+    {
+        ASSERTM("Lunar type", eclipse.type <= EclipseType::TotalLunar);
+        ASSERTM("Penumbral contacts", eclipse.penumbralBegin < eclipse.maximumJulianDays
+                && eclipse.maximumJulianDays < eclipse.penumbralEnd);
+    }
+}
+
+void EclipseUtilities_TestClass::testLongRange()
+{
+    // 1000 to 4000, about 2.4 solar and 2.4 lunar eclipses per year
+    JulianDate start(1000, 1, 1, 0, 0, 0);
+    JulianDate end(4000, 1, 1, 0, 0, 0);
+    std::vector<Eclipse> eclipses;
+    ECLIPSE_UTIL::findEclipses(start, end, eclipses);
+    ASSERTM("About 4.8 eclipses per year", eclipses.size() > 14000 && eclipses.size() < 15000);
+
+    std::size_t totalSolar = 0;
+    std::size_t totalLunar = 0;
+    for (const Eclipse& eclipse : eclipses)
+    {
+        if (eclipse.type == EclipseType::TotalSolar)
+        {
+            totalSolar++;
+        }
+        else if (eclipse.type == EclipseType::TotalLunar)
+        {
+            totalLunar++;
+        }
+        if (!std::isnan(eclipse.totalBegin))
+        {
+            ASSERTM("Totality within umbral phase", eclipse.umbralBegin < eclipse.totalBegin
+                    && eclipse.totalEnd < eclipse.umbralEnd);
+        }
+    }
+    ASSERTM("Total solar eclipses about three in ten of solar", totalSolar > 1800 && totalSolar < 2600);
+    ASSERTM("Total lunar eclipses about three in ten of lunar", totalLunar > 1800 && totalLunar < 2600);
+}
+
+void EclipseUtilities_TestClass::testGenerator()
+{
+    JulianDate start(1990, 1, 1, 0, 0, 0);
+    JulianDate end(2030, 1, 1, 0, 0, 0);
+    std::vector<Eclipse> expected;
+    ECLIPSE_UTIL::findEclipses(start, end, expected);
+
+    EclipseGenerator generator(start, end);
+    Eclipse eclipse;
+    std::size_t index = 0;
+    while (generator.next(eclipse))
+    {
+        ASSERTM("Not too many eclipses", index < expected.size());
+        ASSERT_EQUAL_DELTAM("Time", expected[index].maximumJulianDays, eclipse.maximumJulianDays, 0.0);
+        ASSERTM("Type", expected[index].type == eclipse.type);
+        index++;
+    }
+    ASSERT_EQUALM("Same number of eclipses", expected.size(), index);
+    ASSERTM("Exhausted generator stays exhausted", !generator.next(eclipse));
+
+    EclipseGenerator empty(end, start);
+    ASSERTM("Empty range", !empty.next(eclipse));
+}
+
+void EclipseUtilities_TestClass::testOstream()
+{
+    std::ostringstream oss;
+    oss << EclipseType::PenumbralLunar << ", " << EclipseType::PartialLunar << ", " << EclipseType::TotalLunar
+        << ", " << EclipseType::PartialSolar << ", " << EclipseType::AnnularSolar << ", "
+        << EclipseType::TotalSolar;
+    ASSERT_EQUALM("Eclipse names",
+                  std::string("Penumbral lunar, Partial lunar, Total lunar, Partial solar, Annular solar, Total solar"),
+                  oss.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file EclipseUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for EclipseUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_ECLIPSEUTILITIES_TESTCLASS_H_
+#define TEST_ECLIPSEUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for EclipseUtilities
+ * @ingroup group_test
+ */
+class EclipseUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        EclipseUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~EclipseUtilities_TestClass() = default;
+
+        /**
+         * Tests lunar eclipses against published circumstances.
+         */
+        void testLunarEclipses();
+
+        /**
+         * Tests solar eclipses against published circumstances.
+         */
+        void testSolarEclipses();
+
+        /**
+         * Tests the number and order of eclipses found in a century.
+         */
+        void testEclipseCounts();
+
+        /**
+         * Tests a search over several thousand years.
+         */
+        void testLongRange();
+
+        /**
+         * Tests that EclipseGenerator produces the same eclipses as
+         * ECLIPSE_UTIL::findEclipses().
+         */
+        void testGenerator();
+
+        /**
+         * Tests the ostream operator for EclipseType.
+         */
+        void testOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(EclipseUtilities_TestClass, testLunarEclipses);
+            aSuite += CUTE_SMEMFUN(EclipseUtilities_TestClass, testSolarEclipses);
+            aSuite += CUTE_SMEMFUN(EclipseUtilities_TestClass, testEclipseCounts);
+            aSuite += CUTE_SMEMFUN(EclipseUtilities_TestClass, testLongRange);
+            aSuite += CUTE_SMEMFUN(EclipseUtilities_TestClass, testGenerator);
+            aSuite += CUTE_SMEMFUN(EclipseUtilities_TestClass, testOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_ECLIPSEUTILITIES_TESTCLASS_H_ */
@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file IntervalIndex_TestClass.cc
+ * @brief Definition of IntervalIndex_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "IntervalIndex_TestClass.h"
+#include "IntervalIndex.h"
+#include "JulianDate.h"
+#include "SpaTimeConstants.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Random intervals, some empty, with many shared starts and ends
+void makeRandomIntervals(std::size_t aCount,
+                         unsigned int aSeed,
+                         std::vector<std::int64_t>& aStarts,
+                         std::vector<std::int64_t>& anEnds)
+{
+    std::mt19937_64 generator(aSeed);
+    std::uniform_int_distribution<std::int64_t> startDistribution(-100000, 100000);
+    std::uniform_int_distribution<std::int64_t> lengthDistribution(-10, 2000);
+    aStarts.resize(aCount);
+    anEnds.resize(aCount);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        aStarts[i] = startDistribution(generator);
+        std::int64_t length = lengthDistribution(generator);
+        // A few very long intervals
+        if (i % 97 == 0)
+        {
+            length *= 50;
+        }
+        anEnds[i] = aStarts[i] + length;
+    }
+}
+
+/// Indices of the intervals overlapping [aStart, anEnd), by linear scan
+std::vector<std::size_t> scanOverlapping(const std::vector<std::int64_t>& aStarts,
+                                         const std::vector<std::int64_t>& anEnds,
+                                         std::int64_t aStart,
+                                         std::int64_t anEnd)
+{
+    std::vector<std::size_t> ids;
+    for (std::size_t i = 0; i < aStarts.size(); i++)
+    {
+        if (aStarts[i] < anEnds[i] && aStarts[i] < anEnd && aStart < anEnds[i] && aStart < anEnd)
+        {
+            ids.push_back(i);
+        }
+    }
+    return ids;
+}
+
+/// True if the found indices are the expected ones, in order of start
+bool sameIntervals(std::vector<std::size_t> aFound,
+                   const std::vector<std::size_t>& anExpected,
+                   const std::vector<std::int64_t>& aStarts)
+{
+    for (std::size_t i = 1; i < aFound.size(); i++)
+    {
+        if (aStarts[aFound[i - 1]] > aStarts[aFound[i]])
+        {
+            return false;
+        }
+    }
+    std::sort(aFound.begin(), aFound.end());
+    return aFound == anExpected;
+}
+
+} // end anonymous namespace
+
+void IntervalIndex_TestClass::testEmpty()
+{
+    std::vector<std::size_t> ids;
+    IntervalIndex empty;
+    ASSERT_EQUALM("Empty count", std::size_t(0), empty.getCount());
+    ASSERT_EQUALM("Empty index", std::size_t(0), empty.findContaining(std::int64_t(0), ids));
+
+    std::vector<std::int64_t> starts = { 10, 20, 30 };
+    std::vector<std::int64_t> ends = { 10, 40, 25 };
+    IntervalIndex index(starts.data(), ends.data(), starts.size());
+    ASSERT_EQUALM("Empty intervals dropped", std::size_t(1), index.getCount());
+    ASSERT_EQUALM("Empty interval not found", std::size_t(0), index.findContaining(std::int64_t(10), ids));
+    ASSERT_EQUALM("Empty window", std::size_t(0), index.findOverlapping(std::int64_t(30), std::int64_t(30), ids));
+    ASSERT_EQUALM("Reversed window", std::size_t(0), index.countOverlapping(35, 25));
+    ASSERTM("Nothing appended", ids.empty());
+
+    ASSERT_EQUALM("Start is inside", std::size_t(1), index.findContaining(std::int64_t(20), ids));
+    ASSERT_EQUALM("End is outside", std::size_t(0), index.findContaining(std::int64_t(40), ids));
+    ASSERT_EQUALM("Window ending at start", std::size_t(0), index.countOverlapping(0, 20));
+    ASSERT_EQUALM("Window starting at end", std::size_t(0), index.countOverlapping(40, 50));
+    ASSERTM("Id of the interval", ids == std::vector<std::size_t>({ 1 }));
+}
+
+void IntervalIndex_TestClass::testQueries()
+{
+    // Sizes either side of full trees
+    std::vector<std::size_t> counts = { 1, 2, 3, 15, 16, 17, 1000, 20000 };
+    std::mt19937_64 generator(99);
+    std::uniform_int_distribution<std::int64_t> timeDistribution(-110000, 110000);
+    std::uniform_int_distribution<std::int64_t> lengthDistribution(0, 5000);
+    for (std::size_t count : counts)
+    {
+        std::vector<std::int64_t> starts;
+        std::vector<std::int64_t> ends;
+        makeRandomIntervals(count, unsigned(count), starts, ends);
+        IntervalIndex index(starts.data(), ends.data(), count);
+
+        bool allMatch = true;
+        for (int q = 0; q < 200; q++)
+        {
+            std::int64_t start = timeDistribution(generator);
+            std::int64_t end = start + lengthDistribution(generator);
+
+            std::vector<std::size_t> expected = scanOverlapping(starts, ends, start, end);
+            std::vector<std::size_t> found;
+            std::size_t numFound = index.findOverlapping(start, end, found);
+            allMatch = allMatch && numFound == found.size()
+                && sameIntervals(found, expected, starts)
+                && index.countOverlapping(start, end) == expected.size();
+
+            expected = scanOverlapping(starts, ends, start, start + 1);
+            found.clear();
+            index.findContaining(start, found);
+            allMatch = allMatch && sameIntervals(found, expected, starts);
+        }
+        ASSERTM("Queries match a linear scan", allMatch);
+    }
+}
+
+void IntervalIndex_TestClass::testBatchQueries()
+{
+    std::size_t count = 50000;
+    std::vector<std::int64_t> starts;
+    std::vector<std::int64_t> ends;
+    makeRandomIntervals(count, 5, starts, ends);
+    ThreadPool parallelPool(4);
+    IntervalIndex index(starts.data(), ends.data(), count, &parallelPool);
+
+    std::size_t numWindows = 3000;
+    std::vector<std::int64_t> windowStarts;
+    std::vector<std::int64_t> windowEnds;
+    makeRandomIntervals(numWindows, 6, windowStarts, windowEnds);
+
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> ids;
+    index.findOverlapping(windowStarts.data(), windowEnds.data(), numWindows,
+                          offsets, ids, &parallelPool);
+    ASSERT_EQUALM("Offsets", numWindows + 1, offsets.size());
+    ASSERT_EQUALM("Ids", offsets[numWindows], ids.size());
+
+    bool allMatch = true;
+    for (std::size_t q = 0; q < numWindows; q++)
+    {
+        std::vector<std::size_t> found;
+        index.findOverlapping(windowStarts[q], windowEnds[q], found);
+        allMatch = allMatch && std::vector<std::size_t>(ids.begin() + offsets[q],
+                                                        ids.begin() + offsets[q + 1]) == found;
+    }
+    ASSERTM("Batch matches single queries", allMatch);
+
+    ThreadPool serialPool(1);
+    std::vector<std::size_t> serialOffsets;
+    std::vector<std::size_t> serialIds;
+    index.findOverlapping(windowStarts.data(), windowEnds.data(), numWindows,
+                          serialOffsets, serialIds, &serialPool);
+    ASSERTM("Serial batch offsets", serialOffsets == offsets);
+    ASSERTM("Serial batch ids", serialIds == ids);
+}
+
+void IntervalIndex_TestClass::testJulianDates()
+{
+    const double hour = 1.0 / SPA_HOURS_IN_DAY;
+    const double jd0 = 2461331.5;
+    std::vector<JulianDate> starts = {
+        JulianDate(jd0), JulianDate(jd0 + 2 * hour), JulianDate(jd0 + 0.5), JulianDate(jd0 - 1.0) };
+    std::vector<JulianDate> ends = {
+        JulianDate(jd0 + 3 * hour), JulianDate(jd0 + 4 * hour), JulianDate(jd0 + 1.0), JulianDate(jd0 + 2.0) };
+    IntervalIndex index(starts.data(), ends.data(), starts.size());
+
+    std::vector<std::size_t> ids;
+    index.findContaining(JulianDate(jd0 + 2.5 * hour), ids);
+    ASSERTM("Containing", ids == std::vector<std::size_t>({ 3, 0, 1 }));
+
+    ids.clear();
+    index.findOverlapping(JulianDate(jd0 + 3 * hour), JulianDate(jd0 + 0.5), ids);
+    ASSERTM("Overlapping", ids == std::vector<std::size_t>({ 3, 1 }));
+
+    std::vector<JulianDate> windowStarts = { JulianDate(jd0 + 3.0), JulianDate(jd0 - 2.0) };
+    std::vector<JulianDate> windowEnds = { JulianDate(jd0 + 4.0), JulianDate(jd0 + 0.75) };
+    std::vector<std::size_t> offsets;
+    index.findOverlapping(windowStarts.data(), windowEnds.data(), windowStarts.size(), offsets, ids);
+    ASSERTM("Batch offsets", offsets == std::vector<std::size_t>({ 0, 0, 4 }));
+    ASSERTM("Batch ids", ids == std::vector<std::size_t>({ 3, 0, 1, 2 }));
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
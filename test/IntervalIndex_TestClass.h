@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file IntervalIndex_TestClass.h
+ * @brief Declaration of the CUTE test class for IntervalIndex
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_INTERVALINDEX_TESTCLASS_H_
+#define TEST_INTERVALINDEX_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for IntervalIndex
+ * @ingroup group_test
+ */
+class IntervalIndex_TestClass
+{
+    public:
+        /// Default constructor
+        IntervalIndex_TestClass() = default;
+
+        /// Default destructor
+        virtual ~IntervalIndex_TestClass() = default;
+
+        /**
+         * Tests an empty index and empty intervals and windows
+         */
+        void testEmpty();
+
+        /**
+         * Tests stabbing and overlap queries against a linear scan
+         */
+        void testQueries();
+
+        /**
+         * Tests batch overlap queries against single queries
+         */
+        void testBatchQueries();
+
+        /**
+         * Tests an index built from Julian Dates
+         */
+        void testJulianDates();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(IntervalIndex_TestClass, testEmpty);
+            aSuite += CUTE_SMEMFUN(IntervalIndex_TestClass, testQueries);
+            aSuite += CUTE_SMEMFUN(IntervalIndex_TestClass, testBatchQueries);
+            aSuite += CUTE_SMEMFUN(IntervalIndex_TestClass, testJulianDates);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_INTERVALINDEX_TESTCLASS_H_ */
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file KeplerUtilities_TestClass.cc
+ * @brief Definition of KeplerUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "KeplerUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "KeplerUtilities.h"
+#include "SpaConstants.h"
+
+#include <array>
+#include <vector>
+#include <sstream>
+#include <cmath>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void KeplerUtilities_TestClass::testSolveKeplerElliptic()
+{
+    const int NUM_ECC = 8;
+    std::array<double, NUM_ECC> eccentricities = {{0.0, 0.016713, 0.2, 0.5, 0.9,
+                                                  0.99, 0.999999, 0.9999999999}};
+    double tolerance = 1.0e-14;
+    std::ostringstream ss;
+    for (double ecc : eccentricities)
+    {
+        for (double meanAnomaly = -7.0; meanAnomaly <= 7.0; meanAnomaly += 0.013)
+        {
+            double eccAnomaly = KEPLER_UTIL::solveKeplerElliptic(meanAnomaly, ecc);
+            double residual = eccAnomaly - ecc * std::sin(eccAnomaly) - meanAnomaly;
+            if (std::fabs(residual) > tolerance)
+            {
+                ss << "Elliptic residual " << residual << " for M=" << meanAnomaly
+                   << " e=" << ecc;
+                FAILM(ss.str());
+            }
+        }
+        // Tiny mean anomalies are the hardest case for near-parabolic orbits.
+        for (double meanAnomaly = 1.0e-9; meanAnomaly < 1.0e-2; meanAnomaly *= 3.7)
+        {
+            double eccAnomaly = KEPLER_UTIL::solveKeplerElliptic(meanAnomaly, ecc);
+            double residual = eccAnomaly - ecc * std::sin(eccAnomaly) - meanAnomaly;
+            if (std::fabs(residual) > tolerance * meanAnomaly + 1.0e-17)
+            {
+                ss << "Elliptic residual " << residual << " for small M=" << meanAnomaly
+                   << " e=" << ecc;
+                FAILM(ss.str());
+            }
+        }
+    }
+
+    // The eccentric anomaly stays in the same revolution as M.
+    double meanAnomaly = 4.0 * SPA_PI + 0.3;
+    double eccAnomaly = KEPLER_UTIL::solveKeplerElliptic(meanAnomaly, 0.5);
+    ASSERT_EQUAL_DELTAM("Revolution of eccentric anomaly",
+                        2.0,
+                        std::floor(eccAnomaly / SPA_TWO_PI),
+                        0.0);
+    return;
+}
+
+void KeplerUtilities_TestClass::testSolveKeplerHyperbolic()
+{
+    const int NUM_ECC = 6;
+    std::array<double, NUM_ECC> eccentricities = {{1.0000001, 1.001, 1.1, 1.5, 3.0, 25.0}};
+    std::ostringstream ss;
+    for (double ecc : eccentricities)
+    {
+        for (double absMean = 1.0e-7; absMean < 1.0e4; absMean *= 1.9)
+        {
+            for (double sign = -1.0; sign <= 1.0; sign += 2.0)
+            {
+                double meanAnomaly = sign * absMean;
+                double hypAnomaly = KEPLER_UTIL::solveKeplerHyperbolic(meanAnomaly, ecc);
+                double residual = ecc * std::sinh(hypAnomaly) - hypAnomaly - meanAnomaly;
+                if (std::fabs(residual) > 1.0e-14 * std::fmax(1.0, absMean))
+                {
+                    ss << "Hyperbolic residual " << residual << " for M=" << meanAnomaly
+                       << " e=" << ecc;
+                    FAILM(ss.str());
+                }
+            }
+        }
+    }
+    return;
+}
+
+void KeplerUtilities_TestClass::testSolveBarkerEquation()
+{
+    // s = 1 gives W = 4; s = 2 gives W = 14.
+    double tolerance = 1.0e-14;
+    ASSERT_EQUAL_DELTAM("Barker W=4", 1.0, KEPLER_UTIL::solveBarkerEquation(4.0), tolerance);
+    ASSERT_EQUAL_DELTAM("Barker W=14", 2.0, KEPLER_UTIL::solveBarkerEquation(14.0), tolerance);
+    ASSERT_EQUAL_DELTAM("Barker W=-14", -2.0, KEPLER_UTIL::solveBarkerEquation(-14.0), tolerance);
+    ASSERT_EQUAL_DELTAM("Barker W=0", 0.0, KEPLER_UTIL::solveBarkerEquation(0.0), tolerance);
+
+    std::ostringstream ss;
+    for (double parabolic = -1.0e4; parabolic <= 1.0e4; parabolic += 37.1)
+    {
+        double tanHalf = KEPLER_UTIL::solveBarkerEquation(parabolic);
+        double residual = tanHalf * tanHalf * tanHalf + 3.0 * tanHalf - parabolic;
+        if (std::fabs(residual) > 1.0e-12 * std::fmax(1.0, std::fabs(parabolic)))
+        {
+            ss << "Barker residual " << residual << " for W=" << parabolic;
+            FAILM(ss.str());
+        }
+    }
+    return;
+}
+
+void KeplerUtilities_TestClass::testTrueAnomaly()
+{
+    double tolerance = 1.0e-12;
+
+    // Circular orbit: true anomaly equals eccentric anomaly.
+    ASSERT_EQUAL_DELTAM("Circular orbit",
+                        1.234,
+                        KEPLER_UTIL::calculateEllipticTrueAnomaly(1.234, 0.0),
+                        tolerance);
+
+    // Perihelion and aphelion.
+    ASSERT_EQUAL_DELTAM("Elliptic perihelion",
+                        0.0,
+                        KEPLER_UTIL::calculateEllipticTrueAnomaly(0.0, 0.7),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("Elliptic aphelion",
+                        SPA_PI,
+                        KEPLER_UTIL::calculateEllipticTrueAnomaly(SPA_PI, 0.7),
+                        tolerance);
+
+    // cos v = (cos E - e) / (1 - e cos E)
+    double ecc = 0.3;
+    double eccAnomaly = 1.1;
+    double expectedCosV = (std::cos(eccAnomaly) - ecc) / (1.0 - ecc * std::cos(eccAnomaly));
+    ASSERT_EQUAL_DELTAM("Elliptic cos(v)",
+                        expectedCosV,
+                        std::cos(KEPLER_UTIL::calculateEllipticTrueAnomaly(eccAnomaly, ecc)),
+                        tolerance);
+
+    // cos v = (e - cosh H) / (e cosh H - 1)
+    ecc = 1.4;
+    double hypAnomaly = 0.8;
+    expectedCosV = (ecc - std::cosh(hypAnomaly)) / (ecc * std::cosh(hypAnomaly) - 1.0);
+    ASSERT_EQUAL_DELTAM("Hyperbolic cos(v)",
+                        expectedCosV,
+                        std::cos(KEPLER_UTIL::calculateHyperbolicTrueAnomaly(hypAnomaly, ecc)),
+                        tolerance);
+    return;
+}
+
+void KeplerUtilities_TestClass::testBatchMatchesScalar()
+{
+    const std::size_t count = 1001;
+    std::vector<double> meanAnomalies(count);
+    std::vector<double> eccentricities(count);
+    std::vector<double> hypEccentricities(count);
+    for (std::size_t index = 0; index < count; index++)
+    {
+        meanAnomalies[index] = -10.0 + 0.02 * double(index);
+        eccentricities[index] = 0.999 * double(index) / double(count);
+        hypEccentricities[index] = 1.0001 + 0.01 * double(index);
+    }
+
+    std::vector<double> sharedEcc(count);
+    std::vector<double> perElementEcc(count);
+    std::vector<double> hyperbolic(count);
+    std::vector<double> barker(count);
+    KEPLER_UTIL::solveKeplerElliptic(meanAnomalies.data(), count, 0.3, sharedEcc.data());
+    KEPLER_UTIL::solveKeplerElliptic(meanAnomalies.data(), eccentricities.data(), count, perElementEcc.data());
+    KEPLER_UTIL::solveKeplerHyperbolic(meanAnomalies.data(), hypEccentricities.data(), count, hyperbolic.data());
+    KEPLER_UTIL::solveBarkerEquation(meanAnomalies.data(), count, barker.data());
+
+    for (std::size_t index = 0; index < count; index++)
+    {
+        ASSERT_EQUALM("Shared eccentricity batch",
+                      KEPLER_UTIL::solveKeplerElliptic(meanAnomalies[index], 0.3),
+                      sharedEcc[index]);
+        ASSERT_EQUALM("Per-element eccentricity batch",
+                      KEPLER_UTIL::solveKeplerElliptic(meanAnomalies[index], eccentricities[index]),
+                      perElementEcc[index]);
+        ASSERT_EQUALM("Hyperbolic batch",
+                      KEPLER_UTIL::solveKeplerHyperbolic(meanAnomalies[index], hypEccentricities[index]),
+                      hyperbolic[index]);
+        ASSERT_EQUALM("Barker batch",
+                      KEPLER_UTIL::solveBarkerEquation(meanAnomalies[index]),
+                      barker[index]);
+    }
+
+    // In-place operation is allowed.
+    std::vector<double> inPlace(meanAnomalies);
+    KEPLER_UTIL::solveKeplerElliptic(inPlace.data(), count, 0.3, inPlace.data());
+    ASSERT_EQUALM("In-place batch", sharedEcc[count / 2], inPlace[count / 2]);
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file KeplerUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for KeplerUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_KEPLERUTILITIES_TESTCLASS_H_
+#define TEST_KEPLERUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for KeplerUtilities
+ * @ingroup group_test
+ */
+class KeplerUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        KeplerUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~KeplerUtilities_TestClass() = default;
+
+        /**
+         * Tests the elliptic solver residual over a grid of mean
+         * anomalies and eccentricities, including near-parabolic ones.
+         */
+        void testSolveKeplerElliptic();
+
+        /**
+         * Tests the hyperbolic solver residual over a grid of mean
+         * anomalies and eccentricities.
+         */
+        void testSolveKeplerHyperbolic();
+
+        /**
+         * Tests the closed-form solution of Barker's equation.
+         */
+        void testSolveBarkerEquation();
+
+        /**
+         * Tests the conversions from eccentric and hyperbolic anomaly
+         * to true anomaly.
+         */
+        void testTrueAnomaly();
+
+        /**
+         * Tests that the batch interfaces give the same answers as the
+         * scalar interfaces.
+         */
+        void testBatchMatchesScalar();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(KeplerUtilities_TestClass, testSolveKeplerElliptic);
+            aSuite += CUTE_SMEMFUN(KeplerUtilities_TestClass, testSolveKeplerHyperbolic);
+            aSuite += CUTE_SMEMFUN(KeplerUtilities_TestClass, testSolveBarkerEquation);
+            aSuite += CUTE_SMEMFUN(KeplerUtilities_TestClass, testTrueAnomaly);
+            aSuite += CUTE_SMEMFUN(KeplerUtilities_TestClass, testBatchMatchesScalar);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_KEPLERUTILITIES_TESTCLASS_H_ */
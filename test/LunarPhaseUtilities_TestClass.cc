@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarPhaseUtilities_TestClass.cc
+ * @brief Definition of LunarPhaseUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "LunarPhaseUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "LunarPhaseUtilities.h"
+#include "LunarPhaseGenerator.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void LunarPhaseUtilities_TestClass::testKnownPhases()
+{
+    // Meeus Examples 49.a and 49.b, dynamical time
+    std::vector<LunarPhaseEvent> events;
+    LUNARPHASE_UTIL::findLunarPhases(JulianDate(2443190.0), JulianDate(2443195.0), events);
+    ASSERT_EQUALM("One phase near 1977-02-18", std::size_t(1), events.size());
+    ASSERTM("New Moon", events[0].type == LunarPhaseType::NewMoon);
+    spaTestFloatingPointEqual("New Moon 1977-02-18", 2443192.65118, events[0].julianDays, 0.001, 10);
+
+    LUNARPHASE_UTIL::findLunarPhases(JulianDate(2467634.0), JulianDate(2467639.0), events);
+    ASSERT_EQUALM("One phase near 2044-01-21", std::size_t(1), events.size());
+    ASSERTM("Last quarter", events[0].type == LunarPhaseType::LastQuarter);
+    spaTestFloatingPointEqual("Last quarter 2044-01-21", 2467636.49186, events[0].julianDays, 0.001, 10);
+
+    // January 2000, UT from the US Naval Observatory
+    LUNARPHASE_UTIL::findLunarPhases(JulianDate(2000, 1, 1, 0, 0, 0), JulianDate(2000, 1, 31, 0, 0, 0), events);
+    ASSERT_EQUALM("Four phases in January 2000", std::size_t(4), events.size());
+    const double expected[4] =
+    {
+        JulianDate(2000, 1, 6, 18, 14, 0).getDecimalDays(),
+        JulianDate(2000, 1, 14, 13, 34, 0).getDecimalDays(),
+        JulianDate(2000, 1, 21, 4, 40, 0).getDecimalDays(),
+        JulianDate(2000, 1, 28, 7, 57, 0).getDecimalDays()
+    };
+    for (int index = 0; index < 4; index++)
+    {
+        ASSERTM("Phase type", events[index].type == static_cast<LunarPhaseType>(index));
+        spaTestFloatingPointEqual("January 2000 phase time", expected[index], events[index].julianDays, 0.003, 10);
+    }
+
+    // The refined time really is where the phase angle equals the target.
+    LunarPhaseEvent full = LUNARPHASE_UTIL::calculateLunarPhase(2);
+    spaTestFloatingPointEqual("Phase angle at full Moon",
+                              180.0,
+                              LUNARPHASE_UTIL::calculateLunarPhaseAngle(full.julianDays),
+                              1e-4);
+}
+
+void LunarPhaseUtilities_TestClass::testRangeAndOrder()
+{
+    JulianDate start(2000, 1, 1, 0, 0, 0);
+    JulianDate end(2001, 1, 1, 0, 0, 0);
+    std::vector<LunarPhaseEvent> events;
+    LUNARPHASE_UTIL::findLunarPhases(start, end, events);
+    ASSERTM("About 49 phases in a year", events.size() >= 48 && events.size() <= 50);
+    for (std::size_t index = 0; index < events.size(); index++)
+    {
+        ASSERTM("After start", events[index].julianDays >= start.getDecimalDays());
+        ASSERTM("Before end", events[index].julianDays <= end.getDecimalDays());
+        if (index > 0)
+        {
+            double gap = events[index].julianDays - events[index - 1].julianDays;
+            ASSERTM("Quarter lunation spacing", gap > 5.5 && gap < 9.0);
+            ASSERTM("Phases cycle",
+                    static_cast<int>(events[index].type) == (static_cast<int>(events[index - 1].type) + 1) % 4);
+        }
+    }
+}
+
+void LunarPhaseUtilities_TestClass::testLongRange()
+{
+    // 1500 to 2500, streamed without storing the events
+    JulianDate start(1500, 1, 1, 0, 0, 0);
+    JulianDate end(2500, 1, 1, 0, 0, 0);
+    double previous[4] = {0.0, 0.0, 0.0, 0.0};
+    double minimumMonth = 100.0;
+    double maximumMonth = 0.0;
+    std::size_t count = LUNARPHASE_UTIL::findLunarPhases(start,
+                                                         end,
+                                                         [&](const LunarPhaseEvent& anEvent)
+                                                         {
+                                                             int type = static_cast<int>(anEvent.type);
+                                                             if (anEvent.type == LunarPhaseType::NewMoon && previous[type] > 0.0)
+                                                             {
+                                                                 double month = anEvent.julianDays - previous[type];
+                                                                 minimumMonth = std::min(minimumMonth, month);
+                                                                 maximumMonth = std::max(maximumMonth, month);
+                                                             }
+                                                             previous[type] = anEvent.julianDays;
+                                                             return true;
+                                                         });
+
+    double expectedCount = 4.0 * (end.getDecimalDays() - start.getDecimalDays()) / 29.530588861;
+    ASSERT_EQUAL_DELTAM("Number of phases in 1000 years", expectedCount, double(count), 4.0);
+
+    // New Moon to new Moon ranges from about 29.27 to 29.83 days.
+    ASSERT_EQUAL_DELTAM("Shortest month", 29.27, minimumMonth, 0.02);
+    ASSERT_EQUAL_DELTAM("Longest month", 29.83, maximumMonth, 0.02);
+}
+
+void LunarPhaseUtilities_TestClass::testEarlyStop()
+{
+    int calls = 0;
+    std::size_t count = LUNARPHASE_UTIL::findLunarPhases(JulianDate(2000, 1, 1, 0, 0, 0),
+                                                         JulianDate(2100, 1, 1, 0, 0, 0),
+                                                         [&calls](const LunarPhaseEvent&)
+                                                         {
+                                                             calls++;
+                                                             return calls < 5;
+                                                         });
+    ASSERT_EQUALM("Callback calls", 5, calls);
+    ASSERT_EQUALM("Returned count", std::size_t(5), count);
+}
+
+void LunarPhaseUtilities_TestClass::testGenerator()
+{
+    JulianDate start(2024, 3, 1, 0, 0, 0);
+    JulianDate end(2024, 9, 1, 0, 0, 0);
+    std::vector<LunarPhaseEvent> expected;
+    LUNARPHASE_UTIL::findLunarPhases(start, end, expected);
+
+    LunarPhaseGenerator generator(start, end);
+    LunarPhaseEvent event;
+    std::size_t index = 0;
+    while (generator.next(event))
+    {
+        ASSERTM("Not too many events", index < expected.size());
+        ASSERT_EQUAL_DELTAM("Time", expected[index].julianDays, event.julianDays, 0.0);
+        ASSERTM("Type", expected[index].type == event.type);
+        index++;
+    }
+    ASSERT_EQUALM("Same number of events", expected.size(), index);
+    ASSERTM("Exhausted generator stays exhausted", !generator.next(event));
+
+    LunarPhaseGenerator empty(end, start);
+    ASSERTM("Empty range", !empty.next(event));
+}
+
+void LunarPhaseUtilities_TestClass::testOstream()
+{
+    std::ostringstream oss;
+    oss << LunarPhaseType::NewMoon << ", " << LunarPhaseType::FirstQuarter << ", "
+        << LunarPhaseType::FullMoon << ", " << LunarPhaseType::LastQuarter;
+    ASSERT_EQUALM("Phase names", std::string("New Moon, First quarter, Full Moon, Last quarter"), oss.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
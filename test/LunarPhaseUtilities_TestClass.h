@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarPhaseUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for LunarPhaseUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_LUNARPHASEUTILITIES_TESTCLASS_H_
+#define TEST_LUNARPHASEUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for LunarPhaseUtilities
+ * @ingroup group_test
+ */
+class LunarPhaseUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        LunarPhaseUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~LunarPhaseUtilities_TestClass() = default;
+
+        /**
+         * Tests phase times against published values.
+         */
+        void testKnownPhases();
+
+        /**
+         * Tests that a year of phases is complete, ordered and in range.
+         */
+        void testRangeAndOrder();
+
+        /**
+         * Tests streaming a thousand years of phases.
+         */
+        void testLongRange();
+
+        /**
+         * Tests stopping a search from the callback.
+         */
+        void testEarlyStop();
+
+        /**
+         * Tests that LunarPhaseGenerator matches findLunarPhases().
+         */
+        void testGenerator();
+
+        /**
+         * Tests the ostream operator for LunarPhaseType.
+         */
+        void testOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(LunarPhaseUtilities_TestClass, testKnownPhases);
+            aSuite += CUTE_SMEMFUN(LunarPhaseUtilities_TestClass, testRangeAndOrder);
+            aSuite += CUTE_SMEMFUN(LunarPhaseUtilities_TestClass, testLongRange);
+            aSuite += CUTE_SMEMFUN(LunarPhaseUtilities_TestClass, testEarlyStop);
+            aSuite += CUTE_SMEMFUN(LunarPhaseUtilities_TestClass, testGenerator);
+            aSuite += CUTE_SMEMFUN(LunarPhaseUtilities_TestClass, testOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_LUNARPHASEUTILITIES_TESTCLASS_H_ */
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarSeries_TestClass.cc
+ * @brief Definition of LunarSeries_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "LunarSeries_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "LunarSeries.h"
+#include "MoonUtilities.h"
+#include "JulianDate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Difference between two angles in degrees, in the range [-180, 180).
+double angleDifference(double anAngle1, double anAngle2)
+{
+    double difference = std::fmod(anAngle1 - anAngle2, 360.0);
+    if (difference >= 180.0)
+    {
+        difference -= 360.0;
+    }
+    else if (difference < -180.0)
+    {
+        difference += 360.0;
+    }
+    return difference;
+}
+
+/// Largest differences between two series over about 30 years
+void compareSeries(const LunarSeries& aSeries1,
+                   const LunarSeries& aSeries2,
+                   double& aLongitudeError,
+                   double& aLatitudeError,
+                   double& aDistanceError)
+{
+    aLongitudeError = 0.0;
+    aLatitudeError = 0.0;
+    aDistanceError = 0.0;
+    for (int index = 0; index < 400; index++)
+    {
+        double jd = 2451545.0 + 27.3 * index;
+        MoonPosition position1 = aSeries1.calculatePosition(jd);
+        MoonPosition position2 = aSeries2.calculatePosition(jd);
+        aLongitudeError = std::max(aLongitudeError,
+                                   std::fabs(angleDifference(position1.eclipticLongitude, position2.eclipticLongitude)));
+        aLatitudeError = std::max(aLatitudeError,
+                                  std::fabs(position1.eclipticLatitude - position2.eclipticLatitude));
+        aDistanceError = std::max(aDistanceError,
+                                  std::fabs(position1.distance - position2.distance));
+    }
+}
+
+} // end anonymous namespace
+
+void LunarSeries_TestClass::testMeeusExample()
+{
+    LunarSeries series(1000);
+    ASSERT_EQUALM("Longitude terms", std::size_t(60), series.getNumLongitudeTerms());
+    ASSERT_EQUALM("Latitude terms", std::size_t(30), series.getNumLatitudeTerms());
+
+    // Meeus Example 47.a, 1992 April 12 0h TD
+    MoonPosition moon = series.calculatePosition(JulianDate(2448724.5));
+    spaTestFloatingPointEqual("Longitude", 133.162655, moon.eclipticLongitude, 1e-4);
+    spaTestFloatingPointEqual("Latitude", -3.229126, moon.eclipticLatitude, 1e-3);
+    spaTestFloatingPointEqual("Distance", 368409.7, moon.distance, 1.0);
+}
+
+void LunarSeries_TestClass::testTruncation()
+{
+    LunarSeries complete(1000);
+    LunarSeries standard;
+    ASSERT_EQUALM("Default longitude terms", SPA_MOON_SERIES_DEFAULT_TERMS, standard.getNumLongitudeTerms());
+    ASSERT_EQUALM("Default latitude terms", SPA_MOON_SERIES_DEFAULT_TERMS, standard.getNumLatitudeTerms());
+
+    double longitudeError;
+    double latitudeError;
+    double distanceError;
+    compareSeries(complete, standard, longitudeError, latitudeError, distanceError);
+    ASSERT_EQUAL_DELTAM("Default longitude error", 0.0, longitudeError, 0.035);
+    ASSERT_EQUAL_DELTAM("Default latitude error", 0.0, latitudeError, 0.015);
+    ASSERT_EQUAL_DELTAM("Default distance error", 0.0, distanceError, 150.0);
+
+    // Keeping fewer terms must make things worse, not better.
+    LunarSeries coarse(8);
+    double coarseLongitudeError;
+    double coarseLatitudeError;
+    double coarseDistanceError;
+    compareSeries(complete, coarse, coarseLongitudeError, coarseLatitudeError, coarseDistanceError);
+    ASSERTM("Coarse longitude worse", coarseLongitudeError > longitudeError);
+    ASSERTM("Coarse latitude worse", coarseLatitudeError > latitudeError);
+    ASSERTM("Coarse distance worse", coarseDistanceError > distanceError);
+    ASSERT_EQUAL_DELTAM("Coarse longitude error", 0.0, coarseLongitudeError, 0.3);
+
+    LunarSeries empty(0);
+    MoonPosition mean = empty.calculatePosition(2451545.0);
+    spaTestFloatingPointEqual("No terms gives mean longitude", 218.3164477, mean.eclipticLongitude, 1e-7);
+    spaTestFloatingPointEqual("No terms gives mean distance", 385000.56, mean.distance, 1e-6);
+}
+
+void LunarSeries_TestClass::testBatchMatchesScalar()
+{
+    LunarSeries series;
+    std::vector<double> days;
+    for (int index = 0; index < 200; index++)
+    {
+        days.push_back(2440000.0 + 91.7 * index);
+    }
+
+    MoonPositionArrays positions;
+    series.calculatePositions(days.data(), days.size(), positions);
+    ASSERT_EQUALM("Batch size", days.size(), positions.size());
+    for (std::size_t index = 0; index < days.size(); index++)
+    {
+        MoonPosition expected = series.calculatePosition(days[index]);
+        ASSERT_EQUAL_DELTAM("Longitude", expected.eclipticLongitude, positions.eclipticLongitude[index], 0.0);
+        ASSERT_EQUAL_DELTAM("Latitude", expected.eclipticLatitude, positions.eclipticLatitude[index], 0.0);
+        ASSERT_EQUAL_DELTAM("Distance", expected.distance, positions.distance[index], 0.0);
+        ASSERTM("Longitude in [0, 360)",
+                positions.eclipticLongitude[index] >= 0.0 && positions.eclipticLongitude[index] < 360.0);
+    }
+}
+
+void LunarSeries_TestClass::testAgreesWithSection65()
+{
+    LunarSeries series;
+    for (int index = 0; index < 400; index++)
+    {
+        JulianDate jd(2451545.0 + 27.3 * index);
+        MoonPosition fast = series.calculatePosition(jd);
+        MoonPosition pawyc = MOON_UTIL::calculateMoonPosition(jd);
+        ASSERT_EQUAL_DELTAM("Longitude", 0.0, angleDifference(fast.eclipticLongitude, pawyc.eclipticLongitude), 0.25);
+        ASSERT_EQUAL_DELTAM("Latitude", fast.eclipticLatitude, pawyc.eclipticLatitude, 0.2);
+        ASSERT_EQUAL_DELTAM("Distance", fast.distance, pawyc.distance, 7500.0);
+    }
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
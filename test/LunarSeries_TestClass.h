@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file LunarSeries_TestClass.h
+ * @brief Declaration of the CUTE test class for LunarSeries
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_LUNARSERIES_TESTCLASS_H_
+#define TEST_LUNARSERIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for LunarSeries
+ * @ingroup group_test
+ */
+class LunarSeries_TestClass
+{
+    public:
+        /// Default constructor
+        LunarSeries_TestClass() = default;
+
+        /// Default destructor
+        virtual ~LunarSeries_TestClass() = default;
+
+        /**
+         * Tests the complete series against Meeus Example 47.a.
+         */
+        void testMeeusExample();
+
+        /**
+         * Tests the accuracy of truncated series against the complete
+         * series.
+         */
+        void testTruncation();
+
+        /**
+         * Tests that the batch interface matches the scalar interface.
+         */
+        void testBatchMatchesScalar();
+
+        /**
+         * Tests that the default series agrees with MOON_UTIL within
+         * the accuracy of the Section 65 method.
+         */
+        void testAgreesWithSection65();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(LunarSeries_TestClass, testMeeusExample);
+            aSuite += CUTE_SMEMFUN(LunarSeries_TestClass, testTruncation);
+            aSuite += CUTE_SMEMFUN(LunarSeries_TestClass, testBatchMatchesScalar);
+            aSuite += CUTE_SMEMFUN(LunarSeries_TestClass, testAgreesWithSection65);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_LUNARSERIES_TESTCLASS_H_ */
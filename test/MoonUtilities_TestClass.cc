@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MoonUtilities_TestClass.cc
+ * @brief Definition of MoonUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "MoonUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "MoonUtilities.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void MoonUtilities_TestClass::testMoonPosition()
+{
+    // Reference values from an independent implementation of Sections 65 and 69.
+    MoonPosition moon = MOON_UTIL::calculateMoonPosition(JulianDate(2448724.5));
+    spaTestFloatingPointEqual("1992-04-12 longitude", 133.193134, moon.eclipticLongitude, 1e-5);
+    spaTestFloatingPointEqual("1992-04-12 latitude", -3.240031, moon.eclipticLatitude, 1e-5);
+    spaTestFloatingPointEqual("1992-04-12 distance", 363348.62, moon.distance, 0.01);
+
+    // Meeus Example 47.a, ELP-2000: 133.162655, -3.229126, 368409.7 km
+    spaTestFloatingPointEqual("1992-04-12 longitude vs Meeus", 133.162655, moon.eclipticLongitude, 0.05);
+    spaTestFloatingPointEqual("1992-04-12 latitude vs Meeus", -3.229126, moon.eclipticLatitude, 0.02);
+    spaTestFloatingPointEqual("1992-04-12 distance vs Meeus", 368409.7, moon.distance, 6000.0);
+
+    // Angular size and parallax scale inversely with distance.
+    spaTestFloatingPointEqual("Angular size",
+                              0.5181 * 384401.0 / moon.distance,
+                              moon.angularSize,
+                              1e-12);
+    spaTestFloatingPointEqual("Horizontal parallax",
+                              0.9507 * 384401.0 / moon.distance,
+                              moon.horizontalParallax,
+                              1e-12);
+}
+
+void MoonUtilities_TestClass::testBatchMatchesScalar()
+{
+    std::vector<double> days;
+    for (int index = 0; index < 200; index++)
+    {
+        days.push_back(2451545.0 + 3.71 * index);
+    }
+
+    MoonPositionArrays positions;
+    MOON_UTIL::calculateMoonPositions(days.data(), days.size(), positions);
+    ASSERT_EQUALM("Batch size", days.size(), positions.size());
+    for (std::size_t index = 0; index < days.size(); index++)
+    {
+        MoonPosition expected = MOON_UTIL::calculateMoonPosition(JulianDate(days[index]));
+        MoonPosition actual = positions.at(index);
+        ASSERT_EQUAL_DELTAM("Longitude", expected.eclipticLongitude, actual.eclipticLongitude, 0.0);
+        ASSERT_EQUAL_DELTAM("Latitude", expected.eclipticLatitude, actual.eclipticLatitude, 0.0);
+        ASSERT_EQUAL_DELTAM("Distance", expected.distance, actual.distance, 0.0);
+        ASSERT_EQUAL_DELTAM("Angular size", expected.angularSize, actual.angularSize, 0.0);
+        ASSERT_EQUAL_DELTAM("Parallax", expected.horizontalParallax, actual.horizontalParallax, 0.0);
+    }
+}
+
+void MoonUtilities_TestClass::testHourlyMotion()
+{
+    MoonHourlyMotion motion = MOON_UTIL::calculateMoonHourlyMotion(JulianDate(2448724.5));
+    spaTestFloatingPointEqual("1992-04-12 longitude motion", 0.593566, motion.longitude, 1e-5);
+    spaTestFloatingPointEqual("1992-04-12 latitude motion", -0.041585, motion.latitude, 1e-5);
+
+    // The motion is always prograde, and averages 13.18 degrees a day.
+    double sum = 0.0;
+    int count = 0;
+    for (double jd = 2451545.0; jd < 2451545.0 + 27.32 * 12; jd += 0.25)
+    {
+        MoonHourlyMotion hourly = MOON_UTIL::calculateMoonHourlyMotion(JulianDate(jd));
+        ASSERTM("Longitude motion in range", hourly.longitude > 0.45 && hourly.longitude < 0.70);
+        ASSERTM("Latitude motion in range", std::fabs(hourly.latitude) < 0.07);
+        sum += hourly.longitude;
+        count++;
+    }
+    spaTestFloatingPointEqual("Mean longitude motion", 13.1764 / 24.0, sum / count, 0.005);
+}
+
+void MoonUtilities_TestClass::testAgeAndPhase()
+{
+    // Total solar eclipse, 1979-02-26 16:55 UT
+    JulianDate solarEclipse(1979, 2, 26, 16, 55, 0);
+    double age = MOON_UTIL::calculateMoonAge(solarEclipse);
+    ASSERTM("Age near zero at solar eclipse", age < 0.5 || age > 359.5);
+    spaTestFloatingPointEqual("Phase at solar eclipse", 0.0, MOON_UTIL::calculateMoonPhase(solarEclipse), 1e-4);
+
+    // Total lunar eclipse, 2022-11-08 11:00 UT
+    JulianDate lunarEclipse(2022, 11, 8, 11, 0, 0);
+    spaTestFloatingPointEqual("Age at lunar eclipse", 180.0, MOON_UTIL::calculateMoonAge(lunarEclipse), 0.5);
+    spaTestFloatingPointEqual("Phase at lunar eclipse", 1.0, MOON_UTIL::calculateMoonPhase(lunarEclipse), 1e-4);
+
+    // Four days after new Moon of 2022-11-23
+    JulianDate crescent(2022, 11, 27, 0, 0, 0);
+    spaTestFloatingPointEqual("Age of crescent", 41.7175, MOON_UTIL::calculateMoonAge(crescent), 1e-3);
+    spaTestFloatingPointEqual("Phase of crescent", 0.12678, MOON_UTIL::calculateMoonPhase(crescent), 1e-4);
+}
+
+void MoonUtilities_TestClass::testBrightLimbAngle()
+{
+    // A waxing Moon's bright limb faces the Sun in the west, a waning
+    // Moon's faces east.
+    double waxing = MOON_UTIL::calculateMoonBrightLimbAngle(JulianDate(2022, 11, 27, 0, 0, 0));
+    spaTestFloatingPointEqual("Waxing crescent limb angle", 267.920, waxing, 0.01);
+    double waning = MOON_UTIL::calculateMoonBrightLimbAngle(JulianDate(2022, 11, 12, 0, 0, 0));
+    spaTestFloatingPointEqual("Waning gibbous limb angle", 85.529, waning, 0.01);
+
+    for (double jd = 2451545.0; jd < 2451545.0 + 365.0; jd += 1.1)
+    {
+        double angle = MOON_UTIL::calculateMoonBrightLimbAngle(JulianDate(jd));
+        ASSERTM("Angle in [0, 360)", angle >= 0.0 && angle < 360.0);
+    }
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
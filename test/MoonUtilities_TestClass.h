@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file MoonUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for MoonUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_MOONUTILITIES_TESTCLASS_H_
+#define TEST_MOONUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for MoonUtilities
+ * @ingroup group_test
+ */
+class MoonUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        MoonUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~MoonUtilities_TestClass() = default;
+
+        /**
+         * Tests the Section 65 and 69 position against reference values.
+         */
+        void testMoonPosition();
+
+        /**
+         * Tests that the batch interface matches the scalar interface.
+         */
+        void testBatchMatchesScalar();
+
+        /**
+         * Tests the Section 66 hourly motions.
+         */
+        void testHourlyMotion();
+
+        /**
+         * Tests the age and Section 67 phase at eclipses.
+         */
+        void testAgeAndPhase();
+
+        /**
+         * Tests the Section 68 position-angle of the bright limb.
+         */
+        void testBrightLimbAngle();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(MoonUtilities_TestClass, testMoonPosition);
+            aSuite += CUTE_SMEMFUN(MoonUtilities_TestClass, testBatchMatchesScalar);
+            aSuite += CUTE_SMEMFUN(MoonUtilities_TestClass, testHourlyMotion);
+            aSuite += CUTE_SMEMFUN(MoonUtilities_TestClass, testAgeAndPhase);
+            aSuite += CUTE_SMEMFUN(MoonUtilities_TestClass, testBrightLimbAngle);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_MOONUTILITIES_TESTCLASS_H_ */
@@ -31,6 +31,13 @@
 #include "JulianDate.h"
 #include "DateAndTime.h"
 #include "TimeDifference.h"
+#include "SunUtilities.h"
+#include "CoordinateUtilities.h"
+#include "RiseSetUtilities.h"
+#include "MoonUtilities.h"
+#include "BinaryStarUtilities.h"
+
+#include <vector>
 
 namespace SPA
 {
@@ -209,5 +216,217 @@ void PAWYC_Examples_TestClass::example6_DayOfWeek()
     return;
 }
 
+void PAWYC_Examples_TestClass::example12_GreenwichSiderealTime()
+{
+    JulianDate jd(1980, 4, 22, 14, 36, 51.67, 0);
+    double expectedGST = TIME_UTIL::calculateDecimalHours(4, 40, 5.23);
+    spaTestFloatingPointEqual("GST on 1980-04-22 14:36:51.67 UT",
+                              expectedGST,
+                              TIME_UTIL::calculateGreenwichSiderealTime(jd),
+                              1.0e-6,
+                              6);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example14_LocalSiderealTime()
+{
+    double gst = TIME_UTIL::calculateDecimalHours(4, 40, 5.23);
+    double expectedLST = TIME_UTIL::calculateDecimalHours(0, 24, 5.23);
+    spaTestFloatingPointEqual("LST at longitude 64 W",
+                              expectedLST,
+                              TIME_UTIL::calculateLocalSiderealTime(gst, -64.0),
+                              1.0e-9,
+                              6);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example25_EquatorialToHorizon()
+{
+    double hourAngle = TIME_UTIL::calculateDecimalHours(5, 51, 44);
+    double declination = 23.0 + 13.0 / 60.0 + 10.0 / 3600.0;
+    HorizonCoordinates horizon = COORD_UTIL::convertEquatorialToHorizon(hourAngle, declination, 52.0);
+    spaTestFloatingPointEqual("Altitude",
+                              19.0 + 20.0 / 60.0 + 3.64 / 3600.0,
+                              horizon.altitude,
+                              1.0e-5,
+                              6);
+    spaTestFloatingPointEqual("Azimuth",
+                              283.0 + 16.0 / 60.0 + 15.70 / 3600.0,
+                              horizon.azimuth,
+                              1.0e-5,
+                              6);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example27_EclipticToEquatorial()
+{
+    JulianDate jd(2009, 7, 6, 0, 0, 0, 0);
+    double obliquity = COORD_UTIL::calculateMeanObliquity(jd);
+    EquatorialCoordinates equatorial = COORD_UTIL::convertEclipticToEquatorial(
+                    139.0 + 41.0 / 60.0 + 10.0 / 3600.0,
+                    4.0 + 52.0 / 60.0 + 31.0 / 3600.0,
+                    obliquity);
+    spaTestFloatingPointEqual("Right ascension",
+                              TIME_UTIL::calculateDecimalHours(9, 34, 53.4),
+                              equatorial.rightAscension,
+                              1.0e-4,
+                              4);
+    spaTestFloatingPointEqual("Declination",
+                              19.0 + 32.0 / 60.0 + 8.5 / 3600.0,
+                              equatorial.declination,
+                              1.0e-3,
+                              3);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example46_SunPosition()
+{
+    double tolerance = 1.0e-3;
+    int digits = 4;
+    JulianDate jd(1988, 7, 27, 0, 0, 0, 0);
+    SunPosition sun = SPA::SUN_UTIL::calculateSunPosition(jd);
+    spaTestFloatingPointEqual("Ecliptic longitude of the Sun on 1988-07-27 00:00:00 UT",
+                              124.1877,
+                              sun.eclipticLongitude,
+                              tolerance,
+                              digits);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example48_SunDistanceAndAngularSize()
+{
+    JulianDate jd(1988, 7, 27, 0, 0, 0, 0);
+    SunPosition sun = SPA::SUN_UTIL::calculateSunPosition(jd);
+    spaTestFloatingPointEqual("Distance to the Sun on 1988-07-27 00:00:00 UT",
+                              1.519e8,
+                              sun.distance,
+                              1.0e5,
+                              0);
+    spaTestFloatingPointEqual("Angular size of the Sun on 1988-07-27 00:00:00 UT",
+                              0.5250,
+                              sun.angularSize,
+                              1.0e-4,
+                              4);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example49_SunriseAndSunset()
+{
+    GeographicCoordinates boston = {42.37, -71.05};
+    JulianDate start(1986, 3, 10, 0, 0, 0, 0);
+    JulianDate end(1986, 3, 11, 0, 0, 0, 0);
+    std::vector<SolarEvent> events;
+    RISESET_UTIL::findSolarEvents(boston, start, end, events);
+
+    double sunrise = 0;
+    double sunset = 0;
+    for (const SolarEvent& event : events)
+    {
+        double hours = (event.julianDays - start.getDecimalDays()) * 24.0;
+        if (event.type == SolarEventType::Sunrise)
+        {
+            sunrise = hours;
+        }
+        else if (event.type == SolarEventType::Sunset)
+        {
+            sunset = hours;
+        }
+    }
+
+    // One minute tolerance.
+    double tolerance = 1.0 / 60.0;
+    spaTestFloatingPointEqual("Sunrise at Boston on 1986-03-10, UT hours",
+                              TIME_UTIL::calculateDecimalHours(11, 5, 0),
+                              sunrise,
+                              tolerance,
+                              2);
+    spaTestFloatingPointEqual("Sunset at Boston on 1986-03-10, UT hours",
+                              TIME_UTIL::calculateDecimalHours(22, 45, 0),
+                              sunset,
+                              tolerance,
+                              2);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example50_Twilight()
+{
+    GeographicCoordinates boston = {42.37, -71.05};
+    JulianDate start(1986, 3, 10, 6, 0, 0, 0);
+    JulianDate end(1986, 3, 11, 6, 0, 0, 0);
+    std::vector<SolarEvent> events;
+    RISESET_UTIL::findSolarEvents(boston, start, end, events);
+
+    // Expect exactly one of each event, in dawn-to-dusk order.
+    ASSERT_EQUALM("Number of events", std::size_t(8), events.size());
+    ASSERT_EQUALM("First event", static_cast<int>(SolarEventType::AstronomicalDawn),
+                  static_cast<int>(events.front().type));
+    ASSERT_EQUALM("Last event", static_cast<int>(SolarEventType::AstronomicalDusk),
+                  static_cast<int>(events.back().type));
+
+    JulianDate midnight(1986, 3, 10, 0, 0, 0, 0);
+    double tolerance = 1.0 / 60.0;
+    spaTestFloatingPointEqual("Start of morning astronomical twilight, UT hours",
+                              TIME_UTIL::calculateDecimalHours(9, 32, 0),
+                              (events.front().julianDays - midnight.getDecimalDays()) * 24.0,
+                              tolerance,
+                              2);
+    spaTestFloatingPointEqual("End of evening astronomical twilight, UT hours",
+                              TIME_UTIL::calculateDecimalHours(24, 18, 0),
+                              (events.back().julianDays - midnight.getDecimalDays()) * 24.0,
+                              tolerance,
+                              2);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example51_EquationOfTime()
+{
+    JulianDate jd(1988, 7, 27, 0, 0, 0, 0);
+    spaTestFloatingPointEqual("Equation of time on 1988-07-27, minutes",
+                              -6.5,
+                              SUN_UTIL::calculateEquationOfTime(jd) * 60.0,
+                              0.05,
+                              2);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example63_BinaryStarOrbit()
+{
+    // 1980 January 0.0 is JD 2444238.5
+    BinaryStarElements etaCrB = {41.623, 1934.008, 0.2763, 0.907, 59.025, 219.907, 23.717};
+    BinaryStarPosition position = BINARYSTAR_UTIL::calculateBinaryStarPosition(etaCrB, JulianDate(2444238.5));
+    spaTestFloatingPointEqual("Position angle", 318.5, position.positionAngle, 0.2, 4);
+    spaTestFloatingPointEqual("Separation", 0.41, position.separation, 0.005, 2);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example65_MoonPosition()
+{
+    JulianDate jd(1979, 2, 26, 16, 0, 0, 0);
+    MoonPosition moon = MOON_UTIL::calculateMoonPosition(jd);
+    spaTestFloatingPointEqual("Moon longitude", 337.0011, moon.eclipticLongitude, 0.001, 7);
+    spaTestFloatingPointEqual("Moon latitude", 0.9928, moon.eclipticLatitude, 0.001, 4);
+
+    SunPosition sun = SUN_UTIL::calculateSunPosition(jd);
+    spaTestFloatingPointEqual("Moon near Sun", sun.eclipticLongitude, moon.eclipticLongitude, 0.5, 4);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example67_MoonPhase()
+{
+    JulianDate jd(1979, 2, 26, 16, 0, 0, 0);
+    spaTestFloatingPointEqual("Moon phase", 0.0, MOON_UTIL::calculateMoonPhase(jd), 1e-4, 4);
+    return;
+}
+
+void PAWYC_Examples_TestClass::example69_MoonDistance()
+{
+    JulianDate jd(1979, 2, 26, 16, 0, 0, 0);
+    MoonPosition moon = MOON_UTIL::calculateMoonPosition(jd);
+    spaTestFloatingPointEqual("Moon distance, km", 364605.0, moon.distance, 1.0, 7);
+    spaTestFloatingPointEqual("Moon angular size", 0.5462, moon.angularSize, 1e-4, 4);
+    spaTestFloatingPointEqual("Moon horizontal parallax", 1.0023, moon.horizontalParallax, 1e-4, 5);
+    return;
+}
+
 } /* namespace TEST */
 } /* namespace SPA */
@@ -107,6 +107,119 @@ class PAWYC_Examples_TestClass
          */
         void example6_DayOfWeek();
 
+        /**
+         * @brief Example of Section 12, converting UT to GST.
+         *
+         * On 1980 April 22 at 14h 36m 51.67s UT the GST is
+         * 4h 40m 5.23s.
+         */
+        void example12_GreenwichSiderealTime();
+
+        /**
+         * @brief Example of Section 14, calculating the LST.
+         *
+         * At longitude 64 degrees west, a GST of 4h 40m 5.23s
+         * corresponds to an LST of 0h 24m 5.23s.
+         */
+        void example14_LocalSiderealTime();
+
+        /**
+         * @brief Example of Section 25, converting equatorial to
+         *   horizon coordinates.
+         *
+         * An object at hour angle 5h 51m 44s and declination
+         * +23 13' 10" seen from latitude 52 degrees north has altitude
+         * 19 20' 03.64" and azimuth 283 16' 15.70".
+         */
+        void example25_EquatorialToHorizon();
+
+        /**
+         * @brief Example of Section 27, converting ecliptic to
+         *   equatorial coordinates.
+         *
+         * On 2009 July 6 the ecliptic position 139 41' 10",
+         * +4 52' 31" corresponds to right ascension 9h 34m 53.4s and
+         * declination +19 32' 8.5".
+         */
+        void example27_EclipticToEquatorial();
+
+        /**
+         * @brief Example of Sections 46 and 47, calculating the position
+         *   of the Sun.
+         *
+         * On 1988 July 27 at 0h UT the ecliptic longitude of the Sun
+         * is 124.1877 degrees.
+         */
+        void example46_SunPosition();
+
+        /**
+         * @brief Example of Section 48, calculating the Sun's distance
+         *   and angular size.
+         *
+         * On 1988 July 27 at 0h UT the Sun is 1.519e8 km away and
+         * subtends 0.5250 degrees.
+         */
+        void example48_SunDistanceAndAngularSize();
+
+        /**
+         * @brief Example of Section 49, sunrise and sunset.
+         *
+         * At Boston (42.37 N, 71.05 W) on 1986 March 10 the Sun rises at
+         * about 11h 05m UT and sets at about 22h 45m UT.
+         */
+        void example49_SunriseAndSunset();
+
+        /**
+         * @brief Example of Section 50, twilight.
+         *
+         * At Boston on 1986 March 10 morning astronomical twilight
+         * begins at about 9h 32m UT and evening astronomical twilight
+         * ends at about 0h 18m UT on March 11.
+         */
+        void example50_Twilight();
+
+        /**
+         * @brief Example of Section 51, the equation of time.
+         *
+         * On 1988 July 27 the equation of time is about -6m 30s,
+         * i.e. a sundial is six and a half minutes behind the clock.
+         */
+        void example51_EquationOfTime();
+
+        /**
+         * @brief Example of Section 63, binary-star orbits.
+         *
+         * On 1980 January 0.0 the companion of eta Coronae Borealis is
+         * at position angle 318.5 degrees and separation 0.41
+         * arcseconds.
+         */
+        void example63_BinaryStarOrbit();
+
+        /**
+         * @brief Example of Section 65, the position of the Moon.
+         *
+         * At 1979 February 26 16h UT, during a total solar eclipse,
+         * the Moon is at longitude 337.0 and latitude +1.0 degrees,
+         * within a few tenths of a degree of the Sun.
+         */
+        void example65_MoonPosition();
+
+        /**
+         * @brief Example of Section 67, the phases of the Moon.
+         *
+         * At the same eclipse the Moon is new, with phase zero.
+         */
+        void example67_MoonPhase();
+
+        /**
+         * @brief Example of Section 69, the Moon's distance, angular
+         *   size and horizontal parallax.
+         *
+         * At 1979 February 26 16h UT the Moon is 364600 km away, with
+         * angular diameter 0.546 degrees and parallax 1.002 degrees.
+         */
+        void example69_MoonDistance();
+
         /**
          * Adds all methods that run this class's unit tests to the given cute suite.
          *
@@ -119,6 +232,19 @@ class PAWYC_Examples_TestClass
             aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example4_JulianDate);
             aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example5_JulianDateToCalendarDate);
             aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example6_DayOfWeek);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example12_GreenwichSiderealTime);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example14_LocalSiderealTime);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example25_EquatorialToHorizon);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example27_EclipticToEquatorial);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example46_SunPosition);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example48_SunDistanceAndAngularSize);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example49_SunriseAndSunset);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example50_Twilight);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example51_EquationOfTime);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example63_BinaryStarOrbit);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example65_MoonPosition);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example67_MoonPhase);
+            aSuite += CUTE_SMEMFUN(PAWYC_Examples_TestClass, example69_MoonDistance);
         }
     private:
 };
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetOrbit_TestClass.cc
+ * @brief Definition of PlanetOrbit_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "PlanetOrbit_TestClass.h"
+#include "PlanetOrbit.h"
+#include "SpaPlanetConstants.h"
+#include "SpaTimeConstants.h"
+#include "SpaConstants.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void PlanetOrbit_TestClass::testOrbitGeometry()
+{
+    for (int planet = MERCURY; planet <= NEPTUNE; planet++)
+    {
+        const PlanetaryElements& elements = SPA_PLANETARY_ELEMENTS_1990[planet];
+        PlanetOrbit orbit(elements);
+
+        // Sample one full orbit finely.
+        double periodDays = elements.period * SPA_DAYS_IN_TROPICAL_YEAR;
+        const std::size_t count = 20000;
+        std::vector<double> times(count);
+        for (std::size_t index = 0; index < count; index++)
+        {
+            times[index] = SPA_PLANET_EPOCH_1990 + periodDays * double(index) / double(count);
+        }
+        std::vector<double> x(count);
+        std::vector<double> y(count);
+        std::vector<double> z(count);
+        orbit.calculateHeliocentricPositions(times.data(), count, x.data(), y.data(), z.data());
+
+        double minRadius = 1.0e30;
+        double maxRadius = 0.0;
+        double maxLatitude = 0.0;
+        for (std::size_t index = 0; index < count; index++)
+        {
+            double radius = std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index]);
+            minRadius = std::min(minRadius, radius);
+            maxRadius = std::max(maxRadius, radius);
+            maxLatitude = std::max(maxLatitude, std::asin(z[index] / radius) * SPA_RADIANS_TO_DEGREES);
+        }
+        double a = elements.semiMajorAxis;
+        double e = elements.eccentricity;
+        ASSERT_EQUAL_DELTAM("Perihelion distance", a * (1.0 - e), minRadius, 1.0e-6 * a);
+        ASSERT_EQUAL_DELTAM("Aphelion distance", a * (1.0 + e), maxRadius, 1.0e-6 * a);
+        ASSERT_EQUAL_DELTAM("Maximum latitude", elements.inclination, maxLatitude, 1.0e-3);
+    }
+    return;
+}
+
+void PlanetOrbit_TestClass::testOrbitalPeriod()
+{
+    const PlanetaryElements& elements = SPA_PLANETARY_ELEMENTS_1990[MARS];
+    PlanetOrbit orbit(elements);
+    double x0, y0, z0, x1, y1, z1;
+    double start = 2451545.0;
+    orbit.calculateHeliocentricPosition(start, x0, y0, z0);
+    orbit.calculateHeliocentricPosition(start + elements.period * SPA_DAYS_IN_TROPICAL_YEAR, x1, y1, z1);
+    ASSERT_EQUAL_DELTAM("x after one period", x0, x1, 1.0e-9);
+    ASSERT_EQUAL_DELTAM("y after one period", y0, y1, 1.0e-9);
+    ASSERT_EQUAL_DELTAM("z after one period", z0, z1, 1.0e-9);
+
+    // The default orbit is a circle of radius 1 AU in the ecliptic.
+    PlanetOrbit circle;
+    circle.calculateHeliocentricPosition(start + 12.3, x0, y0, z0);
+    ASSERT_EQUAL_DELTAM("Default orbit radius", 1.0, std::sqrt(x0 * x0 + y0 * y0), 1.0e-12);
+    ASSERT_EQUAL_DELTAM("Default orbit z", 0.0, z0, 1.0e-12);
+    return;
+}
+
+void PlanetOrbit_TestClass::testBatchMatchesScalar()
+{
+    PlanetOrbit orbit(SPA_PLANETARY_ELEMENTS_1990[MERCURY]);
+    const std::size_t count = 300;
+    std::vector<double> times(count);
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    for (std::size_t index = 0; index < count; index++)
+    {
+        times[index] = 2440000.0 + 17.3 * double(index);
+    }
+    orbit.calculateHeliocentricPositions(times.data(), count, x.data(), y.data(), z.data());
+    for (std::size_t index = 0; index < count; index++)
+    {
+        double xs, ys, zs;
+        orbit.calculateHeliocentricPosition(times[index], xs, ys, zs);
+        ASSERT_EQUALM("Batch x", xs, x[index]);
+        ASSERT_EQUALM("Batch y", ys, y[index]);
+        ASSERT_EQUALM("Batch z", zs, z[index]);
+    }
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
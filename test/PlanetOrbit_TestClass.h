@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetOrbit_TestClass.h
+ * @brief Declaration of the CUTE test class for PlanetOrbit
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_PLANETORBIT_TESTCLASS_H_
+#define TEST_PLANETORBIT_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for PlanetOrbit
+ * @ingroup group_test
+ */
+class PlanetOrbit_TestClass
+{
+    public:
+        /// Default constructor
+        PlanetOrbit_TestClass() = default;
+
+        /// Default destructor
+        virtual ~PlanetOrbit_TestClass() = default;
+
+        /**
+         * Tests that the orbit reaches the perihelion and aphelion
+         * distances and the maximum ecliptic latitude implied by its elements.
+         */
+        void testOrbitGeometry();
+
+        /**
+         * Tests that the planet returns to the same place after one
+         * orbital period.
+         */
+        void testOrbitalPeriod();
+
+        /**
+         * Tests that the batch interface gives the same answers as
+         * the scalar interface.
+         */
+        void testBatchMatchesScalar();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(PlanetOrbit_TestClass, testOrbitGeometry);
+            aSuite += CUTE_SMEMFUN(PlanetOrbit_TestClass, testOrbitalPeriod);
+            aSuite += CUTE_SMEMFUN(PlanetOrbit_TestClass, testBatchMatchesScalar);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_PLANETORBIT_TESTCLASS_H_ */
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetUtilities_TestClass.cc
+ * @brief Definition of PlanetUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "PlanetUtilities_TestClass.h"
+#include "PlanetUtilities.h"
+#include "PlanetEventGenerator.h"
+#include "SunUtilities.h"
+#include "SpaPlanetConstants.h"
+#include "AngleUtilities.h"
+#include "SpaConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Signed difference between two angles in degrees, in [-180, 180).
+double angleDifference(double aFirst, double aSecond)
+{
+    return ANGLE_UTIL::normalizeDegrees(aFirst - aSecond + 180.0) - 180.0;
+}
+
+} // end anonymous namespace
+
+void PlanetUtilities_TestClass::testOppositions()
+{
+    // Dates and geocentric distances of oppositions from published
+    // almanacs. At opposition the planet is 180 degrees from the Sun in
+    // ecliptic longitude. The 1990 elements of the outermost planets
+    // have drifted by a degree or two by the 2020s.
+    struct Opposition
+    {
+        Planets planet;
+        JulianDate date;
+        double distance;
+        double tolerance;
+    };
+    std::vector<Opposition> oppositions = {
+        {MARS, JulianDate(2003, 8, 28, 18, 0, 0, 0), 0.3727, 1.0},
+        {JUPITER, JulianDate(2022, 9, 26, 20, 0, 0, 0), 3.953, 1.0},
+        {SATURN, JulianDate(2023, 8, 27, 8, 0, 0, 0), 8.774, 1.0},
+        {URANUS, JulianDate(2023, 11, 13, 17, 0, 0, 0), 18.62, 2.0},
+        {NEPTUNE, JulianDate(2023, 9, 19, 11, 0, 0, 0), 28.91, 2.0}};
+
+    for (const Opposition& opposition : oppositions)
+    {
+        PlanetPosition planet = PLANET_UTIL::calculatePlanetPosition(opposition.planet, opposition.date);
+        double sunLongitude = SUN_UTIL::calculateSunEclipticLongitude(opposition.date);
+        ASSERT_EQUAL_DELTAM("Opposition longitude",
+                            0.0,
+                            angleDifference(planet.eclipticLongitude, sunLongitude + 180.0),
+                            opposition.tolerance);
+        ASSERT_EQUAL_DELTAM("Opposition distance",
+                            opposition.distance,
+                            planet.distance,
+                            0.01 * opposition.distance);
+    }
+    return;
+}
+
+void PlanetUtilities_TestClass::testElongations()
+{
+    struct Elongation
+    {
+        Planets planet;
+        JulianDate date;
+        double elongation;
+    };
+    std::vector<Elongation> elongations = {
+        {VENUS, JulianDate(2023, 6, 4, 11, 0, 0, 0), 45.4},
+        {MERCURY, JulianDate(2024, 3, 24, 23, 0, 0, 0), 18.7}};
+
+    for (const Elongation& elongation : elongations)
+    {
+        // Solve the Sun-Earth-planet triangle so that the Earth's orbit
+        // from Table 8 is used throughout.
+        PlanetPosition planet = PLANET_UTIL::calculatePlanetPosition(elongation.planet, elongation.date);
+        PlanetPosition earth = PLANET_UTIL::calculatePlanetPosition(EARTH, elongation.date);
+        double cosElongation = (earth.radiusVector * earth.radiusVector
+                                + planet.distance * planet.distance
+                                - planet.radiusVector * planet.radiusVector)
+                        / (2.0 * earth.radiusVector * planet.distance);
+        double computed = std::acos(cosElongation) * SPA_RADIANS_TO_DEGREES;
+        ASSERT_EQUAL_DELTAM("Greatest elongation", elongation.elongation, computed, 0.3);
+    }
+    return;
+}
+
+void PlanetUtilities_TestClass::testLightTimeAndAngularSize()
+{
+    JulianDate jd(2026, 10, 18, 0, 0, 0, 0);
+    for (int planet = MERCURY; planet <= NEPTUNE; planet++)
+    {
+        PlanetPosition position = PLANET_UTIL::calculatePlanetPosition(Planets(planet), jd);
+        if (planet == EARTH)
+        {
+            ASSERT_EQUAL_DELTAM("Earth distance", 0.0, position.distance, 0.0);
+            ASSERT_EQUAL_DELTAM("Earth radius vector", 1.0, position.radiusVector, 0.02);
+            continue;
+        }
+        ASSERT_EQUAL_DELTAM("Light time",
+                            SPA_LIGHT_TIME_DAYS_PER_AU * position.distance,
+                            position.lightTime,
+                            1.0e-12);
+        ASSERT_EQUAL_DELTAM("Angular size",
+                            SPA_PLANETARY_ELEMENTS_1990[planet].angularDiameterAt1AU / position.distance,
+                            position.angularSize,
+                            1.0e-12);
+        ASSERTM("Heliocentric latitude within inclination",
+                std::fabs(position.heliocentricLatitude) <= SPA_PLANETARY_ELEMENTS_1990[planet].inclination + 1.0e-9);
+    }
+    return;
+}
+
+void PlanetUtilities_TestClass::testGridMatchesScalar()
+{
+    std::vector<Planets> planets = {MERCURY, VENUS, MARS, JUPITER, SATURN, URANUS, NEPTUNE};
+    const std::size_t count = 144;
+    std::vector<double> julianDays(count);
+    for (std::size_t index = 0; index < count; index++)
+    {
+        julianDays[index] = 2461331.5 + double(index) / 144.0;
+    }
+
+    PlanetPositionArrays grid;
+    PLANET_UTIL::calculatePlanetPositionGrid(planets, julianDays.data(), count, grid);
+    ASSERT_EQUALM("Grid size", planets.size() * count, grid.size());
+
+    for (std::size_t planetIndex = 0; planetIndex < planets.size(); planetIndex++)
+    {
+        PlanetPositionArrays single;
+        PLANET_UTIL::calculatePlanetPositions(planets[planetIndex], julianDays.data(), count, single);
+        for (std::size_t index = 0; index < count; index += 11)
+        {
+            PlanetPosition scalar = PLANET_UTIL::calculatePlanetPosition(planets[planetIndex],
+                                                                         JulianDate(julianDays[index]));
+            PlanetPosition fromGrid = grid.at(planetIndex * count + index);
+            PlanetPosition fromSingle = single.at(index);
+            ASSERT_EQUALM("Grid longitude", scalar.eclipticLongitude, fromGrid.eclipticLongitude);
+            ASSERT_EQUALM("Grid latitude", scalar.eclipticLatitude, fromGrid.eclipticLatitude);
+            ASSERT_EQUALM("Grid distance", scalar.distance, fromGrid.distance);
+            ASSERT_EQUALM("Batch longitude", scalar.eclipticLongitude, fromSingle.eclipticLongitude);
+            ASSERT_EQUALM("Batch heliocentric longitude", scalar.heliocentricLongitude, fromSingle.heliocentricLongitude);
+        }
+    }
+    return;
+}
+
+void PlanetUtilities_TestClass::testPlanetEvents()
+{
+    // Times from an independent bisection search on the same PAWYC
+    // model. Real events differ from these by up to a day or so for the
+    // outer planets because perturbations are ignored.
+    struct Expected
+    {
+        Planets planet;
+        int year;
+        double julianDays;
+        PlanetEventType type;
+    };
+    std::vector<Expected> events = {
+        {MARS, 2003, 2452880.0248, PlanetEventType::Opposition},
+        {JUPITER, 2022, 2459643.9801, PlanetEventType::Conjunction},
+        {JUPITER, 2022, 2459849.2001, PlanetEventType::Opposition},
+        {VENUS, 2023, 2460169.9733, PlanetEventType::Conjunction},
+        {SATURN, 2023, 2459991.9825, PlanetEventType::Conjunction},
+        {SATURN, 2023, 2460183.6083, PlanetEventType::Opposition}};
+    double tolerance = 1.0e-3;
+    std::size_t index = 0;
+    while (index < events.size())
+    {
+        Planets planet = events[index].planet;
+        int year = events[index].year;
+        PlanetEventGenerator generator(planet, JulianDate(year, 1, 1, 0, 0, 0), JulianDate(year + 1, 1, 1, 0, 0, 0));
+        PlanetEvent event;
+        for (; index < events.size() && events[index].planet == planet; index++)
+        {
+            ASSERTM("Event found", generator.next(event));
+            ASSERTM("Planet", event.planet == planet);
+            ASSERTM("Type", event.type == events[index].type);
+            ASSERT_EQUAL_DELTAM("Time", events[index].julianDays, event.julianDays, tolerance);
+        }
+        ASSERTM("No further events", !generator.next(event));
+    }
+
+    // Mercury has six conjunctions in 2024, alternately inferior and
+    // superior.
+    const double mercury[] = {2460368.734, 2460412.325, 2460476.067, 2460541.448, 2460584.248, 2460650.472};
+    PlanetEventGenerator generator(MERCURY, JulianDate(2024, 1, 1, 0, 0, 0), JulianDate(2025, 1, 1, 0, 0, 0));
+    PlanetEvent event;
+    for (double expected : mercury)
+    {
+        ASSERTM("Mercury conjunction found", generator.next(event));
+        ASSERTM("Mercury conjunction type", event.type == PlanetEventType::Conjunction);
+        ASSERT_EQUAL_DELTAM("Mercury conjunction time", expected, event.julianDays, tolerance);
+    }
+    ASSERTM("No further Mercury events", !generator.next(event));
+
+    PlanetEventGenerator earth(EARTH, JulianDate(2024, 1, 1, 0, 0, 0), JulianDate(2025, 1, 1, 0, 0, 0));
+    ASSERTM("No events for the Earth", !earth.next(event));
+
+    std::ostringstream oss;
+    oss << PlanetEventType::Conjunction << ", " << PlanetEventType::Opposition;
+    ASSERT_EQUALM("Event names", std::string("Conjunction, Opposition"), oss.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
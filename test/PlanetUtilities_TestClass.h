@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file PlanetUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for PlanetUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_PLANETUTILITIES_TESTCLASS_H_
+#define TEST_PLANETUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for PlanetUtilities
+ * @ingroup group_test
+ */
+class PlanetUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        PlanetUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~PlanetUtilities_TestClass() = default;
+
+        /**
+         * Tests geocentric longitudes and distances of the outer
+         * planets at known oppositions.
+         */
+        void testOppositions();
+
+        /**
+         * Tests the elongations of Mercury and Venus at known greatest
+         * elongations.
+         */
+        void testElongations();
+
+        /**
+         * Tests the light-time and angular size against the
+         * distance.
+         */
+        void testLightTimeAndAngularSize();
+
+        /**
+         * Tests that the batch and grid interfaces give the same
+         * answers as the scalar interface.
+         */
+        void testGridMatchesScalar();
+
+        /**
+         * Tests the conjunctions and oppositions found by
+         * PlanetEventGenerator against an independent search, and its
+         * ostream operator.
+         */
+        void testPlanetEvents();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(PlanetUtilities_TestClass, testOppositions);
+            aSuite += CUTE_SMEMFUN(PlanetUtilities_TestClass, testElongations);
+            aSuite += CUTE_SMEMFUN(PlanetUtilities_TestClass, testLightTimeAndAngularSize);
+            aSuite += CUTE_SMEMFUN(PlanetUtilities_TestClass, testGridMatchesScalar);
+            aSuite += CUTE_SMEMFUN(PlanetUtilities_TestClass, testPlanetEvents);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_PLANETUTILITIES_TESTCLASS_H_ */
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file RiseSetUtilities_TestClass.cc
+ * @brief Definition of RiseSetUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "RiseSetUtilities_TestClass.h"
+#include "RiseSetUtilities.h"
+#include "MoonRiseSetSearch.h"
+#include "SunUtilities.h"
+#include "CoordinateUtilities.h"
+#include "TimeUtilities.h"
+#include "SpaSunConstants.h"
+#include "SpaMoonConstants.h"
+#include "SpaConstants.h"
+#include "JulianDate.h"
+
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Altitude of the Sun in degrees from the full solar theory.
+double sunAltitude(double aJulianDays, const GeographicCoordinates& aSite)
+{
+    JulianDate jd(aJulianDays);
+    SunPosition sun = SUN_UTIL::calculateSunPosition(jd);
+    EquatorialCoordinates equatorial = COORD_UTIL::convertEclipticToEquatorial(
+                    sun.eclipticLongitude, 0.0, COORD_UTIL::calculateMeanObliquity(jd));
+    double lst = TIME_UTIL::calculateLocalSiderealTime(
+                    TIME_UTIL::calculateGreenwichSiderealTime(jd), aSite.longitude);
+    return COORD_UTIL::convertEquatorialToHorizon(lst - equatorial.rightAscension,
+                                                  equatorial.declination,
+                                                  aSite.latitude).altitude;
+}
+
+/// Threshold altitude in degrees for a given event type.
+double thresholdAltitude(SolarEventType aType)
+{
+    switch (aType)
+    {
+        case SolarEventType::Sunrise:
+        case SolarEventType::Sunset:
+            return SPA_SUN_ALTITUDE_AT_SUNRISE;
+        case SolarEventType::CivilDawn:
+        case SolarEventType::CivilDusk:
+            return SPA_SUN_ALTITUDE_CIVIL_TWILIGHT;
+        case SolarEventType::NauticalDawn:
+        case SolarEventType::NauticalDusk:
+            return SPA_SUN_ALTITUDE_NAUTICAL_TWILIGHT;
+        default:
+            return SPA_SUN_ALTITUDE_ASTRONOMICAL_TWILIGHT;
+    }
+}
+
+} // end anonymous namespace
+
+void RiseSetUtilities_TestClass::testSunTrack()
+{
+    JulianDate start(2026, 1, 1, 0, 0, 0, 0);
+    JulianDate end(2027, 1, 1, 0, 0, 0, 0);
+    SunTrack track;
+    RISESET_UTIL::calculateSunTrack(start, end, SPA_SUN_TRACK_STEP_DAYS, track);
+
+    ASSERT_EQUALM("Track covers the span", std::size_t(365 * 24 + 1), track.size());
+
+    // Unwrapped right ascension increases by a full turn over the year.
+    ASSERT_EQUAL_DELTAM("Right ascension unwrapped",
+                        SPA_TWO_PI,
+                        track.rightAscension.back() - track.rightAscension.front(),
+                        0.02);
+
+    for (std::size_t index = 0; index < track.size(); index += 997)
+    {
+        JulianDate jd(track.startJulianDays + track.stepDays * double(index));
+        SunPosition sun = SUN_UTIL::calculateSunPosition(jd);
+        EquatorialCoordinates equatorial = COORD_UTIL::convertEclipticToEquatorial(
+                        sun.eclipticLongitude, 0.0, COORD_UTIL::calculateMeanObliquity(jd));
+        ASSERT_EQUAL_DELTAM("Track declination",
+                            equatorial.declination,
+                            track.declination[index] * SPA_RADIANS_TO_DEGREES,
+                            1.0e-10);
+        double raHours = std::fmod(track.rightAscension[index] * SPA_RADIANS_TO_DEGREES / 15.0, 24.0);
+        ASSERT_EQUAL_DELTAM("Track right ascension",
+                            equatorial.rightAscension,
+                            raHours,
+                            1.0e-9);
+    }
+    return;
+}
+
+void RiseSetUtilities_TestClass::testEventAltitudes()
+{
+    std::vector<GeographicCoordinates> sites = {{42.37, -71.05}, {-33.87, 151.21}, {64.15, -21.94}};
+    JulianDate start(2026, 1, 1, 0, 0, 0, 0);
+    JulianDate end(2026, 4, 1, 0, 0, 0, 0);
+    SunTrack track;
+    RISESET_UTIL::calculateSunTrack(start, end, SPA_SUN_TRACK_STEP_DAYS, track);
+
+    std::ostringstream ss;
+    for (const GeographicCoordinates& site : sites)
+    {
+        std::vector<SolarEvent> events;
+        RISESET_UTIL::findSolarEvents(track, site, events);
+        for (const SolarEvent& event : events)
+        {
+            double altitude = sunAltitude(event.julianDays, site);
+            if (std::fabs(altitude - thresholdAltitude(event.type)) > 1.0e-3)
+            {
+                ss << event.type << " at JD " << event.julianDays << " has altitude " << altitude;
+                FAILM(ss.str());
+            }
+            // Rising events must have the Sun climbing.
+            double later = sunAltitude(event.julianDays + 1.0e-3, site);
+            bool rising = (event.type <= SolarEventType::Sunrise);
+            ASSERTM("Direction of event", rising == (later > altitude));
+        }
+    }
+    return;
+}
+
+void RiseSetUtilities_TestClass::testEventCounts()
+{
+    // Greenwich: every day of the year has all eight events, starting
+    // from local midnight.
+    GeographicCoordinates greenwich = {51.48, 0.0};
+    JulianDate start(2026, 1, 1, 0, 0, 0, 0);
+    JulianDate end(2026, 12, 31, 0, 0, 0, 0);
+    std::vector<SolarEvent> events;
+    RISESET_UTIL::findSolarEvents(greenwich, start, end, events);
+
+    std::size_t sunrises = 0;
+    std::size_t sunsets = 0;
+    for (std::size_t index = 0; index < events.size(); index++)
+    {
+        if (index > 0)
+        {
+            ASSERTM("Events in time order", events[index - 1].julianDays <= events[index].julianDays);
+        }
+        sunrises += (events[index].type == SolarEventType::Sunrise) ? 1 : 0;
+        sunsets += (events[index].type == SolarEventType::Sunset) ? 1 : 0;
+    }
+    ASSERT_EQUALM("Sunrises at Greenwich", std::size_t(364), sunrises);
+    ASSERT_EQUALM("Sunsets at Greenwich", std::size_t(364), sunsets);
+
+    // The shared-track overload gives the same answer for each site.
+    SunTrack track;
+    RISESET_UTIL::calculateSunTrack(start, end, SPA_SUN_TRACK_STEP_DAYS, track);
+    std::vector<SolarEvent> trackEvents;
+    RISESET_UTIL::findSolarEvents(track, greenwich, trackEvents);
+    ASSERT_EQUALM("Shared track event count", events.size(), trackEvents.size());
+    ASSERT_EQUALM("Shared track first event", events.front().julianDays, trackEvents.front().julianDays);
+    return;
+}
+
+void RiseSetUtilities_TestClass::testPolarSites()
+{
+    std::vector<SolarEvent> events;
+
+    // Tromso around the June solstice: midnight Sun.
+    GeographicCoordinates tromso = {69.65, 18.96};
+    RISESET_UTIL::findSolarEvents(tromso,
+                                  JulianDate(2026, 6, 10, 0, 0, 0, 0),
+                                  JulianDate(2026, 7, 1, 0, 0, 0, 0),
+                                  events);
+    ASSERTM("No events during polar day", events.empty());
+
+    // ...and around the December solstice: civil twilight but no sunrise.
+    RISESET_UTIL::findSolarEvents(tromso,
+                                  JulianDate(2026, 12, 10, 0, 0, 0, 0),
+                                  JulianDate(2026, 12, 25, 0, 0, 0, 0),
+                                  events);
+    ASSERTM("Twilight during polar night", !events.empty());
+    for (const SolarEvent& event : events)
+    {
+        ASSERTM("No sunrise during polar night", event.type != SolarEventType::Sunrise);
+        ASSERTM("No sunset during polar night", event.type != SolarEventType::Sunset);
+    }
+    return;
+}
+
+void RiseSetUtilities_TestClass::testSolarEventTypeOstream()
+{
+    std::ostringstream ss;
+    ss << SolarEventType::NauticalDusk;
+    ASSERT_EQUALM("Ostream output", std::string("Nautical dusk"), ss.str());
+    return;
+}
+
+void RiseSetUtilities_TestClass::testMoonriseAndMoonset()
+{
+    // Reference times from a brute-force one-minute scan of the
+    // complete lunar series, refined by bisection.
+    GeographicCoordinates boston = {42.37, -71.05};
+    std::vector<LunarEvent> events;
+    RISESET_UTIL::findLunarEvents(boston,
+                                  JulianDate(1986, 3, 10, 0, 0, 0, 0),
+                                  JulianDate(1986, 3, 13, 0, 0, 0, 0),
+                                  events);
+    const double bostonTimes[] = {2446499.974914, 2446500.454436, 2446500.988900, 2446501.500165, 2446502.002266};
+    ASSERT_EQUALM("Boston event count", std::size_t(5), events.size());
+    for (std::size_t index = 0; index < events.size(); index++)
+    {
+        ASSERT_EQUAL_DELTAM("Boston event time", bostonTimes[index], events[index].julianDays, 0.001);
+        ASSERTM("Boston event type",
+                events[index].type == (index % 2 == 0 ? LunarEventType::Moonrise : LunarEventType::Moonset));
+    }
+
+    GeographicCoordinates greenwich = {51.48, 0.0};
+    RISESET_UTIL::findLunarEvents(greenwich,
+                                  JulianDate(2024, 1, 1, 0, 0, 0, 0),
+                                  JulianDate(2024, 1, 3, 0, 0, 0, 0),
+                                  events);
+    const double greenwichTimes[] = {2460310.962452, 2460311.411279, 2460311.969758, 2460312.459471};
+    ASSERT_EQUALM("Greenwich event count", std::size_t(4), events.size());
+    for (std::size_t index = 0; index < events.size(); index++)
+    {
+        ASSERT_EQUAL_DELTAM("Greenwich event time", greenwichTimes[index], events[index].julianDays, 0.001);
+        ASSERTM("Greenwich event type",
+                events[index].type == (index % 2 == 0 ? LunarEventType::Moonset : LunarEventType::Moonrise));
+    }
+
+    // About one rise and one set per 24h 50m.
+    RISESET_UTIL::findLunarEvents(greenwich,
+                                  JulianDate(2024, 1, 1, 0, 0, 0, 0),
+                                  JulianDate(2024, 12, 31, 0, 0, 0, 0),
+                                  events);
+    std::size_t rises = 0;
+    for (std::size_t index = 0; index < events.size(); index++)
+    {
+        if (events[index].type == LunarEventType::Moonrise)
+        {
+            rises++;
+        }
+        if (index > 0)
+        {
+            ASSERTM("Rises and sets alternate", events[index].type != events[index - 1].type);
+        }
+    }
+    ASSERT_EQUAL_DELTAM("Moonrises in a year", 365.0 * 24.0 / 24.84, double(rises), 3.0);
+    return;
+}
+
+void RiseSetUtilities_TestClass::testMoonMultiSite()
+{
+    std::vector<GeographicCoordinates> sites = {{42.37, -71.05}, {51.48, 0.0}, {-33.87, 151.21}, {69.65, 18.96}};
+    MoonTrack track;
+    RISESET_UTIL::calculateMoonTrack(JulianDate(2025, 5, 1, 0, 0, 0, 0),
+                                     JulianDate(2025, 6, 1, 0, 0, 0, 0),
+                                     SPA_MOON_TRACK_STEP_DAYS,
+                                     track);
+
+    std::vector<std::vector<LunarEvent>> batch;
+    RISESET_UTIL::findLunarEvents(track, sites, batch);
+    ASSERT_EQUALM("One result per site", sites.size(), batch.size());
+    for (std::size_t site = 0; site < sites.size(); site++)
+    {
+        std::vector<LunarEvent> single;
+        RISESET_UTIL::findLunarEvents(track, sites[site], single);
+        ASSERT_EQUALM("Same number of events", single.size(), batch[site].size());
+        for (std::size_t index = 0; index < single.size(); index++)
+        {
+            ASSERT_EQUAL_DELTAM("Same time", single[index].julianDays, batch[site][index].julianDays, 0.0);
+            ASSERTM("Same type", single[index].type == batch[site][index].type);
+        }
+        ASSERTM("Some events at each site", !single.empty());
+    }
+    return;
+}
+
+void RiseSetUtilities_TestClass::testMoonIncremental()
+{
+    GeographicCoordinates site = {-33.87, 151.21};
+    JulianDate start(2025, 5, 1, 0, 0, 0, 0);
+    int numDays = 40;
+
+    MoonTrack whole;
+    RISESET_UTIL::calculateMoonTrack(start, JulianDate(start.getDecimalDays() + numDays), SPA_MOON_TRACK_STEP_DAYS, whole);
+    std::vector<LunarEvent> expected;
+    RISESET_UTIL::findLunarEvents(whole, site, expected);
+
+    MoonRiseSetSearch search(site);
+    std::vector<LunarEvent> actual;
+    for (int day = 0; day < numDays; day++)
+    {
+        MoonTrack daily;
+        RISESET_UTIL::calculateMoonTrack(JulianDate(start.getDecimalDays() + day),
+                                         JulianDate(start.getDecimalDays() + day + 1),
+                                         SPA_MOON_TRACK_STEP_DAYS,
+                                         daily);
+        search.process(daily, actual);
+    }
+
+    ASSERT_EQUALM("Same number of events", expected.size(), actual.size());
+    for (std::size_t index = 0; index < expected.size(); index++)
+    {
+        ASSERT_EQUAL_DELTAM("Same time", expected[index].julianDays, actual[index].julianDays, 1e-6);
+        ASSERTM("Same type", expected[index].type == actual[index].type);
+    }
+
+    // After a reset the search starts afresh, so the same track gives the same events again.
+    search.reset();
+    std::vector<LunarEvent> again;
+    search.process(whole, again);
+    ASSERT_EQUALM("Same events after reset", expected.size(), again.size());
+    return;
+}
+
+void RiseSetUtilities_TestClass::testLunarEventTypeOstream()
+{
+    std::ostringstream ss;
+    ss << LunarEventType::Moonrise << ", " << LunarEventType::Moonset;
+    ASSERT_EQUALM("Ostream output", std::string("Moonrise, Moonset"), ss.str());
+    return;
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
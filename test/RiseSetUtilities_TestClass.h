@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file RiseSetUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for RiseSetUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_RISESETUTILITIES_TESTCLASS_H_
+#define TEST_RISESETUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for RiseSetUtilities
+ * @ingroup group_test
+ */
+class RiseSetUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        RiseSetUtilities_TestClass() = default;
+
+        /// Default destructor
+        virtual ~RiseSetUtilities_TestClass() = default;
+
+        /**
+         * Tests that the precomputed solar track matches the scalar
+         * solar theory and that right ascension is unwrapped.
+         */
+        void testSunTrack();
+
+        /**
+         * Tests that every event found lies at its threshold altitude
+         * when checked with the full solar theory.
+         */
+        void testEventAltitudes();
+
+        /**
+         * Tests the number and ordering of events over a full year
+         * at mid-latitude, including consistency across sites.
+         */
+        void testEventCounts();
+
+        /**
+         * Tests that polar day and polar night produce no sunrise or
+         * sunset events.
+         */
+        void testPolarSites();
+
+        /**
+         * Tests the ostream operator for SolarEventType.
+         */
+        void testSolarEventTypeOstream();
+
+        /**
+         * Tests moonrise and moonset times against an independent
+         * brute-force search.
+         */
+        void testMoonriseAndMoonset();
+
+        /**
+         * Tests that the multi-site batch matches single-site searches.
+         */
+        void testMoonMultiSite();
+
+        /**
+         * Tests that feeding MoonRiseSetSearch one day of track at a
+         * time gives the same events as one long track.
+         */
+        void testMoonIncremental();
+
+        /**
+         * Tests the ostream operator for LunarEventType.
+         */
+        void testLunarEventTypeOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testSunTrack);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testEventAltitudes);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testEventCounts);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testPolarSites);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testSolarEventTypeOstream);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testMoonriseAndMoonset);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testMoonMultiSite);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testMoonIncremental);
+            aSuite += CUTE_SMEMFUN(RiseSetUtilities_TestClass, testLunarEventTypeOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_RISESETUTILITIES_TESTCLASS_H_ */
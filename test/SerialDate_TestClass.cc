@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SerialDate_TestClass.cc
+ * @brief Definition of SerialDate_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "SerialDate_TestClass.h"
+#include "SerialDate.h"
+#include "SpaDate.h"
+#include "DateAndTime.h"
+#include "JulianDate.h"
+#include "SpaTimeConstants.h"
+#include "TimeUtilities.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void SerialDate_TestClass::testKnownDates()
+{
+    ASSERT_EQUALM("Epoch", 0, SerialDate(2000, 1, 1).getDays());
+    ASSERT_EQUALM("Default is the epoch", 0, SerialDate().getDays());
+    ASSERT_EQUALM("Unix epoch", -10957, SerialDate(1970, 1, 1).getDays());
+    ASSERT_EQUALM("2024 leap day", 8825, SerialDate(2024, 2, 29).getDays());
+    ASSERT_EQUALM("First Gregorian day", SPA_SERIAL_DATE_FIRST_GREGORIAN_DAY,
+                  SerialDate(1582, 10, 15).getDays());
+    ASSERT_EQUALM("Last Julian day", SPA_SERIAL_DATE_FIRST_GREGORIAN_DAY - 1,
+                  SerialDate(1582, 10, 4).getDays());
+    // 1500 is a leap year in the Julian calendar only
+    ASSERT_EQUALM("Julian leap day 1500", 1,
+                  SerialDate(1500, 3, 1) - SerialDate(1500, 2, 29));
+    ASSERT_EQUALM("Days in 1500", 366,
+                  SerialDate(1501, 1, 1) - SerialDate(1500, 1, 1));
+    ASSERT_EQUALM("Days in 1900", 365,
+                  SerialDate(1901, 1, 1) - SerialDate(1900, 1, 1));
+    ASSERT_EQUALM("Start of the Julian Period",
+                  int(-0.5 - SPA_SERIAL_DATE_EPOCH),
+                  SerialDate(-4712, 1, 1).getDays());
+
+    SerialDate fromSpaDate(SpaDate(1985, 2, 17));
+    ASSERT_EQUALM("From SpaDate", SerialDate(1985, 2, 17).getDays(), fromSpaDate.getDays());
+    SpaDate spaDate = fromSpaDate.getSpaDate();
+    ASSERTM("To SpaDate", spaDate == SpaDate(1985, 2, 17));
+}
+
+void SerialDate_TestClass::testRoundTrip()
+{
+    const std::int32_t firstDay = -2000000;
+    const std::int32_t lastDay = 2000000;
+    int year;
+    int month;
+    int day;
+    SerialDate(firstDay).getYearMonthDay(year, month, day);
+    for (std::int32_t days = firstDay; days <= lastDay; days++)
+    {
+        SerialDate date(days);
+        int nextYear;
+        int nextMonth;
+        int nextDay;
+        SerialDate(days + 1).getYearMonthDay(nextYear, nextMonth, nextDay);
+
+        bool isValid = (month >= 1 && month <= 12 && day >= 1 && day <= 31);
+        bool roundTrips = (SerialDate(year, month, day).getDays() == days);
+
+        bool isConsecutive;
+        if (days + 1 == SPA_SERIAL_DATE_FIRST_GREGORIAN_DAY)
+        {
+            isConsecutive = (year == 1582 && month == 10 && day == 4 &&
+                             nextYear == 1582 && nextMonth == 10 && nextDay == 15);
+        }
+        else if (nextDay != 1)
+        {
+            isConsecutive = (nextYear == year && nextMonth == month && nextDay == day + 1);
+        }
+        else if (nextMonth != 1)
+        {
+            isConsecutive = (nextYear == year && nextMonth == month + 1 && day >= 28);
+        }
+        else
+        {
+            isConsecutive = (nextYear == year + 1 && month == 12 && day == 31);
+        }
+
+        if (!isValid || !roundTrips || !isConsecutive)
+        {
+            std::ostringstream ss;
+            ss << "Day " << days << " is " << year << "-" << month << "-" << day
+               << ", next " << nextYear << "-" << nextMonth << "-" << nextDay;
+            ASSERTM(ss.str(), false);
+        }
+        year = nextYear;
+        month = nextMonth;
+        day = nextDay;
+    }
+
+    // Lengths of the Gregorian months
+    for (int testYear = 1600; testYear <= 2400; testYear++)
+    {
+        ASSERT_EQUALM("Days in year", TIME_UTIL::daysInYear(testYear),
+                      SerialDate(testYear + 1, 1, 1) - SerialDate(testYear, 1, 1));
+    }
+}
+
+void SerialDate_TestClass::testJulianDate()
+{
+    for (int year = -4712; year <= 3000; year += 7)
+    {
+        for (int month = 1; month <= 12; month++)
+        {
+            int day = 1 + (year + 4712 + 5 * month) % 28;
+            if (year == 1582 && month == 10)
+            {
+                // JulianDate counts 1582-10-15 0h as a Julian calendar date
+                continue;
+            }
+            SerialDate date(year, month, day);
+            JulianDate expected(year, month, day, 0, 0, 0);
+            std::ostringstream ss;
+            ss << "Julian Date of " << year << "-" << month << "-" << day;
+            ASSERT_EQUALM(ss.str(), expected.getDecimalDays(), date.getJulianDate().getDecimalDays());
+
+            DateAndTime decoded = date.getJulianDate().getDateAndTime();
+            int decodedYear;
+            int decodedMonth;
+            int decodedDay;
+            date.getYearMonthDay(decodedYear, decodedMonth, decodedDay);
+            ASSERT_EQUALM("Year as JulianDate", decoded.getYear(), decodedYear);
+            ASSERT_EQUALM("Month as JulianDate", decoded.getMonth(), decodedMonth);
+            ASSERT_EQUALM("Day as JulianDate", decoded.getDay(), decodedDay);
+        }
+    }
+    ASSERT_EQUALM("1582-10-16", JulianDate(1582, 10, 16, 0, 0, 0).getDecimalDays(),
+                  SerialDate(1582, 10, 16).getJulianDate().getDecimalDays());
+    ASSERT_EQUALM("1582-10-04", JulianDate(1582, 10, 4, 0, 0, 0).getDecimalDays(),
+                  SerialDate(1582, 10, 4).getJulianDate().getDecimalDays());
+}
+
+void SerialDate_TestClass::testArithmetic()
+{
+    SerialDate date(2024, 12, 30);
+    SerialDate later = date + 3;
+    ASSERTM("Add across the year", later == SerialDate(2025, 1, 2));
+    ASSERTM("Subtract", later - 3 == date);
+    ASSERT_EQUALM("Difference", 3, later - date);
+    ASSERT_EQUALM("Negative difference", -3, date - later);
+    date += 366;
+    ASSERTM("Add a year", date == SerialDate(2025, 12, 31));
+    date -= 366;
+    ASSERTM("Subtract a year", date == SerialDate(2024, 12, 30));
+
+    // Day 0 and days past the end of the month carry over
+    ASSERTM("January 0", SerialDate(2010, 1, 0) == SerialDate(2009, 12, 31));
+    ASSERTM("February 30", SerialDate(2023, 2, 30) == SerialDate(2023, 3, 2));
+
+    ASSERTM("Less", SerialDate(1999, 12, 31) < SerialDate(2000, 1, 1));
+    ASSERTM("Greater", SerialDate(2000, 1, 2) > SerialDate(2000, 1, 1));
+    ASSERTM("Less or equal", SerialDate(2000, 1, 1) <= SerialDate(2000, 1, 1));
+    ASSERTM("Greater or equal", SerialDate(2000, 1, 1) >= SerialDate(2000, 1, 1));
+    ASSERTM("Not equal", SerialDate(2000, 1, 1) != SerialDate(2000, 1, 2));
+
+    // Sorting and deduplicating is sorting and deduplicating the counts
+    std::vector<SerialDate> dates;
+    for (int i = 0; i < 100; i++)
+    {
+        dates.push_back(SerialDate(2000 + (i * 37) % 11, 1 + (i * 7) % 12, 1 + i % 3));
+    }
+    std::sort(dates.begin(), dates.end());
+    dates.erase(std::unique(dates.begin(), dates.end()), dates.end());
+    for (std::size_t i = 1; i < dates.size(); i++)
+    {
+        ASSERTM("Sorted and unique", dates[i - 1].getDays() < dates[i].getDays());
+    }
+}
+
+void SerialDate_TestClass::testOstream()
+{
+    std::ostringstream os;
+    os << SerialDate(1985, 2, 7);
+    ASSERT_EQUALM("SerialDate output", std::string("SerialDate{ theDays=-5441 (1985-02-07) }"), os.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SerialDate_TestClass.h
+ * @brief Declaration of the CUTE test class for SerialDate
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_SERIALDATE_TESTCLASS_H_
+#define TEST_SERIALDATE_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for SerialDate
+ * @ingroup group_test
+ */
+class SerialDate_TestClass
+{
+    public:
+        /// Default constructor
+        SerialDate_TestClass() = default;
+
+        /// Default destructor
+        virtual ~SerialDate_TestClass() = default;
+
+        /**
+         * Tests day counts of known dates, including either side of
+         * the Gregorian reform.
+         */
+        void testKnownDates();
+
+        /**
+         * Tests that every day over a wide range converts to a valid
+         * date and back, and that consecutive days are consecutive
+         * dates.
+         */
+        void testRoundTrip();
+
+        /**
+         * Tests agreement with JulianDate in both calendars.
+         */
+        void testJulianDate();
+
+        /**
+         * Tests adding days, differences and comparison.
+         */
+        void testArithmetic();
+
+        /**
+         * Tests the ostream operator.
+         */
+        void testOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(SerialDate_TestClass, testKnownDates);
+            aSuite += CUTE_SMEMFUN(SerialDate_TestClass, testRoundTrip);
+            aSuite += CUTE_SMEMFUN(SerialDate_TestClass, testJulianDate);
+            aSuite += CUTE_SMEMFUN(SerialDate_TestClass, testArithmetic);
+            aSuite += CUTE_SMEMFUN(SerialDate_TestClass, testOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_SERIALDATE_TESTCLASS_H_ */
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SortUtilities_TestClass.cc
+ * @brief Definition of SortUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "SortUtilities_TestClass.h"
+#include "SortUtilities.h"
+#include "DateAndTime.h"
+#include "JulianDate.h"
+#include "SpaConstants.h"
+#include "SpaTimeConstants.h"
+#include "ThreadPool.h"
+#include "TimeUtilities.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+namespace
+{
+
+/// Returns aCount random keys, clustered so that duplicates occur.
+std::vector<std::int64_t> makeRandomKeys(std::size_t aCount, unsigned int aSeed)
+{
+    std::mt19937_64 generator(aSeed);
+    std::vector<std::int64_t> keys(aCount);
+    for (std::size_t i = 0; i < aCount; i++)
+    {
+        std::int64_t key = std::int64_t(generator());
+        // Every third key is small, so the high bytes are often shared
+        keys[i] = (i % 3 == 0) ? key % 1000 : key;
+    }
+    return keys;
+}
+
+} // end anonymous namespace
+
+void SortUtilities_TestClass::testInstantKeys()
+{
+    // Same instant with different offsets, see DateAndTime::getDayFraction()
+    DateAndTime utc(2026, 10, 18, 8, 0, 0.0, 0.0);
+    DateAndTime east(2026, 10, 18, 4, 30, 0.0, 3.5);
+    DateAndTime westPreviousDay(2026, 10, 17, 23, 0, 0.0, 9.0);
+    std::int64_t utcKey = TIME_UTIL::calculateInstantKey(utc);
+    ASSERT_EQUALM("Offset east", utcKey, TIME_UTIL::calculateInstantKey(east));
+    ASSERT_EQUALM("Offset across midnight", utcKey, TIME_UTIL::calculateInstantKey(westPreviousDay));
+
+    ASSERT_EQUALM("Epoch", std::int64_t(0),
+                  TIME_UTIL::calculateInstantKey(DateAndTime(2000, 1, 1)));
+    ASSERT_EQUALM("Epoch Julian Date", std::int64_t(0),
+                  TIME_UTIL::calculateInstantKey(JulianDate(SPA_SERIAL_DATE_EPOCH)));
+    ASSERT_EQUALM("One microsecond", std::int64_t(1),
+                  TIME_UTIL::calculateInstantKey(DateAndTime(2000, 1, 1, 0, 0, 1.0e-6)));
+    ASSERT_EQUALM("Day before epoch", -SPA_INSTANT_KEY_TICKS_IN_DAY,
+                  TIME_UTIL::calculateInstantKey(DateAndTime(1999, 12, 31)));
+
+    // Keys order as Julian Dates do, and agree with them to the
+    // resolution of a double Julian Date
+    std::vector<DateAndTime> dates = {
+        DateAndTime(1582, 10, 4, 23, 59, 59.5),
+        DateAndTime(1582, 10, 15, 0, 0, 0.5),
+        DateAndTime(1985, 2, 17, 6, 0, 0.0, -5.0),
+        DateAndTime(1985, 2, 17, 1, 0, 0.25, 0.0),
+        DateAndTime(2024, 2, 29, 12, 0, 0.0, 12.0),
+        DateAndTime(2024, 3, 1, 0, 0, 0.0, -12.0),
+        DateAndTime(2026, 10, 18, 17, 45, 30.125, 2.0) };
+    for (std::size_t i = 0; i < dates.size(); i++)
+    {
+        JulianDate jd(dates[i]);
+        std::int64_t key = TIME_UTIL::calculateInstantKey(dates[i]);
+        ASSERT_EQUAL_DELTAM("Key against Julian Date",
+                            double(TIME_UTIL::calculateInstantKey(jd)),
+                            double(key),
+                            100.0);
+        for (std::size_t j = 0; j < dates.size(); j++)
+        {
+            bool keyLess = key < TIME_UTIL::calculateInstantKey(dates[j]);
+            bool jdLess = jd.getDecimalDays() < JulianDate(dates[j]).getDecimalDays();
+            ASSERTM("Key order", keyLess == jdLess);
+        }
+    }
+}
+
+void SortUtilities_TestClass::testRadixSort()
+{
+    ThreadPool serialPool(1);
+    ThreadPool parallelPool(4);
+    std::vector<std::size_t> counts = {
+        0, 1, 2, 100, SPA_RADIX_SORT_PARALLEL_MIN_COUNT + 12345 };
+    for (std::size_t count : counts)
+    {
+        std::vector<std::int64_t> expected = makeRandomKeys(count, 42);
+        std::vector<std::int64_t> serialKeys = expected;
+        std::vector<std::int64_t> parallelKeys = expected;
+        std::sort(expected.begin(), expected.end());
+
+        SORT_UTIL::radixSort(serialKeys.data(), count, &serialPool);
+        SORT_UTIL::radixSort(parallelKeys.data(), count, &parallelPool);
+        ASSERTM("Serial sort", serialKeys == expected);
+        ASSERTM("Parallel sort", parallelKeys == expected);
+    }
+
+    // Keys sharing every byte but one, and all equal
+    std::vector<std::int64_t> keys = { 0x0102030405060708, 0x01020304050607ff, 0x0102030405060700 };
+    SORT_UTIL::radixSort(keys.data(), keys.size());
+    ASSERTM("One differing byte",
+            keys == std::vector<std::int64_t>({ 0x0102030405060700, 0x0102030405060708, 0x01020304050607ff }));
+    keys.assign(10, -7);
+    SORT_UTIL::radixSort(keys.data(), keys.size());
+    ASSERTM("All equal", keys == std::vector<std::int64_t>(10, -7));
+}
+
+void SortUtilities_TestClass::testRadixSortIndices()
+{
+    ThreadPool parallelPool(4);
+    std::size_t count = SPA_RADIX_SORT_PARALLEL_MIN_COUNT * 2;
+    std::vector<std::int64_t> keys(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        // Many duplicates, and negative keys
+        keys[i] = std::int64_t((i * 7919) % 1000) - 500;
+    }
+    std::vector<std::size_t> expected(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        expected[i] = i;
+    }
+    std::stable_sort(expected.begin(),
+                     expected.end(),
+                     [&keys](std::size_t aLHS, std::size_t aRHS)
+                     {
+                         return keys[aLHS] < keys[aRHS];
+                     });
+
+    std::vector<std::size_t> indices(count);
+    SORT_UTIL::radixSortIndices(keys.data(), count, indices.data(), &parallelPool);
+    ASSERTM("Stable parallel indices", indices == expected);
+    SORT_UTIL::radixSortIndices(keys.data(), 100, indices.data());
+    ASSERTM("Stable serial indices",
+            std::is_sorted(indices.begin(),
+                           indices.begin() + 100,
+                           [&keys](std::size_t aLHS, std::size_t aRHS)
+                           {
+                               return keys[aLHS] < keys[aRHS]
+                                   || (keys[aLHS] == keys[aRHS] && aLHS < aRHS);
+                           }));
+}
+
+void SortUtilities_TestClass::testSortByInstant()
+{
+    // Clock order differs from instant order here
+    std::vector<DateAndTime> dates = {
+        DateAndTime(2026, 10, 18, 10, 0, 0.0, 0.0),
+        DateAndTime(2026, 10, 18, 12, 0, 0.0, -4.0),
+        DateAndTime(2026, 10, 18, 6, 0, 0.0, 3.0),
+        DateAndTime(2026, 10, 17, 23, 0, 0.0, 0.0),
+        DateAndTime(2026, 10, 18, 5, 0, 0.0, 3.0) };
+    std::vector<std::size_t> indices(dates.size());
+    SORT_UTIL::sortIndicesByInstant(dates.data(), dates.size(), indices.data());
+    // 12h at -4 and 5h at +3 are both 8h, and keep their input order
+    ASSERTM("Indices by instant",
+            indices == std::vector<std::size_t>({ 3, 1, 4, 2, 0 }));
+
+    std::vector<DateAndTime> sorted = dates;
+    SORT_UTIL::sortByInstant(sorted.data(), sorted.size());
+    for (std::size_t i = 0; i < sorted.size(); i++)
+    {
+        ASSERTM("Dates by instant", sorted[i] == dates[indices[i]]);
+    }
+
+    ThreadPool parallelPool(4);
+    std::size_t count = SPA_RADIX_SORT_PARALLEL_MIN_COUNT + 1000;
+    std::vector<std::int64_t> keys = makeRandomKeys(count, 7);
+    std::vector<JulianDate> julianDates(count);
+    std::vector<double> expected(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        // Both signs, and fractions closer than an instant key tick
+        expected[i] = double(keys[i] % 100000000) * 0.01 + 1.0e-9 * double(i % 3);
+        julianDates[i] = JulianDate(expected[i]);
+    }
+    std::sort(expected.begin(), expected.end());
+    SORT_UTIL::sortByInstant(julianDates.data(), count, &parallelPool);
+    bool allEqual = true;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        allEqual = allEqual && (julianDates[i].getDecimalDays() == expected[i]);
+    }
+    ASSERTM("Julian Dates", allEqual);
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
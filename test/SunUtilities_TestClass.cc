@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SunUtilities_TestClass.cc
+ * @brief Definition of SunUtilities_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "SunUtilities_TestClass.h"
+#include "SpaTestUtilities.h"
+#include "SunUtilities.h"
+#include "SpaSunConstants.h"
+#include "SpaTimeConstants.h"
+#include "JulianDate.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+#include <sstream>
+
+namespace SPA
+{
+namespace TEST
+{
+
+SunUtilities_TestClass::SunUtilities_TestClass() : theDegreeTolerance(1.0e-3),
+                theDigitsOfPrecision(6)
+{
+}
+
+void SunUtilities_TestClass::testSunEclipticLongitude()
+{
+    /*
+     * Expected values are from the low precision solar coordinates
+     * of Meeus Chapter 25, which use time-varying elements and so
+     * are an independent check. The two agree to 0.01 degrees.
+     */
+    const int NUM_TESTS = 4;
+    std::array<double, NUM_TESTS> inputJulianDays = {{2447369.5,    // 1988-07-27 00:00 UT
+                                                      2451545.0,    // 2000-01-01 12:00 UT
+                                                      2461331.5,    // 2026-10-18 00:00 UT
+                                                      2443931.1666667}}; // 1979-02-26 16:00 UT
+    std::array<double, NUM_TESTS> expectedLongitude = {{124.187375,
+                                                       280.382159,
+                                                       204.632271,
+                                                       337.467528}};
+    double meeusTolerance = 0.01;
+    std::ostringstream ss;
+    for (int iTest = 0; iTest < NUM_TESTS; iTest++)
+    {
+        JulianDate jd(inputJulianDays[iTest]);
+        double longitude = SUN_UTIL::calculateSunEclipticLongitude(jd);
+        ss << "  Test " << iTest << " ecliptic longitude at JD=" << inputJulianDays[iTest];
+        spaTestFloatingPointEqual(ss.str(),
+                                  expectedLongitude[iTest],
+                                  longitude,
+                                  meeusTolerance,
+                                  theDigitsOfPrecision);
+        ss.str(std::string());
+    }
+
+    // The longitude must always be normalized to [0, 360).
+    for (double days = -40000; days < 40000; days += 97.3)
+    {
+        double longitude = SUN_UTIL::calculateSunEclipticLongitude(JulianDate(SPA_SUN_EPOCH_1990 + days));
+        if ( (longitude < 0) || (longitude >= 360) )
+        {
+            ss << "Ecliptic longitude " << longitude << " out of range at "
+               << days << " days from epoch";
+            FAILM(ss.str());
+        }
+    }
+    return;
+}
+
+void SunUtilities_TestClass::testSunDistanceAndAngularSize()
+{
+    // 1. 1988 July 27, PAWYC Section 48 example epoch.
+    SunPosition position = SUN_UTIL::calculateSunPosition(JulianDate(2447369.5));
+    spaTestFloatingPointEqual("1a. Distance on 1988-07-27",
+                              1.519204e8,
+                              position.distance,
+                              1.0e3,
+                              theDigitsOfPrecision);
+    spaTestFloatingPointEqual("1b. Angular size on 1988-07-27",
+                              0.524980,
+                              position.angularSize,
+                              theDegreeTolerance,
+                              theDigitsOfPrecision);
+
+    // 2. At perigee (mean anomaly zero) and apogee the distance is a(1-e)
+    // and a(1+e), and the true anomaly equals the mean anomaly.
+    double ecc = SPA_SUN_ORBIT_ECCENTRICITY;
+    double daysToPerigee = (SPA_SUN_ECLIPTIC_LONGITUDE_OF_PERIGEE - SPA_SUN_ECLIPTIC_LONGITUDE_AT_EPOCH)
+                            * SPA_DAYS_IN_TROPICAL_YEAR / 360.0;
+    SunPosition perigee = SUN_UTIL::calculateSunPosition(JulianDate(SPA_SUN_EPOCH_1990 + daysToPerigee));
+    spaTestFloatingPointEqual("2a. Distance at perigee",
+                              SPA_SUN_SEMI_MAJOR_AXIS_KM * (1 - ecc),
+                              perigee.distance,
+                              1.0,
+                              theDigitsOfPrecision);
+    spaTestFloatingPointEqual("2b. Angular size at perigee",
+                              SPA_SUN_ANGULAR_DIAMETER_AT_R0 / (1 - ecc),
+                              perigee.angularSize,
+                              1.0e-9,
+                              theDigitsOfPrecision);
+    spaTestFloatingPointEqual("2c. Ecliptic longitude at perigee",
+                              SPA_SUN_ECLIPTIC_LONGITUDE_OF_PERIGEE,
+                              perigee.eclipticLongitude,
+                              1.0e-6,
+                              theDigitsOfPrecision);
+
+    double halfYear = 0.5 * SPA_DAYS_IN_TROPICAL_YEAR;
+    SunPosition apogee = SUN_UTIL::calculateSunPosition(JulianDate(SPA_SUN_EPOCH_1990 + daysToPerigee + halfYear));
+    spaTestFloatingPointEqual("3a. Distance at apogee",
+                              SPA_SUN_SEMI_MAJOR_AXIS_KM * (1 + ecc),
+                              apogee.distance,
+                              1.0,
+                              theDigitsOfPrecision);
+    spaTestFloatingPointEqual("3b. True anomaly at apogee",
+                              180.0,
+                              apogee.trueAnomaly,
+                              1.0e-6,
+                              theDigitsOfPrecision);
+    return;
+}
+
+void SunUtilities_TestClass::testBatchMatchesScalar()
+{
+    const double startDays = 2451000.25;
+    const double stepDays = 1.0 / 1440.0; // One minute
+    const std::size_t count = 5000;
+
+    std::vector<double> julianDays(count);
+    std::vector<JulianDate> julianDates(count);
+    for (std::size_t index = 0; index < count; index++)
+    {
+        julianDays[index] = startDays + stepDays * double(index);
+        julianDates[index] = JulianDate(julianDays[index]);
+    }
+
+    SunPositionArrays fromDays;
+    SunPositionArrays fromDates;
+    SunPositionArrays fromSeries;
+    SUN_UTIL::calculateSunPositions(julianDays.data(), count, fromDays);
+    SUN_UTIL::calculateSunPositions(julianDates, fromDates);
+    SUN_UTIL::calculateSunPositionSeries(JulianDate(startDays), stepDays, count, fromSeries);
+
+    ASSERT_EQUALM("Batch output size", count, fromDays.size());
+    ASSERT_EQUALM("Vector batch output size", count, fromDates.size());
+    ASSERT_EQUALM("Series output size", count, fromSeries.size());
+
+    for (std::size_t index = 0; index < count; index += 499)
+    {
+        SunPosition scalar = SUN_UTIL::calculateSunPosition(julianDates[index]);
+        SunPosition batch = fromDays.at(index);
+        ASSERT_EQUALM("Batch longitude differs from scalar", scalar.eclipticLongitude, batch.eclipticLongitude);
+        ASSERT_EQUALM("Batch distance differs from scalar", scalar.distance, batch.distance);
+        ASSERT_EQUALM("Batch angular size differs from scalar", scalar.angularSize, batch.angularSize);
+        ASSERT_EQUALM("Vector batch longitude differs from scalar",
+                      scalar.eclipticLongitude,
+                      fromDates.eclipticLongitude[index]);
+        spaTestFloatingPointEqual("Series longitude differs from scalar",
+                                  scalar.eclipticLongitude,
+                                  fromSeries.eclipticLongitude[index],
+                                  1.0e-8,
+                                  10);
+    }
+    return;
+}
+
+void SunUtilities_TestClass::testEquationOfTime()
+{
+    // Reference values in minutes from an independent calculation using
+    // the Meeus solar theory; the PAWYC theory agrees to a few seconds.
+    struct Reference
+    {
+        int year;
+        int month;
+        int day;
+        double minutes;
+    };
+    std::array<Reference, 4> references = {{{1988, 7, 27, -6.50},
+                                            {2026, 11, 3, 16.42},
+                                            {2026, 2, 11, -14.22},
+                                            {2026, 4, 15, -0.18}}};
+    for (const Reference& reference : references)
+    {
+        JulianDate jd(reference.year, reference.month, reference.day, 0, 0, 0, 0);
+        ASSERT_EQUAL_DELTAM("Equation of time",
+                            reference.minutes,
+                            SUN_UTIL::calculateEquationOfTime(jd) * 60.0,
+                            0.1);
+    }
+
+    // Series, batch and scalar agree, and the equation of time stays
+    // within its known annual range.
+    JulianDate start(2026, 1, 1, 0, 0, 0, 0);
+    std::vector<double> series;
+    SUN_UTIL::calculateEquationOfTimeSeries(start, 0.25, 4 * 366, series);
+    ASSERT_EQUALM("Series size", std::size_t(4 * 366), series.size());
+    double minimum = series.front();
+    double maximum = series.front();
+    for (std::size_t index = 0; index < series.size(); index++)
+    {
+        minimum = std::min(minimum, series[index]);
+        maximum = std::max(maximum, series[index]);
+        if (index % 97 == 0)
+        {
+            JulianDate jd(start.getDecimalDays() + 0.25 * double(index));
+            ASSERT_EQUALM("Series matches scalar", SUN_UTIL::calculateEquationOfTime(jd), series[index]);
+        }
+    }
+    ASSERT_EQUAL_DELTAM("Annual minimum, minutes", -14.2, minimum * 60.0, 0.2);
+    ASSERT_EQUAL_DELTAM("Annual maximum, minutes", 16.4, maximum * 60.0, 0.2);
+    return;
+}
+
+void SunUtilities_TestClass::testEquationOfTimeTable()
+{
+    JulianDate start(2000, 1, 1, 0, 0, 0, 0);
+    JulianDate end(2030, 1, 1, 0, 0, 0, 0);
+    ChebyshevTable table = SUN_UTIL::buildEquationOfTimeTable(start, end);
+    ASSERTM("Table covers the range", table.getEnd() >= end.getDecimalDays());
+
+    // One millisecond of time, in hours.
+    double tolerance = 1.0e-3 / 3600.0;
+    const std::size_t count = 20000;
+    std::vector<double> julianDays(count);
+    std::vector<double> exact(count);
+    double span = end.getDecimalDays() - start.getDecimalDays();
+    for (std::size_t index = 0; index < count; index++)
+    {
+        julianDays[index] = start.getDecimalDays() + span * (double(index) + 0.37) / double(count);
+    }
+    SUN_UTIL::calculateEquationOfTime(julianDays.data(), count, exact.data());
+    std::ostringstream ss;
+    for (std::size_t index = 0; index < count; index++)
+    {
+        double error = table.evaluate(julianDays[index]) - exact[index];
+        if (std::fabs(error) > tolerance)
+        {
+            ss << "Table error " << error * 3600.0 << " s at JD " << julianDays[index];
+            FAILM(ss.str());
+        }
+    }
+    return;
+}
+
+void SunUtilities_TestClass::testSolarElongation()
+{
+    JulianDate jd(2026, 10, 18, 0, 0, 0, 0);
+    double sunLongitude = SUN_UTIL::calculateSunEclipticLongitude(jd);
+    double tolerance = 1.0e-6;
+    ASSERT_EQUAL_DELTAM("Conjunction",
+                        0.0,
+                        SUN_UTIL::calculateSolarElongation(jd, sunLongitude, 0.0),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("Quadrature",
+                        90.0,
+                        SUN_UTIL::calculateSolarElongation(jd, sunLongitude - 90.0, 0.0),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("Opposition",
+                        180.0,
+                        SUN_UTIL::calculateSolarElongation(jd, sunLongitude + 180.0, 0.0),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("Above the Sun",
+                        30.0,
+                        SUN_UTIL::calculateSolarElongation(jd, sunLongitude, 30.0),
+                        tolerance);
+    return;
+}
+
+void SunUtilities_TestClass::testSeasons()
+{
+    // Published times, UT, rounded to the minute.
+    struct Expected
+    {
+        SeasonType season;
+        int month;
+        int day;
+        int hours;
+        int minutes;
+    };
+    const std::array<Expected, 4> expected = {{
+        {SeasonType::MarchEquinox, 3, 20, 3, 6},
+        {SeasonType::JuneSolstice, 6, 20, 20, 51},
+        {SeasonType::SeptemberEquinox, 9, 22, 12, 44},
+        {SeasonType::DecemberSolstice, 12, 21, 9, 21}
+    }};
+    double tolerance = 10.0 / SPA_MINUTES_IN_DAY;
+    for (const auto& event : expected)
+    {
+        std::ostringstream oss;
+        oss << event.season << " 2024";
+        JulianDate published(2024, event.month, event.day, event.hours, event.minutes, 0.0);
+        spaTestFloatingPointEqual(oss.str(),
+                                  published.getDecimalDays(),
+                                  SUN_UTIL::calculateSeason(2024, event.season),
+                                  tolerance,
+                                  theDigitsOfPrecision);
+    }
+
+    // Far from 2000 the mean start is days out, but the result still
+    // lands on the right longitude.
+    double julianDays = SUN_UTIL::calculateSeason(1600, SeasonType::SeptemberEquinox);
+    double longitude = SUN_UTIL::calculateSunPositionSecular(julianDays).eclipticLongitude;
+    ASSERT_EQUAL_DELTAM("Longitude at 1600 September equinox", 180.0, longitude, 1.0e-5);
+
+    std::ostringstream oss;
+    oss << SeasonType::MarchEquinox << ", " << SeasonType::JuneSolstice << ", "
+        << SeasonType::SeptemberEquinox << ", " << SeasonType::DecemberSolstice;
+    ASSERT_EQUALM("Season names",
+                  std::string("March equinox, June solstice, September equinox, December solstice"),
+                  oss.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file SunUtilities_TestClass.h
+ * @brief Declaration of the CUTE test class for SunUtilities
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_SUNUTILITIES_TESTCLASS_H_
+#define TEST_SUNUTILITIES_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for SunUtilities
+ * @ingroup group_test
+ */
+class SunUtilities_TestClass
+{
+    public:
+        /// Default constructor
+        SunUtilities_TestClass();
+
+        /// Default destructor
+        virtual ~SunUtilities_TestClass() = default;
+
+        /**
+         * Tests the ecliptic longitude of the Sun against the low
+         * precision formula of Meeus Chapter 25 at several epochs.
+         */
+        void testSunEclipticLongitude();
+
+        /**
+         * Tests the Sun's distance and angular size, including their
+         * extremes at perihelion and aphelion.
+         */
+        void testSunDistanceAndAngularSize();
+
+        /**
+         * Tests that the batch and time-series interfaces give the
+         * same answers as the scalar interface.
+         */
+        void testBatchMatchesScalar();
+
+        /**
+         * Tests the equation of time against independently calculated
+         * values, and the batch and series interfaces against the
+         * scalar one.
+         */
+        void testEquationOfTime();
+
+        /**
+         * Tests the accuracy of the compressed equation of time table.
+         */
+        void testEquationOfTimeTable();
+
+        /**
+         * Tests the solar elongation for objects at known positions
+         * relative to the Sun.
+         */
+        void testSolarElongation();
+
+        /**
+         * Tests the times of the equinoxes and solstices of 2024
+         * against published values, and their ostream operator.
+         */
+        void testSeasons();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testSunEclipticLongitude);
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testSunDistanceAndAngularSize);
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testBatchMatchesScalar);
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testEquationOfTime);
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testEquationOfTimeTable);
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testSolarElongation);
+            aSuite += CUTE_SMEMFUN(SunUtilities_TestClass, testSeasons);
+        }
+
+    private:
+        /// Test tolerance for angles, degrees.
+        double theDegreeTolerance;
+
+        /// Number of digits to print numbers to.
+        int theDigitsOfPrecision;
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_SUNUTILITIES_TESTCLASS_H_ */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ThreadPool_TestClass.cc
+ * @brief Definition of ThreadPool_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ThreadPool_TestClass.h"
+#include "ThreadPool.h"
+#include "ParallelUtilities.h"
+#include "SpaConstants.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void ThreadPool_TestClass::testCoverage()
+{
+    const std::size_t counts[] = {0, 1, 7, 1000, 100001};
+    const std::size_t chunkSizes[] = {0, 1, 13, 4096};
+    const unsigned int threads[] = {1, 2, 4, 8};
+    for (unsigned int numThreads : threads)
+    {
+        ThreadPool pool(numThreads);
+        ASSERT_EQUALM("Number of threads", numThreads, pool.getNumThreads());
+        for (std::size_t count : counts)
+        {
+            for (std::size_t chunkSize : chunkSizes)
+            {
+                std::vector<int> visits(count, 0);
+                PARALLEL_UTIL::parallelFor(count, [&visits](std::size_t i) { visits[i]++; }, &pool, chunkSize);
+                bool once = true;
+                for (int visit : visits)
+                {
+                    once = once && (visit == 1);
+                }
+                ASSERTM("Every index visited once", once);
+            }
+        }
+    }
+}
+
+void ThreadPool_TestClass::testDeterminism()
+{
+    const std::size_t count = 50000;
+    std::vector<double> input(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        input[i] = 2451545.0 + 0.37 * i;
+    }
+    auto function = [](double aValue) { return std::sin(aValue) * std::exp(std::cos(aValue)); };
+
+    std::vector<double> expected(count);
+    std::set<std::pair<std::size_t, std::size_t>> expectedChunks;
+    for (unsigned int numThreads : {1u, 3u, 8u})
+    {
+        ThreadPool pool(numThreads);
+        std::vector<double> output(count);
+        PARALLEL_UTIL::parallelTransform(input.data(), count, output.data(), function, &pool);
+
+        std::mutex mutex;
+        std::set<std::pair<std::size_t, std::size_t>> chunks;
+        pool.run(count,
+                 0,
+                 [&mutex, &chunks](std::size_t aBegin, std::size_t anEnd)
+                 {
+                     std::lock_guard<std::mutex> lock(mutex);
+                     chunks.insert(std::make_pair(aBegin, anEnd));
+                 });
+
+        if (numThreads == 1)
+        {
+            expected = output;
+            expectedChunks = chunks;
+            continue;
+        }
+        bool identical = true;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            identical = identical && (output[i] == expected[i]);
+        }
+        ASSERTM("Same output on any number of threads", identical);
+        ASSERTM("Same chunks on any number of threads", chunks == expectedChunks);
+    }
+
+    // In place, on the shared pool.
+    std::vector<double> inPlace(input);
+    PARALLEL_UTIL::parallelTransform(inPlace.data(), count, inPlace.data(), function);
+    ASSERTM("In place", inPlace == expected);
+}
+
+void ThreadPool_TestClass::testNested()
+{
+    ThreadPool pool(4);
+    const std::size_t outer = 16;
+    const std::size_t inner = 1000;
+    std::vector<std::size_t> sums(outer, 0);
+    PARALLEL_UTIL::parallelFor(outer,
+                               [&pool, &sums](std::size_t i)
+                               {
+                                   std::vector<std::size_t> values(inner);
+                                   PARALLEL_UTIL::parallelFor(inner,
+                                                              [&values, i](std::size_t j) { values[j] = i + j; },
+                                                              &pool,
+                                                              10);
+                                   for (std::size_t value : values)
+                                   {
+                                       sums[i] += value;
+                                   }
+                               },
+                               &pool,
+                               1);
+    for (std::size_t i = 0; i < outer; i++)
+    {
+        ASSERT_EQUALM("Nested sum", i * inner + inner * (inner - 1) / 2, sums[i]);
+    }
+}
+
+void ThreadPool_TestClass::testChunkSize()
+{
+    ASSERT_EQUALM("Small counts use the minimum", SPA_PARALLEL_MIN_CHUNK_SIZE, ThreadPool::chooseChunkSize(0));
+    ASSERT_EQUALM("Small counts use the minimum", SPA_PARALLEL_MIN_CHUNK_SIZE, ThreadPool::chooseChunkSize(1000));
+    ASSERT_EQUALM("Large counts use the target number of chunks",
+                  std::size_t(4000),
+                  ThreadPool::chooseChunkSize(4000 * SPA_PARALLEL_TARGET_CHUNKS));
+    ASSERTM("Default pool has at least one thread", ThreadPool::getDefault().getNumThreads() >= 1);
+}
+
+void ThreadPool_TestClass::testException()
+{
+    ThreadPool pool(4);
+    for (std::size_t failing : {std::size_t(0), std::size_t(500), std::size_t(990)})
+    {
+        std::atomic<std::size_t> finished(0);
+        bool caught = false;
+        try
+        {
+            pool.run(1000,
+                     10,
+                     [&finished, failing](std::size_t aBegin, std::size_t)
+                     {
+                         if (aBegin == failing)
+                         {
+                             throw std::runtime_error("chunk failed");
+                         }
+                         finished++;
+                     });
+        }
+        catch (const std::runtime_error&)
+        {
+            caught = true;
+        }
+        ASSERTM("Exception rethrown by run()", caught);
+        ASSERT_EQUALM("Other chunks finished first", std::size_t(99), finished.load());
+    }
+
+    std::vector<int> visits(1000, 0);
+    PARALLEL_UTIL::parallelFor(visits.size(), [&visits](std::size_t i) { visits[i]++; }, &pool, 10);
+    ASSERTM("Pool usable afterwards", visits == std::vector<int>(1000, 1));
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
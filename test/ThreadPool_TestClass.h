@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file ThreadPool_TestClass.h
+ * @brief Declaration of the CUTE test class for ThreadPool
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_THREADPOOL_TESTCLASS_H_
+#define TEST_THREADPOOL_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for ThreadPool
+ * @ingroup group_test
+ */
+class ThreadPool_TestClass
+{
+    public:
+        /// Default constructor
+        ThreadPool_TestClass() = default;
+
+        /// Default destructor
+        virtual ~ThreadPool_TestClass() = default;
+
+        /**
+         * Tests that every index is visited exactly once for a range
+         * of counts, chunk sizes and numbers of threads.
+         */
+        void testCoverage();
+
+        /**
+         * Tests that the chunks, and the results of
+         * parallelTransform(), do not depend on the number of threads.
+         */
+        void testDeterminism();
+
+        /**
+         * Tests a parallel loop run from inside another.
+         */
+        void testNested();
+
+        /**
+         * Tests the automatic choice of chunk size.
+         */
+        void testChunkSize();
+
+        /**
+         * Tests that an exception thrown by a chunk reaches the caller
+         * of run() once every chunk has finished.
+         */
+        void testException();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(ThreadPool_TestClass, testCoverage);
+            aSuite += CUTE_SMEMFUN(ThreadPool_TestClass, testDeterminism);
+            aSuite += CUTE_SMEMFUN(ThreadPool_TestClass, testNested);
+            aSuite += CUTE_SMEMFUN(ThreadPool_TestClass, testChunkSize);
+            aSuite += CUTE_SMEMFUN(ThreadPool_TestClass, testException);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_THREADPOOL_TESTCLASS_H_ */
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file TimeOfDay_TestClass.cc
+ * @brief Definition of TimeOfDay_TestClass functions
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "TimeOfDay_TestClass.h"
+#include "TimeOfDay.h"
+#include "SerialDate.h"
+#include "SpaTime.h"
+#include "SpaTimeConstants.h"
+#include "TimeUtilities.h"
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace SPA
+{
+namespace TEST
+{
+
+void TimeOfDay_TestClass::testConstructors()
+{
+    ASSERT_EQUALM("Default is midnight", std::int64_t(0), TimeOfDay().getTicks());
+
+    TimeOfDay time(13, 45, 30.25);
+    ASSERT_EQUALM("Ticks", 13 * SPA_TICKS_IN_HOUR + 45 * SPA_TICKS_IN_MINUTE + 30250000000LL,
+                  time.getTicks());
+    ASSERT_EQUALM("Hours", 13, time.getHours());
+    ASSERT_EQUALM("Minutes", 45, time.getMinutes());
+    ASSERT_EQUAL_DELTAM("Seconds", 30.25, time.getSeconds(), 1.0e-12);
+    ASSERTM("From ticks", TimeOfDay(time.getTicks()) == time);
+
+    ASSERT_EQUALM("Rounded to the nearest tick", std::int64_t(2),
+                  TimeOfDay(0, 0, 1.6e-9).getTicks());
+    ASSERTM("Leap second wraps to midnight", TimeOfDay(23, 59, 60.0) == TimeOfDay());
+
+    SpaTime spaTime(6, 7, 8.5, -5.0);
+    ASSERTM("From SpaTime ignores the offset", TimeOfDay(spaTime) == TimeOfDay(6, 7, 8.5));
+}
+
+void TimeOfDay_TestClass::testCarry()
+{
+    TimeOfDay time(23, 0, 0);
+    std::int32_t carry = time.addTicks(2 * SPA_TICKS_IN_HOUR);
+    ASSERT_EQUALM("Carry forward", 1, carry);
+    ASSERTM("Wrapped forward", time == TimeOfDay(1, 0, 0));
+
+    carry = time.subtractTicks(2 * SPA_TICKS_IN_HOUR);
+    ASSERT_EQUALM("Carry back", -1, carry);
+    ASSERTM("Wrapped back", time == TimeOfDay(23, 0, 0));
+
+    carry = time.addTicks(-3 * SPA_TICKS_IN_DAY - SPA_TICKS_IN_HOUR);
+    ASSERT_EQUALM("Several days back", -3, carry);
+    ASSERTM("Several days back time", time == TimeOfDay(22, 0, 0));
+
+    carry = time.addTicks(0);
+    ASSERT_EQUALM("No carry", 0, carry);
+
+    time = TimeOfDay::fromTicks(-1, carry);
+    ASSERT_EQUALM("One tick before midnight", -1, carry);
+    ASSERT_EQUALM("Last tick of the day", SPA_TICKS_IN_DAY - 1, time.getTicks());
+
+    time = TimeOfDay::fromTicks(SPA_TICKS_IN_DAY, carry);
+    ASSERT_EQUALM("Midnight next day", 1, carry);
+    ASSERT_EQUALM("Midnight ticks", std::int64_t(0), time.getTicks());
+
+    // Carries move a SerialDate
+    SerialDate date(2024, 12, 31);
+    time = TimeOfDay(18, 0, 0);
+    date += time.addTicks(12 * SPA_TICKS_IN_HOUR);
+    ASSERTM("Date after carry", date == SerialDate(2025, 1, 1));
+    ASSERTM("Time after carry", time == TimeOfDay(6, 0, 0));
+
+    ASSERT_EQUALM("Difference", -SPA_TICKS_IN_HOUR, TimeOfDay(5, 0, 0) - TimeOfDay(6, 0, 0));
+    ASSERTM("Less", TimeOfDay(5, 0, 0) < TimeOfDay(5, 0, 0.000000001));
+    ASSERTM("Greater", TimeOfDay(5, 0, 1) > TimeOfDay(5, 0, 0));
+    ASSERTM("Not equal", TimeOfDay(5, 0, 1) != TimeOfDay(5, 0, 0));
+    ASSERTM("Less or equal", TimeOfDay(5, 0, 0) <= TimeOfDay(5, 0, 0));
+    ASSERTM("Greater or equal", TimeOfDay(5, 0, 0) >= TimeOfDay(5, 0, 0));
+}
+
+void TimeOfDay_TestClass::testConversions()
+{
+    TimeOfDay time(18, 30, 0);
+    ASSERT_EQUAL_DELTAM("Decimal hours", 18.5, time.getDecimalHours(), 1.0e-15);
+    ASSERT_EQUAL_DELTAM("Day fraction", 18.5 / 24.0, time.getDayFraction(), 1.0e-15);
+
+    std::int32_t carry;
+    TimeOfDay fromHours = TimeOfDay::fromDecimalHours(18.5, carry);
+    ASSERT_EQUALM("Decimal hours carry", 0, carry);
+    ASSERTM("From decimal hours", fromHours == time);
+    fromHours = TimeOfDay::fromDecimalHours(-5.5, carry);
+    ASSERT_EQUALM("Negative hours carry", -1, carry);
+    ASSERTM("Negative hours", fromHours == time);
+    fromHours = TimeOfDay::fromDecimalHours(48 + 18.5, carry);
+    ASSERT_EQUALM("Two days carry", 2, carry);
+    ASSERTM("Two days on", fromHours == time);
+
+    // Agreement with SpaTime for the same clock reading
+    SpaTime spaTime(7, 12, 33.125, 0);
+    TimeOfDay fromSpaTime(spaTime);
+    ASSERT_EQUAL_DELTAM("SpaTime day fraction", spaTime.getDayFraction(),
+                        fromSpaTime.getDayFraction(), 1.0e-14);
+    SpaTime back = fromSpaTime.getSpaTime(3.0);
+    ASSERT_EQUALM("SpaTime hours", 7, back.getHours());
+    ASSERT_EQUALM("SpaTime minutes", 12, back.getMinutes());
+    ASSERT_EQUALM("SpaTime seconds", 33.125, back.getSeconds());
+    ASSERT_EQUALM("SpaTime offset", 3.0, back.getUtcOffsetHours());
+}
+
+void TimeOfDay_TestClass::testBulk()
+{
+    std::vector<TimeOfDay> times;
+    std::vector<double> hours;
+    for (int i = 0; i < 1000; i++)
+    {
+        std::int32_t carry;
+        double decimalHours = -30.0 + 0.0791 * i;
+        hours.push_back(decimalHours);
+        times.push_back(TimeOfDay::fromDecimalHours(decimalHours, carry));
+    }
+    std::size_t count = times.size();
+
+    const std::int64_t increments[] = {0, 1, -1, 17 * SPA_TICKS_IN_HOUR, -3 * SPA_TICKS_IN_DAY - 5,
+                                       SPA_TICKS_IN_DAY, 2 * SPA_TICKS_IN_DAY + SPA_TICKS_IN_MINUTE};
+    for (std::int64_t increment : increments)
+    {
+        std::vector<TimeOfDay> results(count);
+        std::vector<std::int32_t> carries(count);
+        TIME_UTIL::addTicks(times.data(), count, increment, results.data(), carries.data());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            TimeOfDay expected = times[i];
+            std::int32_t expectedCarry = expected.addTicks(increment);
+            ASSERTM("Bulk add", results[i] == expected);
+            ASSERT_EQUALM("Bulk carry", expectedCarry, carries[i]);
+        }
+    }
+    std::vector<TimeOfDay> inPlace(times);
+    TIME_UTIL::addTicks(inPlace.data(), count, SPA_TICKS_IN_HOUR, inPlace.data(), nullptr);
+    ASSERTM("In place without carries", inPlace[0] - times[0] == SPA_TICKS_IN_HOUR);
+
+    std::vector<double> decimalHours(count);
+    TIME_UTIL::convertToDecimalHours(times.data(), count, decimalHours.data());
+    std::vector<TimeOfDay> converted(count);
+    std::vector<std::int32_t> carries(count);
+    TIME_UTIL::convertToTimesOfDay(hours.data(), count, converted.data(), carries.data());
+    std::vector<std::int32_t> buckets(count);
+    TIME_UTIL::calculateTimeOfDayBuckets(times.data(), count, SPA_TICKS_IN_HOUR, buckets.data());
+    for (std::size_t i = 0; i < count; i++)
+    {
+        ASSERT_EQUALM("Bulk decimal hours", times[i].getDecimalHours(), decimalHours[i]);
+        std::int32_t carry;
+        ASSERTM("Bulk from decimal hours",
+                converted[i] == TimeOfDay::fromDecimalHours(hours[i], carry));
+        ASSERT_EQUALM("Bulk decimal hours carry", carry, carries[i]);
+        ASSERT_EQUALM("Hour bucket", times[i].getHours(), buckets[i]);
+    }
+}
+
+void TimeOfDay_TestClass::testOstream()
+{
+    std::ostringstream os;
+    os << TimeOfDay(9, 5, 3.000000042);
+    ASSERT_EQUALM("TimeOfDay output",
+                  std::string("TimeOfDay{ theTicks=32703000000042 (09:05:03.000000042) }"),
+                  os.str());
+}
+
+} /* namespace TEST */
+} /* namespace SPA */
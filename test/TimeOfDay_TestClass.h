@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file TimeOfDay_TestClass.h
+ * @brief Declaration of the CUTE test class for TimeOfDay
+ * @ingroup group_test
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#ifndef TEST_TIMEOFDAY_TESTCLASS_H_
+#define TEST_TIMEOFDAY_TESTCLASS_H_
+
+#include <cute/cute.h>
+
+namespace SPA
+{
+namespace TEST
+{
+
+/**
+ * @brief CUTE test class for TimeOfDay
+ * @ingroup group_test
+ */
+class TimeOfDay_TestClass
+{
+    public:
+        /// Default constructor
+        TimeOfDay_TestClass() = default;
+
+        /// Default destructor
+        virtual ~TimeOfDay_TestClass() = default;
+
+        /**
+         * Tests construction from ticks, clock readings and SpaTime.
+         */
+        void testConstructors();
+
+        /**
+         * Tests wrapping round midnight and the days carried.
+         */
+        void testCarry();
+
+        /**
+         * Tests conversion to and from decimal hours, day fractions
+         * and SpaTime.
+         */
+        void testConversions();
+
+        /**
+         * Tests the TIME_UTIL bulk operations against the scalar ones.
+         */
+        void testBulk();
+
+        /**
+         * Tests the ostream operator.
+         */
+        void testOstream();
+
+        /**
+         * Adds all methods that run this class's unit tests to the given cute suite.
+         *
+         * @param[in,out] aSuite The cute suite that the tests will be added to.
+         */
+        static void makeTestSuite(cute::suite& aSuite)
+        {
+            aSuite += CUTE_SMEMFUN(TimeOfDay_TestClass, testConstructors);
+            aSuite += CUTE_SMEMFUN(TimeOfDay_TestClass, testCarry);
+            aSuite += CUTE_SMEMFUN(TimeOfDay_TestClass, testConversions);
+            aSuite += CUTE_SMEMFUN(TimeOfDay_TestClass, testBulk);
+            aSuite += CUTE_SMEMFUN(TimeOfDay_TestClass, testOstream);
+        }
+    private:
+};
+
+} /* namespace TEST */
+} /* namespace SPA */
+
+#endif /* TEST_TIMEOFDAY_TESTCLASS_H_ */
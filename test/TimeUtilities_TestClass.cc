@@ -27,8 +27,12 @@
 
 #include "TimeUtilities_TestClass.h"
 #include "TimeUtilities.h"
+#include "CalendarCursor.h"
 #include "DateAndTime.h"
 #include "JulianDate.h"
+#include "SpaDate.h"
+#include "SpaTimeConstants.h"
+#include "ThreadPool.h"
 
 #include <array>
 #include <sstream>
@@ -36,6 +40,7 @@
 #include <string>
 #include <map>
 #include <utility>
+#include <vector>
 
 namespace SPA
 {
@@ -484,6 +489,44 @@ bool TimeUtilities_TestClass::hoursMinutesSecondsMatch(int anHoursA,
     return true;
 }
 
+void TimeUtilities_TestClass::testCalculateSiderealTime()
+{
+    using namespace TIME_UTIL;
+    double tolerance = 1.0e-6;
+
+    // 1. PAWYC Section 12 example.
+    JulianDate jd(1980, 4, 22, 14, 36, 51.67, 0);
+    double gst = calculateGreenwichSiderealTime(jd);
+    ASSERT_EQUAL_DELTAM("1. GST incorrect.",
+                        calculateDecimalHours(4, 40, 5.23),
+                        gst,
+                        tolerance);
+
+    // 2. GST advances by one sidereal day (slightly more than 24
+    //    sidereal hours) per solar day, and is continuous across 0h UT.
+    double before = calculateGreenwichSiderealTime(JulianDate(2451544.5 - 1.0e-6));
+    double after = calculateGreenwichSiderealTime(JulianDate(2451544.5 + 1.0e-6));
+    ASSERT_EQUAL_DELTAM("2. GST discontinuous at 0h UT.",
+                        2.0e-6 * 24.0 * SPA_SIDEREAL_RATE,
+                        after - before,
+                        tolerance);
+
+    // 3. LST wraps into [0, 24) for both east and west longitudes.
+    ASSERT_EQUAL_DELTAM("3a. LST west incorrect.",
+                        calculateDecimalHours(0, 24, 5.23),
+                        calculateLocalSiderealTime(gst, -64.0),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("3b. LST west wrap incorrect.",
+                        23.0,
+                        calculateLocalSiderealTime(1.0, -30.0),
+                        tolerance);
+    ASSERT_EQUAL_DELTAM("3c. LST east wrap incorrect.",
+                        1.0,
+                        calculateLocalSiderealTime(23.0, 30.0),
+                        tolerance);
+    return;
+}
+
 void TimeUtilities_TestClass::testTimeEnumerationOstream()
 {
     // Ugly but neccessary at this time.
@@ -549,5 +592,199 @@ void TimeUtilities_TestClass::testTimeEnumerationOstream()
 }
 
 
+void TimeUtilities_TestClass::testBatchConversions()
+{
+    // Every quarter day from 1500 to 2500, spanning the change of
+    // calendar.
+    const std::size_t count = 4 * 365243;
+    std::vector<double> julianDays(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        julianDays[i] = 2268923.5 + 0.25 * i;
+    }
+    std::vector<WeekDays> expectedWeekDays(count);
+    std::vector<DateAndTime> expectedDates(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        JulianDate jd(julianDays[i]);
+        expectedWeekDays[i] = TIME_UTIL::calculateDayInTheWeek(jd);
+        expectedDates[i] = jd.getDateAndTime();
+    }
+    std::vector<double> expectedJulianDays(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        expectedJulianDays[i] = JulianDate(expectedDates[i]).getDecimalDays();
+    }
+
+    for (unsigned int numThreads : {1u, 2u, 5u})
+    {
+        ThreadPool pool(numThreads);
+        std::vector<WeekDays> weekDays(count);
+        std::vector<DateAndTime> dates(count);
+        std::vector<double> roundTrip(count);
+        TIME_UTIL::calculateDaysInTheWeek(julianDays.data(), count, weekDays.data(), &pool);
+        TIME_UTIL::convertToDateAndTimes(julianDays.data(), count, dates.data(), &pool, 1000);
+        TIME_UTIL::convertToJulianDays(dates.data(), count, roundTrip.data(), &pool);
+
+        bool weekDaysMatch = true;
+        bool datesMatch = true;
+        bool julianDaysMatch = true;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            weekDaysMatch = weekDaysMatch && (weekDays[i] == expectedWeekDays[i]);
+            datesMatch = datesMatch && (dates[i] == expectedDates[i]);
+            julianDaysMatch = julianDaysMatch && (roundTrip[i] == expectedJulianDays[i]);
+        }
+        ASSERTM("Days of the week", weekDaysMatch);
+        ASSERTM("Dates", datesMatch);
+        ASSERTM("Julian Dates", julianDaysMatch);
+    }
+    return;
+}
+
+namespace
+{
+
+/*
+ * The day number formula of PAWYC Section 3, as calculateDayNumber()
+ * computed it before it used the day-of-year tables. Kept here as an
+ * independent reference.
+ */
+int pawycDayNumber(int aYear, int aMonth, int aDay)
+{
+    int multiplicand = TIME_UTIL::isLeapYear(aYear) ? 62 : 63;
+    int dayNumber = 0;
+    if (aMonth > FEB)
+    {
+        dayNumber = int(SPA_AVG_DAYS_PER_MONTH * (aMonth + 1)) - multiplicand;
+    }
+    else
+    {
+        dayNumber = (aMonth - 1) * multiplicand / 2;
+    }
+    return dayNumber + aDay;
+}
+
+} // end anonymous namespace
+
+void TimeUtilities_TestClass::testDayOfYear()
+{
+    ASSERT_EQUALM("1985-02-17", 48, SPA::TIME_UTIL::calculateDayOfYear(1985, 2, 17));
+    ASSERT_EQUALM("2018-09-02", 245, SPA::TIME_UTIL::calculateDayOfYear(2018, 9, 2));
+    ASSERT_EQUALM("Leap day", 60, SPA::TIME_UTIL::calculateDayOfYear(2024, 2, 29));
+    ASSERT_EQUALM("March 1st, common year", 60, SPA::TIME_UTIL::calculateDayOfYear(1900, 3, 1));
+    ASSERT_EQUALM("December 31st, leap year", 366, SPA::TIME_UTIL::calculateDayOfYear(2000, 12, 31));
+    ASSERT_EQUALM("January 0", 0, SPA::TIME_UTIL::calculateDayOfYear(1990, 1, 0));
+
+    std::vector<int> years;
+    std::vector<int> months;
+    std::vector<int> days;
+    std::vector<int> expected;
+    bool allMatch = true;
+    for (SPA::CalendarCursor cursor(SPA::SpaDate(1599, 1, 1), SPA::SpaDate(2401, 12, 31));
+         !cursor.isDone();
+         cursor.next())
+    {
+        int year = cursor.getYear();
+        int month = cursor.getMonth();
+        int day = cursor.getDay();
+        int dayOfYear = SPA::TIME_UTIL::calculateDayOfYear(year, month, day);
+        int outMonth;
+        int outDay;
+        SPA::TIME_UTIL::calculateMonthAndDay(year, dayOfYear, outMonth, outDay);
+        allMatch = allMatch
+            && dayOfYear == cursor.getDayOfYear()
+            && dayOfYear == pawycDayNumber(year, month, day)
+            && SPA::TIME_UTIL::calculateDayNumber(year, month, day) == dayOfYear
+            && outMonth == month && outDay == day;
+        years.push_back(year);
+        months.push_back(month);
+        days.push_back(day);
+        expected.push_back(dayOfYear);
+    }
+    ASSERTM("Day of year and inverse", allMatch);
+
+    std::vector<int> daysOfYear(years.size());
+    SPA::TIME_UTIL::calculateDaysOfYear(years.data(), months.data(), days.data(), years.size(),
+                                        daysOfYear.data());
+    ASSERTM("Batch day of year", daysOfYear == expected);
+    std::vector<int> outMonths(years.size());
+    std::vector<int> outDays(years.size());
+    SPA::TIME_UTIL::calculateMonthsAndDays(years.data(), daysOfYear.data(), years.size(),
+                                           outMonths.data(), outDays.data());
+    ASSERTM("Batch months", outMonths == months);
+    ASSERTM("Batch days", outDays == days);
+}
+
+void TimeUtilities_TestClass::testIsoWeekDate()
+{
+    struct WeekDate
+    {
+        int year;
+        int month;
+        int day;
+        int isoYear;
+        int isoWeek;
+        int isoWeekDay;
+    };
+    const std::vector<WeekDate> knownDates = {
+        {2005, 1, 1, 2004, 53, 6},
+        {2005, 1, 2, 2004, 53, 7},
+        {2007, 12, 31, 2008, 1, 1},
+        {2008, 12, 29, 2009, 1, 1},
+        {2009, 12, 31, 2009, 53, 4},
+        {2010, 1, 3, 2009, 53, 7},
+        {2026, 10, 18, 2026, 42, 7},
+        {1, 1, 1, 1, 1, 1} };
+    for (const WeekDate& date : knownDates)
+    {
+        std::ostringstream ss;
+        ss << date.year << "-" << date.month << "-" << date.day;
+        int isoYear;
+        int isoWeek;
+        int isoWeekDay;
+        SPA::TIME_UTIL::calculateIsoWeekDate(date.year, date.month, date.day, isoYear, isoWeek, isoWeekDay);
+        ASSERT_EQUALM(ss.str() + " ISO year", date.isoYear, isoYear);
+        ASSERT_EQUALM(ss.str() + " ISO week", date.isoWeek, isoWeek);
+        ASSERT_EQUALM(ss.str() + " ISO weekday", date.isoWeekDay, isoWeekDay);
+    }
+    ASSERT_EQUALM("Weeks in 2020", 53, SPA::TIME_UTIL::calculateIsoWeeksInYear(2020));
+    ASSERT_EQUALM("Weeks in 2021", 52, SPA::TIME_UTIL::calculateIsoWeeksInYear(2021));
+    ASSERT_EQUALM("Weeks in 2026", 53, SPA::TIME_UTIL::calculateIsoWeeksInYear(2026));
+
+    // Week dates count up through every day, and convert back
+    int previousYear = 1599;
+    int previousWeek = 52;
+    int previousWeekDay = 7;
+    bool allMatch = true;
+    for (SPA::CalendarCursor cursor(SPA::SpaDate(1600, 1, 3), SPA::SpaDate(2401, 12, 31));
+         !cursor.isDone();
+         cursor.next())
+    {
+        int isoYear;
+        int isoWeek;
+        int isoWeekDay;
+        SPA::TIME_UTIL::calculateIsoWeekDate(cursor.getYear(), cursor.getMonth(), cursor.getDay(),
+                                             isoYear, isoWeek, isoWeekDay);
+        bool isNextDay = (isoWeekDay == previousWeekDay + 1 && isoWeek == previousWeek && isoYear == previousYear)
+            || (isoWeekDay == 1 && previousWeekDay == 7
+                && ((isoWeek == previousWeek + 1 && isoYear == previousYear)
+                    || (isoWeek == 1 && isoYear == previousYear + 1
+                        && previousWeek == SPA::TIME_UTIL::calculateIsoWeeksInYear(previousYear))));
+
+        int year;
+        int month;
+        int day;
+        SPA::TIME_UTIL::calculateDateFromIsoWeekDate(isoYear, isoWeek, isoWeekDay, year, month, day);
+        allMatch = allMatch && isNextDay
+            && isoWeekDay % SPA::SPA_DAYS_PER_WEEK == int(cursor.getWeekDay())
+            && year == cursor.getYear() && month == cursor.getMonth() && day == cursor.getDay();
+        previousYear = isoYear;
+        previousWeek = isoWeek;
+        previousWeekDay = isoWeekDay;
+    }
+    ASSERTM("Consecutive week dates and round trip", allMatch);
+}
+
 } /* namespace TEST */
 } /* namespace SPA */
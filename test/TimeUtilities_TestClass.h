@@ -75,6 +75,12 @@ class TimeUtilities_TestClass
          */
         void testCalculateEaster();
 
+        /**
+         * Tests the calculation of Greenwich and local sidereal time,
+         * including wrapping into the range [0, 24).
+         */
+        void testCalculateSiderealTime();
+
         /**
          * Tests splitting a real number into an integer and fractional
          *  parts.
@@ -103,6 +109,26 @@ class TimeUtilities_TestClass
          */
         void testTimeEnumerationOstream();
 
+        /**
+         * Tests that the batch conversions between Julian Dates, dates
+         * and days of the week match the scalar ones on pools of
+         * several sizes.
+         */
+        void testBatchConversions();
+
+        /**
+         * Tests the table-driven day of the year, its inverse and
+         * their batch versions against calculateDayNumber() and a
+         * CalendarCursor.
+         */
+        void testDayOfYear();
+
+        /**
+         * Tests ISO 8601 week dates against known dates and their
+         * round trip.
+         */
+        void testIsoWeekDate();
+
         /**
          * @brief Utility function that returns true if two
          *   times, A and B, have matching hours, minutes and seconds.
@@ -144,7 +170,11 @@ class TimeUtilities_TestClass
             aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testCalculateDayInTheWeek);
             aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testCalculateDecimalHours);
             aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testCalculateHoursMinutesAndSeconds);
+            aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testCalculateSiderealTime);
             aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testTimeEnumerationOstream);
+            aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testBatchConversions);
+            aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testDayOfYear);
+            aSuite += CUTE_SMEMFUN(TimeUtilities_TestClass, testIsoWeekDate);
         }
     private:
 };
@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file spa_thread_stress_test.cc
+ * @brief Calls every TIME_UTIL and JulianDate function from many
+ *   threads at once and checks the answers.
+ * @ingroup group_test
+ *
+ * Intended to be built with -DSPA_THREAD_SANITIZER=ON, so that any
+ * data race in the time functions is reported by ThreadSanitizer, but
+ * it also checks results in an ordinary build.
+ *
+ * Usage: spa_thread_stress_test [numThreads [numPasses]]
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "TimeUtilities.h"
+#include "DateAndTime.h"
+#include "JulianDate.h"
+#include "TimeDifference.h"
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using namespace SPA;
+using namespace SPA::TIME_UTIL;
+
+/// Everything the time functions say about one Julian Date.
+struct Record
+{
+    WeekDays weekDay;
+    WeekDays weekDayFromDate;
+    WeekDays weekDayFromYmd;
+    int dayNumber;
+    int daysInTheYear;
+    bool leapYear;
+    int easterMonth;
+    int easterDay;
+    double greenwichSiderealTime;
+    double localSiderealTime;
+    int hours;
+    int minutes;
+    double seconds;
+    double decimalHours;
+    double integerPart;
+    double fractionalPart;
+    int quotient;
+    int remainder;
+    int bceYear;
+    double modifiedJulianDate;
+    double roundTrip;
+    double shifted;
+    double difference;
+    std::string text;
+};
+
+Record evaluate(const JulianDate& aJulianDate)
+{
+    Record record;
+    DateAndTime date = aJulianDate.getDateAndTime();
+    int year = date.getYear();
+    record.weekDay = calculateDayInTheWeek(aJulianDate);
+    record.weekDayFromDate = calculateDayInTheWeek(date);
+    record.weekDayFromYmd = calculateDayInTheWeek(year, date.getMonth(), date.getDay());
+    record.dayNumber = calculateDayNumber(year, date.getMonth(), date.getDay());
+    record.daysInTheYear = daysInYear(year);
+    record.leapYear = isLeapYear(year);
+    calculateEaster(year, record.easterMonth, record.easterDay);
+    record.greenwichSiderealTime = calculateGreenwichSiderealTime(aJulianDate);
+    record.localSiderealTime = calculateLocalSiderealTime(record.greenwichSiderealTime, -64.0);
+    calculateHoursMinutesAndSeconds(record.greenwichSiderealTime, record.hours, record.minutes, record.seconds);
+    record.decimalHours = calculateDecimalHours(record.hours, record.minutes, record.seconds);
+    integerAndFraction(aJulianDate.getDecimalDays(), record.integerPart, record.fractionalPart);
+    quotientAndRemainder(year, 19, record.quotient, record.remainder);
+    record.bceYear = convertBCE_Year(year);
+    record.modifiedJulianDate = aJulianDate.getModifiedJulianDate();
+    record.roundTrip = JulianDate(date).getDecimalDays();
+    JulianDate copy(aJulianDate);
+    copy += TimeDifference(1.25);
+    record.shifted = (copy - TimeDifference(0.5)).getDecimalDays();
+    record.difference = (copy - aJulianDate).getDecimalDayDifference();
+
+    std::ostringstream oss;
+    oss << record.weekDay << " " << static_cast<Months>(date.getMonth()) << " " << date;
+    record.text = oss.str();
+    return record;
+}
+
+bool operator==(const Record& aLHS, const Record& aRHS)
+{
+    return aLHS.weekDay == aRHS.weekDay
+           && aLHS.weekDayFromDate == aRHS.weekDayFromDate
+           && aLHS.weekDayFromYmd == aRHS.weekDayFromYmd
+           && aLHS.dayNumber == aRHS.dayNumber
+           && aLHS.daysInTheYear == aRHS.daysInTheYear
+           && aLHS.leapYear == aRHS.leapYear
+           && aLHS.easterMonth == aRHS.easterMonth
+           && aLHS.easterDay == aRHS.easterDay
+           && aLHS.greenwichSiderealTime == aRHS.greenwichSiderealTime
+           && aLHS.localSiderealTime == aRHS.localSiderealTime
+           && aLHS.hours == aRHS.hours
+           && aLHS.minutes == aRHS.minutes
+           && aLHS.seconds == aRHS.seconds
+           && aLHS.decimalHours == aRHS.decimalHours
+           && aLHS.integerPart == aRHS.integerPart
+           && aLHS.fractionalPart == aRHS.fractionalPart
+           && aLHS.quotient == aRHS.quotient
+           && aLHS.remainder == aRHS.remainder
+           && aLHS.bceYear == aRHS.bceYear
+           && aLHS.modifiedJulianDate == aRHS.modifiedJulianDate
+           && aLHS.roundTrip == aRHS.roundTrip
+           && aLHS.shifted == aRHS.shifted
+           && aLHS.difference == aRHS.difference
+           && aLHS.text == aRHS.text;
+}
+
+/// Results of the batch functions for a whole array of dates.
+struct BatchRecord
+{
+    std::vector<WeekDays> weekDays;
+    std::vector<DateAndTime> dates;
+    std::vector<double> julianDays;
+};
+
+BatchRecord evaluateBatch(const std::vector<double>& aJulianDays, ThreadPool* aPool)
+{
+    BatchRecord record;
+    std::size_t count = aJulianDays.size();
+    record.weekDays.resize(count);
+    record.dates.resize(count);
+    record.julianDays.resize(count);
+    calculateDaysInTheWeek(aJulianDays.data(), count, record.weekDays.data(), aPool, 97);
+    convertToDateAndTimes(aJulianDays.data(), count, record.dates.data(), aPool);
+    convertToJulianDays(record.dates.data(), count, record.julianDays.data(), aPool, 13);
+    return record;
+}
+
+bool operator==(const BatchRecord& aLHS, const BatchRecord& aRHS)
+{
+    return aLHS.weekDays == aRHS.weekDays
+           && aLHS.dates == aRHS.dates
+           && aLHS.julianDays == aRHS.julianDays;
+}
+
+} // end anonymous namespace
+
+/**
+ * @brief Stress test driver
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Array of arguments
+ * @return Zero if every thread got the single-threaded answers
+ */
+int main(int argc, char *argv[])
+{
+    unsigned int numThreads = (argc > 1) ? static_cast<unsigned int>(std::atoi(argv[1])) : 8;
+    int numPasses = (argc > 2) ? std::atoi(argv[2]) : 3;
+    if (numThreads == 0 || numPasses <= 0)
+    {
+        std::cerr << "Usage: " << argv[0] << " [numThreads [numPasses]]" << std::endl;
+        return 2;
+    }
+
+    // Dates from 1600 to 2400 at an irregular step, shared read-only by
+    // every thread.
+    std::vector<double> julianDays;
+    for (double jd = 2305447.5; jd < 2597641.5; jd += 36.61803)
+    {
+        julianDays.push_back(jd);
+    }
+    const std::vector<JulianDate> sharedDates(julianDays.begin(), julianDays.end());
+
+    std::vector<Record> expected;
+    for (const JulianDate& date : sharedDates)
+    {
+        expected.push_back(evaluate(date));
+    }
+    ThreadPool serial(1);
+    const BatchRecord expectedBatch = evaluateBatch(julianDays, &serial);
+
+    std::atomic<std::size_t> failures(0);
+    std::vector<std::thread> threads;
+    for (unsigned int thread = 0; thread < numThreads; thread++)
+    {
+        threads.emplace_back([&, thread]()
+        {
+            std::size_t count = sharedDates.size();
+            std::size_t offset = thread * count / numThreads;
+            for (int pass = 0; pass < numPasses; pass++)
+            {
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    std::size_t index = (offset + i) % count;
+                    if (!(evaluate(sharedDates[index]) == expected[index]))
+                    {
+                        failures++;
+                    }
+                }
+                // Every thread submits to the shared pool at once.
+                if (!(evaluateBatch(julianDays, nullptr) == expectedBatch))
+                {
+                    failures++;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::cout << "spa_thread_stress_test: " << numThreads << " threads, " << numPasses << " passes over "
+              << sharedDates.size() << " dates, " << failures.load() << " failures" << std::endl;
+    return (failures.load() == 0) ? 0 : 1;
+}
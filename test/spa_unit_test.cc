@@ -42,6 +42,32 @@
 #include "SpaTime_TestClass.h"
 #include "JulianDate_TestClass.h"
 #include "TimeDifference_TestClass.h"
+#include "AngleUtilities_TestClass.h"
+#include "SunUtilities_TestClass.h"
+#include "KeplerUtilities_TestClass.h"
+#include "CoordinateUtilities_TestClass.h"
+#include "RiseSetUtilities_TestClass.h"
+#include "ChebyshevUtilities_TestClass.h"
+#include "ChebyshevTable_TestClass.h"
+#include "PlanetOrbit_TestClass.h"
+#include "PlanetUtilities_TestClass.h"
+#include "ChebyshevEphemeris_TestClass.h"
+#include "MoonUtilities_TestClass.h"
+#include "LunarSeries_TestClass.h"
+#include "LunarPhaseUtilities_TestClass.h"
+#include "EclipseUtilities_TestClass.h"
+#include "CometUtilities_TestClass.h"
+#include "CometOrbitTable_TestClass.h"
+#include "BinaryStarOrbit_TestClass.h"
+#include "AstronomicalCalendar_TestClass.h"
+#include "ThreadPool_TestClass.h"
+#include "CpuDispatch_TestClass.h"
+#include "SerialDate_TestClass.h"
+#include "TimeOfDay_TestClass.h"
+#include "SortUtilities_TestClass.h"
+#include "IntervalIndex_TestClass.h"
+#include "CalendarCursor_TestClass.h"
+#include "CalendarPolicy_TestClass.h"
 #include "PolynomialTiming_TestClass.h"
 #include "GetTimeTest.h"
 #include "PAWYC_Examples_TestClass.h"
@@ -74,6 +100,32 @@ int main(int argc, char *argv[])
     SPA::TEST::DateAndTime_TestClass::makeTestSuite(unitTestSuite);
     SPA::TEST::JulianDate_TestClass::makeTestSuite(unitTestSuite);
     SPA::TEST::TimeDifference_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::AngleUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::SunUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::KeplerUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::CoordinateUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::RiseSetUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::ChebyshevUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::ChebyshevTable_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::PlanetOrbit_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::PlanetUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::ChebyshevEphemeris_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::MoonUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::LunarSeries_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::LunarPhaseUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::EclipseUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::CometUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::CometOrbitTable_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::BinaryStarOrbit_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::AstronomicalCalendar_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::ThreadPool_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::CpuDispatch_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::SerialDate_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::TimeOfDay_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::SortUtilities_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::IntervalIndex_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::CalendarCursor_TestClass::makeTestSuite(unitTestSuite);
+    SPA::TEST::CalendarPolicy_TestClass::makeTestSuite(unitTestSuite);
     
     // Examples of PAWYC sections using SPA
     SPA::TEST::PAWYC_Examples_TestClass::makeTestSuite(exampleSuite);
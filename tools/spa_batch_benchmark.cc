@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file spa_batch_benchmark.cc
+ * @brief Command line tool that times the batch kernels at each CPU
+ *   level the processor supports
+ * @ingroup group_examples
+ *
+ * Usage: spa_batch_benchmark [number of elements]
+ *
+ * The calendar kernels vectorize, so they should get faster from the
+ * generic level to SSE4.2 (two doubles per vector) and again with AVX2
+ * and AVX-512. The trigonometric kernels call the C library for every
+ * element and should cost about the same at every level. Levels the
+ * processor cannot run are skipped.
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "CpuDispatch.h"
+#include "GoodTimer.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Elements per kernel call, small enough to stay in the cache
+const std::size_t BLOCK_SIZE = 4096;
+
+/// Prints one row of the results table.
+void report(const std::string& aName, double aSeconds, long anElements, double aChecksum)
+{
+    std::cout << "  " << std::left << std::setw(30) << aName
+        << std::right << std::fixed << std::setprecision(3)
+        << std::setw(10) << 1.0e9 * aSeconds / double(anElements) << " ns/element"
+        << "   (checksum " << std::setprecision(1) << aChecksum << ")" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    long numElements = 50000000;
+    if (argc > 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " [number of elements]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (argc == 2)
+    {
+        numElements = std::atol(argv[1]);
+        if (numElements <= 0)
+        {
+            std::cerr << "ERROR: number of elements must be positive" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    long numCalls = (numElements + long(BLOCK_SIZE) - 1) / long(BLOCK_SIZE);
+    numElements = numCalls * long(BLOCK_SIZE);
+
+    std::vector<int> years(BLOCK_SIZE);
+    std::vector<int> months(BLOCK_SIZE);
+    std::vector<int> days(BLOCK_SIZE);
+    std::vector<double> dayFractions(BLOCK_SIZE);
+    std::vector<double> julianDays(BLOCK_SIZE);
+    std::vector<double> decimalDays(BLOCK_SIZE);
+    std::vector<double> angles(BLOCK_SIZE);
+    std::vector<double> sines(BLOCK_SIZE);
+    std::vector<double> cosines(BLOCK_SIZE);
+    for (std::size_t i = 0; i < BLOCK_SIZE; ++i)
+    {
+        years[i] = int(1500 + i % 1000);
+        months[i] = int(1 + i % 12);
+        days[i] = int(1 + i % 28);
+        dayFractions[i] = 0.125 * double(i % 8);
+        julianDays[i] = 2305447.5 + 89.25 * double(i);
+        angles[i] = 0.0879 * double(i);
+    }
+
+    std::cout << "Detected CPU level: " << SPA::CPU_UTIL::detectCpuLevel()
+        << ", " << numElements << " elements per kernel" << std::endl;
+
+    const SPA::CpuLevel levels[] = {SPA::CpuLevel::Generic,
+                                    SPA::CpuLevel::SSE42,
+                                    SPA::CpuLevel::AVX2,
+                                    SPA::CpuLevel::AVX512};
+    for (SPA::CpuLevel level : levels)
+    {
+        const SPA::BatchKernels& kernels = SPA::CPU_UTIL::getBatchKernels(level);
+        if (kernels.level != level)
+        {
+            std::cout << level << ": not supported, skipped" << std::endl;
+            continue;
+        }
+        std::cout << level << ":" << std::endl;
+
+        // The checksums keep the compiler from discarding the calls.
+        SPA::GoodTimer timer;
+        double checksum = 0;
+        for (long i = 0; i < numCalls; ++i)
+        {
+            kernels.convertToJulianDays(years.data(), months.data(), days.data(),
+                                        dayFractions.data(), BLOCK_SIZE, julianDays.data());
+            checksum += julianDays[std::size_t(i) % BLOCK_SIZE];
+        }
+        report("convertToJulianDays", timer.elapsed(), numElements, checksum);
+
+        timer.reset();
+        checksum = 0;
+        for (long i = 0; i < numCalls; ++i)
+        {
+            kernels.convertFromJulianDays(julianDays.data(), BLOCK_SIZE,
+                                          years.data(), months.data(), decimalDays.data());
+            checksum += decimalDays[std::size_t(i) % BLOCK_SIZE];
+        }
+        report("convertFromJulianDays", timer.elapsed(), numElements, checksum);
+
+        timer.reset();
+        checksum = 0;
+        for (long i = 0; i < numCalls; ++i)
+        {
+            kernels.calculateSinCos(angles.data(), BLOCK_SIZE, sines.data(), cosines.data());
+            checksum += sines[std::size_t(i) % BLOCK_SIZE];
+        }
+        report("calculateSinCos", timer.elapsed(), numElements, checksum);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file spa_build_ephemeris.cc
+ * @brief Command line tool that writes a Chebyshev ephemeris file
+ *   covering the Sun and planets for a range of years
+ * @ingroup group_examples
+ *
+ * Usage: spa_build_ephemeris <output file> <first year> <last year>
+ *
+ * The file can be opened, and memory-mapped, with
+ * SPA::ChebyshevEphemeris.
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "ChebyshevEphemerisBuilder.h"
+#include "JulianDate.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    if (argc != 4)
+    {
+        std::cerr << "Usage: " << argv[0] << " <output file> <first year> <last year>" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string fileName(argv[1]);
+    int firstYear = std::atoi(argv[2]);
+    int lastYear = std::atoi(argv[3]);
+    if (lastYear < firstYear)
+    {
+        std::cerr << "ERROR: last year " << lastYear
+            << " is before first year " << firstYear << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    SPA::JulianDate start(firstYear, 1, 1, 0, 0, 0);
+    SPA::JulianDate end(lastYear + 1, 1, 1, 0, 0, 0);
+    SPA::ChebyshevEphemerisBuilder builder(start.getDecimalDays(), end.getDecimalDays());
+    builder.addSun();
+    for (int planet = SPA::MERCURY; planet < SPA::SPA_NUM_PLANETS; planet++)
+    {
+        if (planet != SPA::EARTH)
+        {
+            builder.addPlanet(static_cast<SPA::Planets>(planet));
+        }
+    }
+
+    if (!builder.write(fileName))
+    {
+        std::cerr << "ERROR: failed to write " << fileName << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Wrote ephemeris for " << firstYear << " to " << lastYear
+        << " to " << fileName << std::endl;
+    return EXIT_SUCCESS;
+}
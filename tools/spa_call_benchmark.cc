@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2026 David Strickland, <dave.strickland@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file spa_call_benchmark.cc
+ * @brief Command line tool that times calls to the small time
+ *   functions, to compare the shared, static, amalgamated and LTO builds
+ * @ingroup group_examples
+ *
+ * Usage: spa_call_benchmark [number of calls]
+ *
+ * The functions defined inline in the headers should cost the same in
+ * every build. The out-of-line functions pay for a call through the
+ * PLT when linked against the shared library, and can only be inlined
+ * into this program when it is built with SPA_ENABLE_LTO against the
+ * static library. The "local copy" row is the same arithmetic as
+ * calculateDecimalHours written here, as the inlined reference.
+ *
+ * @author Dave Strickland, <dave.strickland@gmail.com>
+ *
+ * @version Oct 18, 2026 dks : Initial coding
+ */
+
+#include "GoodTimer.h"
+#include "JulianDate.h"
+#include "SpaTimeConstants.h"
+#include "TimeUtilities.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifndef SPA_BENCHMARK_VARIANT
+#define SPA_BENCHMARK_VARIANT "unknown"
+#endif
+
+namespace
+{
+
+/// Prints one row of the results table.
+void report(const std::string& aName, double aSeconds, long aCalls, double aChecksum)
+{
+    std::cout << std::left << std::setw(36) << aName
+        << std::right << std::fixed << std::setprecision(3)
+        << std::setw(10) << 1.0e9 * aSeconds / double(aCalls) << " ns/call"
+        << "   (checksum " << std::setprecision(1) << aChecksum << ")" << std::endl;
+}
+
+inline double localDecimalHours(int anHour, int aMinute, double aSeconds)
+{
+    return double(anHour) +
+           double(aMinute)/double(SPA::SPA_MINUTES_IN_HOUR) +
+           double(aSeconds)/double(SPA::SPA_SECONDS_IN_HOUR);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    long numCalls = 20000000;
+    if (argc > 2)
+    {
+        std::cerr << "Usage: " << argv[0] << " [number of calls]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    if (argc == 2)
+    {
+        numCalls = std::atol(argv[1]);
+        if (numCalls <= 0)
+        {
+            std::cerr << "ERROR: number of calls must be positive" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << "libspa build variant: " << SPA_BENCHMARK_VARIANT
+        << ", " << numCalls << " calls per function" << std::endl;
+
+    // The checksums keep the compiler from discarding the loops.
+    SPA::GoodTimer timer;
+    double checksum = 0;
+    for (long i = 0; i < numCalls; ++i)
+    {
+        checksum += SPA::TIME_UTIL::isLeapYear(int(i & 4095)) ? 1 : 0;
+    }
+    report("isLeapYear (inline)", timer.elapsed(), numCalls, checksum);
+
+    timer.reset();
+    checksum = 0;
+    for (long i = 0; i < numCalls; ++i)
+    {
+        double integerPart = 0;
+        double fraction = 0;
+        SPA::TIME_UTIL::integerAndFraction(0.25 * double(i & 1023), integerPart, fraction);
+        checksum += integerPart + fraction;
+    }
+    report("integerAndFraction (inline)", timer.elapsed(), numCalls, checksum);
+
+    std::vector<SPA::JulianDate> dates;
+    for (int i = 0; i < 1024; ++i)
+    {
+        dates.push_back(SPA::JulianDate(2461331.5 + 0.25 * i));
+    }
+    timer.reset();
+    checksum = 0;
+    for (long i = 0; i < numCalls; ++i)
+    {
+        checksum += dates[i & 1023].getModifiedJulianDate();
+    }
+    report("getModifiedJulianDate (inline)", timer.elapsed(), numCalls, checksum);
+
+    timer.reset();
+    checksum = 0;
+    for (long i = 0; i < numCalls; ++i)
+    {
+        checksum += SPA::TIME_UTIL::calculateDayNumber(int(2000 + (i & 63)),
+                                                       int(1 + (i % 12)),
+                                                       int(1 + (i & 15)));
+    }
+    report("calculateDayNumber", timer.elapsed(), numCalls, checksum);
+
+    timer.reset();
+    checksum = 0;
+    for (long i = 0; i < numCalls; ++i)
+    {
+        checksum += SPA::TIME_UTIL::calculateDecimalHours(int(i % 24), int(i % 60), 0.5);
+    }
+    report("calculateDecimalHours", timer.elapsed(), numCalls, checksum);
+
+    timer.reset();
+    checksum = 0;
+    for (long i = 0; i < numCalls; ++i)
+    {
+        checksum += localDecimalHours(int(i % 24), int(i % 60), 0.5);
+    }
+    report("calculateDecimalHours (local copy)", timer.elapsed(), numCalls, checksum);
+
+    return EXIT_SUCCESS;
+}